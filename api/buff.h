@@ -240,6 +240,14 @@ extern "C"
 #define BUFF_DEBUG_RING(buf)
 #endif
 
+#ifndef BUFF_DEBUG_ASSERT
+/**
+ * @brief Macro called with condition which is always true if library is used properly (for example tree is not deeper than
+ * BUFF_TREE_MAX_DEPTH). Normally used as empty macro. Can be redefined (for example to assert) to debug library usage.
+ */
+#define BUFF_DEBUG_ASSERT(condition)
+#endif
+
 
 /* ----------------------------------------- LIBRARY FEATURES ENABLING/DISABLING ----------------------------------------------- */
 
@@ -451,6 +459,28 @@ extern "C"
 #define BUFF_USE_TREE_BUFFERS                BUFF_DEFAULT_FEATURES_STATE
 #endif
 
+#ifndef BUFF_USE_IOVEC
+/**
+ * @brief Definition used to enable / disable conversion of readable vectors and trees to tables of struct iovec (POSIX only).
+ * If defined to BUFF_FEATURE_ENABLED then functions Buff_Vector_To_Iovec and Buff_Tree_To_Iovec are available.
+ * They describe data of vector / tree (without copying) as table which can be passed directly to writev / sendmsg.
+ */
+#define BUFF_USE_IOVEC                       BUFF_FEATURE_DISABLED
+#endif
+
+#ifndef BUFF_TREE_MAX_DEPTH
+/**
+ * @brief Maximal depth of tree which can be walked by tree functions. Trees are walked without recursion - stack of branches
+ * is kept inside tree cursor structure (Buff_Readable_Tree_Cursor_XT), also on stack of each tree function, so this value
+ * defines stack usage of tree functions: one level takes 3 words, so with default depth 16 one cursor takes about 400 B
+ * on 64-bit platform; each tree function keeps one cursor on its stack and Buff_Copy_Tree_To_Tree keeps two.
+ * Root of the tree is on depth 1. When branch nested deeper is reached, tree functions fail: size and copy functions
+ * return 0 (and set str_size to 0) although part of data may have been already copied, flattening functions return BUFF_FALSE
+ * and tree cursor gets is_too_deep field set to BUFF_TRUE. BUFF_DEBUG_ASSERT fails as well.
+ */
+#define BUFF_TREE_MAX_DEPTH                  16
+#endif
+
 #ifndef BUFF_USE_RING_BUFFERS
 /**
  * @brief Definition to enable / disable support for ring buffers. If defined to BUFF_FEATURE_ENABLED then all function used to copy
@@ -469,15 +499,159 @@ extern "C"
 #define BUFF_USE_RING_BUFFERS                BUFF_DEFAULT_FEATURES_STATE
 #endif
 
+#ifndef BUFF_RING_USE_LOCK_FREE_SPSC
+/**
+ * @brief Definition used to enable / disable lock-free single-producer / single-consumer mode of ring buffers.
+ * If defined to BUFF_FEATURE_ENABLED then ring buffer doesn't store busy_size - it is calculated from indexes first_free and first_busy.
+ * Index first_free is modified only by producer and index first_busy only by consumer. Each of them is published
+ * by BUFF_ATOMIC_STORE_RELEASE after data has been copied and read by opposite side by BUFF_ATOMIC_LOAD_ACQUIRE,
+ * so one thread can write to the buffer and another one can read from it in same time without protection (use_protection == BUFF_FALSE).
+ * In this mode:
+ * - one byte of buffer memory is always left unused to distinguish full buffer from empty one,
+ *   so buffer initialized with "size" bytes of memory can store maximum size - 1 bytes;
+ * - Buff_Ring_Write*, Buff_Ring_Data_Check_Out, Buff_Ring_Data_Check_In and Buff_Ring_To_Ring_Copy (for destination buffer)
+ *   can be called only by producer;
+ * - Buff_Ring_Read*, Buff_Ring_Peak*, Buff_Ring_OverWrite_If_Exist*, Buff_Ring_Remove and Buff_Ring_Clear
+ *   can be called only by consumer;
+ * - Buff_Ring_Data_Check_Out doesn't de-fragment free space - it returns pointer only if there is enough continous free space
+ *   just after busy area;
+ * - BUFF_RING_ALLOW_OLD_DATA_OVERWRITE must be disabled (this is default in this mode) because producer would have to remove data
+ *   which belongs to consumer.
+ */
+#define BUFF_RING_USE_LOCK_FREE_SPSC         BUFF_FEATURE_DISABLED
+#endif
+
+#ifndef BUFF_RING_USE_MULTI_PRODUCER
+/**
+ * @brief Definition used to enable / disable multi-producer space reservation in ring buffers.
+ * Can be used only together with BUFF_RING_USE_LOCK_FREE_SPSC - consumer side stays the same (Buff_Ring_Read*, Buff_Ring_Peak*,
+ * Buff_Ring_Remove, Buff_Ring_Clear) but data can be written by many threads in same time by functions Buff_Ring_Reserve
+ * and Buff_Ring_Commit. Each producer reserves space atomically (index first_reserved is moved by BUFF_ATOMIC_COMPARE_EXCHANGE),
+ * copies its data to reserved area without any lock and next commits it. Commits are published to consumer in reservation order -
+ * Buff_Ring_Commit waits until all previous reservations are committed.
+ * When enabled, producers must not use Buff_Ring_Write*, Buff_Ring_Data_Check_Out / Check_In and Buff_Ring_To_Ring_Copy (as destination).
+ */
+#define BUFF_RING_USE_MULTI_PRODUCER         BUFF_FEATURE_DISABLED
+#endif
+
+#ifndef BUFF_RING_USE_POWER_OF_2_SIZE
+/**
+ * @brief Definition used to enable / disable power-of-2 sizes of ring buffers.
+ * If defined to BUFF_FEATURE_ENABLED then Buff_Ring_Init accepts only sizes which are power of 2 and indexes are wrapped
+ * by masking (index & (size - 1)) instead of comparing with size / modulo operation (which is especially visible in
+ * lock-free SPSC mode where busy size is calculated from indexes on each operation).
+ * Buffer is never resized by Buff_Ring_Data_Check_Out (its size must stay power of 2) - only continous free space can be checked out.
+ */
+#define BUFF_RING_USE_POWER_OF_2_SIZE        BUFF_FEATURE_DISABLED
+#endif
+
+#ifndef BUFF_RING_USE_MIRRORED_MEMORY
+/**
+ * @brief Definition used to enable / disable support for mirrored ring buffers (Linux only).
+ * If defined to BUFF_FEATURE_ENABLED then function Buff_Ring_Init_Mirrored is available. It allocates buffer memory
+ * as memfd file mapped twice, one mapping just after another, so byte "size + n" is the same as byte "n".
+ * Thanks to that any part of the buffer (up to "size" bytes, starting from any position) is continous in memory:
+ * Buff_Ring_Write, Buff_Ring_Read and Buff_Ring_Peak always use single memcpy, and check-out functions never have
+ * to resize the buffer. Buffers initialized by Buff_Ring_Init work as before.
+ */
+#define BUFF_RING_USE_MIRRORED_MEMORY        BUFF_FEATURE_DISABLED
+#endif
+
+#ifndef BUFF_RING_USE_NON_TEMPORAL_COPY
+/**
+ * @brief Definition used to enable / disable non-temporal (cache bypassing) copying to ring buffers.
+ * If defined to BUFF_FEATURE_ENABLED then non-temporal copying can be switched on for chosen buffers by
+ * Buff_Ring_Set_Non_Temporal_Copy. For such buffers Buff_Ring_Write and Buff_Ring_To_Ring_Copy (destination buffer)
+ * store data bypassing CPU cache (movntdq on x86) if amount of written data is not less than BUFF_NON_TEMPORAL_COPY_THRESHOLD,
+ * and execute BUFF_NON_TEMPORAL_FENCE before new data is made visible to the reader.
+ * Useful for big buffers (bigger than last level cache) which data is read much later, so it would only pollute the cache.
+ */
+#define BUFF_RING_USE_NON_TEMPORAL_COPY      BUFF_FEATURE_DISABLED
+#endif
+
+#ifndef BUFF_RING_USE_AUTO_GROW
+/**
+ * @brief Definition used to enable / disable automatic growing of ring buffers.
+ * If defined to BUFF_FEATURE_ENABLED then function Buff_Ring_Set_Auto_Grow is available. For buffers for which it has been
+ * called, write functions (Buff_Ring_Write*, Buff_Ring_To_Ring_Copy for destination buffer) which find not enough free space
+ * allocate bigger memory by user allocator, move busy data to it (as Buff_Ring_Resize) and release old memory -
+ * before oldest data would be overwritten or write would be shortened.
+ * Must not be enabled together with BUFF_RING_USE_LOCK_FREE_SPSC - memory can't be exchanged while consumer works in parallel.
+ */
+#define BUFF_RING_USE_AUTO_GROW              BUFF_FEATURE_DISABLED
+#endif
+
+#ifndef BUFF_RING_USE_FD_IO
+/**
+ * @brief Definition used to enable / disable file descriptor I/O of ring buffers (POSIX only).
+ * If defined to BUFF_FEATURE_ENABLED then functions Buff_Ring_Write_From_Fd and Buff_Ring_Read_To_Fd are available.
+ * They transfer data directly between file descriptor (socket, pipe, file) and buffer memory by single readv / writev call
+ * for both parts of wrapped free / busy area - without intermediate linear buffer.
+ */
+#define BUFF_RING_USE_FD_IO                  BUFF_FEATURE_DISABLED
+#endif
+
+#ifndef BUFF_RING_USE_IO_URING
+/**
+ * @brief Definition used to enable / disable feeding of ring buffers by io_uring (Linux only, kernel 5.6 or newer).
+ * If defined to BUFF_FEATURE_ENABLED then functions Buff_Ring_Uring_* are available. They keep read requests posted directly
+ * to free space of many ring buffers and check-in completed reads (calling write extensions), so data of many file descriptors
+ * (sockets, pipes) is received with batched submission and completion - by one system call for all buffers.
+ */
+#define BUFF_RING_USE_IO_URING               BUFF_FEATURE_DISABLED
+#endif
+
+#ifndef BUFF_RING_USE_SPLICE
+/**
+ * @brief Definition used to enable / disable zero-copy transfer between ring buffers and pipes by vmsplice (Linux only).
+ * If defined to BUFF_FEATURE_ENABLED then functions Buff_Ring_Splice_Out, Buff_Ring_Splice_Release and Buff_Ring_Splice_In
+ * are available. Busy area given to the pipe by Buff_Ring_Splice_Out is referenced by the kernel (not copied),
+ * so it is removed from the buffer only by Buff_Ring_Splice_Release, after pipe has been drained.
+ */
+#define BUFF_RING_USE_SPLICE                 BUFF_FEATURE_DISABLED
+#endif
+
+#ifndef BUFF_RING_USE_FILE
+/**
+ * @brief Definition used to enable / disable ring buffers placed in memory mapped files (POSIX only).
+ * If defined to BUFF_FEATURE_ENABLED then functions Buff_Ring_Init_File, Buff_Ring_Recover and related are available.
+ * Data and indexes of such buffer are stored in the file, so its content survives crash of the process
+ * and can be reattached by Buff_Ring_Recover. Indexes are published to the file by protected extension of the buffer,
+ * so BUFF_RING_USE_PROTECTED_EXTENSIONS must be enabled and BUFF_RING_USE_LOCK_FREE_SPSC disabled.
+ */
+#define BUFF_RING_USE_FILE                   BUFF_FEATURE_DISABLED
+#endif
+
 #ifndef BUFF_RING_ALLOW_OLD_DATA_OVERWRITE
 /**
  * @brief Definition to enable / disable possibility to overwrite oldest data in ring buffer by write functions.
  * If this definition is set to BUFF_FEATURE_ENABLED then parameter "overwrite_if_no_free_space" of write functions determines
  * if oldest data shall be overwritten in case if there is not enough space in ring buffer. If defined to BUFF_FEATURE_DISABLED
  * then oldest data is NEVER overwritten and parameter "overwrite_if_no_free_space" of write functions is not used.
+ * Must not be enabled together with BUFF_RING_USE_LOCK_FREE_SPSC.
  */
+#if(BUFF_RING_USE_LOCK_FREE_SPSC)
+#define BUFF_RING_ALLOW_OLD_DATA_OVERWRITE   BUFF_FEATURE_DISABLED
+#else
 #define BUFF_RING_ALLOW_OLD_DATA_OVERWRITE   BUFF_DEFAULT_FEATURES_STATE
 #endif
+#endif
+
+#if(BUFF_RING_USE_MULTI_PRODUCER && (!BUFF_RING_USE_LOCK_FREE_SPSC))
+#error "BUFF_RING_USE_MULTI_PRODUCER can be enabled only together with BUFF_RING_USE_LOCK_FREE_SPSC"
+#endif
+
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+#error "BUFF_RING_ALLOW_OLD_DATA_OVERWRITE can't be enabled together with BUFF_RING_USE_LOCK_FREE_SPSC"
+#endif
+
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_AUTO_GROW)
+#error "BUFF_RING_USE_AUTO_GROW can't be enabled together with BUFF_RING_USE_LOCK_FREE_SPSC"
+#endif
+
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_FILE)
+#error "BUFF_RING_USE_FILE can't be enabled together with BUFF_RING_USE_LOCK_FREE_SPSC"
+#endif
 
 #ifndef BUFF_RING_USE_EXTENSIONS
 /**
@@ -522,6 +696,126 @@ extern "C"
 #define BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED        BUFF_DEFAULT_FEATURES_STATE
 #endif
 
+#ifndef BUFF_USE_BIP_BUFFERS
+/**
+ * @brief Definition to enable / disable support for bip-buffers (bipartite buffers, Buff_Bip_XT). Requires BUFF_USE_RING_BUFFERS.
+ * Bip-buffer always gives contiguous memory areas - both for writing (Buff_Bip_Reserve / Buff_Bip_Commit) and for reading
+ * (Buff_Bip_Read / Buff_Bip_Decommit). If there is not enough space at the end of memory, data is written in second region
+ * started from the begining of memory instead of being wrapped, and reading switches to that region when first one is read.
+ * Thanks to that data is never divided and never moved (in opposite to Buff_Ring_Data_Check_Out / Check_In),
+ * so areas can be given directly to DMA. Cost of that is free space at the end of memory which can't be used
+ * until reading switches to second region.
+ * Bip-buffer uses protection mechanism and extensions of ring buffers - they are stored in Buff_Ring_XT contained in Buff_Bip_XT.
+ */
+#define BUFF_USE_BIP_BUFFERS                 BUFF_DEFAULT_FEATURES_STATE
+#endif
+
+#ifndef BUFF_USE_POOL_BUFFERS
+/**
+ * @brief Definition to enable / disable support for slot pools (Buff_Pool_XT). Requires BUFF_USE_RING_BUFFERS.
+ * Slot pool is FIFO queue of fixed-size elements (slots) - slot size and number of slots are fixed on initialization.
+ * Slots are never divided by the end of memory, so each slot is written / read by single copy of known size
+ * or can be filled / used directly through pointer (Buff_Pool_Acquire / Buff_Pool_Commit, Buff_Pool_Peak / Buff_Pool_Release),
+ * without any wrap splitting and byte-size arithmetic of ring buffers.
+ * Slot pool uses protection mechanism and extensions of ring buffers - they are stored in Buff_Ring_XT contained in Buff_Pool_XT.
+ */
+#define BUFF_USE_POOL_BUFFERS                BUFF_DEFAULT_FEATURES_STATE
+#endif
+
+#ifndef BUFF_USE_CHAIN_BUFFERS
+/**
+ * @brief Definition to enable / disable support for chunk chains (Buff_Chain_XT).
+ * Chunk chain is FIFO queue of bytes stored in linked list of fixed-size chunks. Chunks are taken from free list when data
+ * is written and returned to it when data is read, so memory is used only by data which is really stored and capacity
+ * can be extended in run-time by Buff_Chain_Add_Chunks (without moving stored data) instead of being fixed on initialization.
+ * Data stored in the chain can be given to any function which takes vector / tree of linear buffers
+ * (Buff_Chain_To_Vector, Buff_Chain_To_Tree) without copying it.
+ * Chunk chain doesn't use protection mechanism - if it is used by many threads, access to it must be synchronized by the user.
+ */
+#define BUFF_USE_CHAIN_BUFFERS               BUFF_DEFAULT_FEATURES_STATE
+#endif
+
+
+/**
+ * ----------------------------------------- MEMORY COPYING --------------------------------------------------------------------
+ *
+ * This section contains definitions used to select function which is used by the library for all copying of linear
+ * memory areas (vector, tree and ring buffers copying, also internal vendor memcpy used when BUFF_SAVE_PROGRAM_MEMORY is enabled).
+ */
+
+
+#ifndef BUFF_USE_OPTIMIZED_MEMCPY
+/**
+ * If defined to BUFF_FEATURE_ENABLED then function Buff_Memcpy will be enabled (exist) and will be used as default
+ * BUFF_MEMCPY backend. Buff_Memcpy copies small areas (up to 16 bytes) inline by fixed-size overlapping moves - which avoids
+ * call overhead of standard memcpy for many small vector / tree elements - and bigger areas by standard memcpy
+ * (or by AVX2 / SSE2 loop when BUFF_OPTIMIZED_MEMCPY_USE_SIMD is enabled). Gain depends on platform memcpy -
+ * "make benchmark" in test directory compares both (memcpy_benchmark), so it should be checked on target platform
+ * before the feature is enabled.
+ */
+#define BUFF_USE_OPTIMIZED_MEMCPY            BUFF_FEATURE_DISABLED
+#endif
+
+#ifndef BUFF_OPTIMIZED_MEMCPY_USE_SIMD
+/**
+ * If defined to BUFF_FEATURE_ENABLED (and BUFF_USE_OPTIMIZED_MEMCPY is enabled) then Buff_Memcpy copies areas bigger than
+ * 16 bytes by AVX2 / SSE2 loop instead of standard memcpy. Instruction set is chosen only once, during first call,
+ * basing on CPUID; on platforms different than x86 / x86-64 standard memcpy is used anyway. Disabled by default -
+ * memcpy of glibc is faster for areas bigger than about 64 bytes, so it is useful only with simple platform memcpy.
+ */
+#define BUFF_OPTIMIZED_MEMCPY_USE_SIMD       BUFF_FEATURE_DISABLED
+#endif
+
+#ifndef BUFF_MEMCPY
+#if(BUFF_USE_OPTIMIZED_MEMCPY)
+/**
+ * @brief Macro used by the library to copy memory areas which don't overlap.
+ * Can be redefined to any function which has same parameters as standard memcpy.
+ *
+ * @param dest pointer to destination memory
+ * @param src pointer to source memory
+ * @param size number of bytes to be copied
+ */
+#define BUFF_MEMCPY(dest, src, size)         Buff_Memcpy((dest), (src), (size))
+#else
+#define BUFF_MEMCPY(dest, src, size)         memcpy((dest), (src), (size))
+#endif
+#endif
+
+#ifndef BUFF_NON_TEMPORAL_COPY_THRESHOLD
+/**
+ * @brief Minimal size of data (in bytes) written by single operation to ring buffer with non-temporal copying switched on,
+ * for which non-temporal copying is used. Smaller amounts of data are copied by BUFF_MEMCPY.
+ * Used only when BUFF_RING_USE_NON_TEMPORAL_COPY is enabled.
+ */
+#define BUFF_NON_TEMPORAL_COPY_THRESHOLD     16384
+#endif
+
+#ifndef BUFF_NON_TEMPORAL_FENCE
+/**
+ * @brief Macro used to finish all non-temporal stores before ring buffer indexes are updated
+ * (non-temporal stores are weakly ordered). Used only when BUFF_RING_USE_NON_TEMPORAL_COPY is enabled.
+ */
+#if(defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)))
+#define BUFF_NON_TEMPORAL_FENCE()            __builtin_ia32_sfence()
+#else
+#define BUFF_NON_TEMPORAL_FENCE()            __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+#endif
+
+#ifndef BUFF_USE_CHECKSUM
+/**
+ * If defined to BUFF_FEATURE_ENABLED then checksum functions (Buff_Checksum_Init, Buff_Checksum_Update, Buff_Checksum_Get and
+ * Buff_Memcpy_Checksum) will be enabled (exist) together with checksum-accumulating variants of copy functions
+ * (Buff_Copy_From_Vector_Checksum, Buff_Copy_From_Tree_Checksum, Buff_Ring_Read_Checksum, ...). These variants calculate checksum
+ * of copied data during copying, so data doesn't have to be read second time to calculate its checksum.
+ * Checksum-accumulating copy functions are built on top of vendor buffers support, so they need also BUFF_USE_VENDOR_BUFFERS.
+ * Supported checksums: CRC-32C (by SSE4.2 crc32 instruction on x86-64 processors which support it), CRC-16/CCITT-FALSE,
+ * Adler-32 and 16-bit ones-complement sum (Internet checksum, RFC 1071).
+ */
+#define BUFF_USE_CHECKSUM                    BUFF_FEATURE_DISABLED
+#endif
+
 
 /**
  * ----------------------------------------- MULTI-THREAD / MULTI-CONTEXT OPERATIONS PROTECTION --------------------------------
@@ -594,6 +888,71 @@ extern "C"
 #endif
 
 
+/**
+ * ----------------------------------------- LOCK-FREE OPERATIONS SUPPORT ------------------------------------------------------
+ *
+ * This section contains macroes used to access ring buffer indexes shared between producer and consumer
+ * when BUFF_RING_USE_LOCK_FREE_SPSC is enabled. By default GCC / Clang __atomic builtins are used;
+ * for other compilers these macroes must be redefined (for example to C11 atomic_load_explicit / atomic_store_explicit).
+ */
+
+
+#ifndef BUFF_ATOMIC_LOAD_ACQUIRE
+/**
+ * @brief Macro used to read variable with acquire semantic - no memory access which is after this macro
+ * can be executed before it.
+ *
+ * @result value of the variable
+ *
+ * @param ptr pointer to variable to be read
+ */
+#define BUFF_ATOMIC_LOAD_ACQUIRE(ptr)           __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#endif
+
+#ifndef BUFF_ATOMIC_STORE_RELEASE
+/**
+ * @brief Macro used to write variable with release semantic - all memory accesses which are before this macro
+ * are finished before new value of the variable is visible for other threads.
+ *
+ * @param ptr pointer to variable to be written
+ * @param value new value of the variable
+ */
+#define BUFF_ATOMIC_STORE_RELEASE(ptr, value)   __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#endif
+
+#ifndef BUFF_ATOMIC_COMPARE_EXCHANGE
+/**
+ * @brief Macro used to atomically replace value of variable if it is equal to expected one (acquire-release semantic).
+ * Used only when BUFF_RING_USE_MULTI_PRODUCER is enabled.
+ *
+ * @result true if variable has been replaced, false otherwise - then current value of variable is stored under "expected"
+ *
+ * @param ptr pointer to variable to be modified
+ * @param expected pointer to expected value of the variable
+ * @param desired new value of the variable
+ */
+#define BUFF_ATOMIC_COMPARE_EXCHANGE(ptr, expected, desired) \
+   __atomic_compare_exchange_n((ptr), (expected), (desired), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#endif
+
+#ifndef BUFF_ATOMIC_CPU_RELAX
+/**
+ * @brief Macro executed in each iteration of busy-waiting loop (Buff_Ring_Commit waiting for previous reservations).
+ * By default it is spin-wait hint for the CPU ("pause" on x86, "yield" on ARM) which lowers power consumption of the loop
+ * and gives execution resources to other hardware thread of the core. If there can be more producers than CPU cores
+ * (producer can be preempted before it commits its reservation), it should be redefined to yield of the thread,
+ * for example to sched_yield().
+ */
+#if(defined(__i386__) || defined(__x86_64__))
+#define BUFF_ATOMIC_CPU_RELAX()                 __builtin_ia32_pause()
+#elif(defined(__aarch64__) || (defined(__arm__) && (__ARM_ARCH >= 7)))
+#define BUFF_ATOMIC_CPU_RELAX()                 __asm__ __volatile__("yield" ::: "memory")
+#else
+#define BUFF_ATOMIC_CPU_RELAX()
+#endif
+#endif
+
+
 
 /**
  * -----------------------------------------------------------------------------------------------------------------------------
@@ -669,6 +1028,34 @@ typedef struct Buff_Memcpy_Params_eXtended_Tag
 typedef Buff_Size_DT (*Buff_Vendor_Memcpy_HT) (const Buff_Memcpy_Params_XT *params);
 #endif
 
+#if(BUFF_USE_CHECKSUM)
+/**
+ * @brief Kinds of checksum which can be calculated by Buff_Checksum_XT
+ */
+/* CRC-32C (Castagnoli) - reflected polynomial 0x82F63B78, initial value and final XOR 0xFFFFFFFF */
+#define BUFF_CHECKSUM_CRC32C                 0
+/* CRC-16/CCITT-FALSE - polynomial 0x1021, initial value 0xFFFF, no final XOR */
+#define BUFF_CHECKSUM_CRC16                  1
+/* Adler-32 (RFC 1950) */
+#define BUFF_CHECKSUM_ADLER32                2
+/* 16-bit ones-complement sum of big-endian words (Internet checksum, RFC 1071) */
+#define BUFF_CHECKSUM_ONES_COMPLEMENT        3
+
+/**
+ * @brief Structure of running checksum. Checksum is accumulated by consecutive calls of Buff_Checksum_Update,
+ * Buff_Memcpy_Checksum and checksum-accumulating copy functions - data can be provided in parts of any size.
+ */
+typedef struct Buff_Checksum_eXtended_Tag
+{
+   /* running (not finalized) checksum value */
+   uint32_t       value;
+   /* number of bytes accumulated so far */
+   Buff_Size_DT   length;
+   /* kind of checksum - one of BUFF_CHECKSUM_* */
+   uint8_t        type;
+}Buff_Checksum_XT;
+#endif
+
 
 
 #ifndef BUFF_WRITEABLE_VECTOR_XT_EXTERNAL
@@ -735,6 +1122,116 @@ typedef struct Buff_Readable_Tree_eXtended_Tag
 
 
 
+/**
+ * @brief Structure of flattened writeable tree - table of all non-empty linear parts of the tree (in order of data)
+ * with position of each part in tree data. Created by Buff_Writeable_Tree_Flatten. Element "tree" is single-element tree
+ * which points to "vector", so flattened tree can be provided to any function which takes tree ("&flat.tree, 1").
+ * Only Buff_Copy_To_Flat_Tree finds part pointed by offset by binary search (O(log n)) - functions which take tree
+ * walk parts of flattened tree from its begining, as parts of any other vector (O(n)).
+ */
+typedef struct Buff_Writeable_Flat_Tree_eXtended_Tag
+{
+   Buff_Writeable_Tree_XT           tree;
+   Buff_Writeable_Vector_XT        *vector;
+   Buff_Size_DT                    *offset;
+   Buff_Num_Elems_DT                vector_num_elems;
+   Buff_Size_DT                     size;
+}Buff_Writeable_Flat_Tree_XT;
+
+
+
+/**
+ * @brief Structure of flattened readable tree - table of all non-empty linear parts of the tree (in order of data)
+ * with position of each part in tree data. Created by Buff_Readable_Tree_Flatten. Element "tree" is single-element tree
+ * which points to "vector", so flattened tree can be provided to any function which takes tree ("&flat.tree, 1").
+ * Only Buff_Copy_From_Flat_Tree finds part pointed by offset by binary search (O(log n)) - functions which take tree
+ * walk parts of flattened tree from its begining, as parts of any other vector (O(n)).
+ */
+typedef struct Buff_Readable_Flat_Tree_eXtended_Tag
+{
+   Buff_Readable_Tree_XT            tree;
+   Buff_Readable_Vector_XT         *vector;
+   Buff_Size_DT                    *offset;
+   Buff_Num_Elems_DT                vector_num_elems;
+   Buff_Size_DT                     size;
+}Buff_Readable_Flat_Tree_XT;
+
+
+
+/**
+ * @brief Structure of readable vector cursor - position in vector of linear buffers from which next copy will start.
+ * Used to copy data from vector part by part without searching begining of each part from first element of the vector.
+ */
+typedef struct Buff_Readable_Vector_Cursor_eXtended_Tag
+{
+   const Buff_Readable_Vector_XT   *vector;
+   Buff_Num_Elems_DT                vector_num_elems;
+   Buff_Num_Elems_DT                elem;
+   Buff_Size_DT                     elem_offset;
+}Buff_Readable_Vector_Cursor_XT;
+
+
+
+/**
+ * @brief Structure of readable tree cursor - position in tree of linear buffers from which next copy will start:
+ * stack of branches (with index of next element of each branch) leading to currently copied vector
+ * and cursor of this vector.
+ */
+typedef struct Buff_Readable_Tree_Cursor_eXtended_Tag
+{
+   struct
+   {
+      const Buff_Readable_Tree_XT  *branch;
+      Buff_Num_Elems_DT             branch_num_elems;
+      Buff_Num_Elems_DT             elem;
+   }stack[BUFF_TREE_MAX_DEPTH];
+   Buff_Readable_Vector_Cursor_XT   vector;
+   Buff_Num_Elems_DT                depth;
+   Buff_Bool_DT                     is_too_deep;
+}Buff_Readable_Tree_Cursor_XT;
+
+#if(BUFF_USE_IOVEC)
+struct iovec;
+#endif
+
+
+
+#ifndef BUFF_RING_USE_PADDED_LAYOUT
+/**
+ * @brief Definition used to enable / disable cache-line padded layout of Buff_Ring_XT.
+ * Has effect only if BUFF_RING_USE_LOCK_FREE_SPSC is enabled. If defined to BUFF_FEATURE_ENABLED then producer-owned
+ * and consumer-owned indexes are placed on separate cache lines (of size BUFF_CACHE_LINE_SIZE), so producer and consumer
+ * working on different cores don't invalidate each others cache line on every operation. Additionally each side keeps
+ * local copy of index of opposite side and reads the shared one only if local copy shows not enough free / busy space.
+ * Size of Buff_Ring_XT grows by 3 * BUFF_CACHE_LINE_SIZE bytes.
+ */
+#define BUFF_RING_USE_PADDED_LAYOUT          BUFF_FEATURE_DISABLED
+#endif
+
+#ifndef BUFF_CACHE_LINE_SIZE
+/**
+ * @brief Size of CPU cache line in bytes, used when BUFF_RING_USE_PADDED_LAYOUT is enabled.
+ */
+#define BUFF_CACHE_LINE_SIZE                 64
+#endif
+
+struct Buff_Ring_eXtended_Tag;
+
+#ifndef BUFF_RING_MEMORY_ALLOC_HT_EXTERNAL
+/**
+ * @brief Type of function used by automatic growing of ring buffer to allocate new memory.
+ * Returns pointer to memory of "size" bytes or invalid pointer if memory can't be allocated.
+ */
+typedef void *(*Buff_Ring_Memory_Alloc_HT)(struct Buff_Ring_eXtended_Tag *buf, Buff_Size_DT size);
+#endif
+
+#ifndef BUFF_RING_MEMORY_FREE_HT_EXTERNAL
+/**
+ * @brief Type of function used by automatic growing of ring buffer to release memory previously allocated by Buff_Ring_Memory_Alloc_HT.
+ */
+typedef void (*Buff_Ring_Memory_Free_HT)(struct Buff_Ring_eXtended_Tag *buf, void *memory, Buff_Size_DT size);
+#endif
+
 #ifndef BUFF_RING_XT_EXTERNAL
 /**
  * @brief Structure which describes ring buffer
@@ -755,12 +1252,52 @@ typedef struct Buff_Ring_eXtended_Tag
    Buff_Size_DT original_size;
 #endif
    Buff_Size_DT size;
+#if(BUFF_RING_USE_MIRRORED_MEMORY)
+   Buff_Bool_DT is_mirrored;
+#endif
+#if(BUFF_RING_USE_FILE)
+   Buff_Bool_DT is_file_backed;
+#endif
+#if(BUFF_RING_USE_NON_TEMPORAL_COPY)
+   Buff_Bool_DT use_non_temporal_copy;
+#endif
+#if(BUFF_RING_USE_SPLICE)
+   Buff_Size_DT spliced_size;
+#endif
+#if(BUFF_RING_USE_IO_URING && (!BUFF_RING_USE_LOCK_FREE_SPSC))
+   Buff_Bool_DT is_read_posted;
+#endif
+#if(BUFF_RING_USE_AUTO_GROW)
+   Buff_Ring_Memory_Alloc_HT memory_alloc;
+   Buff_Ring_Memory_Free_HT  memory_free;
+   Buff_Size_DT max_size;
+   Buff_Size_DT growth_factor;
+   Buff_Bool_DT is_memory_allocated;
+#endif
+#if(!BUFF_RING_USE_LOCK_FREE_SPSC)
    Buff_Size_DT busy_size;
+#endif
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_PADDED_LAYOUT)
+   /* producer-owned part */
+   uint8_t      producer_padding[BUFF_CACHE_LINE_SIZE];
+#endif
 #if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
    Buff_Size_DT max_busy_size;
 #endif
    Buff_Size_DT first_free;
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_MULTI_PRODUCER)
+   Buff_Size_DT first_reserved;
+#endif
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_PADDED_LAYOUT)
+   Buff_Size_DT cached_first_busy;
+   /* consumer-owned part */
+   uint8_t      consumer_padding[BUFF_CACHE_LINE_SIZE];
+#endif
    Buff_Size_DT first_busy;
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_PADDED_LAYOUT)
+   Buff_Size_DT cached_first_free;
+   uint8_t      end_padding[BUFF_CACHE_LINE_SIZE];
+#endif
 }Buff_Ring_XT;
 #endif
 
@@ -806,56 +1343,303 @@ typedef struct Buff_Ring_Extensions_eXtended_Tag
 }Buff_Ring_Extensions_XT;
 #endif
 
+#ifndef BUFF_BIP_XT_EXTERNAL
 /**
- * -----------------------------------------------------------------------------------------------------------------------------
- * ----------------------------------------- END OF LIBRARY TYPES --------------------------------------------------------------
- * -----------------------------------------------------------------------------------------------------------------------------
+ * @brief Structure which describes bip-buffer.
+ * Data is stored in region A (from region_a_start to region_a_end) and, when there was not enough space after region A,
+ * in region B (from the begining of memory to region_b_end). Region B is read after region A.
+ * Member "ring" keeps memory, protection and extensions of the buffer - extensions can be added to it
+ * by Buff_Ring_Add_Extension / Buff_Ring_Add_Protected_Extension and are called with pointer to it;
+ * other Buff_Ring_* functions must not be used on it.
  */
+typedef struct Buff_Bip_eXtended_Tag
+{
+   Buff_Ring_XT ring;
+   Buff_Size_DT region_a_start;
+   Buff_Size_DT region_a_end;
+   Buff_Size_DT region_b_end;
+   Buff_Size_DT reserved_start;
+   Buff_Size_DT reserved_size;
+   Buff_Bool_DT region_b_in_use;
+}Buff_Bip_XT;
+#endif
 
+#ifndef BUFF_POOL_XT_EXTERNAL
 /**
- * -----------------------------------------------------------------------------------------------------------------------------
- * ----------------------------------------- START OF LIBRARY INTERFACES -------------------------------------------------------
- * -----------------------------------------------------------------------------------------------------------------------------
+ * @brief Structure which describes slot pool.
+ * Positions of first busy and first free slot are kept in bytes (offsets in memory), so slot address is never multiplied.
+ * Member "ring" keeps memory, protection and extensions of the pool - extensions can be added to it
+ * by Buff_Ring_Add_Extension / Buff_Ring_Add_Protected_Extension and are called with pointer to it and size of one slot;
+ * other Buff_Ring_* functions must not be used on it.
  */
-
-#if(BUFF_USE_VECTOR_BUFFERS)
-
-#ifndef BUFF_GET_READABLE_VECTOR_DATA_SIZE_ENABLED
-#define BUFF_GET_READABLE_VECTOR_DATA_SIZE_ENABLED       BUFF_DEFAULT_FEATURES_STATE
+typedef struct Buff_Pool_eXtended_Tag
+{
+   Buff_Ring_XT ring;
+   Buff_Size_DT slot_size;
+   Buff_Size_DT num_slots;
+   Buff_Size_DT num_busy_slots;
+   Buff_Size_DT first_busy;
+   Buff_Size_DT first_free;
+   Buff_Bool_DT slot_acquired;
+}Buff_Pool_XT;
 #endif
-#if(BUFF_GET_READABLE_VECTOR_DATA_SIZE_ENABLED)
+
+#ifndef BUFF_CHAIN_CHUNK_XT_EXTERNAL
 /**
- * @brief Function which calculates size of readable vector of linear buffers
- *
- * @result size of readable vector
- *
- * @param vector pointer to readable vector for which size shall be calculated
- * @param vector_num_elems number of vector elements (independent linear buffers which create vector data)
+ * @brief Structure which describes one chunk of chunk chain - element of linked list and pointer to its memory.
+ * Table of chunks is given by the user to Buff_Chain_Init / Buff_Chain_Add_Chunks and is used by the chain until deinitialization.
  */
-Buff_Size_DT Buff_Get_Readable_Vector_Data_Size(const Buff_Readable_Vector_XT *vector, Buff_Num_Elems_DT vector_num_elems);
+typedef struct Buff_Chain_Chunk_eXtended_Tag
+{
+   struct Buff_Chain_Chunk_eXtended_Tag *next;
+   void *memory;
+}Buff_Chain_Chunk_XT;
 #endif
 
-#ifndef BUFF_GET_WRITEABLE_VECTOR_DATA_SIZE_ENABLED
-#define BUFF_GET_WRITEABLE_VECTOR_DATA_SIZE_ENABLED      BUFF_DEFAULT_FEATURES_STATE
+#ifndef BUFF_CHAIN_XT_EXTERNAL
+/**
+ * @brief Structure which describes chunk chain.
+ * Data starts at offset first_busy of chunk "first" and ends at offset first_free of chunk "last";
+ * empty chain has no chunks (all of them are in free list), so next write starts from the begining of a chunk.
+ */
+typedef struct Buff_Chain_eXtended_Tag
+{
+   Buff_Chain_Chunk_XT *first;
+   Buff_Chain_Chunk_XT *last;
+   Buff_Chain_Chunk_XT *free_chunks;
+   Buff_Size_DT chunk_size;
+   Buff_Size_DT num_free_chunks;
+   Buff_Size_DT busy_size;
+   Buff_Size_DT first_busy;
+   Buff_Size_DT first_free;
+}Buff_Chain_XT;
 #endif
-#if(BUFF_GET_WRITEABLE_VECTOR_DATA_SIZE_ENABLED)
+
+#ifndef BUFF_RING_URING_XT_EXTERNAL
 /**
- * @brief Function which calculates size of writeable vector of linear buffers
- *
- * @result size of writeable vector
- *
- * @param vector pointer to writeable vector for which size shall be calculated
- * @param vector_num_elems number of vector elements (independent linear buffers which create vector data)
+ * @brief Structure which describes io_uring instance used to feed ring buffers - file descriptor of io_uring
+ * and pointers to submission / completion queues shared with the kernel.
  */
-Buff_Size_DT Buff_Get_Writeable_Vector_Data_Size(const Buff_Writeable_Vector_XT *vector, Buff_Num_Elems_DT vector_num_elems);
+typedef struct Buff_Ring_Uring_eXtended_Tag
+{
+   void             *sq_ring;
+   void             *cq_ring;
+   void             *sqes;
+   void             *cqes;
+   unsigned         *sq_head;
+   unsigned         *sq_tail;
+   unsigned         *sq_ring_mask;
+   unsigned         *sq_array;
+   unsigned         *cq_head;
+   unsigned         *cq_tail;
+   unsigned         *cq_ring_mask;
+   Buff_Size_DT      sq_ring_size;
+   Buff_Size_DT      cq_ring_size;
+   Buff_Size_DT      sqes_size;
+   Buff_Num_Elems_DT num_entries;
+   Buff_Num_Elems_DT num_in_flight;
+   Buff_Num_Elems_DT to_submit;
+   int               fd;
+}Buff_Ring_Uring_XT;
+#endif
+
+#ifndef BUFF_RING_URING_FEED_XT_EXTERNAL
+/**
+ * @brief Structure which describes one ring buffer fed by io_uring - buffer, file descriptor from which data is read
+ * and state of read request (with position in the buffer to which it has been posted).
+ * Feed is finished when end of file has been reached or read has failed (error is not 0).
+ */
+typedef struct Buff_Ring_Uring_Feed_eXtended_Tag
+{
+   Buff_Ring_XT     *buf;
+   Buff_Size_DT      size;
+   Buff_Size_DT      posted_pos;
+   int               fd;
+   int               error;
+   Buff_Bool_DT      is_posted;
+   Buff_Bool_DT      is_eof;
+   Buff_Bool_DT      use_protection;
+}Buff_Ring_Uring_Feed_XT;
+#endif
+
+#if(BUFF_RING_USE_FILE)
+/**
+ * @brief Policies of synchronization of file-backed ring buffer with the disk (msync), set by Buff_Ring_File_Set_Sync
+ */
+/* no msync - data is written to the disk by the kernel; content survives crash of the process, not of the system */
+#define BUFF_RING_FILE_SYNC_NONE             0
+/* msync(MS_ASYNC) - writing to the disk is scheduled, without waiting */
+#define BUFF_RING_FILE_SYNC_ASYNC            1
+/* msync(MS_SYNC) - function which modified the buffer waits until data is written to the disk */
+#define BUFF_RING_FILE_SYNC_SYNC             2
 #endif
 
-#ifndef BUFF_READABLE_VECTOR_GET_CONTINEOUS_SIZE_ENABLED
-#define BUFF_READABLE_VECTOR_GET_CONTINEOUS_SIZE_ENABLED    BUFF_DEFAULT_FEATURES_STATE
+#ifndef BUFF_RING_FILE_HEADER_XT_EXTERNAL
+/**
+ * @brief Structure of header placed on the begining of the file of file-backed ring buffer (ring memory starts after header page).
+ * State of indexes is stored in 2 slots - new state is written to slot not pointed by "sequence", next "sequence" is incremented,
+ * so state pointed by "sequence" is always complete, even if process crashed in the middle of update.
+ */
+typedef struct Buff_Ring_File_Header_eXtended_Tag
+{
+   uint32_t          magic;
+   uint32_t          header_size;
+   Buff_Size_DT      memory_size;
+   Buff_Size_DT      sequence;
+   struct
+   {
+      Buff_Size_DT   size;
+      Buff_Size_DT   first_busy;
+      Buff_Size_DT   first_free;
+      Buff_Size_DT   busy_size;
+   }state[2];
+}Buff_Ring_File_Header_XT;
 #endif
-#if(BUFF_READABLE_VECTOR_GET_CONTINEOUS_SIZE_ENABLED)
+
+#ifndef BUFF_RING_FILE_XT_EXTERNAL
 /**
- * @brief Function which calculates size of next contineous part of the vector starting from possition pointed by offset variable.
+ * @brief Structure which describes file of file-backed ring buffer - mapping of the file and synchronization policy.
+ * Member "extension" is installed as protected extension of the buffer and publishes indexes to the file header.
+ */
+typedef struct Buff_Ring_File_eXtended_Tag
+{
+   Buff_Ring_Extensions_XT   extension;
+   Buff_Ring_File_Header_XT *header;
+   Buff_Size_DT              mapping_size;
+   Buff_Size_DT              sync_threshold;
+   Buff_Size_DT              unsynced_size;
+   int                       fd;
+   uint8_t                   sync_mode;
+}Buff_Ring_File_XT;
+#endif
+
+/**
+ * -----------------------------------------------------------------------------------------------------------------------------
+ * ----------------------------------------- END OF LIBRARY TYPES --------------------------------------------------------------
+ * -----------------------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * -----------------------------------------------------------------------------------------------------------------------------
+ * ----------------------------------------- START OF LIBRARY INTERFACES -------------------------------------------------------
+ * -----------------------------------------------------------------------------------------------------------------------------
+ */
+
+#if(BUFF_USE_OPTIMIZED_MEMCPY)
+#ifndef BUFF_MEMCPY_EXTERNAL
+/**
+ * @brief Function which copies linear memory area to another one (areas cannot overlap). Default backend of BUFF_MEMCPY
+ * when BUFF_USE_OPTIMIZED_MEMCPY is enabled. When BUFF_MEMCPY_EXTERNAL is defined then user provides both implementation
+ * and declaration of Buff_Memcpy.
+ *
+ * @param dest pointer to destination memory
+ * @param src pointer to source memory
+ * @param size number of bytes to be copied
+ */
+void Buff_Memcpy(void *dest, const void *src, Buff_Size_DT size);
+#endif
+#endif
+
+#if(BUFF_USE_CHECKSUM)
+
+#ifndef BUFF_CHECKSUM_INIT_ENABLED
+#define BUFF_CHECKSUM_INIT_ENABLED                       BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_CHECKSUM_INIT_ENABLED)
+/**
+ * @brief Function which initializes running checksum.
+ *
+ * @param checksum pointer to checksum to be initialized
+ * @param type kind of checksum - one of BUFF_CHECKSUM_*
+ */
+void Buff_Checksum_Init(Buff_Checksum_XT *checksum, uint8_t type);
+#endif
+
+#ifndef BUFF_CHECKSUM_UPDATE_ENABLED
+#define BUFF_CHECKSUM_UPDATE_ENABLED                     BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_CHECKSUM_UPDATE_ENABLED)
+/**
+ * @brief Function which adds data to running checksum.
+ *
+ * @param checksum pointer to checksum
+ * @param data pointer to linear buffer with data
+ * @param size number of bytes in data
+ */
+void Buff_Checksum_Update(Buff_Checksum_XT *checksum, const void *data, Buff_Size_DT size);
+#endif
+
+#ifndef BUFF_CHECKSUM_GET_ENABLED
+#define BUFF_CHECKSUM_GET_ENABLED                        BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_CHECKSUM_GET_ENABLED)
+/**
+ * @brief Function which returns final value of checksum. Checksum is not changed, so it can be still accumulated.
+ *
+ * @result final value of checksum (16 bits wide for BUFF_CHECKSUM_CRC16 and BUFF_CHECKSUM_ONES_COMPLEMENT)
+ *
+ * @param checksum pointer to checksum
+ */
+uint32_t Buff_Checksum_Get(const Buff_Checksum_XT *checksum);
+#endif
+
+#ifndef BUFF_MEMCPY_CHECKSUM_ENABLED
+#define BUFF_MEMCPY_CHECKSUM_ENABLED                     BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_MEMCPY_CHECKSUM_ENABLED)
+/**
+ * @brief Function which copies linear memory area to another one (areas cannot overlap) and adds copied data to running checksum.
+ * Data is copied by 8-byte chunks and each chunk is added to checksum from its local copy (held in registers),
+ * so data is read from source only once.
+ *
+ * @param dest pointer to destination memory
+ * @param src pointer to source memory
+ * @param size number of bytes to be copied
+ * @param checksum pointer to checksum
+ */
+void Buff_Memcpy_Checksum(void *dest, const void *src, Buff_Size_DT size, Buff_Checksum_XT *checksum);
+#endif
+
+#endif
+
+#if(BUFF_USE_VECTOR_BUFFERS)
+
+#ifndef BUFF_GET_READABLE_VECTOR_DATA_SIZE_ENABLED
+#define BUFF_GET_READABLE_VECTOR_DATA_SIZE_ENABLED       BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_GET_READABLE_VECTOR_DATA_SIZE_ENABLED)
+/**
+ * @brief Function which calculates size of readable vector of linear buffers
+ *
+ * @result size of readable vector
+ *
+ * @param vector pointer to readable vector for which size shall be calculated
+ * @param vector_num_elems number of vector elements (independent linear buffers which create vector data)
+ */
+Buff_Size_DT Buff_Get_Readable_Vector_Data_Size(const Buff_Readable_Vector_XT *vector, Buff_Num_Elems_DT vector_num_elems);
+#endif
+
+#ifndef BUFF_GET_WRITEABLE_VECTOR_DATA_SIZE_ENABLED
+#define BUFF_GET_WRITEABLE_VECTOR_DATA_SIZE_ENABLED      BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_GET_WRITEABLE_VECTOR_DATA_SIZE_ENABLED)
+/**
+ * @brief Function which calculates size of writeable vector of linear buffers
+ *
+ * @result size of writeable vector
+ *
+ * @param vector pointer to writeable vector for which size shall be calculated
+ * @param vector_num_elems number of vector elements (independent linear buffers which create vector data)
+ */
+Buff_Size_DT Buff_Get_Writeable_Vector_Data_Size(const Buff_Writeable_Vector_XT *vector, Buff_Num_Elems_DT vector_num_elems);
+#endif
+
+#ifndef BUFF_READABLE_VECTOR_GET_CONTINEOUS_SIZE_ENABLED
+#define BUFF_READABLE_VECTOR_GET_CONTINEOUS_SIZE_ENABLED    BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_READABLE_VECTOR_GET_CONTINEOUS_SIZE_ENABLED)
+/**
+ * @brief Function which calculates size of next contineous part of the vector starting from possition pointed by offset variable.
  *
  * @result size of next contineous part of the vector
  *
@@ -939,6 +1723,34 @@ Buff_Size_DT Buff_Copy_From_Vector_Vendor(
    Buff_Vendor_Memcpy_HT            vendor_cpy);
 #endif
 
+#ifndef BUFF_COPY_FROM_VECTOR_CHECKSUM_ENABLED
+#define BUFF_COPY_FROM_VECTOR_CHECKSUM_ENABLED           BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_COPY_FROM_VECTOR_CHECKSUM_ENABLED && BUFF_COPY_FROM_VECTOR_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS && BUFF_USE_CHECKSUM \
+   && BUFF_MEMCPY_CHECKSUM_ENABLED )
+/**
+ * @brief Function which copies data from vector of linear buffers to one linear buffer and adds copied data to running checksum.
+ *
+ * @result number of bytes copied from source to destination
+ *
+ * @param dest destination - linear buffer into which data will be copied
+ * @param src source - vector of linear buffers from which data will be copied
+ * @param src_num_elems number of source vector elements (independent linear buffers which create vector data)
+ * @param size number of bytes to be copied from source to destination
+ * @param offset_dest offset in destination buffer between begining of the buffer and first byte to which data will be copied
+ * @param offset_src offset in source buffer between begining of the buffer and first byte from which data will be copied
+ * @param checksum pointer to running checksum to which copied data will be added
+ */
+Buff_Size_DT Buff_Copy_From_Vector_Checksum(
+   void                            *dest,
+   const Buff_Readable_Vector_XT   *src,
+   Buff_Num_Elems_DT                src_num_elems,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_dest,
+   Buff_Size_DT                     offset_src,
+   Buff_Checksum_XT                *checksum);
+#endif
+
 #ifndef BUFF_COPY_TO_VECTOR_ENABLED
 #define BUFF_COPY_TO_VECTOR_ENABLED                      BUFF_DEFAULT_FEATURES_STATE
 #endif
@@ -994,6 +1806,34 @@ Buff_Size_DT Buff_Copy_To_Vector_Vendor(
    Buff_Vendor_Memcpy_HT            vendor_cpy);
 #endif
 
+#ifndef BUFF_COPY_TO_VECTOR_CHECKSUM_ENABLED
+#define BUFF_COPY_TO_VECTOR_CHECKSUM_ENABLED             BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_COPY_TO_VECTOR_CHECKSUM_ENABLED && BUFF_COPY_TO_VECTOR_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS && BUFF_USE_CHECKSUM \
+   && BUFF_MEMCPY_CHECKSUM_ENABLED )
+/**
+ * @brief Function which copies data from one linear buffer to vector of linear buffers and adds copied data to running checksum.
+ *
+ * @result number of bytes copied from source to destination
+ *
+ * @param dest destination - vector of linear buffers into which data will be copied
+ * @param dest_num_elems number of destination vector elements (independent linear buffers which create vector data)
+ * @param src source - linear buffer from which data will be copied
+ * @param size number of bytes to be copied from source to destination
+ * @param offset_dest offset in destination buffer between begining of the buffer and first byte to which data will be copied
+ * @param offset_src offset in source buffer between begining of the buffer and first byte from which data will be copied
+ * @param checksum pointer to running checksum to which copied data will be added
+ */
+Buff_Size_DT Buff_Copy_To_Vector_Checksum(
+   const Buff_Writeable_Vector_XT  *dest,
+   Buff_Num_Elems_DT                dest_num_elems,
+   const void                      *src,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_dest,
+   Buff_Size_DT                     offset_src,
+   Buff_Checksum_XT                *checksum);
+#endif
+
 #ifndef BUFF_COPY_VECTOR_TO_VECTOR_ENABLED
 #define BUFF_COPY_VECTOR_TO_VECTOR_ENABLED               BUFF_DEFAULT_FEATURES_STATE
 #endif
@@ -1021,6 +1861,68 @@ Buff_Size_DT Buff_Copy_Vector_To_Vector(
    Buff_Size_DT                     offset_src);
 #endif
 
+#ifndef BUFF_READABLE_VECTOR_CURSOR_ENABLED
+#define BUFF_READABLE_VECTOR_CURSOR_ENABLED              BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_READABLE_VECTOR_CURSOR_ENABLED)
+/**
+ * @brief Function which initializes cursor of readable vector of linear buffers.
+ *
+ * @param cursor pointer to cursor to be initialized
+ * @param vector pointer to readable vector which will be walked by the cursor
+ * @param vector_num_elems number of vector elements (independent linear buffers which create vector data)
+ * @param offset offset in vector data on which cursor will be set
+ */
+void Buff_Readable_Vector_Cursor_Init(
+   Buff_Readable_Vector_Cursor_XT  *cursor,
+   const Buff_Readable_Vector_XT   *vector,
+   Buff_Num_Elems_DT                vector_num_elems,
+   Buff_Size_DT                     offset);
+
+/**
+ * @brief Function which copies data from vector of linear buffers, starting from possition of the cursor, to one linear buffer
+ * and moves the cursor after copied data. Consecutive calls copy consecutive parts of the vector;
+ * each call costs only as many vector elements as it copies from.
+ *
+ * @result number of bytes copied from source to destination (less than size if end of vector has been reached)
+ *
+ * @param dest destination - linear buffer into which data will be copied
+ * @param cursor pointer to cursor of vector from which data will be copied
+ * @param size number of bytes to be copied from source to destination
+ */
+Buff_Size_DT Buff_Copy_From_Vector_Cursor(
+   void                            *dest,
+   Buff_Readable_Vector_Cursor_XT  *cursor,
+   Buff_Size_DT                     size);
+#endif
+
+#ifndef BUFF_VECTOR_TO_IOVEC_ENABLED
+#define BUFF_VECTOR_TO_IOVEC_ENABLED                     BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_VECTOR_TO_IOVEC_ENABLED && BUFF_USE_IOVEC && BUFF_READABLE_VECTOR_CURSOR_ENABLED)
+/**
+ * @brief Function which describes data of vector of linear buffers, starting from possition of the cursor, as table of struct iovec
+ * (without copying) and moves the cursor after described data. Adjacent elements which are contiguous in memory
+ * are coalesced into one iovec entry. If iovec table is too small (e.g. IOV_MAX reached) then description is truncated
+ * and cursor points to first not described byte, so next call continues from this place.
+ *
+ * @result number of bytes described by iovec table (less than size if end of vector has been reached or description has been truncated)
+ *
+ * @param iov destination - table of struct iovec to be filled
+ * @param iov_num_elems pointer to number of iov elements; on input - size of iov table, on output - number of used elements
+ * @param cursor pointer to cursor of vector which data will be described (continuation token of consecutive calls)
+ * @param size number of bytes to be described
+ * @param truncated pointer to variable set to BUFF_TRUE if iov table has been too small to describe all requested data,
+ *        BUFF_FALSE otherwise; can be NULL
+ */
+Buff_Size_DT Buff_Vector_To_Iovec(
+   struct iovec                    *iov,
+   Buff_Num_Elems_DT               *iov_num_elems,
+   Buff_Readable_Vector_Cursor_XT  *cursor,
+   Buff_Size_DT                     size,
+   Buff_Bool_DT                    *truncated);
+#endif
+
 #endif /* #if(BUFF_USE_VECTOR_BUFFERS) */
 
 
@@ -1036,7 +1938,8 @@ Buff_Size_DT Buff_Copy_Vector_To_Vector(
  *
  * @result size of readable tree
  *
- * @param tree pointer to readable tree for which size shall be calculated
+ * @param tree pointer to readable tree for which size shall be calculated;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
  * @param tree_num_elems number of elements in tree root
  */
 Buff_Size_DT Buff_Get_Readable_Tree_Data_Size(const Buff_Readable_Tree_XT *tree, Buff_Num_Elems_DT tree_num_elems);
@@ -1051,7 +1954,8 @@ Buff_Size_DT Buff_Get_Readable_Tree_Data_Size(const Buff_Readable_Tree_XT *tree,
  *
  * @result size of writeable tree
  *
- * @param tree pointer to writeable tree for which size shall be calculated
+ * @param tree pointer to writeable tree for which size shall be calculated;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
  * @param tree_num_elems number of elements in tree root
  */
 Buff_Size_DT Buff_Get_Writeable_Tree_Data_Size(const Buff_Writeable_Tree_XT *tree, Buff_Num_Elems_DT tree_num_elems);
@@ -1066,7 +1970,8 @@ Buff_Size_DT Buff_Get_Writeable_Tree_Data_Size(const Buff_Writeable_Tree_XT *tre
  *
  * @result size of next contineous part of the tree
  *
- * @param tree pointer to writeable tree for which size shall be calculated
+ * @param tree pointer to writeable tree for which size shall be calculated;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
  * @param tree_num_elems number of elements in tree root
  * @param offset first byte from which we should calcupate size of next contineous part of the tree.
  */
@@ -1083,7 +1988,8 @@ Buff_Size_DT Buff_Readable_Tree_Get_Contineous_Size(
  *
  * @result size of next contineous part of the tree
  *
- * @param tree pointer to writeable tree for which size shall be calculated
+ * @param tree pointer to writeable tree for which size shall be calculated;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
  * @param tree_num_elems number of elements in tree root
  * @param offset first byte from which we should calcupate size of next contineous part of the tree.
  */
@@ -1101,7 +2007,8 @@ Buff_Size_DT Buff_Writeable_Tree_Get_Contineous_Size(
  * @result number of bytes copied from source to destination
  *
  * @param dest destination - linear buffer into which data will be copied
- * @param src source - tree of vectors of linear buffers from which data will be copied
+ * @param src source - tree of vectors of linear buffers from which data will be copied;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
  * @param src_num_elems number of elements in source tree root
  * @param size number of bytes to be copied from source to destination
  * @param offset_dest offset in destination buffer between begining of the buffer and first byte to which data will be copied
@@ -1134,7 +2041,8 @@ Buff_Size_DT Buff_Copy_From_Tree(
  * @result number of bytes copied from source to destination
  *
  * @param dest destination - vendor-specific buffer into which data will be copied
- * @param src source - tree of vectors of linear buffers from which data will be copied
+ * @param src source - tree of vectors of linear buffers from which data will be copied;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
  * @param src_num_elems number of elements in source tree root
  * @param size number of bytes to be copied from source to destination
  * @param offset_dest offset in destination buffer between begining of the buffer and first byte to which data will be copied
@@ -1156,6 +2064,39 @@ Buff_Size_DT Buff_Copy_From_Tree_Vendor(
    Buff_Vendor_Memcpy_HT         vendor_cpy);
 #endif
 
+#ifndef BUFF_COPY_FROM_TREE_CHECKSUM_ENABLED
+#define BUFF_COPY_FROM_TREE_CHECKSUM_ENABLED             BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_COPY_FROM_TREE_CHECKSUM_ENABLED && BUFF_COPY_FROM_TREE_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS && BUFF_USE_CHECKSUM \
+   && BUFF_MEMCPY_CHECKSUM_ENABLED )
+/**
+ * @brief Function which copies data from tree of vectors of linear buffers to one linear buffer and adds copied data
+ * to running checksum.
+ *
+ * @result number of bytes copied from source to destination
+ *
+ * @param dest destination - linear buffer into which data will be copied
+ * @param src source - tree of vectors of linear buffers from which data will be copied;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
+ * @param src_num_elems number of elements in source tree root
+ * @param size number of bytes to be copied from source to destination
+ * @param offset_dest offset in destination buffer between begining of the buffer and first byte to which data will be copied
+ * @param offset_src offset in source buffer between begining of the buffer and first byte from which data will be copied
+ * @param str_size pointer to variable into which size of data in source buffer will be returned - same as for Buff_Copy_From_Tree;
+ * optional, when not needed, can be set to BUFF_MAKE_INVALID_PTR(Buff_Size_DT).
+ * @param checksum pointer to running checksum to which copied data will be added
+ */
+Buff_Size_DT Buff_Copy_From_Tree_Checksum(
+   void                         *dest,
+   const Buff_Readable_Tree_XT  *src,
+   Buff_Num_Elems_DT             src_num_elems,
+   Buff_Size_DT                  size,
+   Buff_Size_DT                  offset_dest,
+   Buff_Size_DT                  offset_src,
+   Buff_Size_DT                 *str_size,
+   Buff_Checksum_XT             *checksum);
+#endif
+
 #ifndef BUFF_COPY_TO_TREE_ENABLED
 #define BUFF_COPY_TO_TREE_ENABLED                        BUFF_DEFAULT_FEATURES_STATE
 #endif
@@ -1165,7 +2106,8 @@ Buff_Size_DT Buff_Copy_From_Tree_Vendor(
  *
  * @result number of bytes copied from source to destination
  *
- * @param dest destination - tree of vectors of linear buffers into which data will be copied
+ * @param dest destination - tree of vectors of linear buffers into which data will be copied;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
  * @param dest_num_elems number of elements in destination tree root
  * @param src source - linear buffer from which data will be copied
  * @param size number of bytes to be copied from source to destination
@@ -1198,7 +2140,8 @@ Buff_Size_DT Buff_Copy_To_Tree(
  *
  * @result number of bytes copied from source to destination
  *
- * @param dest destination - tree of vectors of linear buffers into which data will be copied
+ * @param dest destination - tree of vectors of linear buffers into which data will be copied;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
  * @param dest_num_elems number of elements in destination tree root
  * @param src source - vendor-specific buffer from which data will be copied
  * @param size number of bytes to be copied from source to destination
@@ -1221,6 +2164,39 @@ Buff_Size_DT Buff_Copy_To_Tree_Vendor(
    Buff_Vendor_Memcpy_HT         vendor_cpy);
 #endif
 
+#ifndef BUFF_COPY_TO_TREE_CHECKSUM_ENABLED
+#define BUFF_COPY_TO_TREE_CHECKSUM_ENABLED               BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_COPY_TO_TREE_CHECKSUM_ENABLED && BUFF_COPY_TO_TREE_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS && BUFF_USE_CHECKSUM \
+   && BUFF_MEMCPY_CHECKSUM_ENABLED )
+/**
+ * @brief Function which copies data from one linear buffer to tree of vectors of linear buffers and adds copied data
+ * to running checksum.
+ *
+ * @result number of bytes copied from source to destination
+ *
+ * @param dest destination - tree of vectors of linear buffers into which data will be copied;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
+ * @param dest_num_elems number of elements in destination tree root
+ * @param src source - linear buffer from which data will be copied
+ * @param size number of bytes to be copied from source to destination
+ * @param offset_dest offset in destination buffer between begining of the buffer and first byte to which data will be copied
+ * @param offset_src offset in source buffer between begining of the buffer and first byte from which data will be copied
+ * @param str_size pointer to variable into which size of data in destination buffer will be returned - same as for
+ * Buff_Copy_To_Tree; optional, when not needed, can be set to BUFF_MAKE_INVALID_PTR(Buff_Size_DT).
+ * @param checksum pointer to running checksum to which copied data will be added
+ */
+Buff_Size_DT Buff_Copy_To_Tree_Checksum(
+   const Buff_Writeable_Tree_XT *dest,
+   Buff_Num_Elems_DT             dest_num_elems,
+   const void                   *src,
+   Buff_Size_DT                  size,
+   Buff_Size_DT                  offset_dest,
+   Buff_Size_DT                  offset_src,
+   Buff_Size_DT                 *str_size,
+   Buff_Checksum_XT             *checksum);
+#endif
+
 #ifndef BUFF_COPY_TREE_TO_TREE_ENABLED
 #define BUFF_COPY_TREE_TO_TREE_ENABLED                   BUFF_DEFAULT_FEATURES_STATE
 #endif
@@ -1230,9 +2206,11 @@ Buff_Size_DT Buff_Copy_To_Tree_Vendor(
  *
  * @result number of bytes copied from source to destination
  *
- * @param dest destination - tree of vectors of linear buffers into which data will be copied
+ * @param dest destination - tree of vectors of linear buffers into which data will be copied;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
  * @param dest_num_elems number of elements in destination tree root
- * @param src source - tree of vectors of linear buffers from which data will be copied
+ * @param src source - tree of vectors of linear buffers from which data will be copied;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
  * @param src_num_elems number of elements in source tree root
  * @param size number of bytes to be copied from source to destination
  * @param offset_dest offset in destination buffer between begining of the buffer and first byte to which data will be copied
@@ -1256,6 +2234,177 @@ Buff_Size_DT Buff_Copy_Tree_To_Tree(
    Buff_Bool_DT                 *end_of_destination_reached);
 #endif
 
+#ifndef BUFF_READABLE_TREE_FLATTEN_ENABLED
+#define BUFF_READABLE_TREE_FLATTEN_ENABLED               BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_READABLE_TREE_FLATTEN_ENABLED)
+/**
+ * @brief Function which flattens readable tree - stores all its non-empty linear parts in one table, together with position
+ * of each part in tree data. Tree is analyzed only once, by this function; flattened tree can be used many times
+ * by Buff_Copy_From_Flat_Tree which finds part pointed by offset by binary search, without recursion.
+ * Flattened tree points to the same linear parts as original tree - only structure of the tree is copied, not its data.
+ *
+ * @result BUFF_TRUE if tree has been flattened, BUFF_FALSE if tree has more non-empty linear parts than max_num_elems
+ * (then flattened tree is empty)
+ *
+ * @param flat pointer to flattened tree structure to be initialized
+ * @param vector table for linear parts of the tree; must be valid as long as flattened tree is used
+ * @param offset table for positions of linear parts of the tree (same number of elements as "vector");
+ * must be valid as long as flattened tree is used
+ * @param max_num_elems number of elements in "vector" and "offset" tables
+ * @param tree pointer to readable tree to be flattened;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
+ * @param tree_num_elems number of elements in tree root
+ */
+Buff_Bool_DT Buff_Readable_Tree_Flatten(
+   Buff_Readable_Flat_Tree_XT   *flat,
+   Buff_Readable_Vector_XT      *vector,
+   Buff_Size_DT                 *offset,
+   Buff_Num_Elems_DT             max_num_elems,
+   const Buff_Readable_Tree_XT  *tree,
+   Buff_Num_Elems_DT             tree_num_elems);
+#endif
+
+#ifndef BUFF_WRITEABLE_TREE_FLATTEN_ENABLED
+#define BUFF_WRITEABLE_TREE_FLATTEN_ENABLED              BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_WRITEABLE_TREE_FLATTEN_ENABLED)
+/**
+ * @brief Function which flattens writeable tree - stores all its non-empty linear parts in one table, together with position
+ * of each part in tree data. Tree is analyzed only once, by this function; flattened tree can be used many times
+ * by Buff_Copy_To_Flat_Tree which finds part pointed by offset by binary search, without recursion.
+ * Flattened tree points to the same linear parts as original tree - only structure of the tree is copied, not its data.
+ *
+ * @result BUFF_TRUE if tree has been flattened, BUFF_FALSE if tree has more non-empty linear parts than max_num_elems
+ * (then flattened tree is empty)
+ *
+ * @param flat pointer to flattened tree structure to be initialized
+ * @param vector table for linear parts of the tree; must be valid as long as flattened tree is used
+ * @param offset table for positions of linear parts of the tree (same number of elements as "vector");
+ * must be valid as long as flattened tree is used
+ * @param max_num_elems number of elements in "vector" and "offset" tables
+ * @param tree pointer to writeable tree to be flattened;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
+ * @param tree_num_elems number of elements in tree root
+ */
+Buff_Bool_DT Buff_Writeable_Tree_Flatten(
+   Buff_Writeable_Flat_Tree_XT  *flat,
+   Buff_Writeable_Vector_XT     *vector,
+   Buff_Size_DT                 *offset,
+   Buff_Num_Elems_DT             max_num_elems,
+   const Buff_Writeable_Tree_XT *tree,
+   Buff_Num_Elems_DT             tree_num_elems);
+#endif
+
+#ifndef BUFF_COPY_FROM_FLAT_TREE_ENABLED
+#define BUFF_COPY_FROM_FLAT_TREE_ENABLED                 BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_COPY_FROM_FLAT_TREE_ENABLED)
+/**
+ * @brief Function which copies data from flattened tree (created by Buff_Readable_Tree_Flatten) to one linear buffer.
+ *
+ * @result number of bytes copied from source to destination
+ *
+ * @param dest destination - linear buffer into which data will be copied
+ * @param src source - flattened tree from which data will be copied
+ * @param size number of bytes to be copied from source to destination
+ * @param offset_dest offset in destination buffer between begining of the buffer and first byte to which data will be copied
+ * @param offset_src offset in source buffer between begining of the buffer and first byte from which data will be copied
+ */
+Buff_Size_DT Buff_Copy_From_Flat_Tree(
+   void                              *dest,
+   const Buff_Readable_Flat_Tree_XT  *src,
+   Buff_Size_DT                       size,
+   Buff_Size_DT                       offset_dest,
+   Buff_Size_DT                       offset_src);
+#endif
+
+#ifndef BUFF_COPY_TO_FLAT_TREE_ENABLED
+#define BUFF_COPY_TO_FLAT_TREE_ENABLED                   BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_COPY_TO_FLAT_TREE_ENABLED)
+/**
+ * @brief Function which copies data from one linear buffer to flattened tree (created by Buff_Writeable_Tree_Flatten).
+ *
+ * @result number of bytes copied from source to destination
+ *
+ * @param dest destination - flattened tree into which data will be copied
+ * @param src source - linear buffer from which data will be copied
+ * @param size number of bytes to be copied from source to destination
+ * @param offset_dest offset in destination buffer between begining of the buffer and first byte to which data will be copied
+ * @param offset_src offset in source buffer between begining of the buffer and first byte from which data will be copied
+ */
+Buff_Size_DT Buff_Copy_To_Flat_Tree(
+   const Buff_Writeable_Flat_Tree_XT *dest,
+   const void                        *src,
+   Buff_Size_DT                       size,
+   Buff_Size_DT                       offset_dest,
+   Buff_Size_DT                       offset_src);
+#endif
+
+
+#ifndef BUFF_READABLE_TREE_CURSOR_ENABLED
+#define BUFF_READABLE_TREE_CURSOR_ENABLED                BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_READABLE_TREE_CURSOR_ENABLED)
+/**
+ * @brief Function which initializes cursor of readable tree of vectors of linear buffers.
+ *
+ * @param cursor pointer to cursor to be initialized
+ * @param tree pointer to readable tree which will be walked by the cursor; when cursor reaches branch nested deeper than
+ * BUFF_TREE_MAX_DEPTH then it stops as on end of the tree and its field is_too_deep is set to BUFF_TRUE
+ * @param tree_num_elems number of elements in tree root
+ * @param offset offset in tree data on which cursor will be set
+ */
+void Buff_Readable_Tree_Cursor_Init(
+   Buff_Readable_Tree_Cursor_XT    *cursor,
+   const Buff_Readable_Tree_XT     *tree,
+   Buff_Num_Elems_DT                tree_num_elems,
+   Buff_Size_DT                     offset);
+
+/**
+ * @brief Function which copies data from tree of vectors of linear buffers, starting from possition of the cursor,
+ * to one linear buffer and moves the cursor after copied data. Consecutive calls copy consecutive parts of the tree
+ * without recursion and without walking the tree from its begining.
+ *
+ * @result number of bytes copied from source to destination (less than size if end of tree has been reached)
+ *
+ * @param dest destination - linear buffer into which data will be copied
+ * @param cursor pointer to cursor of tree from which data will be copied
+ * @param size number of bytes to be copied from source to destination
+ */
+Buff_Size_DT Buff_Copy_From_Tree_Cursor(
+   void                            *dest,
+   Buff_Readable_Tree_Cursor_XT    *cursor,
+   Buff_Size_DT                     size);
+#endif
+
+#ifndef BUFF_TREE_TO_IOVEC_ENABLED
+#define BUFF_TREE_TO_IOVEC_ENABLED                       BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_TREE_TO_IOVEC_ENABLED && BUFF_USE_IOVEC && BUFF_READABLE_TREE_CURSOR_ENABLED)
+/**
+ * @brief Function which describes data of tree of vectors of linear buffers, starting from possition of the cursor,
+ * as table of struct iovec (without copying) and moves the cursor after described data. Works as Buff_Vector_To_Iovec,
+ * so e.g. header / payload / trailer tree can be sent by single writev / sendmsg call.
+ *
+ * @result number of bytes described by iovec table (less than size if end of tree has been reached or description has been truncated)
+ *
+ * @param iov destination - table of struct iovec to be filled
+ * @param iov_num_elems pointer to number of iov elements; on input - size of iov table, on output - number of used elements
+ * @param cursor pointer to cursor of tree which data will be described (continuation token of consecutive calls)
+ * @param size number of bytes to be described
+ * @param truncated pointer to variable set to BUFF_TRUE if iov table has been too small to describe all requested data,
+ *        BUFF_FALSE otherwise; can be NULL
+ */
+Buff_Size_DT Buff_Tree_To_Iovec(
+   struct iovec                    *iov,
+   Buff_Num_Elems_DT               *iov_num_elems,
+   Buff_Readable_Tree_Cursor_XT    *cursor,
+   Buff_Size_DT                     size,
+   Buff_Bool_DT                    *truncated);
+#endif
+
 #endif /* #if(BUFF_USE_TREE_BUFFERS) */
 
 
@@ -1273,7 +2422,8 @@ Buff_Size_DT Buff_Copy_Tree_To_Tree(
  *
  * @param buf pointer to buffer to be initialized
  * @param memory pointer to RAM memory on which buffer will operate (store data and read from)
- * @param size size of memory in bytes
+ * @param size size of memory in bytes; must be greater than 1 when BUFF_RING_USE_LOCK_FREE_SPSC is enabled
+ * and power of 2 when BUFF_RING_USE_POWER_OF_2_SIZE is enabled
  */
 Buff_Bool_DT Buff_Ring_Init(Buff_Ring_XT *buf, void *memory, Buff_Size_DT size);
 #endif
@@ -1291,19 +2441,109 @@ Buff_Bool_DT Buff_Ring_Init(Buff_Ring_XT *buf, void *memory, Buff_Size_DT size);
 void   Buff_Ring_Deinit(Buff_Ring_XT *buf);
 #endif
 
-#ifndef BUFF_RING_INIT_EXTENSION_ENABLED
-#define BUFF_RING_INIT_EXTENSION_ENABLED                 BUFF_DEFAULT_FEATURES_STATE
+#ifndef BUFF_RING_INIT_MIRRORED_ENABLED
+#define BUFF_RING_INIT_MIRRORED_ENABLED                  BUFF_DEFAULT_FEATURES_STATE
 #endif
-#if( BUFF_RING_INIT_EXTENSION_ENABLED && BUFF_RING_USE_EXTENSIONS )
+#if( BUFF_RING_INIT_MIRRORED_ENABLED && BUFF_RING_USE_MIRRORED_MEMORY )
 /**
- * @brief Function which initializes to defaults structure with ring buffer extensions.
- * Extension is a function which is called after buffer context modification.
- * There can be: read, write, overwrite and remove extensions. Extensions installed using this function
- * are called after buffer protection unlock (not protected extensions).
+ * @brief Function which allocates mirrored memory (same memfd mapped twice, back-to-back) and initializes ring buffer on it.
+ * Buffer initialized by this function must be deinitialized by Buff_Ring_Deinit_Mirrored.
  *
- * @param extension pointer to extensions structure to be initialized
- */
-void Buff_Ring_Init_Extension(Buff_Ring_Extensions_XT *extension);
+ * @result BUFF_TRUE if initialization succeeded, BUFF_FALSE otherwise
+ *
+ * @param buf pointer to buffer to be initialized
+ * @param size requested size of buffer in bytes; it is rounded up to multiple of memory page size
+ * (and to power of 2 when BUFF_RING_USE_POWER_OF_2_SIZE is enabled)
+ */
+Buff_Bool_DT Buff_Ring_Init_Mirrored(Buff_Ring_XT *buf, Buff_Size_DT size);
+
+/**
+ * @brief Function which deinitializes ring buffer initialized by Buff_Ring_Init_Mirrored and releases its memory.
+ *
+ * @param buf pointer to ring buffer to be deinitialized
+ */
+void   Buff_Ring_Deinit_Mirrored(Buff_Ring_XT *buf);
+#endif
+
+#ifndef BUFF_RING_INIT_FILE_ENABLED
+#define BUFF_RING_INIT_FILE_ENABLED                      BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_RING_INIT_FILE_ENABLED && BUFF_RING_USE_FILE && BUFF_RING_USE_PROTECTED_EXTENSIONS \
+   && (!BUFF_RING_USE_LOCK_FREE_SPSC) && BUFF_RING_INIT_ENABLED && BUFF_RING_DEINIT_ENABLED )
+/**
+ * @brief Function which creates (or truncates) file, maps it and initializes empty ring buffer on it.
+ * After each modification of the buffer its indexes are published to the file header (by protected extension,
+ * so protected extension slot of the buffer is used - user can install only not protected extension).
+ * Buffer initialized by this function must be deinitialized by Buff_Ring_Deinit_File. Its memory is mapped file, so
+ * Buff_Ring_Resize fails for it, buffer doesn't grow automatically and Buff_Ring_Add_Protected_Extension fails for it.
+ *
+ * @result BUFF_TRUE if initialization succeeded, BUFF_FALSE otherwise
+ *
+ * @param buf pointer to buffer to be initialized
+ * @param file pointer to file descriptor structure to be initialized
+ * @param path path of the file
+ * @param size size of buffer memory in bytes (file is bigger by one memory page used by header)
+ */
+Buff_Bool_DT Buff_Ring_Init_File(Buff_Ring_XT *buf, Buff_Ring_File_XT *file, const char *path, Buff_Size_DT size);
+
+/**
+ * @brief Function which maps existing file of file-backed ring buffer (e.g. after crash of the process) and initializes
+ * ring buffer on it with data and indexes last published to the file header.
+ *
+ * @result BUFF_TRUE if buffer has been recovered, BUFF_FALSE otherwise (no file or file content is not valid)
+ *
+ * @param buf pointer to buffer to be initialized
+ * @param file pointer to file descriptor structure to be initialized
+ * @param path path of the file
+ */
+Buff_Bool_DT Buff_Ring_Recover(Buff_Ring_XT *buf, Buff_Ring_File_XT *file, const char *path);
+
+/**
+ * @brief Function which sets policy of synchronization of the file with the disk. msync is called by function which modified
+ * the buffer (inside protection), when number of bytes written since last synchronization reaches the threshold.
+ * Default policy is BUFF_RING_FILE_SYNC_NONE.
+ *
+ * @param file pointer to file descriptor structure
+ * @param sync_mode BUFF_RING_FILE_SYNC_NONE, BUFF_RING_FILE_SYNC_ASYNC or BUFF_RING_FILE_SYNC_SYNC
+ * @param sync_threshold number of written bytes after which msync is called; 0 - msync after each modification
+ */
+void Buff_Ring_File_Set_Sync(Buff_Ring_File_XT *file, uint8_t sync_mode, Buff_Size_DT sync_threshold);
+
+/**
+ * @brief Function which synchronizes whole file with the disk (msync(MS_SYNC)) independently on synchronization policy,
+ * e.g. periodically or before planned shutdown.
+ *
+ * @result BUFF_TRUE if synchronization succeeded, BUFF_FALSE otherwise
+ *
+ * @param buf pointer to buffer initialized by Buff_Ring_Init_File or Buff_Ring_Recover
+ * @param file pointer to file descriptor structure of the buffer
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of synchronization, BUFF_FALSE otherwise
+ */
+Buff_Bool_DT Buff_Ring_File_Sync(Buff_Ring_XT *buf, Buff_Ring_File_XT *file, Buff_Bool_DT use_protection);
+
+/**
+ * @brief Function which deinitializes ring buffer initialized by Buff_Ring_Init_File or Buff_Ring_Recover, synchronizes
+ * the file with the disk and unmaps it. File stays on the disk with content of the buffer.
+ *
+ * @param buf pointer to ring buffer to be deinitialized
+ * @param file pointer to file descriptor structure of the buffer
+ */
+void   Buff_Ring_Deinit_File(Buff_Ring_XT *buf, Buff_Ring_File_XT *file);
+#endif
+
+#ifndef BUFF_RING_INIT_EXTENSION_ENABLED
+#define BUFF_RING_INIT_EXTENSION_ENABLED                 BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_RING_INIT_EXTENSION_ENABLED && BUFF_RING_USE_EXTENSIONS )
+/**
+ * @brief Function which initializes to defaults structure with ring buffer extensions.
+ * Extension is a function which is called after buffer context modification.
+ * There can be: read, write, overwrite and remove extensions. Extensions installed using this function
+ * are called after buffer protection unlock (not protected extensions).
+ *
+ * @param extension pointer to extensions structure to be initialized
+ */
+void Buff_Ring_Init_Extension(Buff_Ring_Extensions_XT *extension);
 #endif
 
 #ifndef BUFF_RING_ADD_EXTENSION_ENABLED
@@ -1333,6 +2573,8 @@ Buff_Bool_DT Buff_Ring_Add_Extension(Buff_Ring_XT *buf, Buff_Ring_Extensions_XT
  * Extension is a function which is called after buffer context modification.
  * There can be: read, write, overwrite and remove extensions. Extensions installed using this function
  * are called before buffer protection unlock (protected extensions).
+ * Protected extension slot of file-backed buffer (initialized by Buff_Ring_Init_File or Buff_Ring_Recover) is used
+ * by the buffer itself, so installation into such buffer fails.
  *
  * @result BUFF_TRUE if installation succeedded, BUFF_FALSE otherwise
  *
@@ -1342,6 +2584,74 @@ Buff_Bool_DT Buff_Ring_Add_Extension(Buff_Ring_XT *buf, Buff_Ring_Extensions_XT
 Buff_Bool_DT Buff_Ring_Add_Protected_Extension(Buff_Ring_XT *buf, Buff_Ring_Extensions_XT *protected_extension);
 #endif
 
+#ifndef BUFF_RING_SET_NON_TEMPORAL_COPY_ENABLED
+#define BUFF_RING_SET_NON_TEMPORAL_COPY_ENABLED          BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_RING_SET_NON_TEMPORAL_COPY_ENABLED && BUFF_RING_USE_NON_TEMPORAL_COPY )
+/**
+ * @brief Function which switches on / off non-temporal copying of data written to ring buffer.
+ * Switched off by default (by Buff_Ring_Init).
+ *
+ * @param buf pointer to ring buffer for which non-temporal copying shall be switched on / off
+ * @param use_non_temporal_copy if BUFF_TRUE then data written to the buffer (at least BUFF_NON_TEMPORAL_COPY_THRESHOLD bytes
+ * at once) is stored bypassing CPU cache, if BUFF_FALSE then BUFF_MEMCPY is always used
+ */
+void Buff_Ring_Set_Non_Temporal_Copy(Buff_Ring_XT *buf, Buff_Bool_DT use_non_temporal_copy);
+#endif
+
+#ifndef BUFF_RING_RESIZE_ENABLED
+#define BUFF_RING_RESIZE_ENABLED                         BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_RING_RESIZE_ENABLED)
+/**
+ * @brief Function which exchanges memory of working ring buffer, without losing data stored in it.
+ * Busy data is copied to the begining of new memory (as one continous area), all indexes and size are updated;
+ * extensions stay attached. Old memory is not used by the buffer after this function returns and can be released by the caller
+ * (if it has been allocated by automatic growing, it is released by Buff_Ring_Memory_Free_HT function).
+ * In BUFF_RING_USE_LOCK_FREE_SPSC mode neither producer nor consumer may access the buffer in same time.
+ * Mirrored buffers (initialized by Buff_Ring_Init_Mirrored) can't be resized, nor buffers with data given to the pipe
+ * by Buff_Ring_Splice_Out which hasn't been released yet by Buff_Ring_Splice_Release, nor file-backed buffers
+ * (initialized by Buff_Ring_Init_File or Buff_Ring_Recover).
+ *
+ * @result BUFF_TRUE if memory has been exchanged, BUFF_FALSE otherwise (new memory too small for busy data)
+ *
+ * @param buf pointer to buffer which memory shall be exchanged
+ * @param memory pointer to new memory; must not overlap current memory of the buffer
+ * @param size size of new memory in bytes; same restrictions as for Buff_Ring_Init apply, must be enough for busy data
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+Buff_Bool_DT Buff_Ring_Resize(Buff_Ring_XT *buf, void *memory, Buff_Size_DT size, Buff_Bool_DT use_protection);
+#endif
+
+#ifndef BUFF_RING_SET_AUTO_GROW_ENABLED
+#define BUFF_RING_SET_AUTO_GROW_ENABLED                  BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_RING_SET_AUTO_GROW_ENABLED && BUFF_RING_USE_AUTO_GROW )
+/**
+ * @brief Function which switches on / off automatic growing of ring buffer. Switched off by default (by Buff_Ring_Init).
+ * When write function finds not enough free space, buffer size is multiplied by growth_factor (as many times as needed,
+ * but not above max_size), new memory is taken from memory_alloc, busy data is moved to it and old memory - if it has been
+ * allocated by memory_alloc - is released by memory_free (memory given to Buff_Ring_Init / Buff_Ring_Resize is never released).
+ * Buff_Ring_Deinit doesn't release memory, so if is_memory_allocated field of the buffer is BUFF_TRUE then memory of the buffer
+ * shall be released by the caller before deinitialization. Buffer doesn't grow as long as it has data given to the pipe
+ * by Buff_Ring_Splice_Out (not released yet) - write functions work then as without automatic growing.
+ * File-backed buffers (initialized by Buff_Ring_Init_File or Buff_Ring_Recover) never grow.
+ *
+ * @param buf pointer to ring buffer for which automatic growing shall be switched on / off
+ * @param memory_alloc function used to allocate new memory; invalid handler switches automatic growing off
+ * @param memory_free function used to release memory allocated by memory_alloc
+ * @param growth_factor factor by which buffer size is multiplied; must be at least 2 (power of 2 when
+ * BUFF_RING_USE_POWER_OF_2_SIZE is enabled)
+ * @param max_size maximal size of buffer memory
+ */
+void Buff_Ring_Set_Auto_Grow(
+   Buff_Ring_XT               *buf,
+   Buff_Ring_Memory_Alloc_HT   memory_alloc,
+   Buff_Ring_Memory_Free_HT    memory_free,
+   Buff_Size_DT                growth_factor,
+   Buff_Size_DT                max_size);
+#endif
+
 #ifndef BUFF_PROTECTION_LOCK_ENABLED
 #define BUFF_PROTECTION_LOCK_ENABLED                     BUFF_DEFAULT_FEATURES_STATE
 #endif
@@ -1378,8 +2688,13 @@ void Buff_Protection_Unlock(Buff_Ring_XT *buf);
  *
  * @param buf pointer to buffer for which state shall be checked
  */
+#if(BUFF_RING_USE_LOCK_FREE_SPSC)
+#define BUFF_RING_IS_EMPTY(buf)        \
+   (BUFF_ATOMIC_LOAD_ACQUIRE(&((buf)->first_free)) == BUFF_ATOMIC_LOAD_ACQUIRE(&((buf)->first_busy)))
+#else
 #define BUFF_RING_IS_EMPTY(buf)        (0 == (buf)->busy_size)
 #endif
+#endif
 
 #ifndef BUFF_RING_IS_EMPTY_ENABLED
 #define BUFF_RING_IS_EMPTY_ENABLED                       BUFF_DEFAULT_FEATURES_STATE
@@ -1404,8 +2719,12 @@ Buff_Bool_DT Buff_Ring_Is_Empty(Buff_Ring_XT *buf, Buff_Bool_DT use_protection);
  *
  * @param buf pointer to buffer for which state shall be checked
  */
+#if(BUFF_RING_USE_LOCK_FREE_SPSC)
+#define BUFF_RING_IS_FULL(buf)         (((buf)->size - 1) == BUFF_RING_GET_BUSY_SIZE(buf))
+#else
 #define BUFF_RING_IS_FULL(buf)         ((buf)->size == (buf)->busy_size)
 #endif
+#endif
 
 #ifndef BUFF_RING_IS_FULL_ENABLED
 #define BUFF_RING_IS_FULL_ENABLED                        BUFF_DEFAULT_FEATURES_STATE
@@ -1430,8 +2749,12 @@ Buff_Bool_DT Buff_Ring_Is_Full(Buff_Ring_XT *buf, Buff_Bool_DT use_protection);
  *
  * @param buf pointer to buffer for which size shall be returned
  */
+#if(BUFF_RING_USE_LOCK_FREE_SPSC)
+#define BUFF_RING_GET_SIZE(buf)        ((buf)->size - 1)
+#else
 #define BUFF_RING_GET_SIZE(buf)        ((buf)->size)
 #endif
+#endif
 
 #ifndef BUFF_RING_GET_SIZE_ENABLED
 #define BUFF_RING_GET_SIZE_ENABLED                       BUFF_DEFAULT_FEATURES_STATE
@@ -1449,6 +2772,22 @@ Buff_Bool_DT Buff_Ring_Is_Full(Buff_Ring_XT *buf, Buff_Bool_DT use_protection);
 Buff_Size_DT Buff_Ring_Get_Size(Buff_Ring_XT *buf, Buff_Bool_DT use_protection);
 #endif
 
+#ifndef BUFF_RING_MODULO_SIZE
+/**
+ * @brief Macro which calculates remainder of division of "value" by size of buffer.
+ *
+ * @result value modulo size of buffer, type of returned data is Buff_Size_DT
+ *
+ * @param buf pointer to buffer
+ * @param value value to be divided
+ */
+#if(BUFF_RING_USE_POWER_OF_2_SIZE)
+#define BUFF_RING_MODULO_SIZE(buf, value)    ((value) & ((buf)->size - 1))
+#else
+#define BUFF_RING_MODULO_SIZE(buf, value)    ((value) % (buf)->size)
+#endif
+#endif
+
 #ifndef BUFF_RING_GET_BUSY_SIZE
 /**
  * @brief Macro which gets busy size of buffer - size of data stored in buffer at this moment.
@@ -1457,8 +2796,13 @@ Buff_Size_DT Buff_Ring_Get_Size(Buff_Ring_XT *buf, Buff_Bool_DT use_protection);
  *
  * @param buf pointer to buffer for which size shall be returned
  */
+#if(BUFF_RING_USE_LOCK_FREE_SPSC)
+#define BUFF_RING_GET_BUSY_SIZE(buf)     \
+   BUFF_RING_MODULO_SIZE(buf, BUFF_ATOMIC_LOAD_ACQUIRE(&((buf)->first_free)) + (buf)->size - BUFF_ATOMIC_LOAD_ACQUIRE(&((buf)->first_busy)))
+#else
 #define BUFF_RING_GET_BUSY_SIZE(buf)     ((buf)->busy_size)
 #endif
+#endif
 
 #ifndef BUFF_RING_GET_BUSY_SIZE_ENABLED
 #define BUFF_RING_GET_BUSY_SIZE_ENABLED                  BUFF_DEFAULT_FEATURES_STATE
@@ -1513,8 +2857,12 @@ Buff_Size_DT Buff_Ring_Get_Max_Busy_Size(Buff_Ring_XT *buf, Buff_Bool_DT use_pro
  *
  * @param buf pointer to buffer for which size shall be returned
  */
+#if(BUFF_RING_USE_LOCK_FREE_SPSC)
+#define BUFF_RING_GET_FREE_SIZE(buf)     ((buf)->size - 1 - BUFF_RING_GET_BUSY_SIZE(buf))
+#else
 #define BUFF_RING_GET_FREE_SIZE(buf)     ((buf)->size - (buf)->busy_size)
 #endif
+#endif
 
 #ifndef BUFF_RING_GET_FREE_SIZE_ENABLED
 #define BUFF_RING_GET_FREE_SIZE_ENABLED                  BUFF_DEFAULT_FEATURES_STATE
@@ -1594,6 +2942,32 @@ void *Buff_Ring_Data_Check_Out(
    Buff_Bool_DT   use_protection);
 #endif
 
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
+/**
+ * @brief Function which gets whole free space of the buffer as 2 linear parts - part just after busy area (up to end of buffer memory)
+ * and part on the begining of buffer memory (second one has size 0 if free space is continous).
+ * In opposite to Buff_Ring_Data_Check_Out, buffer is never resized, so following Buff_Ring_Data_Check_In doesn't need
+ * to de-fragment data. Useful for users which can write scatter-gather (vendor memcpy, DMA, readv).
+ * With BUFF_RING_USE_PADDED_LAYOUT described free space can be smaller than whole free space (but not smaller than size_needed
+ * if there is so much free space) - producer's copy of first_busy is refreshed only if it shows less free space than needed.
+ * Protection is not unlocked by this function - it is done by Buff_Ring_Data_Check_In.
+ *
+ * @result size of free space described by "vector"
+ *
+ * @param buf pointer to buffer for "check out" operation shall be executed
+ * @param vector pointer to 2-cells vector to which description of free space will be stored
+ * @param size_needed size of data which is expected to be stored
+ * @param overwrite_if_no_free_space if BUFF_TRUE then old data will be removed if there isn't enough free space, BUFF_FALSE otherwise
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer on the begining, leaving active when exit. BUFF_FALSE otherwise
+ */
+Buff_Size_DT Buff_Ring_Data_Check_Out_Vector(
+   Buff_Ring_XT                *buf,
+   Buff_Writeable_Vector_XT     vector[2],
+   Buff_Size_DT                 size_needed,
+   Buff_Bool_DT                 overwrite_if_no_free_space,
+   Buff_Bool_DT                 use_protection);
+#endif
+
 #if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
 /**
  * Function used to mark that number of bytes has been stored in ring buffer without using "Write" functions.
@@ -1613,6 +2987,44 @@ void *Buff_Ring_Data_Check_Out(
 Buff_Size_DT Buff_Ring_Data_Check_In(Buff_Ring_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection);
 #endif
 
+#ifndef BUFF_RING_RESERVE_ENABLED
+#define BUFF_RING_RESERVE_ENABLED                        BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_RING_RESERVE_ENABLED && BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_MULTI_PRODUCER)
+/**
+ * @brief Function which atomically reserves space in ring buffer for one of many producers.
+ * Reserved space is described by 2 vector cells (second one has size 0 if reserved space is continous).
+ * After data is stored in reserved space it must be committed by Buff_Ring_Commit - until then consumer doesn't see that data,
+ * nor data of reservations made later by other producers.
+ *
+ * @result position of first byte of reserved space if reservation succeeded, size of buffer or bigger value otherwise
+ * This is offset from begining of buffer memmory which must be later provided to Buff_Ring_Commit.
+ *
+ * @param buf pointer to buffer in which space shall be reserved
+ * @param vector pointer to 2-cells vector to which description of reserved space will be stored
+ * @param size number of bytes to be reserved
+ */
+Buff_Size_DT Buff_Ring_Reserve(Buff_Ring_XT *buf, Buff_Writeable_Vector_XT vector[2], Buff_Size_DT size);
+#endif
+
+#ifndef BUFF_RING_COMMIT_ENABLED
+#define BUFF_RING_COMMIT_ENABLED                         BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_RING_COMMIT_ENABLED && BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_MULTI_PRODUCER)
+/**
+ * @brief Function which commits space reserved by Buff_Ring_Reserve - makes data stored in it visible for consumer.
+ * Commits are published in order of reservations, so function waits (executing BUFF_ATOMIC_CPU_RELAX) until all reservations
+ * made before this one are committed.
+ *
+ * @result BUFF_TRUE if commit succeeded, BUFF_FALSE otherwise
+ *
+ * @param buf pointer to buffer in which space has been reserved
+ * @param pos position returned by Buff_Ring_Reserve
+ * @param size number of bytes reserved (same as provided to Buff_Ring_Reserve)
+ */
+Buff_Bool_DT Buff_Ring_Commit(Buff_Ring_XT *buf, Buff_Size_DT pos, Buff_Size_DT size);
+#endif
+
 #ifndef BUFF_RING_WRITE_ENABLED
 #define BUFF_RING_WRITE_ENABLED                          BUFF_DEFAULT_FEATURES_STATE
 #endif
@@ -1664,6 +3076,32 @@ Buff_Size_DT Buff_Ring_Write_Vendor(
    Buff_Bool_DT            use_protection);
 #endif
 
+#ifndef BUFF_RING_WRITE_CHECKSUM_ENABLED
+#define BUFF_RING_WRITE_CHECKSUM_ENABLED                 BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_RING_WRITE_CHECKSUM_ENABLED && BUFF_RING_WRITE_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS && BUFF_USE_CHECKSUM \
+   && BUFF_MEMCPY_CHECKSUM_ENABLED )
+/**
+ * @brief Function which writes data from linear buffer to ring buffer and adds written data to running checksum.
+ *
+ * @result size of data which has been copied to ring buffer
+ *
+ * @param buf pointer to buffer in which data shall be stored
+ * @param data pointer to linear buffer from which data will be copied
+ * @param size size of data to be copied from linear buffer to ring buffer
+ * @param checksum pointer to running checksum to which copied data will be added
+ * @param overwrite_if_no_free_space if BUFF_TRUE and if there is not enough free space then oldest data will be overwritten
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+Buff_Size_DT Buff_Ring_Write_Checksum(
+   Buff_Ring_XT           *buf,
+   const void             *data,
+   Buff_Size_DT            size,
+   Buff_Checksum_XT       *checksum,
+   Buff_Bool_DT            overwrite_if_no_free_space,
+   Buff_Bool_DT            use_protection);
+#endif
+
 #ifndef BUFF_RING_WRITE_FROM_VECTOR_ENABLED
 #define BUFF_RING_WRITE_FROM_VECTOR_ENABLED              BUFF_DEFAULT_FEATURES_STATE
 #endif
@@ -1701,7 +3139,8 @@ Buff_Size_DT Buff_Ring_Write_From_Vector(
  * @result size of data which has been copied to ring buffer
  *
  * @param buf pointer to buffer in which data shall be stored
- * @param data pointer to tree of linear buffers (Buff_Readable_Tree_XT) of data to be stored in the buffer
+ * @param data pointer to tree of linear buffers (Buff_Readable_Tree_XT) of data to be stored in the buffer;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
  * @param data_num_elems number of elements in data tree root
  * @param size size of data to be copied from tree of linear buffers to ring buffer
  * @param offset_data offset in tree of linear buffers from which data will be copied to ring buffer
@@ -1718,6 +3157,54 @@ Buff_Size_DT Buff_Ring_Write_From_Tree(
    Buff_Bool_DT                  use_protection);
 #endif
 
+#ifndef BUFF_RING_WRITE_FROM_VECTOR_CURSOR_ENABLED
+#define BUFF_RING_WRITE_FROM_VECTOR_CURSOR_ENABLED       BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_RING_WRITE_FROM_VECTOR_CURSOR_ENABLED && BUFF_USE_VECTOR_BUFFERS && BUFF_READABLE_VECTOR_CURSOR_ENABLED )
+/**
+ * @brief Function which writes data from vector of linear buffers, starting from possition of the cursor, to ring buffer
+ * and moves the cursor after written data.
+ *
+ * @result size of data which has been copied to ring buffer
+ *
+ * @param buf pointer to buffer in which data shall be stored
+ * @param cursor pointer to cursor of vector from which data will be copied
+ * @param size size of data to be copied from vector of linear buffers to ring buffer
+ * @param overwrite_if_no_free_space if BUFF_TRUE and if there is not enough free space then oldest data will be overwritten
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+Buff_Size_DT Buff_Ring_Write_From_Vector_Cursor(
+   Buff_Ring_XT                    *buf,
+   Buff_Readable_Vector_Cursor_XT  *cursor,
+   Buff_Size_DT                     size,
+   Buff_Bool_DT                     overwrite_if_no_free_space,
+   Buff_Bool_DT                     use_protection);
+#endif
+
+#ifndef BUFF_RING_WRITE_FROM_TREE_CURSOR_ENABLED
+#define BUFF_RING_WRITE_FROM_TREE_CURSOR_ENABLED         BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_RING_WRITE_FROM_TREE_CURSOR_ENABLED && BUFF_USE_TREE_BUFFERS && BUFF_READABLE_TREE_CURSOR_ENABLED )
+/**
+ * @brief Function which writes data from tree of linear buffers, starting from possition of the cursor, to ring buffer
+ * and moves the cursor after written data.
+ *
+ * @result size of data which has been copied to ring buffer
+ *
+ * @param buf pointer to buffer in which data shall be stored
+ * @param cursor pointer to cursor of tree from which data will be copied
+ * @param size size of data to be copied from tree of linear buffers to ring buffer
+ * @param overwrite_if_no_free_space if BUFF_TRUE and if there is not enough free space then oldest data will be overwritten
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+Buff_Size_DT Buff_Ring_Write_From_Tree_Cursor(
+   Buff_Ring_XT                    *buf,
+   Buff_Readable_Tree_Cursor_XT    *cursor,
+   Buff_Size_DT                     size,
+   Buff_Bool_DT                     overwrite_if_no_free_space,
+   Buff_Bool_DT                     use_protection);
+#endif
+
 #ifndef BUFF_RING_OVERWRITE_IF_EXIST_ENABLED
 #define BUFF_RING_OVERWRITE_IF_EXIST_ENABLED             BUFF_DEFAULT_FEATURES_STATE
 #endif
@@ -1866,7 +3353,8 @@ Buff_Size_DT Buff_Ring_Peak_To_Vector(
  * @result size of data which has been copied from ring buffer
  *
  * @param buf pointer to buffer from which data shall be read
- * @param data pointer to tree of linear buffers (Buff_Writeable_Tree_XT) to which data will be read from ring buffer
+ * @param data pointer to tree of linear buffers (Buff_Writeable_Tree_XT) to which data will be read from ring buffer;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
  * @param data_num_elems number of elements in data tree root
  * @param size size of data to be copied from ring buffer to tree of linear buffers
  * @param offset_data offset in vector of linear buffers to which data will be copied from ring buffer
@@ -1882,6 +3370,65 @@ Buff_Size_DT Buff_Ring_Peak_To_Tree(
    Buff_Bool_DT                  use_protection);
 #endif
 
+#ifndef BUFF_RING_FIND_BYTE_ENABLED
+#define BUFF_RING_FIND_BYTE_ENABLED                      BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_RING_FIND_BYTE_ENABLED)
+/**
+ * @brief Function which searches data stored in ring buffer for given byte, without copying data out of the buffer.
+ * Data is searched in place, also when it is divided into two parts by the end of buffer memory. On x86 / x86-64 processors
+ * data is compared by AVX2 / SSE2 instructions (chosen once, during first call, basing on CPUID).
+ * This function doesn't remove data from ring buffer.
+ *
+ * @result BUFF_TRUE if byte has been found, BUFF_FALSE otherwise
+ *
+ * @param buf pointer to buffer which data shall be searched
+ * @param byte value to be found
+ * @param buf_offset offset of busy data (counted from oldest byte in the buffer) from which search starts;
+ * can be used to skip data which has been already searched
+ * @param pos pointer to variable into which position of found byte will be returned - offset counted from oldest byte
+ * in the buffer, same as buf_offset of Buff_Ring_Peak; not changed if byte has not been found
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of accessing buffer, BUFF_FALSE otherwise
+ */
+Buff_Bool_DT Buff_Ring_Find_Byte(
+   Buff_Ring_XT  *buf,
+   uint8_t        byte,
+   Buff_Size_DT   buf_offset,
+   Buff_Size_DT  *pos,
+   Buff_Bool_DT   use_protection);
+#endif
+
+#ifndef BUFF_RING_FIND_PATTERN_ENABLED
+#define BUFF_RING_FIND_PATTERN_ENABLED                   BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_RING_FIND_PATTERN_ENABLED)
+/**
+ * @brief Function which searches data stored in ring buffer for given sequence of bytes, without copying data out of the buffer.
+ * Data is searched in place; pattern can be also divided into two parts by the end of buffer memory.
+ * On x86 / x86-64 processors candidate positions are found by AVX2 / SSE2 instructions comparing first and last byte
+ * of the pattern at once, only these positions are compared with whole pattern.
+ * This function doesn't remove data from ring buffer.
+ *
+ * @result BUFF_TRUE if pattern has been found, BUFF_FALSE otherwise
+ *
+ * @param buf pointer to buffer which data shall be searched
+ * @param pattern pointer to linear buffer with searched sequence of bytes
+ * @param pattern_size size of pattern; must be bigger than 0
+ * @param buf_offset offset of busy data (counted from oldest byte in the buffer) from which search starts;
+ * can be used to skip data which has been already searched
+ * @param pos pointer to variable into which position of first byte of found pattern will be returned - offset counted
+ * from oldest byte in the buffer, same as buf_offset of Buff_Ring_Peak; not changed if pattern has not been found
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of accessing buffer, BUFF_FALSE otherwise
+ */
+Buff_Bool_DT Buff_Ring_Find_Pattern(
+   Buff_Ring_XT  *buf,
+   const void    *pattern,
+   Buff_Size_DT   pattern_size,
+   Buff_Size_DT   buf_offset,
+   Buff_Size_DT  *pos,
+   Buff_Bool_DT   use_protection);
+#endif
+
 #ifndef BUFF_RING_READ_ENABLED
 #define BUFF_RING_READ_ENABLED                           BUFF_DEFAULT_FEATURES_STATE
 #endif
@@ -1889,6 +3436,7 @@ Buff_Size_DT Buff_Ring_Peak_To_Tree(
 /**
  * @brief Function which reads data from ring buffer to linear buffer.
  * This function removes data from ring buffer after reading.
+ * Nothing is read while data given to a pipe by Buff_Ring_Splice_Out is not released (same for other Buff_Ring_Read* functions).
  *
  * @result size of data which has been copied from ring buffer
  *
@@ -1931,6 +3479,30 @@ Buff_Size_DT Buff_Ring_Read_Vendor(
    Buff_Bool_DT            use_protection);
 #endif
 
+#ifndef BUFF_RING_READ_CHECKSUM_ENABLED
+#define BUFF_RING_READ_CHECKSUM_ENABLED                  BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_RING_READ_CHECKSUM_ENABLED && BUFF_RING_READ_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS && BUFF_USE_CHECKSUM \
+   && BUFF_MEMCPY_CHECKSUM_ENABLED )
+/**
+ * @brief Function which reads data from ring buffer to linear buffer and adds read data to running checksum.
+ *
+ * @result size of data which has been copied from ring buffer
+ *
+ * @param buf pointer to buffer from which data shall be read
+ * @param data pointer to linear buffer to which data will be copied
+ * @param size maximal size of data to be copied from ring buffer to linear buffer
+ * @param checksum pointer to running checksum to which copied data will be added
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+Buff_Size_DT Buff_Ring_Read_Checksum(
+   Buff_Ring_XT           *buf,
+   void                   *data,
+   Buff_Size_DT            size,
+   Buff_Checksum_XT       *checksum,
+   Buff_Bool_DT            use_protection);
+#endif
+
 #ifndef BUFF_RING_READ_TO_VECTOR_ENABLED
 #define BUFF_RING_READ_TO_VECTOR_ENABLED                 BUFF_DEFAULT_FEATURES_STATE
 #endif
@@ -1968,7 +3540,8 @@ Buff_Size_DT Buff_Ring_Read_To_Vector(
  * @result size of data which has been copied from ring buffer
  *
  * @param buf pointer to buffer from which data shall be read
- * @param data pointer to tree of linear buffers (Buff_Writeable_Tree_XT) to which data will be read from ring buffer
+ * @param data pointer to tree of linear buffers (Buff_Writeable_Tree_XT) to which data will be read from ring buffer;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
  * @param data_num_elems number of elements in data tree root
  * @param size size of data to be copied from ring buffer to tree of linear buffers
  * @param offset_data offset in vector of linear buffers to which data will be copied from ring buffer
@@ -1983,63 +3556,953 @@ Buff_Size_DT Buff_Ring_Read_To_Tree(
    Buff_Bool_DT                  use_protection);
 #endif
 
-#ifndef BUFF_RING_TO_RING_COPY_ENABLED
-#define BUFF_RING_TO_RING_COPY_ENABLED                   BUFF_DEFAULT_FEATURES_STATE
+#ifndef BUFF_RING_READ_CHECK_IN_CHECK_OUT_ENABLED
+#define BUFF_RING_READ_CHECK_IN_CHECK_OUT_ENABLED        BUFF_DEFAULT_FEATURES_STATE
 #endif
-#if(BUFF_RING_TO_RING_COPY_ENABLED)
+#if(BUFF_RING_READ_CHECK_IN_CHECK_OUT_ENABLED)
 /**
- * @brief Function which copies data from one ring buffer to another ring buffer/
- * This function doesn't remove data from source buffer after copying.
+ * @brief Function which gets busy area of the buffer as 2 linear parts (second one has size 0 if busy area is continous),
+ * so data can be processed directly in buffer memory, without copying it. Data is not removed from the buffer -
+ * it must be done after processing by Buff_Ring_Read_Check_In.
  *
- * @result size of data which has been copied
+ * @result size of data described by "vector" (0 if buffer is empty)
  *
- * @param dest pointer to ring buffer to which data shall be stored
- * @param src pointer to ring buffer from which data shall be copied
- * @param size size of data to be copied from src ring buffer to dest ring buffer
- * @param src_offset offset from begining of busy space in source buffer from which data shall be copied.
- * If src_offset is biffer than buffer size then data will be copied from the begining of bust space (oldest data)
- * @param overwrite_if_no_free_space if BUFF_TRUE and if there is not enough free space in dest buffer then oldest data will be overwritten
- * @param use_protection if BUFF_TRUE then function will lock access to both buffers for moment of modifying them, BUFF_FALSE otherwise
+ * @param buf pointer to buffer for which "check out" operation shall be executed
+ * @param vector pointer to 2-cells vector to which description of busy area will be stored
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer on the begining, leaving active when exit. BUFF_FALSE otherwise
  */
-Buff_Size_DT Buff_Ring_To_Ring_Copy(
-   Buff_Ring_XT                 *dest,
-   Buff_Ring_XT                 *src,
-   Buff_Size_DT                  size,
-   Buff_Size_DT                  src_offset,
-   Buff_Bool_DT                  overwrite_if_no_free_space,
-   Buff_Bool_DT                  use_protection);
+Buff_Size_DT Buff_Ring_Read_Check_Out(Buff_Ring_XT *buf, Buff_Readable_Vector_XT vector[2], Buff_Bool_DT use_protection);
+
+/**
+ * @brief Function used to remove from the buffer data processed after Buff_Ring_Read_Check_Out.
+ * Read extensions are called same as for Buff_Ring_Read.
+ *
+ * @result size of data which has been removed from the buffer
+ *
+ * @param buf pointer to buffer for which data shall be checked-in
+ * @param size size of data which has been consumed (can be smaller than size returned by Buff_Ring_Read_Check_Out)
+ * @param use_protection if BUFF_TRUE then function will unlock access to the buffer on the exit. BUFF_FALSE otherwise
+ */
+Buff_Size_DT Buff_Ring_Read_Check_In(Buff_Ring_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection);
 #endif
 
-#ifndef BUFF_RING_REMOVE_ENABLED
-#define BUFF_RING_REMOVE_ENABLED                         BUFF_DEFAULT_FEATURES_STATE
+#ifndef BUFF_RING_WRITE_FROM_FD_ENABLED
+#define BUFF_RING_WRITE_FROM_FD_ENABLED                  BUFF_DEFAULT_FEATURES_STATE
 #endif
-#if(BUFF_RING_REMOVE_ENABLED)
+#if( BUFF_RING_WRITE_FROM_FD_ENABLED && BUFF_RING_USE_FD_IO && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED )
 /**
- * @brief Function which remove specific number of bytes from ring buffer.
+ * @brief Function which reads data from file descriptor directly to free space of ring buffer, by single readv call
+ * (free space is checked-out as 2 parts by Buff_Ring_Data_Check_Out_Vector and checked-in after reading).
+ * Write extensions are called same as for Buff_Ring_Write. Interrupted call (EINTR) is repeated.
+ * Buffer is locked for time of readv call, so non-blocking file descriptor should be used.
  *
- * @result number of bytes which has been removed from ring buffer.
+ * @result size of data which has been read from file descriptor to the buffer; can be smaller than size (partial read).
+ * 0 with *error set to 0, when there was free space in the buffer, means end of file.
  *
- * @param buf pointer to buffer from which data shall be removed
- * @param size number of bytes to be removed from ring buffer. If this value is bigger than busy size of the buffer then
- * ring buffer will be cleared (there will be remove all the data stored in it).
+ * @param buf pointer to buffer in which data shall be stored
+ * @param fd file descriptor from which data shall be read
+ * @param size maximal size of data to be read
+ * @param error pointer to variable to which 0 or errno of failed readv (for example EAGAIN) is stored; can be invalid pointer
  * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
  */
-Buff_Size_DT Buff_Ring_Remove(Buff_Ring_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection);
+Buff_Size_DT Buff_Ring_Write_From_Fd(
+   Buff_Ring_XT  *buf,
+   int            fd,
+   Buff_Size_DT   size,
+   int           *error,
+   Buff_Bool_DT   use_protection);
 #endif
 
-#ifndef BUFF_RING_CLEAR_ENABLED
-#define BUFF_RING_CLEAR_ENABLED                          BUFF_DEFAULT_FEATURES_STATE
+#ifndef BUFF_RING_READ_TO_FD_ENABLED
+#define BUFF_RING_READ_TO_FD_ENABLED                     BUFF_DEFAULT_FEATURES_STATE
 #endif
-#if(BUFF_RING_CLEAR_ENABLED)
+#if( BUFF_RING_READ_TO_FD_ENABLED && BUFF_RING_USE_FD_IO && BUFF_RING_READ_CHECK_IN_CHECK_OUT_ENABLED )
 /**
- * @brief Function which removed all the data stored in ring buffer.
+ * @brief Function which writes data from ring buffer directly to file descriptor, by single writev call
+ * (busy area is checked-out as 2 parts by Buff_Ring_Read_Check_Out), and removes written data from the buffer.
+ * Read extensions are called same as for Buff_Ring_Read. Interrupted call (EINTR) is repeated.
+ * Buffer is locked for time of writev call, so non-blocking file descriptor should be used.
  *
- * @param buf pointer to buffer which shall be cleared
+ * @result size of data which has been written to file descriptor and removed from the buffer;
+ * can be smaller than size (partial write) - rest of data stays in the buffer
+ *
+ * @param buf pointer to buffer from which data shall be read
+ * @param fd file descriptor to which data shall be written
+ * @param size maximal size of data to be written
+ * @param error pointer to variable to which 0 or errno of failed writev (for example EAGAIN) is stored; can be invalid pointer
  * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
  */
-void Buff_Ring_Clear(Buff_Ring_XT *buf, Buff_Bool_DT use_protection);
+Buff_Size_DT Buff_Ring_Read_To_Fd(
+   Buff_Ring_XT  *buf,
+   int            fd,
+   Buff_Size_DT   size,
+   int           *error,
+   Buff_Bool_DT   use_protection);
 #endif
-#endif /* #if(BUFF_USE_RING_BUFFERS) */
+
+#ifndef BUFF_RING_SPLICE_OUT_ENABLED
+#define BUFF_RING_SPLICE_OUT_ENABLED                     BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_RING_SPLICE_OUT_ENABLED && BUFF_RING_USE_SPLICE && BUFF_RING_READ_CHECK_IN_CHECK_OUT_ENABLED )
+/**
+ * @brief Function which gives data of ring buffer to a pipe by single vmsplice call, without copying - pipe references
+ * pages of buffer memory. Data is not removed from the buffer: consecutive calls give next data (after already spliced one)
+ * and spliced data must be removed by Buff_Ring_Splice_Release only when it has been consumed from the pipe
+ * (e.g. moved to file / socket by splice), so memory isn't reused before the kernel releases it.
+ * As long as some data is spliced, Buff_Ring_Read* / Buff_Ring_Remove / Buff_Ring_Clear / Buff_Ring_Read_Record fail
+ * (nothing is read nor removed), old data is not overwritten by writes with overwrite_if_no_free_space
+ * and buffer must not be resized.
+ * Pipe is written in non-blocking mode (SPLICE_F_NONBLOCK) because buffer is locked for time of vmsplice call.
+ *
+ * @result size of data which has been given to the pipe; can be smaller than size (pipe full)
+ *
+ * @param buf pointer to buffer from which data shall be spliced
+ * @param pipe_fd write end of the pipe
+ * @param size maximal size of data to be spliced
+ * @param error pointer to variable to which 0 or errno of failed vmsplice (for example EAGAIN) is stored; can be invalid pointer
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+Buff_Size_DT Buff_Ring_Splice_Out(
+   Buff_Ring_XT  *buf,
+   int            pipe_fd,
+   Buff_Size_DT   size,
+   int           *error,
+   Buff_Bool_DT   use_protection);
+
+/**
+ * @brief Function which removes from the buffer data given to the pipe by Buff_Ring_Splice_Out, after it has been consumed
+ * from the pipe. Read extensions are called same as for Buff_Ring_Read.
+ *
+ * @result size of data which has been removed from the buffer (limited to size of spliced data)
+ *
+ * @param buf pointer to buffer from which spliced data shall be removed
+ * @param size size of data consumed from the pipe
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+Buff_Size_DT Buff_Ring_Splice_Release(Buff_Ring_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection);
+#endif
+
+#ifndef BUFF_RING_SPLICE_IN_ENABLED
+#define BUFF_RING_SPLICE_IN_ENABLED                      BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_RING_SPLICE_IN_ENABLED && BUFF_RING_USE_SPLICE && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED )
+/**
+ * @brief Function which moves data from a pipe directly to free space of ring buffer by single vmsplice call
+ * (free space is checked-out as 2 parts by Buff_Ring_Data_Check_Out_Vector and checked-in after reading).
+ * Write extensions are called same as for Buff_Ring_Write. Pipe is read in non-blocking mode (SPLICE_F_NONBLOCK).
+ *
+ * @result size of data which has been moved from the pipe to the buffer; 0 with *error set to 0,
+ * when there was free space in the buffer, means that write end of the pipe has been closed
+ *
+ * @param buf pointer to buffer in which data shall be stored
+ * @param pipe_fd read end of the pipe
+ * @param size maximal size of data to be moved
+ * @param error pointer to variable to which 0 or errno of failed vmsplice (for example EAGAIN) is stored; can be invalid pointer
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+Buff_Size_DT Buff_Ring_Splice_In(
+   Buff_Ring_XT  *buf,
+   int            pipe_fd,
+   Buff_Size_DT   size,
+   int           *error,
+   Buff_Bool_DT   use_protection);
+#endif
+
+#ifndef BUFF_RING_URING_ENABLED
+#define BUFF_RING_URING_ENABLED                          BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_RING_URING_ENABLED && BUFF_RING_USE_IO_URING && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED )
+/**
+ * @brief Function which creates io_uring instance used to feed ring buffers and maps its queues.
+ *
+ * @result BUFF_TRUE if initialization succeeded, BUFF_FALSE otherwise (errno describes the reason, e.g. ENOSYS)
+ *
+ * @param uring pointer to io_uring descriptor to be initialized
+ * @param num_entries maximal number of read requests posted in the same time (rounded up by kernel to power of 2)
+ */
+Buff_Bool_DT Buff_Ring_Uring_Init(Buff_Ring_Uring_XT *uring, Buff_Num_Elems_DT num_entries);
+
+/**
+ * @brief Function which releases io_uring instance. Read requests which are still posted are cancelled by the kernel,
+ * so memory of fed buffers shall not be released before all posted requests are completed.
+ *
+ * @param uring pointer to io_uring descriptor to be released
+ */
+void Buff_Ring_Uring_Deinit(Buff_Ring_Uring_XT *uring);
+
+/**
+ * @brief Function which initializes feed - connection between file descriptor and ring buffer.
+ * While read request is posted, kernel writes to free space of the buffer, so fed buffer can be only read / removed /
+ * cleared by consumer (what gives free space for next request). Other producers see it as full: Buff_Ring_Write*,
+ * Buff_Ring_Data_Check_Out* and Buff_Ring_To_Ring_Copy store nothing (also when overwriting is requested),
+ * and Buff_Ring_Resize / auto-grow fail. Emptied buffer keeps its positions as long as read request is posted,
+ * so data is checked-in exactly where the kernel has written it. In lock-free SPSC mode writes are not rejected -
+ * if buffer has been written anyway, completed data is dropped and feed is finished with error EIO.
+ *
+ * @param feed pointer to feed to be initialized
+ * @param buf pointer to buffer in which data shall be stored
+ * @param fd file descriptor from which data shall be read
+ * @param size maximal size of data read by one request
+ * @param use_protection if BUFF_TRUE then buffer will be locked for moment of checking-out / checking-in data, BUFF_FALSE otherwise
+ */
+void Buff_Ring_Uring_Feed_Init(
+   Buff_Ring_Uring_Feed_XT *feed,
+   Buff_Ring_XT            *buf,
+   int                      fd,
+   Buff_Size_DT             size,
+   Buff_Bool_DT             use_protection);
+
+/**
+ * @brief Function which feeds ring buffers by io_uring. Posts read request to continous part of free space of each feed
+ * which has no posted request (if there is free space and feed is not finished), submits all of them
+ * and waits for completions by one io_uring_enter call, and next checks-in all completed reads by Buff_Ring_Data_Check_In,
+ * so write extensions are called same as for Buff_Ring_Write. Data is never copied by user space.
+ *
+ * @result number of completed requests processed by this call
+ *
+ * @param uring pointer to io_uring descriptor
+ * @param feeds table of feeds; the same feeds must be given to consecutive calls as long as they have posted requests
+ * @param feeds_num_elems number of feeds
+ * @param min_complete number of completions to wait for (limited to number of posted requests); 0 - don't wait
+ * @param error pointer to variable to which 0 or errno of failed io_uring_enter is stored; can be invalid pointer
+ */
+Buff_Num_Elems_DT Buff_Ring_Uring_Process(
+   Buff_Ring_Uring_XT      *uring,
+   Buff_Ring_Uring_Feed_XT *feeds,
+   Buff_Num_Elems_DT        feeds_num_elems,
+   Buff_Num_Elems_DT        min_complete,
+   int                     *error);
+#endif
+
+#ifndef BUFF_RING_TO_RING_COPY_ENABLED
+#define BUFF_RING_TO_RING_COPY_ENABLED                   BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_RING_TO_RING_COPY_ENABLED)
+/**
+ * @brief Function which copies data from one ring buffer to another ring buffer/
+ * This function doesn't remove data from source buffer after copying.
+ *
+ * @result size of data which has been copied
+ *
+ * @param dest pointer to ring buffer to which data shall be stored
+ * @param src pointer to ring buffer from which data shall be copied
+ * @param size size of data to be copied from src ring buffer to dest ring buffer
+ * @param src_offset offset from begining of busy space in source buffer from which data shall be copied.
+ * If src_offset is biffer than buffer size then data will be copied from the begining of bust space (oldest data)
+ * @param overwrite_if_no_free_space if BUFF_TRUE and if there is not enough free space in dest buffer then oldest data will be overwritten
+ * @param use_protection if BUFF_TRUE then function will lock access to both buffers for moment of modifying them, BUFF_FALSE otherwise
+ */
+Buff_Size_DT Buff_Ring_To_Ring_Copy(
+   Buff_Ring_XT                 *dest,
+   Buff_Ring_XT                 *src,
+   Buff_Size_DT                  size,
+   Buff_Size_DT                  src_offset,
+   Buff_Bool_DT                  overwrite_if_no_free_space,
+   Buff_Bool_DT                  use_protection);
+#endif
+
+#ifndef BUFF_RING_REMOVE_ENABLED
+#define BUFF_RING_REMOVE_ENABLED                         BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_RING_REMOVE_ENABLED)
+/**
+ * @brief Function which remove specific number of bytes from ring buffer.
+ * Nothing is removed while data given to a pipe by Buff_Ring_Splice_Out is not released.
+ *
+ * @result number of bytes which has been removed from ring buffer.
+ *
+ * @param buf pointer to buffer from which data shall be removed
+ * @param size number of bytes to be removed from ring buffer. If this value is bigger than busy size of the buffer then
+ * ring buffer will be cleared (there will be remove all the data stored in it).
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+Buff_Size_DT Buff_Ring_Remove(Buff_Ring_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection);
+#endif
+
+#ifndef BUFF_RING_CLEAR_ENABLED
+#define BUFF_RING_CLEAR_ENABLED                          BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_RING_CLEAR_ENABLED)
+/**
+ * @brief Function which removed all the data stored in ring buffer.
+ * Buffer is not cleared while data given to a pipe by Buff_Ring_Splice_Out is not released.
+ *
+ * @param buf pointer to buffer which shall be cleared
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+void Buff_Ring_Clear(Buff_Ring_XT *buf, Buff_Bool_DT use_protection);
+#endif
+
+#ifndef BUFF_RING_WRITE_RECORD_ENABLED
+#define BUFF_RING_WRITE_RECORD_ENABLED                   BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_RING_WRITE_RECORD_ENABLED && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && BUFF_COPY_TO_VECTOR_ENABLED && BUFF_USE_VECTOR_BUFFERS )
+/**
+ * @brief Function which writes record (message) from linear buffer to ring buffer.
+ * Record is stored as its size (Buff_Size_DT, native byte order) followed by record data; header and data are written
+ * under one lock, together or not at all - on_write extensions are called once per record, with size of header and data.
+ * Ring buffer used with Buff_Ring_*_Record functions must contain only records.
+ * If overwrite_if_no_free_space is BUFF_TRUE then oldest records are removed as a whole, never part of them.
+ *
+ * @result BUFF_TRUE if whole record has been stored in the buffer, BUFF_FALSE otherwise
+ *
+ * @param buf pointer to buffer in which record shall be stored
+ * @param data pointer to linear buffer with record data
+ * @param size size of record data (without header)
+ * @param overwrite_if_no_free_space if BUFF_TRUE and if there is not enough free space then oldest records will be removed
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+Buff_Bool_DT Buff_Ring_Write_Record(
+   Buff_Ring_XT  *buf,
+   const void    *data,
+   Buff_Size_DT   size,
+   Buff_Bool_DT   overwrite_if_no_free_space,
+   Buff_Bool_DT   use_protection);
+#endif
+
+#ifndef BUFF_RING_WRITE_RECORD_FROM_VECTOR_ENABLED
+#define BUFF_RING_WRITE_RECORD_FROM_VECTOR_ENABLED       BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_RING_WRITE_RECORD_FROM_VECTOR_ENABLED && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && BUFF_COPY_TO_VECTOR_ENABLED \
+   && BUFF_COPY_VECTOR_TO_VECTOR_ENABLED && BUFF_GET_READABLE_VECTOR_DATA_SIZE_ENABLED && BUFF_USE_VECTOR_BUFFERS )
+/**
+ * @brief Function which writes record (message) from vector of linear buffers (Buff_Readable_Vector_XT) to ring buffer.
+ * Works like Buff_Ring_Write_Record; record is not written if vector contains less than size bytes after offset_data.
+ *
+ * @result BUFF_TRUE if whole record has been stored in the buffer, BUFF_FALSE otherwise
+ *
+ * @param buf pointer to buffer in which record shall be stored
+ * @param data pointer to vector of linear buffers (Buff_Readable_Vector_XT) with record data
+ * @param data_num_elems number of data vector elements (independent linear buffers which create vector data)
+ * @param size size of record data (without header)
+ * @param offset_data offset in vector of linear buffers from which record data starts
+ * @param overwrite_if_no_free_space if BUFF_TRUE and if there is not enough free space then oldest records will be removed
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+Buff_Bool_DT Buff_Ring_Write_Record_From_Vector(
+   Buff_Ring_XT                    *buf,
+   const Buff_Readable_Vector_XT   *data,
+   Buff_Num_Elems_DT                data_num_elems,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_data,
+   Buff_Bool_DT                     overwrite_if_no_free_space,
+   Buff_Bool_DT                     use_protection);
+#endif
+
+#ifndef BUFF_RING_WRITE_RECORD_FROM_TREE_ENABLED
+#define BUFF_RING_WRITE_RECORD_FROM_TREE_ENABLED         BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_RING_WRITE_RECORD_FROM_TREE_ENABLED && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && BUFF_COPY_TO_VECTOR_ENABLED \
+   && BUFF_COPY_TREE_TO_TREE_ENABLED && BUFF_GET_READABLE_TREE_DATA_SIZE_ENABLED && BUFF_USE_VECTOR_BUFFERS && BUFF_USE_TREE_BUFFERS )
+/**
+ * @brief Function which writes record (message) from tree of linear buffers (Buff_Readable_Tree_XT) to ring buffer.
+ * Works like Buff_Ring_Write_Record; record is not written if tree contains less than size bytes after offset_data.
+ *
+ * @result BUFF_TRUE if whole record has been stored in the buffer, BUFF_FALSE otherwise
+ *
+ * @param buf pointer to buffer in which record shall be stored
+ * @param data pointer to tree of linear buffers (Buff_Readable_Tree_XT) with record data;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
+ * @param data_num_elems number of elements in data tree root
+ * @param size size of record data (without header)
+ * @param offset_data offset in tree of linear buffers from which record data starts
+ * @param overwrite_if_no_free_space if BUFF_TRUE and if there is not enough free space then oldest records will be removed
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+Buff_Bool_DT Buff_Ring_Write_Record_From_Tree(
+   Buff_Ring_XT                 *buf,
+   const Buff_Readable_Tree_XT  *data,
+   Buff_Num_Elems_DT             data_num_elems,
+   Buff_Size_DT                  size,
+   Buff_Size_DT                  offset_data,
+   Buff_Bool_DT                  overwrite_if_no_free_space,
+   Buff_Bool_DT                  use_protection);
+#endif
+
+#ifndef BUFF_RING_PEAK_RECORD_ENABLED
+#define BUFF_RING_PEAK_RECORD_ENABLED                    BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_RING_PEAK_RECORD_ENABLED && BUFF_RING_PEAK_ENABLED )
+/**
+ * @brief Function which reads oldest record (message) from ring buffer to linear buffer.
+ * This function doesn't remove record from ring buffer after reading.
+ * Record which has not been completely written yet (possible only in BUFF_RING_USE_LOCK_FREE_SPSC mode) is not visible.
+ *
+ * @result BUFF_TRUE if record has been copied to data, BUFF_FALSE if there is no record in the buffer
+ * or if record is bigger than size
+ *
+ * @param buf pointer to buffer from which record shall be read
+ * @param data pointer to linear buffer to which record data shall be copied; can be NULL if size is 0
+ * @param size size of linear buffer
+ * @param record_size pointer to variable into which size of oldest record is returned, also if it doesn't fit into data;
+ * not changed if there is no record in the buffer
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of accessing buffer, BUFF_FALSE otherwise
+ */
+Buff_Bool_DT Buff_Ring_Peak_Record(
+   Buff_Ring_XT  *buf,
+   void          *data,
+   Buff_Size_DT   size,
+   Buff_Size_DT  *record_size,
+   Buff_Bool_DT   use_protection);
+#endif
+
+#ifndef BUFF_RING_READ_RECORD_ENABLED
+#define BUFF_RING_READ_RECORD_ENABLED                    BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_RING_READ_RECORD_ENABLED && BUFF_RING_PEAK_ENABLED && BUFF_RING_REMOVE_ENABLED )
+/**
+ * @brief Function which reads oldest record (message) from ring buffer to linear buffer and removes it from the buffer.
+ * Record which doesn't fit into data stays in the buffer. Record which has not been completely written yet
+ * (possible only in BUFF_RING_USE_LOCK_FREE_SPSC mode) is not visible.
+ *
+ * @result BUFF_TRUE if record has been copied to data and removed from the buffer, BUFF_FALSE if there is no record
+ * in the buffer or if record is bigger than size
+ *
+ * @param buf pointer to buffer from which record shall be read
+ * @param data pointer to linear buffer to which record data shall be copied; can be NULL if size is 0
+ * @param size size of linear buffer
+ * @param record_size pointer to variable into which size of oldest record is returned, also if it doesn't fit into data;
+ * not changed if there is no record in the buffer
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+Buff_Bool_DT Buff_Ring_Read_Record(
+   Buff_Ring_XT  *buf,
+   void          *data,
+   Buff_Size_DT   size,
+   Buff_Size_DT  *record_size,
+   Buff_Bool_DT   use_protection);
+#endif
+#endif /* #if(BUFF_USE_RING_BUFFERS) */
+
+
+
+#if(BUFF_USE_BIP_BUFFERS && BUFF_USE_RING_BUFFERS)
+
+#ifndef BUFF_BIP_INIT_ENABLED
+#define BUFF_BIP_INIT_ENABLED                            BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_BIP_INIT_ENABLED && BUFF_RING_INIT_ENABLED )
+/**
+ * @brief Function which initializes bip-buffer - sets all internal pointers and indexes properly to be able to operate on buffer.
+ *
+ * @result BUFF_TRUE if initialization succeeded, BUFF_FALSE otherwise
+ *
+ * @param buf pointer to buffer to be initialized
+ * @param memory pointer to RAM memory on which buffer will operate (store data and read from)
+ * @param size size of memory in bytes; same restrictions as for Buff_Ring_Init apply
+ */
+Buff_Bool_DT Buff_Bip_Init(Buff_Bip_XT *buf, void *memory, Buff_Size_DT size);
+#endif
+
+#ifndef BUFF_BIP_DEINIT_ENABLED
+#define BUFF_BIP_DEINIT_ENABLED                          BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_BIP_DEINIT_ENABLED && BUFF_RING_DEINIT_ENABLED )
+/**
+ * @brief Function which deinitializes bip-buffer - sets all internal pointers to invalid,
+ * so no more operations will be allowed on the buffer.
+ *
+ * @param buf pointer to bip-buffer to be deinitialized
+ */
+void   Buff_Bip_Deinit(Buff_Bip_XT *buf);
+#endif
+
+#ifndef BUFF_BIP_GET_BUSY_SIZE_ENABLED
+#define BUFF_BIP_GET_BUSY_SIZE_ENABLED                   BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_BIP_GET_BUSY_SIZE_ENABLED)
+/**
+ * @brief Function which returns size of data stored in bip-buffer (in both regions).
+ *
+ * @result size of committed and not decommitted data
+ *
+ * @param buf pointer to buffer which parameter shall be returned
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of accessing buffer, BUFF_FALSE otherwise
+ */
+Buff_Size_DT Buff_Bip_Get_Busy_Size(Buff_Bip_XT *buf, Buff_Bool_DT use_protection);
+#endif
+
+#ifndef BUFF_BIP_RESERVE_ENABLED
+#define BUFF_BIP_RESERVE_ENABLED                         BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_BIP_RESERVE_ENABLED)
+/**
+ * @brief Function which reserves contiguous area of free space in bip-buffer, to be filled by user (for example by DMA).
+ * Area is taken just after region A or, if there is not enough space there, from the begining of memory (region B).
+ * If region A is empty, it is moved to the begining of memory first, so region B is started only behind not empty region A.
+ * Data written to reserved area becomes visible for reader after Buff_Bip_Commit. Only one area can be reserved
+ * in same time - next reservation replaces previous one (which is not committed).
+ *
+ * @result pointer to reserved area or invalid pointer if there is no contiguous free space of requested size
+ *
+ * @param buf pointer to buffer in which space shall be reserved
+ * @param size size of area to be reserved; must be bigger than 0
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+void *Buff_Bip_Reserve(Buff_Bip_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection);
+#endif
+
+#ifndef BUFF_BIP_COMMIT_ENABLED
+#define BUFF_BIP_COMMIT_ENABLED                          BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_BIP_COMMIT_ENABLED)
+/**
+ * @brief Function which makes data written to area reserved by Buff_Bip_Reserve visible for reader.
+ * Rest of reserved area (if size is less than reserved size) is released; size 0 cancels reservation.
+ *
+ * @result BUFF_TRUE if reservation has been committed, BUFF_FALSE if there is no reservation or size is bigger than reserved size
+ *
+ * @param buf pointer to buffer in which data shall be committed
+ * @param size size of data written to reserved area, counted from its begining
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+Buff_Bool_DT Buff_Bip_Commit(Buff_Bip_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection);
+#endif
+
+#ifndef BUFF_BIP_READ_ENABLED
+#define BUFF_BIP_READ_ENABLED                            BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_BIP_READ_ENABLED)
+/**
+ * @brief Function which returns oldest contiguous area of committed data (whole region A). Data is not removed from the buffer -
+ * it stays valid and unchanged until it is released by Buff_Bip_Decommit.
+ *
+ * @result pointer to oldest committed data or invalid pointer if buffer is empty
+ *
+ * @param buf pointer to buffer from which data shall be read
+ * @param size pointer to variable into which size of returned area will be written (0 if buffer is empty)
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of accessing buffer, BUFF_FALSE otherwise
+ */
+const void *Buff_Bip_Read(Buff_Bip_XT *buf, Buff_Size_DT *size, Buff_Bool_DT use_protection);
+#endif
+
+#ifndef BUFF_BIP_DECOMMIT_ENABLED
+#define BUFF_BIP_DECOMMIT_ENABLED                        BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_BIP_DECOMMIT_ENABLED)
+/**
+ * @brief Function which releases oldest committed data, previously returned by Buff_Bip_Read.
+ * When whole region A is released, reading switches to region B.
+ *
+ * @result BUFF_TRUE if data has been released, BUFF_FALSE if size is bigger than area returned by Buff_Bip_Read
+ *
+ * @param buf pointer to buffer from which data shall be released
+ * @param size size of data to be released; must not be bigger than size returned by Buff_Bip_Read
+ * @param use_protection if BUFF_TRUE then function will lock access to the buffer for moment of modifying buffer, BUFF_FALSE otherwise
+ */
+Buff_Bool_DT Buff_Bip_Decommit(Buff_Bip_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection);
+#endif
+
+#endif /* #if(BUFF_USE_BIP_BUFFERS && BUFF_USE_RING_BUFFERS) */
+
+
+
+#if(BUFF_USE_POOL_BUFFERS && BUFF_USE_RING_BUFFERS)
+
+#ifndef BUFF_POOL_INIT_ENABLED
+#define BUFF_POOL_INIT_ENABLED                           BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_POOL_INIT_ENABLED && BUFF_RING_INIT_ENABLED )
+/**
+ * @brief Function which initializes slot pool - sets all internal pointers and indexes properly to be able to operate on it.
+ *
+ * @result BUFF_TRUE if initialization succeeded, BUFF_FALSE otherwise
+ *
+ * @param buf pointer to pool to be initialized
+ * @param memory pointer to RAM memory on which pool will operate; must have at least slot_size * num_slots bytes
+ * and should be aligned properly for type of elements stored in slots
+ * @param slot_size size of one slot in bytes; must be bigger than 0
+ * @param num_slots number of slots; must be bigger than 0. When BUFF_RING_USE_POWER_OF_2_SIZE is enabled,
+ * slot_size * num_slots must be power of 2
+ */
+Buff_Bool_DT Buff_Pool_Init(Buff_Pool_XT *buf, void *memory, Buff_Size_DT slot_size, Buff_Size_DT num_slots);
+#endif
+
+#ifndef BUFF_POOL_DEINIT_ENABLED
+#define BUFF_POOL_DEINIT_ENABLED                         BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_POOL_DEINIT_ENABLED && BUFF_RING_DEINIT_ENABLED )
+/**
+ * @brief Function which deinitializes slot pool - sets all internal pointers to invalid,
+ * so no more operations will be allowed on the pool.
+ *
+ * @param buf pointer to pool to be deinitialized
+ */
+void   Buff_Pool_Deinit(Buff_Pool_XT *buf);
+#endif
+
+#ifndef BUFF_POOL_GET_BUSY_SLOTS_ENABLED
+#define BUFF_POOL_GET_BUSY_SLOTS_ENABLED                 BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_POOL_GET_BUSY_SLOTS_ENABLED)
+/**
+ * @brief Function which returns number of slots stored in the pool (committed and not released).
+ *
+ * @result number of busy slots
+ *
+ * @param buf pointer to pool which parameter shall be returned
+ * @param use_protection if BUFF_TRUE then function will lock access to the pool for moment of accessing it, BUFF_FALSE otherwise
+ */
+Buff_Size_DT Buff_Pool_Get_Busy_Slots(Buff_Pool_XT *buf, Buff_Bool_DT use_protection);
+#endif
+
+#ifndef BUFF_POOL_GET_FREE_SLOTS_ENABLED
+#define BUFF_POOL_GET_FREE_SLOTS_ENABLED                 BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_POOL_GET_FREE_SLOTS_ENABLED)
+/**
+ * @brief Function which returns number of free slots in the pool.
+ *
+ * @result number of free slots
+ *
+ * @param buf pointer to pool which parameter shall be returned
+ * @param use_protection if BUFF_TRUE then function will lock access to the pool for moment of accessing it, BUFF_FALSE otherwise
+ */
+Buff_Size_DT Buff_Pool_Get_Free_Slots(Buff_Pool_XT *buf, Buff_Bool_DT use_protection);
+#endif
+
+#ifndef BUFF_POOL_ACQUIRE_ENABLED
+#define BUFF_POOL_ACQUIRE_ENABLED                        BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_POOL_ACQUIRE_ENABLED)
+/**
+ * @brief Function which returns pointer to next free slot, to be filled directly by user.
+ * Slot is added to the queue by Buff_Pool_Commit. Calling this function again before Buff_Pool_Commit returns same slot.
+ * Buff_Pool_Write fails until acquired slot is committed.
+ *
+ * @result pointer to free slot or invalid pointer if pool is full
+ *
+ * @param buf pointer to pool from which slot shall be acquired
+ * @param use_protection if BUFF_TRUE then function will lock access to the pool for moment of modifying it, BUFF_FALSE otherwise
+ */
+void *Buff_Pool_Acquire(Buff_Pool_XT *buf, Buff_Bool_DT use_protection);
+#endif
+
+#ifndef BUFF_POOL_COMMIT_ENABLED
+#define BUFF_POOL_COMMIT_ENABLED                         BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_POOL_COMMIT_ENABLED)
+/**
+ * @brief Function which adds slot acquired by Buff_Pool_Acquire to the end of the queue.
+ *
+ * @result BUFF_TRUE if slot has been added, BUFF_FALSE if no slot has been acquired
+ *
+ * @param buf pointer to pool to which slot shall be added
+ * @param use_protection if BUFF_TRUE then function will lock access to the pool for moment of modifying it, BUFF_FALSE otherwise
+ */
+Buff_Bool_DT Buff_Pool_Commit(Buff_Pool_XT *buf, Buff_Bool_DT use_protection);
+#endif
+
+#ifndef BUFF_POOL_PEAK_ENABLED
+#define BUFF_POOL_PEAK_ENABLED                           BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_POOL_PEAK_ENABLED)
+/**
+ * @brief Function which returns pointer to oldest slot in the queue. Slot stays in the queue until Buff_Pool_Release is called.
+ *
+ * @result pointer to oldest slot or invalid pointer if pool is empty
+ *
+ * @param buf pointer to pool from which slot shall be returned
+ * @param use_protection if BUFF_TRUE then function will lock access to the pool for moment of accessing it, BUFF_FALSE otherwise
+ */
+void *Buff_Pool_Peak(Buff_Pool_XT *buf, Buff_Bool_DT use_protection);
+#endif
+
+#ifndef BUFF_POOL_RELEASE_ENABLED
+#define BUFF_POOL_RELEASE_ENABLED                        BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_POOL_RELEASE_ENABLED)
+/**
+ * @brief Function which removes oldest slot from the queue - slot becomes free.
+ *
+ * @result BUFF_TRUE if slot has been removed, BUFF_FALSE if pool is empty
+ *
+ * @param buf pointer to pool from which slot shall be removed
+ * @param use_protection if BUFF_TRUE then function will lock access to the pool for moment of modifying it, BUFF_FALSE otherwise
+ */
+Buff_Bool_DT Buff_Pool_Release(Buff_Pool_XT *buf, Buff_Bool_DT use_protection);
+#endif
+
+#ifndef BUFF_POOL_WRITE_ENABLED
+#define BUFF_POOL_WRITE_ENABLED                          BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_POOL_WRITE_ENABLED)
+/**
+ * @brief Function which copies one element (slot_size bytes) to free slot and adds it to the end of the queue.
+ * Element is not added while slot acquired by Buff_Pool_Acquire is not committed yet - it would overwrite that slot.
+ *
+ * @result BUFF_TRUE if element has been added, BUFF_FALSE if pool is full or slot is acquired
+ *
+ * @param buf pointer to pool to which element shall be added
+ * @param data pointer to element to be copied; must have slot_size bytes
+ * @param use_protection if BUFF_TRUE then function will lock access to the pool for moment of modifying it, BUFF_FALSE otherwise
+ */
+Buff_Bool_DT Buff_Pool_Write(Buff_Pool_XT *buf, const void *data, Buff_Bool_DT use_protection);
+#endif
+
+#ifndef BUFF_POOL_READ_ENABLED
+#define BUFF_POOL_READ_ENABLED                           BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_POOL_READ_ENABLED)
+/**
+ * @brief Function which copies oldest element (slot_size bytes) from the queue and removes it from the queue.
+ *
+ * @result BUFF_TRUE if element has been read, BUFF_FALSE if pool is empty
+ *
+ * @param buf pointer to pool from which element shall be read
+ * @param data pointer to memory to which element shall be copied; must have slot_size bytes
+ * @param use_protection if BUFF_TRUE then function will lock access to the pool for moment of modifying it, BUFF_FALSE otherwise
+ */
+Buff_Bool_DT Buff_Pool_Read(Buff_Pool_XT *buf, void *data, Buff_Bool_DT use_protection);
+#endif
+
+#endif /* #if(BUFF_USE_POOL_BUFFERS && BUFF_USE_RING_BUFFERS) */
+
+
+
+#if(BUFF_USE_CHAIN_BUFFERS)
+
+#ifndef BUFF_CHAIN_INIT_ENABLED
+#define BUFF_CHAIN_INIT_ENABLED                          BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_CHAIN_INIT_ENABLED)
+/**
+ * @brief Function which initializes chunk chain - sets all internal pointers and indexes properly to be able to operate on it
+ * and puts all given chunks to free list.
+ *
+ * @result BUFF_TRUE if initialization succeeded, BUFF_FALSE otherwise
+ *
+ * @param buf pointer to chain to be initialized
+ * @param chunks pointer to table of chunks descriptors
+ * @param memory pointer to RAM memory of chunks; must have at least chunk_size * num_chunks bytes
+ * @param chunk_size size of memory of one chunk in bytes; must be bigger than 0
+ * @param num_chunks number of chunks (elements of table "chunks"); can be 0 if chunks will be added by Buff_Chain_Add_Chunks
+ */
+Buff_Bool_DT Buff_Chain_Init(
+   Buff_Chain_XT          *buf,
+   Buff_Chain_Chunk_XT    *chunks,
+   void                   *memory,
+   Buff_Size_DT            chunk_size,
+   Buff_Size_DT            num_chunks);
+#endif
+
+#ifndef BUFF_CHAIN_DEINIT_ENABLED
+#define BUFF_CHAIN_DEINIT_ENABLED                        BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_CHAIN_DEINIT_ENABLED)
+/**
+ * @brief Function which deinitializes chunk chain - sets all internal pointers to invalid,
+ * so no more operations will be allowed on the chain. Memory of chunks can be released by the user after this call.
+ *
+ * @param buf pointer to chain to be deinitialized
+ */
+void   Buff_Chain_Deinit(Buff_Chain_XT *buf);
+#endif
+
+#ifndef BUFF_CHAIN_ADD_CHUNKS_ENABLED
+#define BUFF_CHAIN_ADD_CHUNKS_ENABLED                    BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_CHAIN_ADD_CHUNKS_ENABLED)
+/**
+ * @brief Function which extends capacity of working chunk chain by next chunks. Stored data is not moved.
+ *
+ * @result BUFF_TRUE if chunks have been added, BUFF_FALSE otherwise
+ *
+ * @param buf pointer to chain to which chunks shall be added
+ * @param chunks pointer to table of chunks descriptors
+ * @param memory pointer to RAM memory of chunks; must have at least chunk_size * num_chunks bytes (chunk_size given to Buff_Chain_Init)
+ * @param num_chunks number of chunks (elements of table "chunks")
+ */
+Buff_Bool_DT Buff_Chain_Add_Chunks(Buff_Chain_XT *buf, Buff_Chain_Chunk_XT *chunks, void *memory, Buff_Size_DT num_chunks);
+#endif
+
+#ifndef BUFF_CHAIN_GET_BUSY_SIZE_ENABLED
+#define BUFF_CHAIN_GET_BUSY_SIZE_ENABLED                 BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_CHAIN_GET_BUSY_SIZE_ENABLED)
+/**
+ * @brief Function which returns size of data stored in the chain.
+ *
+ * @result number of busy bytes
+ *
+ * @param buf pointer to chain which parameter shall be returned
+ */
+Buff_Size_DT Buff_Chain_Get_Busy_Size(const Buff_Chain_XT *buf);
+#endif
+
+#ifndef BUFF_CHAIN_GET_FREE_SIZE_ENABLED
+#define BUFF_CHAIN_GET_FREE_SIZE_ENABLED                 BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_CHAIN_GET_FREE_SIZE_ENABLED)
+/**
+ * @brief Function which returns number of bytes which can be written to the chain - free space of last chunk and of free chunks.
+ *
+ * @result number of free bytes
+ *
+ * @param buf pointer to chain which parameter shall be returned
+ */
+Buff_Size_DT Buff_Chain_Get_Free_Size(const Buff_Chain_XT *buf);
+#endif
+
+#ifndef BUFF_CHAIN_WRITE_ENABLED
+#define BUFF_CHAIN_WRITE_ENABLED                         BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_CHAIN_WRITE_ENABLED)
+/**
+ * @brief Function which appends data from linear buffer to the end of the chain.
+ *
+ * @result size of data which has been copied to the chain (less than size if there is not enough free chunks)
+ *
+ * @param buf pointer to chain in which data shall be stored
+ * @param data pointer to data to be stored in the chain
+ * @param size size of data to be stored in the chain
+ */
+Buff_Size_DT Buff_Chain_Write(Buff_Chain_XT *buf, const void *data, Buff_Size_DT size);
+#endif
+
+#ifndef BUFF_CHAIN_WRITE_FROM_VECTOR_ENABLED
+#define BUFF_CHAIN_WRITE_FROM_VECTOR_ENABLED             BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_CHAIN_WRITE_FROM_VECTOR_ENABLED && BUFF_USE_VECTOR_BUFFERS && BUFF_READABLE_VECTOR_CURSOR_ENABLED )
+/**
+ * @brief Function which appends data from vector of linear buffers (Buff_Readable_Vector_XT) to the end of the chain.
+ *
+ * @result size of data which has been copied to the chain
+ *
+ * @param buf pointer to chain in which data shall be stored
+ * @param data pointer to vector of linear buffers (Buff_Readable_Vector_XT) of data to be stored in the chain
+ * @param data_num_elems number of data vector elements (independent linear buffers which create vector data)
+ * @param size size of data to be copied from vector of linear buffers to the chain
+ * @param offset_data offset in vector of linear buffers from which data will be copied to the chain
+ */
+Buff_Size_DT Buff_Chain_Write_From_Vector(
+   Buff_Chain_XT                   *buf,
+   const Buff_Readable_Vector_XT   *data,
+   Buff_Num_Elems_DT                data_num_elems,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_data);
+#endif
+
+#ifndef BUFF_CHAIN_WRITE_FROM_TREE_ENABLED
+#define BUFF_CHAIN_WRITE_FROM_TREE_ENABLED               BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_CHAIN_WRITE_FROM_TREE_ENABLED && BUFF_USE_TREE_BUFFERS && BUFF_READABLE_TREE_CURSOR_ENABLED )
+/**
+ * @brief Function which appends data from tree of vectors of linear buffers (Buff_Readable_Tree_XT) to the end of the chain.
+ *
+ * @result size of data which has been copied to the chain
+ *
+ * @param buf pointer to chain in which data shall be stored
+ * @param data pointer to tree of vectors of linear buffers (Buff_Readable_Tree_XT) of data to be stored in the chain;
+ * function fails if it reaches branch nested deeper than BUFF_TREE_MAX_DEPTH
+ * @param data_num_elems number of data tree elements
+ * @param size size of data to be copied from tree to the chain
+ * @param offset_data offset in tree from which data will be copied to the chain
+ */
+Buff_Size_DT Buff_Chain_Write_From_Tree(
+   Buff_Chain_XT                   *buf,
+   const Buff_Readable_Tree_XT     *data,
+   Buff_Num_Elems_DT                data_num_elems,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_data);
+#endif
+
+#ifndef BUFF_CHAIN_PEAK_ENABLED
+#define BUFF_CHAIN_PEAK_ENABLED                          BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_CHAIN_PEAK_ENABLED)
+/**
+ * @brief Function which copies data from the chain to linear buffer without removing it from the chain.
+ *
+ * @result size of data which has been copied from the chain
+ *
+ * @param buf pointer to chain from which data shall be copied
+ * @param data pointer to linear buffer to which data shall be copied
+ * @param size size of data to be copied
+ * @param buf_offset offset in chain data (from oldest byte) from which data will be copied
+ */
+Buff_Size_DT Buff_Chain_Peak(Buff_Chain_XT *buf, void *data, Buff_Size_DT size, Buff_Size_DT buf_offset);
+#endif
+
+#ifndef BUFF_CHAIN_REMOVE_ENABLED
+#define BUFF_CHAIN_REMOVE_ENABLED                        BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_CHAIN_REMOVE_ENABLED)
+/**
+ * @brief Function which removes oldest data from the chain. Chunks which become empty are returned to free list.
+ *
+ * @result size of data which has been removed
+ *
+ * @param buf pointer to chain from which data shall be removed
+ * @param size size of data to be removed
+ */
+Buff_Size_DT Buff_Chain_Remove(Buff_Chain_XT *buf, Buff_Size_DT size);
+#endif
+
+#ifndef BUFF_CHAIN_READ_ENABLED
+#define BUFF_CHAIN_READ_ENABLED                          BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_CHAIN_READ_ENABLED)
+/**
+ * @brief Function which copies oldest data from the chain to linear buffer and removes it from the chain.
+ *
+ * @result size of data which has been read
+ *
+ * @param buf pointer to chain from which data shall be read
+ * @param data pointer to linear buffer to which data shall be copied
+ * @param size size of data to be read
+ */
+Buff_Size_DT Buff_Chain_Read(Buff_Chain_XT *buf, void *data, Buff_Size_DT size);
+#endif
+
+#ifndef BUFF_CHAIN_TO_VECTOR_ENABLED
+#define BUFF_CHAIN_TO_VECTOR_ENABLED                     BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if(BUFF_CHAIN_TO_VECTOR_ENABLED)
+/**
+ * @brief Function which describes data stored in the chain as vector of linear buffers - one element per used chunk,
+ * in order of data. Data is not copied, so vector can be given to Buff_Ring_Write_From_Vector, Buff_Copy_From_Vector etc.
+ * Vector is valid until data is removed from the chain. Data is usually removed (Buff_Chain_Remove) after it has been consumed.
+ *
+ * @result number of vector elements which have been filled
+ *
+ * @param buf pointer to chain which data shall be described
+ * @param vector pointer to vector of linear buffers to be filled
+ * @param vector_num_elems number of elements of the vector; if chain uses more chunks, only oldest data is described
+ * @param size pointer to variable to which size of described data is written; can be invalid pointer if not needed
+ */
+Buff_Num_Elems_DT Buff_Chain_To_Vector(
+   const Buff_Chain_XT             *buf,
+   Buff_Readable_Vector_XT         *vector,
+   Buff_Num_Elems_DT                vector_num_elems,
+   Buff_Size_DT                    *size);
+#endif
+
+#ifndef BUFF_CHAIN_TO_TREE_ENABLED
+#define BUFF_CHAIN_TO_TREE_ENABLED                       BUFF_DEFAULT_FEATURES_STATE
+#endif
+#if( BUFF_CHAIN_TO_TREE_ENABLED && BUFF_CHAIN_TO_VECTOR_ENABLED )
+/**
+ * @brief Function which describes data stored in the chain as single-element tree of linear buffers (same way as
+ * Buff_Readable_Tree_Flatten does), so it can be given to Buff_Copy_From_Tree, Buff_Ring_Write_From_Tree etc. as "tree, 1".
+ *
+ * @result number of vector elements which have been filled
+ *
+ * @param buf pointer to chain which data shall be described
+ * @param tree pointer to tree element which is set to point to the vector
+ * @param vector pointer to vector of linear buffers to be filled (as in Buff_Chain_To_Vector)
+ * @param vector_num_elems number of elements of the vector
+ * @param size pointer to variable to which size of described data is written; can be invalid pointer if not needed
+ */
+Buff_Num_Elems_DT Buff_Chain_To_Tree(
+   const Buff_Chain_XT             *buf,
+   Buff_Readable_Tree_XT           *tree,
+   Buff_Readable_Vector_XT         *vector,
+   Buff_Num_Elems_DT                vector_num_elems,
+   Buff_Size_DT                    *size);
+#endif
+
+#endif /* #if(BUFF_USE_CHAIN_BUFFERS) */
 
 /**
  * -----------------------------------------------------------------------------------------------------------------------------
@@ -33,641 +33,867 @@
 #include "buff_cfg.h"
 #endif
 
+#if(BUFF_USE_RING_BUFFERS && BUFF_RING_USE_MIRRORED_MEMORY)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if(BUFF_USE_RING_BUFFERS && BUFF_RING_USE_FD_IO)
+#include <errno.h>
+#include <sys/uio.h>
+#endif
+
+#if(BUFF_USE_IOVEC)
+#include <sys/uio.h>
+#endif
+
+#if(BUFF_USE_RING_BUFFERS && BUFF_RING_USE_SPLICE)
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#if(BUFF_USE_RING_BUFFERS && BUFF_RING_USE_FILE)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if(BUFF_USE_RING_BUFFERS && BUFF_RING_USE_IO_URING)
+#include <errno.h>
+#include <string.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if(BUFF_USE_RING_BUFFERS && BUFF_RING_USE_SPLICE && (!defined(SPLICE_F_NONBLOCK)))
+/* declared by fcntl.h only with _GNU_SOURCE */
+#define SPLICE_F_NONBLOCK                          0x02
+#endif
+
 #ifndef BUFF_RING_IS_FREE_SPACE_CONTINOUS
-#define BUFF_RING_IS_FREE_SPACE_CONTINOUS(buf)     ((0 == (buf)->first_busy) || ((buf)->first_free < (buf)->first_busy))
+#define BUFF_RING_IS_FREE_SPACE_CONTINOUS(buf)     (BUFF_RING_IS_MIRRORED(buf) || (0 == (buf)->first_busy) || ((buf)->first_free < (buf)->first_busy))
 #endif
 
 #ifndef BUFF_RING_GET_ORIGINAL_FREE_SIZE
-#define BUFF_RING_GET_ORIGINAL_FREE_SIZE(buf)      ((buf)->original_size - (buf)->busy_size)
+#define BUFF_RING_GET_ORIGINAL_FREE_SIZE(buf)      ((buf)->original_size - BUFF_RING_GET_BUSY_SIZE(buf))
 #endif
 
-#if(BUFF_SAVE_PROGRAM_MEMORY)
-static Buff_Size_DT buff_vendor_memcpy(const Buff_Memcpy_Params_XT *params)
-{
-   uint8_t       *dest = &((uint8_t*)(params->dest))[params->dest_offset];
-   const uint8_t *src  = &((const uint8_t*)(params->src))[params->src_offset];
-   Buff_Size_DT   cntr;
+#if(BUFF_RING_USE_LOCK_FREE_SPSC)
+#define BUFF_RING_SET_FIRST_FREE(buf, pos)         BUFF_ATOMIC_STORE_RELEASE(&((buf)->first_free), (pos))
+#define BUFF_RING_SET_FIRST_BUSY(buf, pos)         BUFF_ATOMIC_STORE_RELEASE(&((buf)->first_busy), (pos))
+#define BUFF_RING_GET_FIRST_FREE(buf)              BUFF_ATOMIC_LOAD_ACQUIRE(&((buf)->first_free))
+#define BUFF_RING_GET_FIRST_BUSY(buf)              BUFF_ATOMIC_LOAD_ACQUIRE(&((buf)->first_busy))
+#define BUFF_RING_INCREASE_BUSY_SIZE(buf, size)
+#define BUFF_RING_DECREASE_BUSY_SIZE(buf, size)
+#else
+#define BUFF_RING_SET_FIRST_FREE(buf, pos)         (buf)->first_free = (pos)
+#define BUFF_RING_SET_FIRST_BUSY(buf, pos)         (buf)->first_busy = (pos)
+#define BUFF_RING_GET_FIRST_FREE(buf)              ((buf)->first_free)
+#define BUFF_RING_GET_FIRST_BUSY(buf)              ((buf)->first_busy)
+#define BUFF_RING_INCREASE_BUSY_SIZE(buf, size)    (buf)->busy_size += (size)
+#define BUFF_RING_DECREASE_BUSY_SIZE(buf, size)    (buf)->busy_size -= (size)
+#endif
 
-   for(cntr = 0; cntr < params->size; cntr++)
-   {
-      dest[cntr] = src[cntr];
-   }
+#if(BUFF_RING_USE_POWER_OF_2_SIZE)
+#define BUFF_RING_WRAP_POS(buf, pos)               ((pos) & ((buf)->size - 1))
+#else
+#define BUFF_RING_WRAP_POS(buf, pos)               (((pos) >= (buf)->size) ? ((pos) - (buf)->size) : (pos))
+#endif
 
-   return params->size;
-} /* buff_vendor_memcpy */
+#if(BUFF_RING_USE_IO_URING && (!BUFF_RING_USE_LOCK_FREE_SPSC))
+/* kernel writes to free space of buffer fed by io_uring, so positions of emptied buffer must stay where they are */
+#define BUFF_RING_IS_POS_RESET_ALLOWED(buf)        (!BUFF_BOOL_IS_TRUE((buf)->is_read_posted))
+/* free space of buffer with posted read belongs to the kernel - producers see it as full */
+#define BUFF_RING_IS_READ_POSTED(buf)              BUFF_BOOL_IS_TRUE((buf)->is_read_posted)
+#else
+#define BUFF_RING_IS_POS_RESET_ALLOWED(buf)        BUFF_TRUE
+#define BUFF_RING_IS_READ_POSTED(buf)              BUFF_FALSE
 #endif
 
-#if(BUFF_USE_VECTOR_BUFFERS || BUFF_USE_TREE_BUFFERS)
+#if(BUFF_RING_USE_SPLICE)
+/* data given to the pipe by Buff_Ring_Splice_Out is referenced by the kernel - only Buff_Ring_Splice_Release can remove it */
+#define BUFF_RING_IS_SPLICED(buf)                  (0 != (buf)->spliced_size)
+#else
+#define BUFF_RING_IS_SPLICED(buf)                  BUFF_FALSE
+#endif
 
-#if( (!defined(BUFF_GET_READABLE_VECTOR_DATA_SIZE_EXTERNAL)) && (BUFF_GET_READABLE_VECTOR_DATA_SIZE_ENABLED || BUFF_GET_WRITEABLE_VECTOR_DATA_SIZE_ENABLED || BUFF_GET_READABLE_TREE_DATA_SIZE_ENABLED || BUFF_GET_WRITEABLE_TREE_DATA_SIZE_ENABLED) )
-Buff_Size_DT Buff_Get_Readable_Vector_Data_Size(const Buff_Readable_Vector_XT *vector, Buff_Num_Elems_DT vector_num_elems)
-{
-   const Buff_Readable_Vector_XT*elem;
-   Buff_Size_DT                  result = 0;
-   Buff_Num_Elems_DT             cntr;
+#if(BUFF_RING_USE_MIRRORED_MEMORY)
+#define BUFF_RING_IS_MIRRORED(buf)                 BUFF_BOOL_IS_TRUE((buf)->is_mirrored)
+#else
+#define BUFF_RING_IS_MIRRORED(buf)                 BUFF_FALSE
+#endif
 
-   BUFF_ENTER_FUNC();
+#if(BUFF_RING_USE_FILE)
+/* memory of file-backed buffer is mapped file and its protected extension slot publishes indexes to the file header */
+#define BUFF_RING_IS_FILE_BACKED(buf)              BUFF_BOOL_IS_TRUE((buf)->is_file_backed)
+#else
+#define BUFF_RING_IS_FILE_BACKED(buf)              BUFF_FALSE
+#endif
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Vector_XT, vector)))
-   {
-      for(cntr = 0; cntr < vector_num_elems; cntr++)
-      {
-         elem = &vector[cntr];
+#if(BUFF_RING_USE_NON_TEMPORAL_COPY)
+#define BUFF_RING_IS_NON_TEMPORAL_COPY(buf, size)                 \
+   (BUFF_BOOL_IS_TRUE((buf)->use_non_temporal_copy) && ((size) >= BUFF_NON_TEMPORAL_COPY_THRESHOLD))
+#define BUFF_RING_MEMCPY(non_temporal, dest, src, size)           \
+   (BUFF_BOOL_IS_TRUE(non_temporal) ? buff_memcpy_non_temporal((dest), (src), (size)) : (void)BUFF_MEMCPY((dest), (src), (size)))
+#else
+#define BUFF_RING_MEMCPY(non_temporal, dest, src, size)           BUFF_MEMCPY((dest), (src), (size))
+#endif
 
-         if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, elem->data)))
-         {
-            result += elem->size;
-         }
-      }
-   }
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
+#define BUFF_RING_GET_MEMORY_SIZE(buf)             ((buf)->original_size)
+#else
+#define BUFF_RING_GET_MEMORY_SIZE(buf)             ((buf)->size)
+#endif
 
-   BUFF_EXIT_FUNC();
+#if(BUFF_RING_USE_AUTO_GROW && (!BUFF_RING_USE_LOCK_FREE_SPSC))
+#define BUFF_RING_AUTO_GROW(buf, size_needed)      buff_ring_auto_grow((buf), (size_needed))
+#else
+#define BUFF_RING_AUTO_GROW(buf, size_needed)
+#endif
 
-   return result;
-} /* Buff_Get_Readable_Vector_Data_size */
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_PADDED_LAYOUT)
+#define BUFF_RING_PRODUCER_GET_FREE_SIZE(buf, size_needed)     buff_ring_producer_get_free_size((buf), (size_needed))
+#define BUFF_RING_PRODUCER_GET_FIRST_BUSY(buf)                 ((buf)->cached_first_busy)
+#define BUFF_RING_CONSUMER_GET_BUSY_SIZE(buf, size_needed)     buff_ring_consumer_get_busy_size((buf), (size_needed))
+#define BUFF_RING_CONSUMER_GET_FIRST_FREE(buf)                 ((buf)->cached_first_free)
+#else
+#if(BUFF_RING_USE_IO_URING && (!BUFF_RING_USE_LOCK_FREE_SPSC))
+#define BUFF_RING_PRODUCER_GET_FREE_SIZE(buf, size_needed)     (BUFF_RING_IS_READ_POSTED(buf) ? 0 : BUFF_RING_GET_FREE_SIZE(buf))
+#else
+#define BUFF_RING_PRODUCER_GET_FREE_SIZE(buf, size_needed)     BUFF_RING_GET_FREE_SIZE(buf)
+#endif
+#define BUFF_RING_PRODUCER_GET_FIRST_BUSY(buf)                 BUFF_RING_GET_FIRST_BUSY(buf)
+#define BUFF_RING_CONSUMER_GET_BUSY_SIZE(buf, size_needed)     BUFF_RING_GET_BUSY_SIZE(buf)
+#define BUFF_RING_CONSUMER_GET_FIRST_FREE(buf)                 BUFF_RING_GET_FIRST_FREE(buf)
 #endif
 
+#if(defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)))
+/*
+ * Functions optimized for instruction sets which are not supported by every CPU are called by pointer, which initially
+ * points to selector. Selector picks implementation by BUFF_CPU_DISPATCH_SELECT and stores it to the pointer, so next calls
+ * go directly to it. Every thread which gets to selector picks the same implementation, so race between them is harmless.
+ */
+#define BUFF_CPU_DISPATCH_SELECT(func_ptr, selected, implementation)                      \
+   do                                                                                     \
+   {                                                                                      \
+      __builtin_cpu_init();                                                               \
+      (selected) = (implementation);                                                      \
+      __atomic_store_n(&(func_ptr), (selected), __ATOMIC_RELAXED);                        \
+   }while(0)
+/* "implementation" if CPU supports "feature", "otherwise" if it doesn't */
+#define BUFF_CPU_IMPLEMENTATION(feature, implementation, otherwise)                       \
+   (__builtin_cpu_supports(feature) ? (implementation) : (otherwise))
+#define BUFF_CPU_DISPATCH_GET(func_ptr)            __atomic_load_n(&(func_ptr), __ATOMIC_RELAXED)
 #endif
-#if(BUFF_USE_VECTOR_BUFFERS)
 
-#if( (!defined(BUFF_GET_WRITEABLE_VECTOR_DATA_SIZE_EXTERNAL)) && BUFF_GET_WRITEABLE_VECTOR_DATA_SIZE_ENABLED )
-Buff_Size_DT Buff_Get_Writeable_Vector_Data_Size(const Buff_Writeable_Vector_XT *vector, Buff_Num_Elems_DT vector_num_elems)
+#if( (!defined(BUFF_MEMCPY_EXTERNAL)) && BUFF_USE_OPTIMIZED_MEMCPY )
+
+#define BUFF_MEMCPY_SMALL_SIZE                     16
+
+typedef void (*buff_memcpy_large_HT)(uint8_t *dest, const uint8_t *src, Buff_Size_DT size);
+
+static void buff_memcpy_small(uint8_t *dest, const uint8_t *src, Buff_Size_DT size)
 {
-   Buff_Size_DT result;
+   uint64_t first64;
+   uint64_t last64;
+   uint32_t first32;
+   uint32_t last32;
 
-   BUFF_ENTER_FUNC();
+   /* fixed-size copies are inlined by compiler into single load / store instructions; first and last word overlap */
+   if(size >= 8)
+   {
+      memcpy(&first64, src, 8);
+      memcpy(&last64, &src[size - 8], 8);
+      memcpy(dest, &first64, 8);
+      memcpy(&dest[size - 8], &last64, 8);
+   }
+   else if(size >= 4)
+   {
+      memcpy(&first32, src, 4);
+      memcpy(&last32, &src[size - 4], 4);
+      memcpy(dest, &first32, 4);
+      memcpy(&dest[size - 4], &last32, 4);
+   }
+   else if(size > 0)
+   {
+      dest[0]          = src[0];
+      dest[size >> 1]  = src[size >> 1];
+      dest[size - 1]   = src[size - 1];
+   }
+} /* buff_memcpy_small */
 
-   result = Buff_Get_Readable_Vector_Data_Size((const Buff_Readable_Vector_XT*)vector, vector_num_elems);
 
-   BUFF_EXIT_FUNC();
 
-   return result;
-} /* Buff_Get_Writeable_Vector_Data_size */
-#endif
+static void buff_memcpy_large_std(uint8_t *dest, const uint8_t *src, Buff_Size_DT size)
+{
+   memcpy(dest, src, size);
+} /* buff_memcpy_large_std */
 
 
 
-#if( ( (!defined(BUFF_READABLE_VECTOR_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_READABLE_VECTOR_GET_CONTINEOUS_SIZE_ENABLED ) || ( (!defined(BUFF_WRITEABLE_VECTOR_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_WRITEABLE_VECTOR_GET_CONTINEOUS_SIZE_ENABLED ) || ( (!defined(BUFF_READABLE_TREE_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_READABLE_TREE_GET_CONTINEOUS_SIZE_ENABLED ) || ( (!defined(BUFF_WRITEABLE_TREE_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_WRITEABLE_TREE_GET_CONTINEOUS_SIZE_ENABLED ) )
-static Buff_Size_DT buff_readable_vector_get_contineous_size_internal(
-   const Buff_Readable_Vector_XT *vector, Buff_Num_Elems_DT vector_num_elems, Buff_Size_DT offset, Buff_Size_DT *vector_size)
+#if(BUFF_OPTIMIZED_MEMCPY_USE_SIMD && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)))
+
+/* GCC vector types are used instead of <immintrin.h> intrinsics; inside functions compiled for given target
+   fixed-size copies of these types are translated to single unaligned SSE2 / AVX2 load / store */
+typedef uint8_t buff_memcpy_v16_DT __attribute__((vector_size(16)));
+typedef uint8_t buff_memcpy_v32_DT __attribute__((vector_size(32)));
+
+__attribute__((target("sse2")))
+static void buff_memcpy_large_sse2(uint8_t *dest, const uint8_t *src, Buff_Size_DT size)
 {
-   const Buff_Readable_Vector_XT*elem;
-   Buff_Size_DT                  pos = 0;
-   Buff_Size_DT                  result = 0;
-   Buff_Num_Elems_DT             cntr;
+   buff_memcpy_v16_DT chunk;
+   buff_memcpy_v16_DT last;
+   Buff_Size_DT       pos;
 
-   BUFF_ENTER_FUNC();
+   memcpy(&last, &src[size - 16], 16);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Vector_XT, vector)))
+   for(pos = 0; (pos + 16) < size; pos += 16)
    {
-      for(cntr = 0; cntr < vector_num_elems; cntr++)
-      {
-         elem = &vector[cntr];
+      memcpy(&chunk, &src[pos], 16);
+      memcpy(&dest[pos], &chunk, 16);
+   }
 
-         if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, elem->data)))
-         {
-            if((offset >= pos) && (offset < (pos + elem->size)))
-            {
-               result = pos + elem->size - offset;
-               break;
-            }
+   /* last 16 bytes overlap with previous store - no byte loop needed for the tail */
+   memcpy(&dest[size - 16], &last, 16);
+} /* buff_memcpy_large_sse2 */
 
-            pos += elem->size;
-         }
-      }
+
+
+__attribute__((target("avx2")))
+static void buff_memcpy_large_avx2(uint8_t *dest, const uint8_t *src, Buff_Size_DT size)
+{
+   buff_memcpy_v32_DT chunk;
+   buff_memcpy_v32_DT last;
+   buff_memcpy_v16_DT first16;
+   buff_memcpy_v16_DT last16;
+   Buff_Size_DT       pos;
+
+   if(size <= 32)
+   {
+      memcpy(&first16, src, 16);
+      memcpy(&last16, &src[size - 16], 16);
+      memcpy(dest, &first16, 16);
+      memcpy(&dest[size - 16], &last16, 16);
    }
+   else
+   {
+      memcpy(&last, &src[size - 32], 32);
 
-   *vector_size = pos;
+      for(pos = 0; (pos + 32) < size; pos += 32)
+      {
+         memcpy(&chunk, &src[pos], 32);
+         memcpy(&dest[pos], &chunk, 32);
+      }
 
-   BUFF_EXIT_FUNC();
+      memcpy(&dest[size - 32], &last, 32);
+   }
+} /* buff_memcpy_large_avx2 */
 
-   return result;
-} /* buff_readable_vector_get_contineous_size_internal */
-#endif
 
 
+static void buff_memcpy_large_select(uint8_t *dest, const uint8_t *src, Buff_Size_DT size);
 
-#if( (!defined(BUFF_READABLE_VECTOR_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_READABLE_VECTOR_GET_CONTINEOUS_SIZE_ENABLED )
-Buff_Size_DT Buff_Readable_Vector_Get_Contineous_Size(
-   const Buff_Readable_Vector_XT *vector, Buff_Num_Elems_DT vector_num_elems, Buff_Size_DT offset)
+static buff_memcpy_large_HT buff_memcpy_large = buff_memcpy_large_select;
+
+static void buff_memcpy_large_select(uint8_t *dest, const uint8_t *src, Buff_Size_DT size)
 {
-   Buff_Size_DT size;
-   Buff_Size_DT result;
+   buff_memcpy_large_HT selected;
 
-   BUFF_ENTER_FUNC();
+   BUFF_CPU_DISPATCH_SELECT(buff_memcpy_large, selected,
+      BUFF_CPU_IMPLEMENTATION("avx2", buff_memcpy_large_avx2, BUFF_CPU_IMPLEMENTATION("sse2", buff_memcpy_large_sse2, buff_memcpy_large_std)));
 
-   result = buff_readable_vector_get_contineous_size_internal(vector, vector_num_elems, offset, &size);
+   selected(dest, src, size);
+} /* buff_memcpy_large_select */
 
-   BUFF_EXIT_FUNC();
+#define BUFF_MEMCPY_LARGE(dest, src, size)         BUFF_CPU_DISPATCH_GET(buff_memcpy_large)((dest), (src), (size))
+
+#else
+
+#define BUFF_MEMCPY_LARGE(dest, src, size)         buff_memcpy_large_std((dest), (src), (size))
 
-   return result;
-} /* Buff_Readable_Vector_Get_Contineous_Size */
 #endif
 
 
 
-#if( (!defined(BUFF_WRITEABLE_VECTOR_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_WRITEABLE_VECTOR_GET_CONTINEOUS_SIZE_ENABLED )
-Buff_Size_DT Buff_Writeable_Vector_Get_Contineous_Size(
-   const Buff_Writeable_Vector_XT *vector, Buff_Num_Elems_DT vector_num_elems, Buff_Size_DT offset)
+void Buff_Memcpy(void *dest, const void *src, Buff_Size_DT size)
 {
-   Buff_Size_DT size;
-   Buff_Size_DT result;
+   if(size <= BUFF_MEMCPY_SMALL_SIZE)
+   {
+      buff_memcpy_small((uint8_t*)dest, (const uint8_t*)src, size);
+   }
+   else
+   {
+      BUFF_MEMCPY_LARGE((uint8_t*)dest, (const uint8_t*)src, size);
+   }
+} /* Buff_Memcpy */
+#endif
 
-   BUFF_ENTER_FUNC();
+#if(BUFF_USE_CHECKSUM && (((!defined(BUFF_CHECKSUM_UPDATE_EXTERNAL)) && BUFF_CHECKSUM_UPDATE_ENABLED) \
+   || ((!defined(BUFF_MEMCPY_CHECKSUM_EXTERNAL)) && BUFF_MEMCPY_CHECKSUM_ENABLED)))
 
-   result = buff_readable_vector_get_contineous_size_internal(
-      (const Buff_Readable_Vector_XT*)vector, vector_num_elems, offset, &size);
+#define BUFF_CHECKSUM_ADLER32_MOD                  65521
+/* maximal number of bytes which can be added to Adler-32 sums before modulo without overflow of 32-bit sum */
+#define BUFF_CHECKSUM_ADLER32_NMAX                 5552
 
-   BUFF_EXIT_FUNC();
+typedef uint32_t (*buff_checksum_crc32c_HT)(uint8_t *dest, const uint8_t *src, Buff_Size_DT size, uint32_t crc);
 
-   return result;
-} /* Buff_Writeable_Vector_Get_Contineous_Size */
-#endif
+/* CRCs are calculated by 4 bits at once - 16 elements tables are small enough for any platform */
+static const uint32_t buff_checksum_crc32c_table[16] =
+{
+   0x00000000, 0x105EC76F, 0x20BD8EDE, 0x30E349B1, 0x417B1DBC, 0x5125DAD3, 0x61C69362, 0x7198540D,
+   0x82F63B78, 0x92A8FC17, 0xA24BB5A6, 0xB21572C9, 0xC38D26C4, 0xD3D3E1AB, 0xE330A81A, 0xF36E6F75
+};
 
+static const uint16_t buff_checksum_crc16_table[16] =
+{
+   0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+   0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
 
+/* data is copied by chunks - each chunk is loaded once, added to checksum from local copy and stored at once */
+#define BUFF_CHECKSUM_CHUNK_SIZE                   8
 
-#if( (!defined(BUFF_COPY_FROM_VECTOR_EXTERNAL)) && BUFF_COPY_FROM_VECTOR_ENABLED )
-Buff_Size_DT Buff_Copy_From_Vector(
-   void                            *dest,
-   const Buff_Readable_Vector_XT   *src,
-   Buff_Num_Elems_DT                src_num_elems,
-   Buff_Size_DT                     size,
-   Buff_Size_DT                     offset_dest,
-   Buff_Size_DT                     offset_src)
+/* in all functions below dest can be invalid pointer - then data is only added to checksum */
+static uint32_t buff_checksum_crc32c_std(uint8_t *dest, const uint8_t *src, Buff_Size_DT size, uint32_t crc)
 {
-#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+   uint8_t      chunk[BUFF_CHECKSUM_CHUNK_SIZE];
+   Buff_Size_DT pos;
+   Buff_Size_DT cntr;
+   uint8_t      byte;
 
-   Buff_Readable_Tree_XT tree;
+   for(pos = 0; (pos + BUFF_CHECKSUM_CHUNK_SIZE) <= size; pos += BUFF_CHECKSUM_CHUNK_SIZE)
+   {
+      memcpy(chunk, &src[pos], BUFF_CHECKSUM_CHUNK_SIZE);
 
-   tree.is_branch = BUFF_FALSE;
-   tree.elem_type.vector.vector           = src;
-   tree.elem_type.vector.vector_num_elems = src_num_elems;
+      for(cntr = 0; cntr < BUFF_CHECKSUM_CHUNK_SIZE; cntr++)
+      {
+         crc ^= chunk[cntr];
+         crc  = (crc >> 4) ^ buff_checksum_crc32c_table[crc & 0x0F];
+         crc  = (crc >> 4) ^ buff_checksum_crc32c_table[crc & 0x0F];
+      }
 
-#if(BUFF_USE_VENDOR_BUFFERS)
-   return Buff_Copy_From_Tree_Vendor(
-      dest, &tree, 1, size, offset_dest, offset_src, BUFF_MAKE_INVALID_PTR(Buff_Size_DT), buff_vendor_memcpy);
-#else
-   return Buff_Copy_From_Tree(
-      dest, &tree, 1, size, offset_dest, offset_src, BUFF_MAKE_INVALID_PTR(Buff_Size_DT));
-#endif
+      if(BUFF_CHECK_PTR(uint8_t, dest))
+      {
+         memcpy(&dest[pos], chunk, BUFF_CHECKSUM_CHUNK_SIZE);
+      }
+   }
 
-#elif(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VENDOR_BUFFERS)
+   for(; pos < size; pos++)
+   {
+      byte = src[pos];
+      crc ^= byte;
+      crc  = (crc >> 4) ^ buff_checksum_crc32c_table[crc & 0x0F];
+      crc  = (crc >> 4) ^ buff_checksum_crc32c_table[crc & 0x0F];
 
-   return Buff_Copy_From_Vector_Vendor(dest, src, src_num_elems, size, offset_dest, offset_src, buff_vendor_memcpy);
+      if(BUFF_CHECK_PTR(uint8_t, dest))
+      {
+         dest[pos] = byte;
+      }
+   }
 
-#else
+   return crc;
+} /* buff_checksum_crc32c_std */
 
-   const Buff_Readable_Vector_XT *src_vector;
-   Buff_Size_DT      result = 0;
-   Buff_Size_DT      part;
-   Buff_Num_Elems_DT cntr;
 
-   BUFF_ENTER_FUNC();
 
-   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(void, dest) && BUFF_CHECK_PTR(Buff_Readable_Vector_XT, src)))
+#if(defined(__GNUC__) && defined(__x86_64__))
+
+__attribute__((target("sse4.2")))
+static uint32_t buff_checksum_crc32c_sse42(uint8_t *dest, const uint8_t *src, Buff_Size_DT size, uint32_t crc)
+{
+   unsigned long long crc64 = crc;
+   uint64_t           chunk;
+   Buff_Size_DT       pos;
+
+   /* each 8 bytes are loaded once - same register is used by crc32 instruction and stored to destination */
+   for(pos = 0; (pos + 8) <= size; pos += 8)
    {
-      for(cntr = 0; cntr < src_num_elems; cntr++)
+      memcpy(&chunk, &src[pos], 8);
+      crc64 = __builtin_ia32_crc32di(crc64, chunk);
+
+      if(BUFF_CHECK_PTR(uint8_t, dest))
       {
-         src_vector = &src[cntr];
+         memcpy(&dest[pos], &chunk, 8);
+      }
+   }
 
-         if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, src_vector->data)))
-         {
-            if(offset_src < src_vector->size)
-            {
-               if((src_vector->size - offset_src) < size)
-               {
-                  part = src_vector->size - offset_src;
-                  memcpy(&((uint8_t*)dest)[offset_dest], &((const uint8_t*)(src_vector->data))[offset_src], part);
-                  offset_dest += part;
-                  offset_src  += part;
-                  result      += part;
-                  size        -= part;
-               }
-               else
-               {
-                  memcpy(&((uint8_t*)dest)[offset_dest], &((const uint8_t*)(src_vector->data))[offset_src], size);
-                  result      += size;
-                  break;
-               }
-            }
+   crc = (uint32_t)crc64;
 
-            offset_src -= src_vector->size;
-         }
+   for(; pos < size; pos++)
+   {
+      crc = __builtin_ia32_crc32qi(crc, src[pos]);
+
+      if(BUFF_CHECK_PTR(uint8_t, dest))
+      {
+         dest[pos] = src[pos];
       }
    }
 
-   BUFF_EXIT_FUNC();
+   return crc;
+} /* buff_checksum_crc32c_sse42 */
 
-   return result;
 
-#endif
-} /* Buff_Copy_From_Vector */
-#endif
 
+static uint32_t buff_checksum_crc32c_select(uint8_t *dest, const uint8_t *src, Buff_Size_DT size, uint32_t crc);
 
+static buff_checksum_crc32c_HT buff_checksum_crc32c = buff_checksum_crc32c_select;
 
-#if( (!defined(BUFF_COPY_FROM_VECTOR_VENDOR_EXTERNAL)) && BUFF_COPY_FROM_VECTOR_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS )
-Buff_Size_DT Buff_Copy_From_Vector_Vendor(
-   void                            *dest,
-   const Buff_Readable_Vector_XT   *src,
-   Buff_Num_Elems_DT                src_num_elems,
-   Buff_Size_DT                     size,
-   Buff_Size_DT                     offset_dest,
-   Buff_Size_DT                     offset_src,
-   Buff_Vendor_Memcpy_HT            vendor_cpy)
+static uint32_t buff_checksum_crc32c_select(uint8_t *dest, const uint8_t *src, Buff_Size_DT size, uint32_t crc)
 {
-#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+   buff_checksum_crc32c_HT selected;
 
-   Buff_Readable_Tree_XT tree;
+   BUFF_CPU_DISPATCH_SELECT(buff_checksum_crc32c, selected,
+      BUFF_CPU_IMPLEMENTATION("sse4.2", buff_checksum_crc32c_sse42, buff_checksum_crc32c_std));
 
-   tree.is_branch = BUFF_FALSE;
-   tree.elem_type.vector.vector           = src;
-   tree.elem_type.vector.vector_num_elems = src_num_elems;
+   return selected(dest, src, size, crc);
+} /* buff_checksum_crc32c_select */
 
-   return Buff_Copy_From_Tree_Vendor(
-      dest, &tree, 1, size, offset_dest, offset_src, BUFF_MAKE_INVALID_PTR(Buff_Size_DT), vendor_cpy);
+#define BUFF_CHECKSUM_CRC32C_COPY(dest, src, size, crc) \
+   BUFF_CPU_DISPATCH_GET(buff_checksum_crc32c)((dest), (src), (size), (crc))
 
 #else
 
-   const Buff_Readable_Vector_XT *src_vector;
-   Buff_Memcpy_Params_XT memcpy_params;
-   Buff_Size_DT      result = 0;
-   Buff_Size_DT      memcpy_result;
-   Buff_Size_DT      part;
-   Buff_Num_Elems_DT cntr;
+#define BUFF_CHECKSUM_CRC32C_COPY(dest, src, size, crc) buff_checksum_crc32c_std((dest), (src), (size), (crc))
 
-   BUFF_ENTER_FUNC();
-
-   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(void, dest) && BUFF_CHECK_PTR(Buff_Readable_Vector_XT, src)
-      && BUFF_CHECK_HANDLER(Buff_Vendor_Memcpy_HT, vendor_cpy)))
-   {
-      memcpy_params.dest = dest;
-
-      for(cntr = 0; cntr < src_num_elems; cntr++)
-      {
-         src_vector = &src[cntr];
+#endif
 
-         if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, src_vector->data)))
-         {
-            if(offset_src < src_vector->size)
-            {
-               memcpy_params.src          = src_vector->data;
-               memcpy_params.dest_offset  = offset_dest;
-               memcpy_params.src_offset   = offset_src;
 
-               if((src_vector->size - offset_src) < size)
-               {
-                  part = src_vector->size - offset_src;
 
-                  memcpy_params.size = part;
-                  memcpy_params.is_last_part = BUFF_FALSE;
+static uint32_t buff_checksum_crc16(uint8_t *dest, const uint8_t *src, Buff_Size_DT size, uint32_t crc)
+{
+   uint8_t      chunk[BUFF_CHECKSUM_CHUNK_SIZE];
+   Buff_Size_DT pos;
+   Buff_Size_DT cntr;
+   uint8_t      byte;
 
-                  memcpy_result = vendor_cpy(&memcpy_params);
+   for(pos = 0; (pos + BUFF_CHECKSUM_CHUNK_SIZE) <= size; pos += BUFF_CHECKSUM_CHUNK_SIZE)
+   {
+      memcpy(chunk, &src[pos], BUFF_CHECKSUM_CHUNK_SIZE);
 
-                  if(memcpy_result < part)
-                  {
-                     result      += memcpy_result;
-                     break;
-                  }
-                  else
-                  {
-                     offset_dest += part;
-                     offset_src  += part;
-                     result      += part;
-                     size        -= part;
-                  }
-               }
-               else
-               {
-                  memcpy_params.size = size;
-                  memcpy_params.is_last_part = BUFF_TRUE;
+      for(cntr = 0; cntr < BUFF_CHECKSUM_CHUNK_SIZE; cntr++)
+      {
+         byte = chunk[cntr];
+         crc  = ((crc << 4) ^ buff_checksum_crc16_table[((crc >> 12) ^ (byte >> 4)) & 0x0F]) & 0xFFFF;
+         crc  = ((crc << 4) ^ buff_checksum_crc16_table[((crc >> 12) ^ byte) & 0x0F]) & 0xFFFF;
+      }
 
-                  memcpy_result   = vendor_cpy(&memcpy_params);
+      if(BUFF_CHECK_PTR(uint8_t, dest))
+      {
+         memcpy(&dest[pos], chunk, BUFF_CHECKSUM_CHUNK_SIZE);
+      }
+   }
 
-                  if(BUFF_UNLIKELY(memcpy_result < size))
-                  {
-                     size         = memcpy_result;
-                  }
-                  result         += size;
-                  break;
-               }
-            }
+   for(; pos < size; pos++)
+   {
+      byte = src[pos];
+      crc  = ((crc << 4) ^ buff_checksum_crc16_table[((crc >> 12) ^ (byte >> 4)) & 0x0F]) & 0xFFFF;
+      crc  = ((crc << 4) ^ buff_checksum_crc16_table[((crc >> 12) ^ byte) & 0x0F]) & 0xFFFF;
 
-            offset_src -= src_vector->size;
-         }
+      if(BUFF_CHECK_PTR(uint8_t, dest))
+      {
+         dest[pos] = byte;
       }
    }
 
-   BUFF_EXIT_FUNC();
+   return crc;
+} /* buff_checksum_crc16 */
 
-   return result;
 
-#endif
-} /* Buff_Copy_From_Vector_Vendor */
-#endif
 
+static uint32_t buff_checksum_adler32(uint8_t *dest, const uint8_t *src, Buff_Size_DT size, uint32_t adler)
+{
+   uint8_t      chunk[BUFF_CHECKSUM_CHUNK_SIZE];
+   uint32_t     a = adler & 0xFFFF;
+   uint32_t     b = adler >> 16;
+   Buff_Size_DT pos = 0;
+   Buff_Size_DT block_end;
+   Buff_Size_DT cntr;
+   uint8_t      byte;
 
+   while(pos < size)
+   {
+      /* modulo is calculated once per block instead of once per byte */
+      block_end = ((size - pos) > BUFF_CHECKSUM_ADLER32_NMAX) ? (pos + BUFF_CHECKSUM_ADLER32_NMAX) : size;
 
-#if( (!defined(BUFF_COPY_TO_VECTOR_EXTERNAL)) && BUFF_COPY_TO_VECTOR_ENABLED )
-Buff_Size_DT Buff_Copy_To_Vector(
-   const Buff_Writeable_Vector_XT  *dest,
-   Buff_Num_Elems_DT                dest_num_elems,
-   const void                      *src,
-   Buff_Size_DT                     size,
-   Buff_Size_DT                     offset_dest,
-   Buff_Size_DT                     offset_src)
-{
-#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+      for(; (pos + BUFF_CHECKSUM_CHUNK_SIZE) <= block_end; pos += BUFF_CHECKSUM_CHUNK_SIZE)
+      {
+         memcpy(chunk, &src[pos], BUFF_CHECKSUM_CHUNK_SIZE);
 
-   Buff_Writeable_Tree_XT tree;
+         for(cntr = 0; cntr < BUFF_CHECKSUM_CHUNK_SIZE; cntr++)
+         {
+            a += chunk[cntr];
+            b += a;
+         }
 
-   tree.is_branch = BUFF_FALSE;
-   tree.elem_type.vector.vector           = dest;
-   tree.elem_type.vector.vector_num_elems = dest_num_elems;
+         if(BUFF_CHECK_PTR(uint8_t, dest))
+         {
+            memcpy(&dest[pos], chunk, BUFF_CHECKSUM_CHUNK_SIZE);
+         }
+      }
 
-#if(BUFF_USE_VENDOR_BUFFERS)
-   return Buff_Copy_To_Tree_Vendor(
-      &tree, 1, src, size, offset_dest, offset_src, BUFF_MAKE_INVALID_PTR(Buff_Size_DT), buff_vendor_memcpy);
-#else
-   return Buff_Copy_To_Tree(
-      &tree, 1, src, size, offset_dest, offset_src, BUFF_MAKE_INVALID_PTR(Buff_Size_DT));
-#endif
+      for(; pos < block_end; pos++)
+      {
+         byte = src[pos];
+         a   += byte;
+         b   += a;
 
-#elif(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VENDOR_BUFFERS)
+         if(BUFF_CHECK_PTR(uint8_t, dest))
+         {
+            dest[pos] = byte;
+         }
+      }
 
-   return Buff_Copy_To_Vector_Vendor(dest, dest_num_elems, src, size, offset_dest, offset_src, buff_vendor_memcpy);
+      a %= BUFF_CHECKSUM_ADLER32_MOD;
+      b %= BUFF_CHECKSUM_ADLER32_MOD;
+   }
 
-#else
+   return (b << 16) | a;
+} /* buff_checksum_adler32 */
 
-   const Buff_Writeable_Vector_XT *dest_vector;
-   Buff_Size_DT      result = 0;
-   Buff_Size_DT      part;
-   Buff_Num_Elems_DT cntr;
 
-   BUFF_ENTER_FUNC();
 
-   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(Buff_Writeable_Vector_XT, dest) && BUFF_CHECK_PTR(void, src)))
+static uint32_t buff_checksum_ones_complement(uint8_t *dest, const uint8_t *src, Buff_Size_DT size, uint32_t sum, Buff_Bool_DT odd)
+{
+   uint8_t      chunk[BUFF_CHECKSUM_CHUNK_SIZE];
+   uint64_t     sum64 = sum;
+   Buff_Size_DT pos = 0;
+   Buff_Size_DT cntr;
+   uint8_t      high;
+   uint8_t      low;
+
+   /* previous part ended in the middle of 16-bit word - first byte is low byte of this word */
+   if(BUFF_BOOL_IS_TRUE(odd) && (size > 0))
    {
-      for(cntr = 0; cntr < dest_num_elems; cntr++)
+      low    = src[0];
+      sum64 += low;
+
+      if(BUFF_CHECK_PTR(uint8_t, dest))
       {
-         dest_vector = &dest[cntr];
+         dest[0] = low;
+      }
 
-         if(BUFF_LIKELY(BUFF_CHECK_PTR(void, dest_vector->data)))
-         {
-            if(offset_dest < dest_vector->size)
-            {
-               if((dest_vector->size - offset_dest) < size)
-               {
-                  part = dest_vector->size - offset_dest;
-                  memcpy( &((uint8_t*)(dest_vector->data))[offset_dest], &((const uint8_t*)src)[offset_src], part);
-                  offset_dest += part;
-                  offset_src  += part;
-                  result      += part;
-                  size        -= part;
-               }
-               else
-               {
-                  memcpy( &((uint8_t*)(dest_vector->data))[offset_dest], &((const uint8_t*)src)[offset_src], size);
-                  result      += size;
-                  break;
-               }
-            }
+      pos = 1;
+   }
 
-            offset_dest -= dest_vector->size;
-         }
+   for(; (pos + BUFF_CHECKSUM_CHUNK_SIZE) <= size; pos += BUFF_CHECKSUM_CHUNK_SIZE)
+   {
+      memcpy(chunk, &src[pos], BUFF_CHECKSUM_CHUNK_SIZE);
+
+      for(cntr = 0; cntr < BUFF_CHECKSUM_CHUNK_SIZE; cntr += 2)
+      {
+         sum64 += ((uint32_t)chunk[cntr] << 8) | chunk[cntr + 1];
       }
-   }
 
-   BUFF_EXIT_FUNC();
+      if(BUFF_CHECK_PTR(uint8_t, dest))
+      {
+         memcpy(&dest[pos], chunk, BUFF_CHECKSUM_CHUNK_SIZE);
+      }
+   }
 
-   return result;
+   for(; (pos + 2) <= size; pos += 2)
+   {
+      high   = src[pos];
+      low    = src[pos + 1];
+      sum64 += ((uint32_t)high << 8) | low;
 
-#endif
-} /* Buff_Copy_To_Vector */
-#endif
+      if(BUFF_CHECK_PTR(uint8_t, dest))
+      {
+         dest[pos]     = high;
+         dest[pos + 1] = low;
+      }
+   }
 
+   if(pos < size)
+   {
+      high   = src[pos];
+      sum64 += (uint32_t)high << 8;
 
+      if(BUFF_CHECK_PTR(uint8_t, dest))
+      {
+         dest[pos] = high;
+      }
+   }
 
-#if( (!defined(BUFF_COPY_TO_VECTOR_VENDOR_EXTERNAL)) && BUFF_COPY_TO_VECTOR_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS )
-Buff_Size_DT Buff_Copy_To_Vector_Vendor(
-   const Buff_Writeable_Vector_XT  *dest,
-   Buff_Num_Elems_DT                dest_num_elems,
-   const void                      *src,
-   Buff_Size_DT                     size,
-   Buff_Size_DT                     offset_dest,
-   Buff_Size_DT                     offset_src,
-   Buff_Vendor_Memcpy_HT            vendor_cpy)
-{
-#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+   /* end-around carry */
+   while(0 != (sum64 >> 16))
+   {
+      sum64 = (sum64 & 0xFFFF) + (sum64 >> 16);
+   }
 
-   Buff_Writeable_Tree_XT tree;
+   return (uint32_t)sum64;
+} /* buff_checksum_ones_complement */
 
-   tree.is_branch = BUFF_FALSE;
-   tree.elem_type.vector.vector           = dest;
-   tree.elem_type.vector.vector_num_elems = dest_num_elems;
 
-   return Buff_Copy_To_Tree_Vendor(
-      &tree, 1, src, size, offset_dest, offset_src, BUFF_MAKE_INVALID_PTR(Buff_Size_DT), vendor_cpy);
 
-#else
+static void buff_checksum_process(uint8_t *dest, const uint8_t *src, Buff_Size_DT size, Buff_Checksum_XT *checksum)
+{
+   switch(checksum->type)
+   {
+      case BUFF_CHECKSUM_CRC32C:
+         checksum->value = BUFF_CHECKSUM_CRC32C_COPY(dest, src, size, checksum->value);
+         break;
+
+      case BUFF_CHECKSUM_CRC16:
+         checksum->value = buff_checksum_crc16(dest, src, size, checksum->value);
+         break;
+
+      case BUFF_CHECKSUM_ADLER32:
+         checksum->value = buff_checksum_adler32(dest, src, size, checksum->value);
+         break;
+
+      case BUFF_CHECKSUM_ONES_COMPLEMENT:
+         checksum->value = buff_checksum_ones_complement(
+            dest, src, size, checksum->value, (0 != (checksum->length & 1)) ? BUFF_TRUE : BUFF_FALSE);
+         break;
+
+      default:
+         /* unknown checksum - data is only copied */
+         if(BUFF_CHECK_PTR(uint8_t, dest))
+         {
+            BUFF_MEMCPY(dest, src, size);
+         }
+         break;
+   }
 
-   const Buff_Writeable_Vector_XT *dest_vector;
-   Buff_Memcpy_Params_XT memcpy_params;
-   Buff_Size_DT      result = 0;
-   Buff_Size_DT      memcpy_result;
-   Buff_Size_DT      part;
-   Buff_Num_Elems_DT cntr;
+   checksum->length += size;
+} /* buff_checksum_process */
+#endif
 
+#if( (!defined(BUFF_CHECKSUM_INIT_EXTERNAL)) && BUFF_CHECKSUM_INIT_ENABLED && BUFF_USE_CHECKSUM )
+void Buff_Checksum_Init(Buff_Checksum_XT *checksum, uint8_t type)
+{
    BUFF_ENTER_FUNC();
 
-   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(Buff_Writeable_Vector_XT, dest) && BUFF_CHECK_PTR(void, src)
-      && BUFF_CHECK_HANDLER(Buff_Vendor_Memcpy_HT, vendor_cpy)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Checksum_XT, checksum)))
    {
-      memcpy_params.src = src;
+      checksum->type    = type;
+      checksum->length  = 0;
 
-      for(cntr = 0; cntr < dest_num_elems; cntr++)
+      switch(type)
       {
-         dest_vector = &dest[cntr];
+         case BUFF_CHECKSUM_CRC32C:
+            checksum->value = 0xFFFFFFFF;
+            break;
 
-         if(BUFF_LIKELY(BUFF_CHECK_PTR(void, dest_vector->data)))
-         {
-            if(offset_dest < dest_vector->size)
-            {
-               memcpy_params.dest         = dest_vector->data;
-               memcpy_params.dest_offset  = offset_dest;
-               memcpy_params.src_offset   = offset_src;
+         case BUFF_CHECKSUM_CRC16:
+            checksum->value = 0xFFFF;
+            break;
 
-               if((dest_vector->size - offset_dest) < size)
-               {
-                  part = dest_vector->size - offset_dest;
+         case BUFF_CHECKSUM_ADLER32:
+            checksum->value = 1;
+            break;
 
-                  memcpy_params.size = part;
-                  memcpy_params.is_last_part = BUFF_FALSE;
+         default:
+            checksum->value = 0;
+            break;
+      }
+   }
 
-                  memcpy_result = vendor_cpy(&memcpy_params);
+   BUFF_EXIT_FUNC();
+} /* Buff_Checksum_Init */
+#endif
 
-                  if(memcpy_result < part)
-                  {
-                     result      += memcpy_result;
-                     break;
-                  }
-                  else
-                  {
-                     offset_dest += part;
-                     offset_src  += part;
-                     result      += part;
-                     size        -= part;
-                  }
-               }
-               else
-               {
-                  memcpy_params.size = size;
-                  memcpy_params.is_last_part = BUFF_TRUE;
 
-                  memcpy_result   = vendor_cpy(&memcpy_params);
 
-                  if(BUFF_UNLIKELY(memcpy_result < size))
-                  {
-                     size         = memcpy_result;
-                  }
-                  result         += size;
-                  break;
-               }
-            }
+#if( (!defined(BUFF_CHECKSUM_UPDATE_EXTERNAL)) && BUFF_CHECKSUM_UPDATE_ENABLED && BUFF_USE_CHECKSUM )
+void Buff_Checksum_Update(Buff_Checksum_XT *checksum, const void *data, Buff_Size_DT size)
+{
+   BUFF_ENTER_FUNC();
 
-            offset_dest -= dest_vector->size;
-         }
-      }
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Checksum_XT, checksum) && BUFF_CHECK_PTR(const void, data)))
+   {
+      buff_checksum_process(BUFF_MAKE_INVALID_PTR(uint8_t), (const uint8_t*)data, size, checksum);
    }
 
    BUFF_EXIT_FUNC();
-
-   return result;
-
-#endif
-} /* Buff_Copy_To_Vector_Vendor */
+} /* Buff_Checksum_Update */
 #endif
 
 
 
-#if( (!defined(BUFF_COPY_VECTOR_TO_VECTOR_EXTERNAL)) && BUFF_COPY_VECTOR_TO_VECTOR_ENABLED )
-Buff_Size_DT Buff_Copy_Vector_To_Vector(
-   const Buff_Writeable_Vector_XT  *dest,
-   Buff_Num_Elems_DT                dest_num_elems,
-   const Buff_Readable_Vector_XT   *src,
-   Buff_Num_Elems_DT                src_num_elems,
-   Buff_Size_DT                     size,
-   Buff_Size_DT                     offset_dest,
-   Buff_Size_DT                     offset_src)
+#if( (!defined(BUFF_CHECKSUM_GET_EXTERNAL)) && BUFF_CHECKSUM_GET_ENABLED && BUFF_USE_CHECKSUM )
+uint32_t Buff_Checksum_Get(const Buff_Checksum_XT *checksum)
 {
-#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+   uint32_t result = 0;
 
-   Buff_Writeable_Tree_XT tree_dest;
-   Buff_Readable_Tree_XT tree_src;
+   BUFF_ENTER_FUNC();
 
-   tree_dest.is_branch = BUFF_FALSE;
-   tree_dest.elem_type.vector.vector           = dest;
-   tree_dest.elem_type.vector.vector_num_elems = dest_num_elems;
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(const Buff_Checksum_XT, checksum)))
+   {
+      switch(checksum->type)
+      {
+         case BUFF_CHECKSUM_CRC32C:
+            result = checksum->value ^ 0xFFFFFFFF;
+            break;
 
-   tree_src.is_branch = BUFF_FALSE;
-   tree_src.elem_type.vector.vector            = src;
-   tree_src.elem_type.vector.vector_num_elems  = src_num_elems;
+         case BUFF_CHECKSUM_ONES_COMPLEMENT:
+            result = (~(checksum->value)) & 0xFFFF;
+            break;
 
-   return Buff_Copy_Tree_To_Tree(
-      &tree_dest,
-      1,
-      &tree_src,
-      1,
-      size,
-      offset_dest,
-      offset_src,
-      BUFF_MAKE_INVALID_PTR(Buff_Size_DT),
-      BUFF_MAKE_INVALID_PTR(Buff_Bool_DT));
+         default:
+            result = checksum->value;
+            break;
+      }
+   }
 
-#else
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Checksum_Get */
+#endif
 
-   const Buff_Readable_Vector_XT *src_vector;
-   Buff_Size_DT      result = 0;
-   Buff_Size_DT      ret_part;
-   Buff_Size_DT      part;
-   Buff_Num_Elems_DT cntr;
 
+
+#if( (!defined(BUFF_MEMCPY_CHECKSUM_EXTERNAL)) && BUFF_MEMCPY_CHECKSUM_ENABLED && BUFF_USE_CHECKSUM )
+void Buff_Memcpy_Checksum(void *dest, const void *src, Buff_Size_DT size, Buff_Checksum_XT *checksum)
+{
    BUFF_ENTER_FUNC();
 
-   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(Buff_Writeable_Vector_XT, dest) && BUFF_CHECK_PTR(Buff_Readable_Vector_XT, src)
-      && (dest_num_elems > 0)))
+   if(BUFF_CHECK_PTR(Buff_Checksum_XT, checksum))
    {
-      for(cntr = 0; cntr < src_num_elems; cntr++)
-      {
-         src_vector = &src[cntr];
+      buff_checksum_process((uint8_t*)dest, (const uint8_t*)src, size, checksum);
+   }
+   else
+   {
+      BUFF_MEMCPY(dest, src, size);
+   }
 
-         if(BUFF_LIKELY(BUFF_CHECK_PTR(void, src_vector->data)))
-         {
-            if(offset_src < src_vector->size)
-            {
-               if((src_vector->size - offset_src) < size)
-               {
-                  part        = src_vector->size - offset_src;
-                  ret_part    = Buff_Copy_To_Vector(dest, dest_num_elems, src_vector->data, part, offset_dest, offset_src);
-                  offset_dest+= ret_part;
-                  offset_src += ret_part;
-                  result     += ret_part;
-                  size       -= ret_part;
-
-                  if(ret_part < part)
-                  {
-                     break;
-                  }
-               }
-               else
-               {
-                  ret_part    = Buff_Copy_To_Vector(dest, dest_num_elems, src_vector->data, size, offset_dest, offset_src);
-                  result     += ret_part;
-                  break;
-               }
-            }
+   BUFF_EXIT_FUNC();
+} /* Buff_Memcpy_Checksum */
+#endif
 
-            offset_src       -= src_vector->size;
-         }
-      }
+#if(BUFF_USE_RING_BUFFERS && BUFF_RING_USE_NON_TEMPORAL_COPY)
+static void buff_memcpy_non_temporal(void *dest, const void *src, Buff_Size_DT size)
+{
+#if(defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)))
+   typedef long long buff_v2di_DT __attribute__((vector_size(16)));
+   uint8_t       *dest8 = (uint8_t*)dest;
+   const uint8_t *src8  = (const uint8_t*)src;
+   buff_v2di_DT   chunk;
+   Buff_Size_DT   part;
+
+   /* movntdq requires 16-byte aligned destination - begining and end of the area are copied normally */
+   part = (Buff_Size_DT)((16 - ((uintptr_t)dest8 & 15)) & 15);
+
+   if(part > size)
+   {
+      part = size;
    }
 
-   BUFF_EXIT_FUNC();
+   BUFF_MEMCPY(dest8, src8, part);
+   dest8 = &dest8[part];
+   src8  = &src8[part];
+   size -= part;
 
-   return result;
+   while(size >= 16)
+   {
+      memcpy(&chunk, src8, 16);
+      __builtin_ia32_movntdq((buff_v2di_DT*)dest8, chunk);
+      dest8 = &dest8[16];
+      src8  = &src8[16];
+      size -= 16;
+   }
 
+   BUFF_MEMCPY(dest8, src8, size);
+#else
+   BUFF_MEMCPY(dest, src, size);
 #endif
-} /* Buff_Copy_Vector_To_Vector */
+} /* buff_memcpy_non_temporal */
 #endif
 
-#endif /* #if(BUFF_USE_VECTOR_BUFFERS) */
+#if(BUFF_SAVE_PROGRAM_MEMORY)
+static Buff_Size_DT buff_vendor_memcpy(const Buff_Memcpy_Params_XT *params)
+{
+   BUFF_MEMCPY(&((uint8_t*)(params->dest))[params->dest_offset], &((const uint8_t*)(params->src))[params->src_offset], params->size);
 
+   return params->size;
+} /* buff_vendor_memcpy */
+#endif
 
+#if(BUFF_USE_CHECKSUM && BUFF_USE_VENDOR_BUFFERS)
+/**
+ * Checksum-accumulating copy functions are built on vendor copy functions - linear buffer provided by the user
+ * is wrapped together with checksum into this structure and provided to vendor function as "vendor buffer".
+ */
+typedef struct
+{
+   void             *dest;
+   const void       *src;
+   Buff_Checksum_XT *checksum;
+}buff_checksum_context_XT;
+#endif
+
+#if( ((!defined(BUFF_COPY_FROM_VECTOR_CHECKSUM_EXTERNAL)) && BUFF_COPY_FROM_VECTOR_CHECKSUM_ENABLED && BUFF_COPY_FROM_VECTOR_VENDOR_ENABLED) \
+   || ((!defined(BUFF_COPY_FROM_TREE_CHECKSUM_EXTERNAL)) && BUFF_COPY_FROM_TREE_CHECKSUM_ENABLED && BUFF_COPY_FROM_TREE_VENDOR_ENABLED) \
+   || ((!defined(BUFF_RING_READ_CHECKSUM_EXTERNAL)) && BUFF_RING_READ_CHECKSUM_ENABLED && BUFF_RING_READ_VENDOR_ENABLED) )
+#if(BUFF_USE_CHECKSUM && BUFF_USE_VENDOR_BUFFERS && BUFF_MEMCPY_CHECKSUM_ENABLED)
+/**
+ * Vendor memcpy for copying to linear buffer wrapped by buff_checksum_context_XT.
+ */
+static Buff_Size_DT buff_checksum_vendor_memcpy_to_context(const Buff_Memcpy_Params_XT *params)
+{
+   const buff_checksum_context_XT *context = (const buff_checksum_context_XT*)(params->dest);
 
-#if(BUFF_USE_TREE_BUFFERS)
+   Buff_Memcpy_Checksum(
+      &((uint8_t*)(context->dest))[params->dest_offset],
+      &((const uint8_t*)(params->src))[params->src_offset],
+      params->size,
+      context->checksum);
 
-#if( (!defined(BUFF_GET_READABLE_TREE_DATA_SIZE_EXTERNAL)) && (BUFF_GET_READABLE_TREE_DATA_SIZE_ENABLED || BUFF_GET_WRITEABLE_TREE_DATA_SIZE_ENABLED) )
-Buff_Size_DT Buff_Get_Readable_Tree_Data_Size(const Buff_Readable_Tree_XT *tree, Buff_Num_Elems_DT tree_num_elems)
+   return params->size;
+} /* buff_checksum_vendor_memcpy_to_context */
+#endif
+#endif
+
+#if( ((!defined(BUFF_COPY_TO_VECTOR_CHECKSUM_EXTERNAL)) && BUFF_COPY_TO_VECTOR_CHECKSUM_ENABLED && BUFF_COPY_TO_VECTOR_VENDOR_ENABLED) \
+   || ((!defined(BUFF_COPY_TO_TREE_CHECKSUM_EXTERNAL)) && BUFF_COPY_TO_TREE_CHECKSUM_ENABLED && BUFF_COPY_TO_TREE_VENDOR_ENABLED) \
+   || ((!defined(BUFF_RING_WRITE_CHECKSUM_EXTERNAL)) && BUFF_RING_WRITE_CHECKSUM_ENABLED && BUFF_RING_WRITE_VENDOR_ENABLED) )
+#if(BUFF_USE_CHECKSUM && BUFF_USE_VENDOR_BUFFERS && BUFF_MEMCPY_CHECKSUM_ENABLED)
+/**
+ * Vendor memcpy for copying from linear buffer wrapped by buff_checksum_context_XT.
+ */
+static Buff_Size_DT buff_checksum_vendor_memcpy_from_context(const Buff_Memcpy_Params_XT *params)
+{
+   const buff_checksum_context_XT *context = (const buff_checksum_context_XT*)(params->src);
+
+   Buff_Memcpy_Checksum(
+      &((uint8_t*)(params->dest))[params->dest_offset],
+      &((const uint8_t*)(context->src))[params->src_offset],
+      params->size,
+      context->checksum);
+
+   return params->size;
+} /* buff_checksum_vendor_memcpy_from_context */
+#endif
+#endif
+
+#if(BUFF_USE_VECTOR_BUFFERS || BUFF_USE_TREE_BUFFERS)
+
+#if( (!defined(BUFF_GET_READABLE_VECTOR_DATA_SIZE_EXTERNAL)) && (BUFF_GET_READABLE_VECTOR_DATA_SIZE_ENABLED || BUFF_GET_WRITEABLE_VECTOR_DATA_SIZE_ENABLED || BUFF_GET_READABLE_TREE_DATA_SIZE_ENABLED || BUFF_GET_WRITEABLE_TREE_DATA_SIZE_ENABLED) )
+Buff_Size_DT Buff_Get_Readable_Vector_Data_Size(const Buff_Readable_Vector_XT *vector, Buff_Num_Elems_DT vector_num_elems)
 {
-   const Buff_Readable_Tree_XT  *elem;
+   const Buff_Readable_Vector_XT*elem;
    Buff_Size_DT                  result = 0;
    Buff_Num_Elems_DT             cntr;
 
    BUFF_ENTER_FUNC();
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Tree_XT, tree)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Vector_XT, vector)))
    {
-      for(cntr = 0; cntr < tree_num_elems; cntr++)
+      for(cntr = 0; cntr < vector_num_elems; cntr++)
       {
-         elem = &tree[cntr];
+         elem = &vector[cntr];
 
-         if(BUFF_UNLIKELY(BUFF_BOOL_IS_TRUE(elem->is_branch)))
-         {
-            result += Buff_Get_Readable_Tree_Data_Size(elem->elem_type.tree.branch, elem->elem_type.tree.branch_num_elems);
-         }
-         else
+         if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, elem->data)))
          {
-            result += Buff_Get_Readable_Vector_Data_Size(elem->elem_type.vector.vector, elem->elem_type.vector.vector_num_elems);
+            result += elem->size;
          }
       }
    }
@@ -675,234 +901,281 @@ Buff_Size_DT Buff_Get_Readable_Tree_Data_Size(const Buff_Readable_Tree_XT *tree,
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Get_Readable_Tree_Data_size */
+} /* Buff_Get_Readable_Vector_Data_size */
 #endif
 
 
 
-#if( (!defined(BUFF_GET_WRITEABLE_TREE_DATA_SIZE_EXTERNAL)) && BUFF_GET_WRITEABLE_TREE_DATA_SIZE_ENABLED )
-Buff_Size_DT Buff_Get_Writeable_Tree_Data_Size(const Buff_Writeable_Tree_XT *tree, Buff_Num_Elems_DT tree_num_elems)
+#if( ((!defined(BUFF_READABLE_VECTOR_CURSOR_EXTERNAL)) && BUFF_USE_VECTOR_BUFFERS && BUFF_READABLE_VECTOR_CURSOR_ENABLED) || ((!defined(BUFF_READABLE_TREE_CURSOR_EXTERNAL)) && BUFF_USE_TREE_BUFFERS && BUFF_READABLE_TREE_CURSOR_ENABLED) )
+/**
+ * Copies data from position of vector cursor and moves the cursor; if dest is invalid pointer then data is only skipped.
+ */
+static Buff_Size_DT buff_readable_vector_cursor_copy(uint8_t *dest, Buff_Readable_Vector_Cursor_XT *cursor, Buff_Size_DT size)
 {
-   Buff_Size_DT result;
+   const Buff_Readable_Vector_XT *elem;
+   Buff_Size_DT                   part;
+   Buff_Size_DT                   result = 0;
 
-   BUFF_ENTER_FUNC();
+   while((result < size) && (cursor->elem < cursor->vector_num_elems))
+   {
+      elem = &(cursor->vector[cursor->elem]);
 
-   result = Buff_Get_Readable_Tree_Data_Size((const Buff_Readable_Tree_XT*)tree, tree_num_elems);
+      if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, elem->data) && (cursor->elem_offset < elem->size)))
+      {
+         part = elem->size - cursor->elem_offset;
 
-   BUFF_EXIT_FUNC();
+         if(part > (size - result))
+         {
+            part = size - result;
+         }
+
+         if(BUFF_CHECK_PTR(uint8_t, dest))
+         {
+            BUFF_MEMCPY(&dest[result], &((const uint8_t*)(elem->data))[cursor->elem_offset], part);
+         }
+
+         cursor->elem_offset += part;
+         result              += part;
+      }
+      else
+      {
+         cursor->elem++;
+         cursor->elem_offset  = 0;
+      }
+   }
 
    return result;
-} /* Buff_Get_Writeable_Tree_Data_size */
+} /* buff_readable_vector_cursor_copy */
 #endif
 
 
 
-#if(( (!defined(BUFF_READABLE_TREE_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_READABLE_TREE_GET_CONTINEOUS_SIZE_ENABLED ) || ( (!defined(BUFF_WRITEABLE_TREE_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_WRITEABLE_TREE_GET_CONTINEOUS_SIZE_ENABLED ) )
-static Buff_Size_DT buff_readable_tree_get_contineous_size_internal(
-   const Buff_Readable_Tree_XT *tree, Buff_Num_Elems_DT tree_num_elems, Buff_Size_DT offset, Buff_Size_DT *tree_size)
+#if( BUFF_USE_IOVEC && ( ((!defined(BUFF_VECTOR_TO_IOVEC_EXTERNAL)) && BUFF_USE_VECTOR_BUFFERS && BUFF_VECTOR_TO_IOVEC_ENABLED && BUFF_READABLE_VECTOR_CURSOR_ENABLED) \
+   || ((!defined(BUFF_TREE_TO_IOVEC_EXTERNAL)) && BUFF_USE_TREE_BUFFERS && BUFF_TREE_TO_IOVEC_ENABLED && BUFF_READABLE_TREE_CURSOR_ENABLED) ) )
+/**
+ * Describes data from position of vector cursor by iovec table (appending to *iov_used already used elements) and moves the cursor.
+ * Part contiguous with last used iovec element extends this element. Stops and sets truncated if there is no free iovec element.
+ */
+static Buff_Size_DT buff_readable_vector_cursor_to_iovec(
+   struct iovec *iov, Buff_Num_Elems_DT iov_num_elems, Buff_Num_Elems_DT *iov_used,
+   Buff_Readable_Vector_Cursor_XT *cursor, Buff_Size_DT size, Buff_Bool_DT *truncated)
 {
-   const Buff_Readable_Tree_XT  *elem;
-   Buff_Size_DT                  pos = 0;
-   Buff_Size_DT                  branch_size;
-   Buff_Size_DT                  result = 0;
-   Buff_Size_DT                  branch_result;
-   Buff_Num_Elems_DT             cntr;
+   const Buff_Readable_Vector_XT *elem;
+   const uint8_t                 *data;
+   Buff_Size_DT                   part;
+   Buff_Size_DT                   result = 0;
 
-   BUFF_ENTER_FUNC();
-
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Tree_XT, tree)))
+   while((result < size) && (cursor->elem < cursor->vector_num_elems))
    {
-      for(cntr = 0; cntr < tree_num_elems; cntr++)
+      elem = &(cursor->vector[cursor->elem]);
+
+      if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, elem->data) && (cursor->elem_offset < elem->size)))
       {
-         elem = &tree[cntr];
+         data = &((const uint8_t*)(elem->data))[cursor->elem_offset];
+         part = elem->size - cursor->elem_offset;
 
-         if(BUFF_UNLIKELY(BUFF_BOOL_IS_TRUE(elem->is_branch)))
+         if(part > (size - result))
          {
-            branch_result = buff_readable_tree_get_contineous_size_internal(
-               elem->elem_type.tree.branch, elem->elem_type.tree.branch_num_elems, offset - pos, &branch_size);
+            part = size - result;
          }
-         else
+
+         if((*iov_used > 0) && ((&((const uint8_t*)(iov[*iov_used - 1].iov_base))[iov[*iov_used - 1].iov_len]) == data))
          {
-            branch_result = buff_readable_vector_get_contineous_size_internal(
-               elem->elem_type.vector.vector, elem->elem_type.vector.vector_num_elems, offset - pos, &branch_size);
+            iov[*iov_used - 1].iov_len += part;
          }
-         if(0 != branch_result)
+         else if(*iov_used < iov_num_elems)
          {
-            result = branch_result;
-            break;
+            iov[*iov_used].iov_base = (void*)data;
+            iov[*iov_used].iov_len  = part;
+            (*iov_used)++;
          }
          else
          {
-            pos += branch_size;
+            *truncated = BUFF_TRUE;
+            break;
          }
+
+         cursor->elem_offset += part;
+         result              += part;
+      }
+      else
+      {
+         cursor->elem++;
+         cursor->elem_offset  = 0;
       }
    }
 
-   *tree_size = pos;
+   return result;
+} /* buff_readable_vector_cursor_to_iovec */
+#endif
+
+#endif
+#if(BUFF_USE_VECTOR_BUFFERS)
+
+#if( (!defined(BUFF_GET_WRITEABLE_VECTOR_DATA_SIZE_EXTERNAL)) && BUFF_GET_WRITEABLE_VECTOR_DATA_SIZE_ENABLED )
+Buff_Size_DT Buff_Get_Writeable_Vector_Data_Size(const Buff_Writeable_Vector_XT *vector, Buff_Num_Elems_DT vector_num_elems)
+{
+   Buff_Size_DT result;
+
+   BUFF_ENTER_FUNC();
+
+   result = Buff_Get_Readable_Vector_Data_Size((const Buff_Readable_Vector_XT*)vector, vector_num_elems);
 
    BUFF_EXIT_FUNC();
 
    return result;
-} /* buff_readable_tree_get_contineous_size_internal */
+} /* Buff_Get_Writeable_Vector_Data_size */
 #endif
 
 
 
-#if( (!defined(BUFF_READABLE_TREE_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_READABLE_TREE_GET_CONTINEOUS_SIZE_ENABLED )
-Buff_Size_DT Buff_Readable_Tree_Get_Contineous_Size(
-   const Buff_Readable_Tree_XT *tree, Buff_Num_Elems_DT tree_num_elems, Buff_Size_DT offset)
+#if( ( (!defined(BUFF_READABLE_VECTOR_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_READABLE_VECTOR_GET_CONTINEOUS_SIZE_ENABLED ) || ( (!defined(BUFF_WRITEABLE_VECTOR_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_WRITEABLE_VECTOR_GET_CONTINEOUS_SIZE_ENABLED ) || ( (!defined(BUFF_READABLE_TREE_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_READABLE_TREE_GET_CONTINEOUS_SIZE_ENABLED ) || ( (!defined(BUFF_WRITEABLE_TREE_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_WRITEABLE_TREE_GET_CONTINEOUS_SIZE_ENABLED ) )
+static Buff_Size_DT buff_readable_vector_get_contineous_size_internal(
+   const Buff_Readable_Vector_XT *vector, Buff_Num_Elems_DT vector_num_elems, Buff_Size_DT offset, Buff_Size_DT *vector_size)
 {
+   const Buff_Readable_Vector_XT*elem;
+   Buff_Size_DT                  pos = 0;
    Buff_Size_DT                  result = 0;
-   Buff_Size_DT                  branch_result;
+   Buff_Num_Elems_DT             cntr;
 
    BUFF_ENTER_FUNC();
 
-   result = buff_readable_tree_get_contineous_size_internal(tree, tree_num_elems, offset, &branch_result);
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Vector_XT, vector)))
+   {
+      for(cntr = 0; cntr < vector_num_elems; cntr++)
+      {
+         elem = &vector[cntr];
+
+         if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, elem->data)))
+         {
+            if((offset >= pos) && (offset < (pos + elem->size)))
+            {
+               result = pos + elem->size - offset;
+               break;
+            }
+
+            pos += elem->size;
+         }
+      }
+   }
+
+   *vector_size = pos;
 
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Readable_Tree_Get_Contineous_Size */
+} /* buff_readable_vector_get_contineous_size_internal */
 #endif
 
 
 
-#if( (!defined(BUFF_WRITEABLE_TREE_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_WRITEABLE_TREE_GET_CONTINEOUS_SIZE_ENABLED )
-Buff_Size_DT Buff_Writeable_Tree_Get_Contineous_Size(
-   const Buff_Writeable_Tree_XT *tree, Buff_Num_Elems_DT tree_num_elems, Buff_Size_DT offset)
+#if( (!defined(BUFF_READABLE_VECTOR_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_READABLE_VECTOR_GET_CONTINEOUS_SIZE_ENABLED )
+Buff_Size_DT Buff_Readable_Vector_Get_Contineous_Size(
+   const Buff_Readable_Vector_XT *vector, Buff_Num_Elems_DT vector_num_elems, Buff_Size_DT offset)
 {
-   Buff_Size_DT                  result = 0;
-   Buff_Size_DT                  branch_result;
+   Buff_Size_DT size;
+   Buff_Size_DT result;
 
    BUFF_ENTER_FUNC();
 
-   result = buff_readable_tree_get_contineous_size_internal(
-      (const Buff_Readable_Tree_XT *)tree, tree_num_elems, offset, &branch_result);
+   result = buff_readable_vector_get_contineous_size_internal(vector, vector_num_elems, offset, &size);
 
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Writeable_Tree_Get_Contineous_Size */
+} /* Buff_Readable_Vector_Get_Contineous_Size */
 #endif
 
 
 
-#if( (!defined(BUFF_COPY_FROM_TREE_EXTERNAL)) && BUFF_COPY_FROM_TREE_ENABLED )
-Buff_Size_DT Buff_Copy_From_Tree(
-   void                         *dest,
-   const Buff_Readable_Tree_XT  *src,
-   Buff_Num_Elems_DT             src_num_elems,
-   Buff_Size_DT                  size,
-   Buff_Size_DT                  offset_dest,
-   Buff_Size_DT                  offset_src,
-   Buff_Size_DT                 *str_size)
+#if( (!defined(BUFF_WRITEABLE_VECTOR_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_WRITEABLE_VECTOR_GET_CONTINEOUS_SIZE_ENABLED )
+Buff_Size_DT Buff_Writeable_Vector_Get_Contineous_Size(
+   const Buff_Writeable_Vector_XT *vector, Buff_Num_Elems_DT vector_num_elems, Buff_Size_DT offset)
 {
-#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VENDOR_BUFFERS)
+   Buff_Size_DT size;
+   Buff_Size_DT result;
 
-   return Buff_Copy_From_Tree_Vendor(dest, src, src_num_elems, size, offset_dest, offset_src, str_size, buff_vendor_memcpy);
+   BUFF_ENTER_FUNC();
 
-#else
+   result = buff_readable_vector_get_contineous_size_internal(
+      (const Buff_Readable_Vector_XT*)vector, vector_num_elems, offset, &size);
 
-   const Buff_Readable_Tree_XT   *tree_elem;
-   const Buff_Readable_Vector_XT *vector_elem;
-   Buff_Size_DT      result = 0;
-   Buff_Size_DT      ret_size_elem = 0;
-   Buff_Size_DT      ret_size_sub_elem;
-   Buff_Size_DT      part;
-   Buff_Num_Elems_DT tree_cntr;
-   Buff_Num_Elems_DT cntr;
+   BUFF_EXIT_FUNC();
 
-   BUFF_ENTER_FUNC();
+   return result;
+} /* Buff_Writeable_Vector_Get_Contineous_Size */
+#endif
 
-   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(void, dest) && BUFF_CHECK_PTR(Buff_Readable_Tree_XT, src) && (src_num_elems > 0)))
-   {
-      for(tree_cntr = 0; tree_cntr < src_num_elems; tree_cntr++)
-      {
-         tree_elem = &src[tree_cntr];
 
-         if(BUFF_UNLIKELY(BUFF_BOOL_IS_TRUE(tree_elem->is_branch)))
-         {
-            if(BUFF_LIKELY(BUFF_CHECK_PTR(const Buff_Readable_Tree_XT, tree_elem->elem_type.tree.branch)
-               && (tree_elem->elem_type.tree.branch_num_elems > 0)))
-            {
-               ret_size_sub_elem = 0;
 
-               (void)Buff_Copy_From_Tree(
-                  dest,
-                  tree_elem->elem_type.tree.branch,
-                  tree_elem->elem_type.tree.branch_num_elems,
-                  size,
-                  offset_dest,
-                  offset_src,
-                  &ret_size_sub_elem);
+#if( (!defined(BUFF_COPY_FROM_VECTOR_EXTERNAL)) && BUFF_COPY_FROM_VECTOR_ENABLED )
+Buff_Size_DT Buff_Copy_From_Vector(
+   void                            *dest,
+   const Buff_Readable_Vector_XT   *src,
+   Buff_Num_Elems_DT                src_num_elems,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_dest,
+   Buff_Size_DT                     offset_src)
+{
+#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
 
-               ret_size_elem    += ret_size_sub_elem;
+   Buff_Readable_Tree_XT tree;
 
-               if(offset_src < ret_size_sub_elem)
-               {
-                  if((ret_size_sub_elem - offset_src) < size)
-                  {
-                     part        = ret_size_sub_elem - offset_src;
-                     offset_dest+= part;
-                     offset_src += part;
-                     result     += part;
-                     size       -= part;
-                  }
-                  else
-                  {
-                     result     += size;
-                     break;
-                  }
-               }
+   tree.is_branch = BUFF_FALSE;
+   tree.elem_type.vector.vector           = src;
+   tree.elem_type.vector.vector_num_elems = src_num_elems;
 
-               offset_src       -= ret_size_sub_elem;
-            }
-         }
-         else if(BUFF_LIKELY(BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, tree_elem->elem_type.vector.vector)))
+#if(BUFF_USE_VENDOR_BUFFERS)
+   return Buff_Copy_From_Tree_Vendor(
+      dest, &tree, 1, size, offset_dest, offset_src, BUFF_MAKE_INVALID_PTR(Buff_Size_DT), buff_vendor_memcpy);
+#else
+   return Buff_Copy_From_Tree(
+      dest, &tree, 1, size, offset_dest, offset_src, BUFF_MAKE_INVALID_PTR(Buff_Size_DT));
+#endif
+
+#elif(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VENDOR_BUFFERS)
+
+   return Buff_Copy_From_Vector_Vendor(dest, src, src_num_elems, size, offset_dest, offset_src, buff_vendor_memcpy);
+
+#else
+
+   const Buff_Readable_Vector_XT *src_vector;
+   Buff_Size_DT      result = 0;
+   Buff_Size_DT      part;
+   Buff_Num_Elems_DT cntr;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(void, dest) && BUFF_CHECK_PTR(Buff_Readable_Vector_XT, src)))
+   {
+      for(cntr = 0; cntr < src_num_elems; cntr++)
+      {
+         src_vector = &src[cntr];
+
+         if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, src_vector->data)))
          {
-            for(cntr = 0; cntr < tree_elem->elem_type.vector.vector_num_elems; cntr++)
+            if(offset_src < src_vector->size)
             {
-               vector_elem = &(tree_elem->elem_type.vector.vector[cntr]);
-
-               if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, vector_elem->data)))
+               if((src_vector->size - offset_src) < size)
                {
-                  if(offset_src < vector_elem->size)
-                  {
-                     if((vector_elem->size - offset_src) < size)
-                     {
-                        part = vector_elem->size - offset_src;
-                        memcpy(&((uint8_t*)dest)[offset_dest], &((const uint8_t*)(vector_elem->data))[offset_src], part);
-                        offset_dest    += part;
-                        offset_src     += part;
-                        result         += part;
-                        size           -= part;
-                     }
-                     else
-                     {
-                        memcpy(&((uint8_t*)dest)[offset_dest], &((const uint8_t*)(vector_elem->data))[offset_src], size);
-                        result         += size;
-                        ret_size_elem  += size + offset_src;
-                        size            = 0;
-                        break;
-                     }
-                  }
-
-                  offset_src        -= vector_elem->size;
-                  ret_size_elem     += vector_elem->size;
+                  part = src_vector->size - offset_src;
+                  BUFF_MEMCPY(&((uint8_t*)dest)[offset_dest], &((const uint8_t*)(src_vector->data))[offset_src], part);
+                  offset_dest += part;
+                  offset_src  += part;
+                  result      += part;
+                  size        -= part;
+               }
+               else
+               {
+                  BUFF_MEMCPY(&((uint8_t*)dest)[offset_dest], &((const uint8_t*)(src_vector->data))[offset_src], size);
+                  result      += size;
+                  break;
                }
             }
 
-            if(0 == size)
-            {
-               break;
-            }
+            offset_src -= src_vector->size;
          }
       }
-
-      if(BUFF_CHECK_PTR(Buff_Size_DT, str_size))
-      {
-         *str_size = ret_size_elem;
-      }
    }
 
    BUFF_EXIT_FUNC();
@@ -910,288 +1183,214 @@ Buff_Size_DT Buff_Copy_From_Tree(
    return result;
 
 #endif
-} /* Buff_Copy_From_Tree */
+} /* Buff_Copy_From_Vector */
 #endif
 
 
 
-#if( (!defined(BUFF_COPY_FROM_TREE_VENDOR_EXTERNAL)) && BUFF_COPY_FROM_TREE_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS )
-Buff_Size_DT Buff_Copy_From_Tree_Vendor(
-   void                         *dest,
-   const Buff_Readable_Tree_XT  *src,
-   Buff_Num_Elems_DT             src_num_elems,
-   Buff_Size_DT                  size,
-   Buff_Size_DT                  offset_dest,
-   Buff_Size_DT                  offset_src,
-   Buff_Size_DT                 *str_size,
-   Buff_Vendor_Memcpy_HT         vendor_cpy)
+#if( (!defined(BUFF_COPY_FROM_VECTOR_VENDOR_EXTERNAL)) && BUFF_COPY_FROM_VECTOR_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS )
+Buff_Size_DT Buff_Copy_From_Vector_Vendor(
+   void                            *dest,
+   const Buff_Readable_Vector_XT   *src,
+   Buff_Num_Elems_DT                src_num_elems,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_dest,
+   Buff_Size_DT                     offset_src,
+   Buff_Vendor_Memcpy_HT            vendor_cpy)
 {
-   const Buff_Readable_Tree_XT   *tree_elem;
-   const Buff_Readable_Vector_XT *vector_elem;
+#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+
+   Buff_Readable_Tree_XT tree;
+
+   tree.is_branch = BUFF_FALSE;
+   tree.elem_type.vector.vector           = src;
+   tree.elem_type.vector.vector_num_elems = src_num_elems;
+
+   return Buff_Copy_From_Tree_Vendor(
+      dest, &tree, 1, size, offset_dest, offset_src, BUFF_MAKE_INVALID_PTR(Buff_Size_DT), vendor_cpy);
+
+#else
+
+   const Buff_Readable_Vector_XT *src_vector;
    Buff_Memcpy_Params_XT memcpy_params;
    Buff_Size_DT      result = 0;
    Buff_Size_DT      memcpy_result;
-   Buff_Size_DT      ret_size_elem = 0;
-   Buff_Size_DT      ret_size_sub_elem;
    Buff_Size_DT      part;
-   Buff_Num_Elems_DT tree_cntr;
    Buff_Num_Elems_DT cntr;
 
    BUFF_ENTER_FUNC();
 
-   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(void, dest) && BUFF_CHECK_PTR(Buff_Readable_Tree_XT, src) && (src_num_elems > 0)
+   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(void, dest) && BUFF_CHECK_PTR(Buff_Readable_Vector_XT, src)
       && BUFF_CHECK_HANDLER(Buff_Vendor_Memcpy_HT, vendor_cpy)))
    {
       memcpy_params.dest = dest;
 
-      for(tree_cntr = 0; tree_cntr < src_num_elems; tree_cntr++)
+      for(cntr = 0; cntr < src_num_elems; cntr++)
       {
-         tree_elem = &src[tree_cntr];
+         src_vector = &src[cntr];
 
-         if(BUFF_UNLIKELY(BUFF_BOOL_IS_TRUE(tree_elem->is_branch)))
+         if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, src_vector->data)))
          {
-            if(BUFF_LIKELY(BUFF_CHECK_PTR(const Buff_Readable_Tree_XT, tree_elem->elem_type.tree.branch)
-               && (tree_elem->elem_type.tree.branch_num_elems > 0)))
+            if(offset_src < src_vector->size)
             {
-               ret_size_sub_elem = 0;
+               memcpy_params.src          = src_vector->data;
+               memcpy_params.dest_offset  = offset_dest;
+               memcpy_params.src_offset   = offset_src;
 
-               memcpy_result = Buff_Copy_From_Tree_Vendor(
-                  dest,
-                  tree_elem->elem_type.tree.branch,
-                  tree_elem->elem_type.tree.branch_num_elems,
-                  size,
-                  offset_dest,
-                  offset_src,
-                  &ret_size_sub_elem,
-                  vendor_cpy);
+               if((src_vector->size - offset_src) < size)
+               {
+                  part = src_vector->size - offset_src;
+
+                  memcpy_params.size = part;
+                  memcpy_params.is_last_part = BUFF_FALSE;
 
-               ret_size_elem    += ret_size_sub_elem;
+                  memcpy_result = vendor_cpy(&memcpy_params);
 
-               /* vendor memcpy took less data than provided */
-               if(memcpy_result > ret_size_sub_elem)
-               {
-                  result        += memcpy_result;
-                  break;
-               }
-               else if(offset_src < ret_size_sub_elem)
-               {
-                  if((ret_size_sub_elem - offset_src) < size)
+                  if(memcpy_result < part)
                   {
-                     part        = ret_size_sub_elem - offset_src;
-                     offset_dest+= part;
-                     offset_src += part;
-                     result     += part;
-                     size       -= part;
+                     result      += memcpy_result;
+                     break;
                   }
                   else
                   {
-                     result     += size;
-                     break;
+                     offset_dest += part;
+                     offset_src  += part;
+                     result      += part;
+                     size        -= part;
                   }
                }
+               else
+               {
+                  memcpy_params.size = size;
+                  memcpy_params.is_last_part = BUFF_TRUE;
+
+                  memcpy_result   = vendor_cpy(&memcpy_params);
 
-               offset_src       -= ret_size_sub_elem;
+                  if(BUFF_UNLIKELY(memcpy_result < size))
+                  {
+                     size         = memcpy_result;
+                  }
+                  result         += size;
+                  break;
+               }
             }
+
+            offset_src -= src_vector->size;
          }
-         else if(BUFF_LIKELY(BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, tree_elem->elem_type.vector.vector)))
-         {
-            for(cntr = 0; cntr < tree_elem->elem_type.vector.vector_num_elems; cntr++)
-            {
-               vector_elem = &(tree_elem->elem_type.vector.vector[cntr]);
+      }
+   }
 
-               if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, vector_elem->data)))
-               {
-                  if(offset_src < vector_elem->size)
-                  {
-                     memcpy_params.src          = vector_elem->data;
-                     memcpy_params.dest_offset  = offset_dest;
-                     memcpy_params.src_offset   = offset_src;
+   BUFF_EXIT_FUNC();
 
-                     if((vector_elem->size - offset_src) < size)
-                     {
-                        part = vector_elem->size - offset_src;
+   return result;
 
-                        memcpy_params.size = part;
-                        memcpy_params.is_last_part = BUFF_FALSE;
+#endif
+} /* Buff_Copy_From_Vector_Vendor */
+#endif
 
-                        memcpy_result = vendor_cpy(&memcpy_params);
 
-                        /* vendor memcpy took less data than provided; do not increase ret_size_elem */
-                        if(memcpy_result < part)
-                        {
-                           ret_size_elem= 0;
-                           result      += memcpy_result;
-                           size         = 0;
-                           break;
-                        }
-                        else
-                        {
-                           offset_dest += part;
-                           offset_src  += part;
-                           result      += part;
-                           size        -= part;
-                        }
-                     }
-                     else
-                     {
-                        memcpy_params.size = size;
-                        memcpy_params.is_last_part = BUFF_TRUE;
 
-                        memcpy_result  = vendor_cpy(&memcpy_params);
-                        if(BUFF_UNLIKELY(memcpy_result < size))
-                        {
-                           size        = memcpy_result;
-                        }
-                        result        += size;
-                        ret_size_elem += size + offset_src;
-                        size           = 0;
-                        break;
-                     }
-                  }
+#if( (!defined(BUFF_COPY_FROM_VECTOR_CHECKSUM_EXTERNAL)) && BUFF_COPY_FROM_VECTOR_CHECKSUM_ENABLED && BUFF_COPY_FROM_VECTOR_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS && BUFF_USE_CHECKSUM \
+   && BUFF_MEMCPY_CHECKSUM_ENABLED )
+Buff_Size_DT Buff_Copy_From_Vector_Checksum(
+   void                            *dest,
+   const Buff_Readable_Vector_XT   *src,
+   Buff_Num_Elems_DT                src_num_elems,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_dest,
+   Buff_Size_DT                     offset_src,
+   Buff_Checksum_XT                *checksum)
+{
+   buff_checksum_context_XT context;
+   Buff_Size_DT             result = 0;
 
-                  offset_src    -= vector_elem->size;
-                  ret_size_elem += vector_elem->size;
-               }
-            }
+   BUFF_ENTER_FUNC();
 
-            if(0 == size)
-            {
-               break;
-            }
-         }
-      }
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, dest) && BUFF_CHECK_PTR(Buff_Checksum_XT, checksum)))
+   {
+      context.dest     = dest;
+      context.checksum = checksum;
 
-      if(BUFF_CHECK_PTR(Buff_Size_DT, str_size))
-      {
-         *str_size = ret_size_elem;
-      }
+      result = Buff_Copy_From_Vector_Vendor(
+         &context, src, src_num_elems, size, offset_dest, offset_src, buff_checksum_vendor_memcpy_to_context);
    }
 
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Copy_From_Tree_Vendor */
+} /* Buff_Copy_From_Vector_Checksum */
 #endif
 
 
 
-#if( (!defined(BUFF_COPY_TO_TREE_EXTERNAL)) && BUFF_COPY_TO_TREE_ENABLED )
-Buff_Size_DT Buff_Copy_To_Tree(
-   const Buff_Writeable_Tree_XT *dest,
-   Buff_Num_Elems_DT             dest_num_elems,
-   const void                   *src,
-   Buff_Size_DT                  size,
-   Buff_Size_DT                  offset_dest,
-   Buff_Size_DT                  offset_src,
-   Buff_Size_DT                 *str_size)
+#if( (!defined(BUFF_COPY_TO_VECTOR_EXTERNAL)) && BUFF_COPY_TO_VECTOR_ENABLED )
+Buff_Size_DT Buff_Copy_To_Vector(
+   const Buff_Writeable_Vector_XT  *dest,
+   Buff_Num_Elems_DT                dest_num_elems,
+   const void                      *src,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_dest,
+   Buff_Size_DT                     offset_src)
 {
-#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VENDOR_BUFFERS)
+#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
 
-   return Buff_Copy_To_Tree_Vendor(dest, dest_num_elems, src, size, offset_dest, offset_src, str_size, buff_vendor_memcpy);
+   Buff_Writeable_Tree_XT tree;
+
+   tree.is_branch = BUFF_FALSE;
+   tree.elem_type.vector.vector           = dest;
+   tree.elem_type.vector.vector_num_elems = dest_num_elems;
+
+#if(BUFF_USE_VENDOR_BUFFERS)
+   return Buff_Copy_To_Tree_Vendor(
+      &tree, 1, src, size, offset_dest, offset_src, BUFF_MAKE_INVALID_PTR(Buff_Size_DT), buff_vendor_memcpy);
+#else
+   return Buff_Copy_To_Tree(
+      &tree, 1, src, size, offset_dest, offset_src, BUFF_MAKE_INVALID_PTR(Buff_Size_DT));
+#endif
+
+#elif(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VENDOR_BUFFERS)
+
+   return Buff_Copy_To_Vector_Vendor(dest, dest_num_elems, src, size, offset_dest, offset_src, buff_vendor_memcpy);
 
 #else
 
-   const Buff_Writeable_Tree_XT   *tree_elem;
-   const Buff_Writeable_Vector_XT *vector_elem;
+   const Buff_Writeable_Vector_XT *dest_vector;
    Buff_Size_DT      result = 0;
-   Buff_Size_DT      ret_size_elem = 0;
-   Buff_Size_DT      ret_size_sub_elem;
    Buff_Size_DT      part;
-   Buff_Num_Elems_DT tree_cntr;
    Buff_Num_Elems_DT cntr;
 
    BUFF_ENTER_FUNC();
 
-   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(const void, src) && BUFF_CHECK_PTR(Buff_Writeable_Tree_XT, dest)
-      && (dest_num_elems > 0)))
+   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(Buff_Writeable_Vector_XT, dest) && BUFF_CHECK_PTR(void, src)))
    {
-      for(tree_cntr = 0; tree_cntr < dest_num_elems; tree_cntr++)
+      for(cntr = 0; cntr < dest_num_elems; cntr++)
       {
-         tree_elem = &dest[tree_cntr];
+         dest_vector = &dest[cntr];
 
-         if(BUFF_UNLIKELY(BUFF_BOOL_IS_TRUE(tree_elem->is_branch)))
+         if(BUFF_LIKELY(BUFF_CHECK_PTR(void, dest_vector->data)))
          {
-            if(BUFF_LIKELY(BUFF_CHECK_PTR(const Buff_Writeable_Tree_XT, tree_elem->elem_type.tree.branch)
-               && (tree_elem->elem_type.tree.branch_num_elems > 0)))
+            if(offset_dest < dest_vector->size)
             {
-               ret_size_sub_elem = 0;
-
-               (void)Buff_Copy_To_Tree(
-                  tree_elem->elem_type.tree.branch,
-                  tree_elem->elem_type.tree.branch_num_elems,
-                  src,
-                  size,
-                  offset_dest,
-                  offset_src,
-                  &ret_size_sub_elem);
-
-               ret_size_elem    += ret_size_sub_elem;
-
-               if(offset_dest < ret_size_sub_elem)
+               if((dest_vector->size - offset_dest) < size)
                {
-                  if((ret_size_sub_elem - offset_dest) < size)
-                  {
-                     part        = ret_size_sub_elem - offset_dest;
-                     offset_dest+= part;
-                     offset_src += part;
-                     result     += part;
-                     size       -= part;
-                  }
-                  else
-                  {
-                     result     += size;
-                     break;
-                  }
+                  part = dest_vector->size - offset_dest;
+                  BUFF_MEMCPY( &((uint8_t*)(dest_vector->data))[offset_dest], &((const uint8_t*)src)[offset_src], part);
+                  offset_dest += part;
+                  offset_src  += part;
+                  result      += part;
+                  size        -= part;
                }
-
-               offset_dest      -= ret_size_sub_elem;
-            }
-         }
-         else if(BUFF_LIKELY(BUFF_CHECK_PTR(const Buff_Writeable_Vector_XT, tree_elem->elem_type.vector.vector)))
-         {
-            for(cntr = 0; cntr < tree_elem->elem_type.vector.vector_num_elems; cntr++)
-            {
-               vector_elem = &(tree_elem->elem_type.vector.vector[cntr]);
-
-               if(BUFF_LIKELY(BUFF_CHECK_PTR(void, vector_elem->data)))
+               else
                {
-                  if(offset_dest < vector_elem->size)
-                  {
-                     if((vector_elem->size - offset_dest) < size)
-                     {
-                        part = vector_elem->size - offset_dest;
-                        memcpy( &((uint8_t*)(vector_elem->data))[offset_dest], &((const uint8_t*)src)[offset_src], part);
-                        offset_dest    += part;
-                        offset_src     += part;
-                        result         += part;
-                        size           -= part;
-                     }
-                     else
-                     {
-                        memcpy( &((uint8_t*)(vector_elem->data))[offset_dest], &((const uint8_t*)src)[offset_src], size);
-                        result         += size;
-                        ret_size_elem  += size + offset_dest;
-                        size            = 0;
-                        break;
-                     }
-                  }
-
-                  offset_dest          -= vector_elem->size;
-                  ret_size_elem        += vector_elem->size;
+                  BUFF_MEMCPY( &((uint8_t*)(dest_vector->data))[offset_dest], &((const uint8_t*)src)[offset_src], size);
+                  result      += size;
+                  break;
                }
             }
 
-            if(0 == size)
-            {
-               break;
-            }
+            offset_dest -= dest_vector->size;
          }
       }
-
-      if(BUFF_CHECK_PTR(Buff_Size_DT, str_size))
-      {
-         *str_size = ret_size_elem;
-      }
    }
 
    BUFF_EXIT_FUNC();
@@ -1199,1434 +1398,7495 @@ Buff_Size_DT Buff_Copy_To_Tree(
    return result;
 
 #endif
-} /* Buff_Copy_To_Tree */
+} /* Buff_Copy_To_Vector */
 #endif
 
 
 
-#if( (!defined(BUFF_COPY_TO_TREE_VENDOR_EXTERNAL)) && BUFF_COPY_TO_TREE_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS )
-Buff_Size_DT Buff_Copy_To_Tree_Vendor(
-   const Buff_Writeable_Tree_XT *dest,
-   Buff_Num_Elems_DT             dest_num_elems,
-   const void                   *src,
-   Buff_Size_DT                  size,
-   Buff_Size_DT                  offset_dest,
-   Buff_Size_DT                  offset_src,
-   Buff_Size_DT                 *str_size,
-   Buff_Vendor_Memcpy_HT         vendor_cpy)
+#if( (!defined(BUFF_COPY_TO_VECTOR_VENDOR_EXTERNAL)) && BUFF_COPY_TO_VECTOR_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS )
+Buff_Size_DT Buff_Copy_To_Vector_Vendor(
+   const Buff_Writeable_Vector_XT  *dest,
+   Buff_Num_Elems_DT                dest_num_elems,
+   const void                      *src,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_dest,
+   Buff_Size_DT                     offset_src,
+   Buff_Vendor_Memcpy_HT            vendor_cpy)
 {
-   const Buff_Writeable_Tree_XT   *tree_elem;
-   const Buff_Writeable_Vector_XT *vector_elem;
+#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+
+   Buff_Writeable_Tree_XT tree;
+
+   tree.is_branch = BUFF_FALSE;
+   tree.elem_type.vector.vector           = dest;
+   tree.elem_type.vector.vector_num_elems = dest_num_elems;
+
+   return Buff_Copy_To_Tree_Vendor(
+      &tree, 1, src, size, offset_dest, offset_src, BUFF_MAKE_INVALID_PTR(Buff_Size_DT), vendor_cpy);
+
+#else
+
+   const Buff_Writeable_Vector_XT *dest_vector;
    Buff_Memcpy_Params_XT memcpy_params;
    Buff_Size_DT      result = 0;
    Buff_Size_DT      memcpy_result;
-   Buff_Size_DT      ret_size_elem = 0;
-   Buff_Size_DT      ret_size_sub_elem;
    Buff_Size_DT      part;
-   Buff_Num_Elems_DT tree_cntr;
    Buff_Num_Elems_DT cntr;
 
    BUFF_ENTER_FUNC();
 
-   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(const void, src) && BUFF_CHECK_PTR(Buff_Writeable_Tree_XT, dest) && (dest_num_elems > 0)
+   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(Buff_Writeable_Vector_XT, dest) && BUFF_CHECK_PTR(void, src)
       && BUFF_CHECK_HANDLER(Buff_Vendor_Memcpy_HT, vendor_cpy)))
    {
       memcpy_params.src = src;
 
-      for(tree_cntr = 0; tree_cntr < dest_num_elems; tree_cntr++)
+      for(cntr = 0; cntr < dest_num_elems; cntr++)
       {
-         tree_elem = &dest[tree_cntr];
+         dest_vector = &dest[cntr];
 
-         if(BUFF_UNLIKELY(BUFF_BOOL_IS_TRUE(tree_elem->is_branch)))
+         if(BUFF_LIKELY(BUFF_CHECK_PTR(void, dest_vector->data)))
          {
-            if(BUFF_LIKELY(BUFF_CHECK_PTR(const Buff_Writeable_Tree_XT, tree_elem->elem_type.tree.branch)
-               && (tree_elem->elem_type.tree.branch_num_elems > 0)))
+            if(offset_dest < dest_vector->size)
             {
-               ret_size_sub_elem = 0;
+               memcpy_params.dest         = dest_vector->data;
+               memcpy_params.dest_offset  = offset_dest;
+               memcpy_params.src_offset   = offset_src;
 
-               memcpy_result = Buff_Copy_To_Tree_Vendor(
-                  tree_elem->elem_type.tree.branch,
-                  tree_elem->elem_type.tree.branch_num_elems,
-                  src,
-                  size,
-                  offset_dest,
-                  offset_src,
-                  &ret_size_sub_elem,
-                  vendor_cpy);
+               if((dest_vector->size - offset_dest) < size)
+               {
+                  part = dest_vector->size - offset_dest;
 
-               ret_size_elem    += ret_size_sub_elem;
+                  memcpy_params.size = part;
+                  memcpy_params.is_last_part = BUFF_FALSE;
 
-               /* vendor memcpy took less data than provided */
-               if(memcpy_result > ret_size_sub_elem)
-               {
-                  result        += memcpy_result;
-                  break;
-               }
-               else if(offset_dest < ret_size_sub_elem)
-               {
-                  if((ret_size_sub_elem - offset_dest) < size)
+                  memcpy_result = vendor_cpy(&memcpy_params);
+
+                  if(memcpy_result < part)
                   {
-                     part        = ret_size_sub_elem - offset_dest;
-                     offset_dest+= part;
-                     offset_src += part;
-                     result     += part;
-                     size       -= part;
+                     result      += memcpy_result;
+                     break;
                   }
                   else
                   {
-                     result     += size;
-                     break;
+                     offset_dest += part;
+                     offset_src  += part;
+                     result      += part;
+                     size        -= part;
                   }
                }
-
-               offset_dest      -= ret_size_sub_elem;
-            }
-         }
-         else if(BUFF_LIKELY(BUFF_CHECK_PTR(const Buff_Writeable_Vector_XT, tree_elem->elem_type.vector.vector)))
-         {
-            for(cntr = 0; cntr < tree_elem->elem_type.vector.vector_num_elems; cntr++)
-            {
-               vector_elem = &(tree_elem->elem_type.vector.vector[cntr]);
-
-               if(BUFF_LIKELY(BUFF_CHECK_PTR(void, vector_elem->data)))
+               else
                {
-                  if(offset_dest < vector_elem->size)
-                  {
-                     memcpy_params.dest         = vector_elem->data;
-                     memcpy_params.dest_offset  = offset_dest;
-                     memcpy_params.src_offset   = offset_src;
-
-                     if((vector_elem->size - offset_dest) < size)
-                     {
-                        part = vector_elem->size - offset_dest;
-
-                        memcpy_params.size = part;
-                        memcpy_params.is_last_part = BUFF_FALSE;
-
-                        memcpy_result = vendor_cpy(&memcpy_params);
+                  memcpy_params.size = size;
+                  memcpy_params.is_last_part = BUFF_TRUE;
 
-                        /* vendor memcpy took less data than provided; do not increase ret_size_elem */
-                        if(memcpy_result < part)
-                        {
-                           ret_size_elem= 0;
-                           result      += memcpy_result;
-                           size         = 0;
-                           break;
-                        }
-                        else
-                        {
-                           offset_dest += part;
-                           offset_src  += part;
-                           result      += part;
-                           size        -= part;
-                        }
-                     }
-                     else
-                     {
-                        memcpy_params.size = size;
-                        memcpy_params.is_last_part = BUFF_TRUE;
+                  memcpy_result   = vendor_cpy(&memcpy_params);
 
-                        memcpy_result  = vendor_cpy(&memcpy_params);
-                        if(BUFF_UNLIKELY(memcpy_result < size))
-                        {
-                           size        = memcpy_result;
-                        }
-                        result        += size;
-                        ret_size_elem += size + offset_dest;
-                        size           = 0;
-                        break;
-                     }
+                  if(BUFF_UNLIKELY(memcpy_result < size))
+                  {
+                     size         = memcpy_result;
                   }
-
-                  offset_dest       -= vector_elem->size;
-                  ret_size_elem     += vector_elem->size;
+                  result         += size;
+                  break;
                }
             }
 
-            if(0 == size)
-            {
-               break;
-            }
+            offset_dest -= dest_vector->size;
          }
       }
-
-      if(BUFF_CHECK_PTR(Buff_Size_DT, str_size))
-      {
-         *str_size = ret_size_elem;
-      }
    }
 
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Copy_To_Tree_Vendor */
+
+#endif
+} /* Buff_Copy_To_Vector_Vendor */
 #endif
 
 
 
-#if( (!defined(BUFF_COPY_TREE_TO_TREE_EXTERNAL)) && BUFF_COPY_TREE_TO_TREE_ENABLED )
-Buff_Size_DT Buff_Copy_Tree_To_Tree(
-   const Buff_Writeable_Tree_XT *dest,
-   Buff_Num_Elems_DT             dest_num_elems,
-   const Buff_Readable_Tree_XT  *src,
-   Buff_Num_Elems_DT             src_num_elems,
-   Buff_Size_DT                  size,
-   Buff_Size_DT                  offset_dest,
-   Buff_Size_DT                  offset_src,
-   Buff_Size_DT                 *str_size,
-   Buff_Bool_DT                 *end_of_destination_reached)
+#if( (!defined(BUFF_COPY_TO_VECTOR_CHECKSUM_EXTERNAL)) && BUFF_COPY_TO_VECTOR_CHECKSUM_ENABLED && BUFF_COPY_TO_VECTOR_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS && BUFF_USE_CHECKSUM \
+   && BUFF_MEMCPY_CHECKSUM_ENABLED )
+Buff_Size_DT Buff_Copy_To_Vector_Checksum(
+   const Buff_Writeable_Vector_XT  *dest,
+   Buff_Num_Elems_DT                dest_num_elems,
+   const void                      *src,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_dest,
+   Buff_Size_DT                     offset_src,
+   Buff_Checksum_XT                *checksum)
 {
-   const Buff_Readable_Tree_XT   *tree_elem;
-   const Buff_Readable_Vector_XT *vector_elem;
-   Buff_Size_DT      result = 0;
-   Buff_Size_DT      ret_size_elem = 0;
-   Buff_Size_DT      ret_size_sub_elem;
-   Buff_Size_DT      ret_part;
-   Buff_Size_DT      part;
-   Buff_Num_Elems_DT tree_cntr;
-   Buff_Num_Elems_DT cntr;
-   Buff_Bool_DT      end_of_destination = BUFF_FALSE;
-   Buff_Bool_DT      end_of_destination_sub_elem;
+   buff_checksum_context_XT context;
+   Buff_Size_DT             result = 0;
 
    BUFF_ENTER_FUNC();
 
-   if(BUFF_LIKELY((size > 0)
-      && BUFF_CHECK_PTR(Buff_Writeable_Tree_XT, dest) && (dest_num_elems > 0)
-      && BUFF_CHECK_PTR(Buff_Readable_Tree_XT, src) && (src_num_elems > 0)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, src) && BUFF_CHECK_PTR(Buff_Checksum_XT, checksum)))
    {
-      for(tree_cntr = 0; tree_cntr < src_num_elems; tree_cntr++)
-      {
-         tree_elem = &src[tree_cntr];
+      context.src      = src;
+      context.checksum = checksum;
 
-         if(BUFF_UNLIKELY(BUFF_BOOL_IS_TRUE(tree_elem->is_branch)))
-         {
-            if(BUFF_LIKELY(BUFF_CHECK_PTR(const Buff_Readable_Tree_XT, tree_elem->elem_type.tree.branch)
-               && (tree_elem->elem_type.tree.branch_num_elems > 0)))
-            {
-               end_of_destination_sub_elem = BUFF_FALSE;
+      result = Buff_Copy_To_Vector_Vendor(
+         dest, dest_num_elems, &context, size, offset_dest, offset_src, buff_checksum_vendor_memcpy_from_context);
+   }
 
-               ret_size_sub_elem = 0;
+   BUFF_EXIT_FUNC();
 
-               ret_part = Buff_Copy_Tree_To_Tree(
-                  dest,
-                  dest_num_elems,
-                  tree_elem->elem_type.tree.branch,
-                  tree_elem->elem_type.tree.branch_num_elems,
-                  size,
-                  offset_dest,
-                  offset_src,
-                  &ret_size_sub_elem,
-                  &end_of_destination_sub_elem);
+   return result;
+} /* Buff_Copy_To_Vector_Checksum */
+#endif
 
-               ret_size_elem    += ret_size_sub_elem;
 
-               /* less data was copied to destination than requested */
-               if(BUFF_BOOL_IS_TRUE(end_of_destination_sub_elem))
-               {
-                  result        += ret_part;
-                  end_of_destination  = BUFF_TRUE;
-                  break;
-               }
-               else if(offset_src < ret_size_sub_elem)
-               {
-                  result        += ret_part;
 
-                  if(ret_part < size)
-                  {
-                     offset_dest+= ret_part;
-                     offset_src += ret_part;
-                     size       -= ret_part;
-                  }
-                  else
-                  {
-                     break;
-                  }
-               }
+#if( (!defined(BUFF_COPY_VECTOR_TO_VECTOR_EXTERNAL)) && BUFF_COPY_VECTOR_TO_VECTOR_ENABLED && (!(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)) )
+/**
+ * Moves "elem" forward to vector part which contains byte "offset" (offset counted from begining of part pointed by "elem")
+ * and reduces "offset" to be relative to this part. Parts with invalid data pointer are skipped.
+ * Returns BUFF_FALSE if end of the vector has been reached.
+ */
+static Buff_Bool_DT buff_readable_vector_seek(
+   const Buff_Readable_Vector_XT *vector, Buff_Num_Elems_DT vector_num_elems, Buff_Num_Elems_DT *elem, Buff_Size_DT *offset)
+{
+   Buff_Bool_DT result = BUFF_FALSE;
 
-               offset_src       -= ret_size_sub_elem;
-            }
-         }
-         else if(BUFF_LIKELY(BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, tree_elem->elem_type.vector.vector)))
+   while(*elem < vector_num_elems)
+   {
+      if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, vector[*elem].data)))
+      {
+         if(*offset < vector[*elem].size)
          {
-            for(cntr = 0; cntr < tree_elem->elem_type.vector.vector_num_elems; cntr++)
-            {
-               vector_elem = &(tree_elem->elem_type.vector.vector[cntr]);
-
-               if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, vector_elem->data)))
-               {
-                  if(offset_src < vector_elem->size)
-                  {
-                     if((vector_elem->size - offset_src) < size)
-                     {
-                        part        = vector_elem->size - offset_src;
-                        ret_part    = Buff_Copy_To_Tree(
-                           dest,
-                           dest_num_elems,
-                           vector_elem->data,
-                           part,
-                           offset_dest,
-                           offset_src,
-                           BUFF_MAKE_INVALID_PTR(Buff_Size_DT));
-                        offset_dest+= ret_part;
-                        offset_src += ret_part;
-                        result     += ret_part;
-                        size       -= ret_part;
-
-                        /* less data was copied to destination than requested */
-                        if(ret_part < part)
-                        {
-                           size                 = 0;
-                           end_of_destination   = BUFF_TRUE;
-                           break;
-                        }
-                     }
-                     else
-                     {
-                        ret_part       = Buff_Copy_To_Tree(
-                           dest,
-                           dest_num_elems,
-                           vector_elem->data,
-                           size,
-                           offset_dest,
-                           offset_src,
-                           BUFF_MAKE_INVALID_PTR(Buff_Size_DT));
-
-                        ret_size_elem += ret_part + offset_src;
-
-                        result        += ret_part;
-                        size           = 0;
-                        break;
-                     }
-                  }
-
-                  offset_src          -= vector_elem->size;
-                  ret_size_elem       += vector_elem->size;
-               }
-            }
-
-            if(0 == size)
-            {
-               break;
-            }
+            result = BUFF_TRUE;
+            break;
          }
-      }
 
-      if(BUFF_CHECK_PTR(Buff_Bool_DT, end_of_destination_reached))
-      {
-         *end_of_destination_reached = end_of_destination;
+         *offset -= vector[*elem].size;
       }
 
-      if(BUFF_CHECK_PTR(Buff_Size_DT, str_size))
-      {
-         *str_size = ret_size_elem;
-      }
+      (*elem)++;
    }
 
-   BUFF_EXIT_FUNC();
-
    return result;
-} /* Buff_Copy_Tree_To_Tree */
+} /* buff_readable_vector_seek */
 #endif
-#endif /* #if(BUFF_USE_TREE_BUFFERS) */
-
 
 
-#if(BUFF_USE_RING_BUFFERS)
 
-#if( (!defined(RING_BUF_INIT_EXTERNAL)) && BUFF_RING_INIT_ENABLED )
-Buff_Bool_DT Buff_Ring_Init(Buff_Ring_XT *buf, void *memory, Buff_Size_DT size)
+#if( (!defined(BUFF_COPY_VECTOR_TO_VECTOR_EXTERNAL)) && BUFF_COPY_VECTOR_TO_VECTOR_ENABLED )
+Buff_Size_DT Buff_Copy_Vector_To_Vector(
+   const Buff_Writeable_Vector_XT  *dest,
+   Buff_Num_Elems_DT                dest_num_elems,
+   const Buff_Readable_Vector_XT   *src,
+   Buff_Num_Elems_DT                src_num_elems,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_dest,
+   Buff_Size_DT                     offset_src)
 {
-   Buff_Bool_DT result = BUFF_FALSE;
+#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
 
-   BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
+   Buff_Writeable_Tree_XT tree_dest;
+   Buff_Readable_Tree_XT tree_src;
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
-   {
-      if((size > 0) && BUFF_CHECK_PTR(void, memory))
-      {
-#if(BUFF_RING_USE_EXTENSIONS)
-         buf->extension  = BUFF_MAKE_INVALID_PTR(Buff_Ring_Extensions_XT);
-#endif
-#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
-         buf->protected_extension  = BUFF_MAKE_INVALID_PTR(Buff_Ring_Extensions_XT);
-#endif
-         buf->memory          = memory;
-#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
-         buf->original_size   = size;
-#endif
-         buf->size            = size;
-         buf->busy_size       = 0;
-#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
-         buf->max_busy_size   = 0;
-#endif
-         buf->first_free      = 0;
-         buf->first_busy      = 0;
+   tree_dest.is_branch = BUFF_FALSE;
+   tree_dest.elem_type.vector.vector           = dest;
+   tree_dest.elem_type.vector.vector_num_elems = dest_num_elems;
+
+   tree_src.is_branch = BUFF_FALSE;
+   tree_src.elem_type.vector.vector            = src;
+   tree_src.elem_type.vector.vector_num_elems  = src_num_elems;
+
+   return Buff_Copy_Tree_To_Tree(
+      &tree_dest,
+      1,
+      &tree_src,
+      1,
+      size,
+      offset_dest,
+      offset_src,
+      BUFF_MAKE_INVALID_PTR(Buff_Size_DT),
+      BUFF_MAKE_INVALID_PTR(Buff_Bool_DT));
 
-#if(BUFF_RING_USE_PROTECTION)
-         if(BUFF_PROTECTION_CREATE(buf))
-         {
-            if(BUFF_PROTECTION_INIT(buf))
-            {
-               result = BUFF_TRUE;
-            }
-         }
 #else
-         result = BUFF_TRUE;
-#endif
-      }
 
-      if(!result)
+   Buff_Size_DT      result = 0;
+   Buff_Size_DT      part;
+   Buff_Num_Elems_DT src_cntr = 0;
+   Buff_Num_Elems_DT dest_cntr = 0;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(Buff_Writeable_Vector_XT, dest) && BUFF_CHECK_PTR(Buff_Readable_Vector_XT, src)
+      && (dest_num_elems > 0)))
+   {
+      /* both vectors are walked together - one memcpy per each pair of overlapping parts of source and destination */
+      while((size > 0)
+         && BUFF_BOOL_IS_TRUE(buff_readable_vector_seek(src, src_num_elems, &src_cntr, &offset_src))
+         && BUFF_BOOL_IS_TRUE(buff_readable_vector_seek((const Buff_Readable_Vector_XT*)dest, dest_num_elems, &dest_cntr, &offset_dest)))
       {
-#if(BUFF_RING_USE_EXTENSIONS)
-         buf->extension  = BUFF_MAKE_INVALID_PTR(Buff_Ring_Extensions_XT);
-#endif
-#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
-         buf->protected_extension  = BUFF_MAKE_INVALID_PTR(Buff_Ring_Extensions_XT);
-#endif
-         buf->memory          = BUFF_MAKE_INVALID_PTR(void);
-#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
-         buf->original_size   = 0;
-#endif
-         buf->size            = 0;
-         buf->busy_size       = 0;
-#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
-         buf->max_busy_size   = 0;
-#endif
-         buf->first_free      = 0;
-         buf->first_busy      = 0;
+         part = src[src_cntr].size - offset_src;
+
+         if(part > (dest[dest_cntr].size - offset_dest))
+         {
+            part = dest[dest_cntr].size - offset_dest;
+         }
+         if(part > size)
+         {
+            part = size;
+         }
+
+         BUFF_MEMCPY( &((uint8_t*)(dest[dest_cntr].data))[offset_dest], &((const uint8_t*)(src[src_cntr].data))[offset_src], part);
+         offset_dest += part;
+         offset_src  += part;
+         result      += part;
+         size        -= part;
       }
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Ring_Init */
+
+#endif
+} /* Buff_Copy_Vector_To_Vector */
 #endif
 
 
 
-#if( (!defined(BUFF_RING_DEINIT_EXTERNAL)) && BUFF_RING_DEINIT_ENABLED )
-void   Buff_Ring_Deinit(Buff_Ring_XT *buf)
+#if( (!defined(BUFF_READABLE_VECTOR_CURSOR_EXTERNAL)) && BUFF_READABLE_VECTOR_CURSOR_ENABLED )
+void Buff_Readable_Vector_Cursor_Init(
+   Buff_Readable_Vector_Cursor_XT  *cursor,
+   const Buff_Readable_Vector_XT   *vector,
+   Buff_Num_Elems_DT                vector_num_elems,
+   Buff_Size_DT                     offset)
 {
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Vector_Cursor_XT, cursor)))
    {
-#if(BUFF_RING_USE_PROTECTION)
-      BUFF_PROTECTION_LOCK(buf);
-#endif
-
-#if(BUFF_RING_USE_EXTENSIONS)
-      buf->extension  = BUFF_MAKE_INVALID_PTR(Buff_Ring_Extensions_XT);
-#endif
-#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
-      buf->protected_extension  = BUFF_MAKE_INVALID_PTR(Buff_Ring_Extensions_XT);
-#endif
-      buf->memory          = BUFF_MAKE_INVALID_PTR(void);
-#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
-      buf->original_size   = 0;
-#endif
-      buf->size            = 0;
-      buf->busy_size       = 0;
-#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
-      buf->max_busy_size   = 0;
-#endif
-      buf->first_free      = 0;
-      buf->first_busy      = 0;
-
-#if(BUFF_RING_USE_PROTECTION)
-      BUFF_PROTECTION_UNLOCK(buf);
+      cursor->vector             = vector;
+      cursor->vector_num_elems   = BUFF_CHECK_PTR(Buff_Readable_Vector_XT, vector) ? vector_num_elems : 0;
+      cursor->elem               = 0;
+      cursor->elem_offset        = 0;
 
-      BUFF_PROTECTION_DEINIT(buf);
-      BUFF_PROTECTION_DESTROY(buf);
-#endif
+      (void)buff_readable_vector_cursor_copy(BUFF_MAKE_INVALID_PTR(uint8_t), cursor, offset);
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
-} /* Buff_Ring_Deinit */
-#endif
-
-
-
-#if( (!defined(BUFF_RING_INIT_EXTENSION_EXTERNAL)) && BUFF_RING_INIT_EXTENSION_ENABLED && BUFF_RING_USE_EXTENSIONS )
-void Buff_Ring_Init_Extension(Buff_Ring_Extensions_XT *extension)
-{
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension)))
-   {
-      extension->on_read_params        = BUFF_MAKE_INVALID_PTR(void);
-      extension->on_write_params       = BUFF_MAKE_INVALID_PTR(void);
-      extension->on_overwrite_params   = BUFF_MAKE_INVALID_PTR(void);
-      extension->on_remove_params      = BUFF_MAKE_INVALID_PTR(void);
-      extension->on_read               = BUFF_MAKE_INVALID_HANDLER(Buff_Ring_Extension_On_Read);
-      extension->on_write              = BUFF_MAKE_INVALID_HANDLER(Buff_Ring_Extension_On_Write);
-      extension->on_overwrite          = BUFF_MAKE_INVALID_HANDLER(Buff_Ring_Extension_On_Overwrite);
-      extension->on_remove             = BUFF_MAKE_INVALID_HANDLER(Buff_Ring_Extension_On_Remove);
-   }
-} /* Buff_Ring_Init_Extension */
-#endif
+} /* Buff_Readable_Vector_Cursor_Init */
 
 
 
-#if( (!defined(BUFF_RING_ADD_EXTENSION_EXTERNAL)) && BUFF_RING_ADD_EXTENSION_ENABLED && BUFF_RING_USE_EXTENSIONS )
-Buff_Bool_DT Buff_Ring_Add_Extension(Buff_Ring_XT *buf, Buff_Ring_Extensions_XT *extension)
+Buff_Size_DT Buff_Copy_From_Vector_Cursor(
+   void                            *dest,
+   Buff_Readable_Vector_Cursor_XT  *cursor,
+   Buff_Size_DT                     size)
 {
-   Buff_Bool_DT result = BUFF_FALSE;
+   Buff_Size_DT result = 0;
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, dest) && BUFF_CHECK_PTR(Buff_Readable_Vector_Cursor_XT, cursor)))
    {
-      buf->extension = extension;
-
-      result = BUFF_TRUE;
+      result = buff_readable_vector_cursor_copy((uint8_t*)dest, cursor, size);
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Ring_Add_Extension */
+} /* Buff_Copy_From_Vector_Cursor */
 #endif
 
 
 
-#if( (!defined(BUFF_RING_ADD_PROTECTED_EXTENSION_EXTERNAL)) && BUFF_RING_ADD_PROTECTED_EXTENSION_ENABLED && BUFF_RING_USE_PROTECTED_EXTENSIONS )
-Buff_Bool_DT Buff_Ring_Add_Protected_Extension(Buff_Ring_XT *buf, Buff_Ring_Extensions_XT *protected_extension)
+#if( (!defined(BUFF_VECTOR_TO_IOVEC_EXTERNAL)) && BUFF_VECTOR_TO_IOVEC_ENABLED && BUFF_USE_IOVEC && BUFF_READABLE_VECTOR_CURSOR_ENABLED )
+Buff_Size_DT Buff_Vector_To_Iovec(
+   struct iovec                    *iov,
+   Buff_Num_Elems_DT               *iov_num_elems,
+   Buff_Readable_Vector_Cursor_XT  *cursor,
+   Buff_Size_DT                     size,
+   Buff_Bool_DT                    *truncated)
 {
-   Buff_Bool_DT result = BUFF_FALSE;
+   Buff_Num_Elems_DT iov_used = 0;
+   Buff_Bool_DT      is_truncated = BUFF_FALSE;
+   Buff_Size_DT      result = 0;
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(struct iovec, iov) && BUFF_CHECK_PTR(Buff_Num_Elems_DT, iov_num_elems)
+      && BUFF_CHECK_PTR(Buff_Readable_Vector_Cursor_XT, cursor)))
    {
-      buf->protected_extension = protected_extension;
+      result = buff_readable_vector_cursor_to_iovec(iov, *iov_num_elems, &iov_used, cursor, size, &is_truncated);
 
-      result = BUFF_TRUE;
+      *iov_num_elems = iov_used;
+   }
+
+   if(BUFF_CHECK_PTR(Buff_Bool_DT, truncated))
+   {
+      *truncated = is_truncated;
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Ring_Add_Protected_Extension */
+} /* Buff_Vector_To_Iovec */
 #endif
 
+#endif /* #if(BUFF_USE_VECTOR_BUFFERS) */
 
 
-#if( (!defined(BUFF_PROTECTION_LOCK_EXTERNAL)) && BUFF_PROTECTION_LOCK_ENABLED && BUFF_RING_USE_PROTECTION )
-void Buff_Protection_Lock(Buff_Ring_XT *buf)
+
+#if(BUFF_USE_TREE_BUFFERS)
+
+#if( ((!defined(BUFF_GET_READABLE_TREE_DATA_SIZE_EXTERNAL)) && (BUFF_GET_READABLE_TREE_DATA_SIZE_ENABLED || BUFF_GET_WRITEABLE_TREE_DATA_SIZE_ENABLED)) \
+   || ((!defined(BUFF_READABLE_TREE_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_READABLE_TREE_GET_CONTINEOUS_SIZE_ENABLED) \
+   || ((!defined(BUFF_WRITEABLE_TREE_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_WRITEABLE_TREE_GET_CONTINEOUS_SIZE_ENABLED) \
+   || ((!defined(BUFF_COPY_FROM_TREE_EXTERNAL)) && BUFF_COPY_FROM_TREE_ENABLED) \
+   || ((!defined(BUFF_COPY_FROM_TREE_VENDOR_EXTERNAL)) && BUFF_COPY_FROM_TREE_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS) \
+   || ((!defined(BUFF_COPY_TO_TREE_EXTERNAL)) && BUFF_COPY_TO_TREE_ENABLED) \
+   || ((!defined(BUFF_COPY_TO_TREE_VENDOR_EXTERNAL)) && BUFF_COPY_TO_TREE_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS) \
+   || ((!defined(BUFF_COPY_TREE_TO_TREE_EXTERNAL)) && BUFF_COPY_TREE_TO_TREE_ENABLED) \
+   || ((!defined(BUFF_READABLE_TREE_FLATTEN_EXTERNAL)) && BUFF_READABLE_TREE_FLATTEN_ENABLED) \
+   || ((!defined(BUFF_WRITEABLE_TREE_FLATTEN_EXTERNAL)) && BUFF_WRITEABLE_TREE_FLATTEN_ENABLED) \
+   || ((!defined(BUFF_READABLE_TREE_CURSOR_EXTERNAL)) && BUFF_READABLE_TREE_CURSOR_ENABLED) )
+/**
+ * Tree walker - all tree functions walk trees without recursion, using stack of branches stored inside tree cursor structure.
+ * Stack depth is limited by BUFF_TREE_MAX_DEPTH; branches nested deeper end the walk and set is_too_deep of the walker
+ * (also reported by BUFF_DEBUG_ASSERT), so tree functions can report failure instead of processing part of the tree.
+ */
+static void buff_readable_tree_walker_init(
+   Buff_Readable_Tree_Cursor_XT *walker, const Buff_Readable_Tree_XT *tree, Buff_Num_Elems_DT tree_num_elems)
 {
-   BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
+   walker->stack[0].branch          = tree;
+   walker->stack[0].branch_num_elems= tree_num_elems;
+   walker->stack[0].elem            = 0;
+   walker->depth                    = BUFF_CHECK_PTR(const Buff_Readable_Tree_XT, tree) ? 1 : 0;
+   walker->vector.vector            = BUFF_MAKE_INVALID_PTR(const Buff_Readable_Vector_XT);
+   walker->vector.vector_num_elems  = 0;
+   walker->vector.elem              = 0;
+   walker->vector.elem_offset       = 0;
+   walker->is_too_deep              = BUFF_FALSE;
+} /* buff_readable_tree_walker_init */
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+
+
+/**
+ * Moves tree walker to next vector of the tree. Returns BUFF_FALSE if end of the tree has been reached.
+ */
+static Buff_Bool_DT buff_readable_tree_walker_next_vector(Buff_Readable_Tree_Cursor_XT *walker)
+{
+   const Buff_Readable_Tree_XT *elem;
+   Buff_Num_Elems_DT            level;
+
+   while(walker->depth > 0)
    {
-      BUFF_PROTECTION_LOCK(buf);
+      level = walker->depth - 1;
+
+      if(walker->stack[level].elem >= walker->stack[level].branch_num_elems)
+      {
+         /* end of branch - go back to parent */
+         walker->depth--;
+      }
+      else
+      {
+         elem = &(walker->stack[level].branch[walker->stack[level].elem]);
+         walker->stack[level].elem++;
+
+         if(BUFF_UNLIKELY(BUFF_BOOL_IS_TRUE(elem->is_branch)))
+         {
+            if(BUFF_CHECK_PTR(const Buff_Readable_Tree_XT, elem->elem_type.tree.branch))
+            {
+               BUFF_DEBUG_ASSERT(walker->depth < BUFF_TREE_MAX_DEPTH);
+
+               if(BUFF_UNLIKELY(walker->depth >= BUFF_TREE_MAX_DEPTH))
+               {
+                  /* tree too deep for the walker - walk is finished and failure is remembered */
+                  walker->depth        = 0;
+                  walker->is_too_deep  = BUFF_TRUE;
+               }
+               else
+               {
+                  walker->stack[walker->depth].branch           = elem->elem_type.tree.branch;
+                  walker->stack[walker->depth].branch_num_elems = elem->elem_type.tree.branch_num_elems;
+                  walker->stack[walker->depth].elem             = 0;
+                  walker->depth++;
+               }
+            }
+         }
+         else if(BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, elem->elem_type.vector.vector))
+         {
+            walker->vector.vector            = elem->elem_type.vector.vector;
+            walker->vector.vector_num_elems  = elem->elem_type.vector.vector_num_elems;
+            walker->vector.elem              = 0;
+            walker->vector.elem_offset       = 0;
+            break;
+         }
+      }
    }
 
-   BUFF_DEBUG_RING(buf);
-   BUFF_EXIT_FUNC();
-} /* Buff_Lock_Protection */
+   return (walker->depth > 0) ? BUFF_TRUE : BUFF_FALSE;
+} /* buff_readable_tree_walker_next_vector */
 #endif
 
 
 
-#if( (!defined(BUFF_PROTECTION_UNLOCK_EXTERNAL)) && BUFF_PROTECTION_UNLOCK_ENABLED && BUFF_RING_USE_PROTECTION )
-void Buff_Protection_Unlock(Buff_Ring_XT *buf)
+#if( ((!defined(BUFF_GET_READABLE_TREE_DATA_SIZE_EXTERNAL)) && (BUFF_GET_READABLE_TREE_DATA_SIZE_ENABLED || BUFF_GET_WRITEABLE_TREE_DATA_SIZE_ENABLED)) \
+   || ((!defined(BUFF_READABLE_TREE_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_READABLE_TREE_GET_CONTINEOUS_SIZE_ENABLED) \
+   || ((!defined(BUFF_WRITEABLE_TREE_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_WRITEABLE_TREE_GET_CONTINEOUS_SIZE_ENABLED) \
+   || ((!defined(BUFF_COPY_FROM_TREE_EXTERNAL)) && BUFF_COPY_FROM_TREE_ENABLED) \
+   || ((!defined(BUFF_COPY_FROM_TREE_VENDOR_EXTERNAL)) && BUFF_COPY_FROM_TREE_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS) \
+   || ((!defined(BUFF_COPY_TO_TREE_EXTERNAL)) && BUFF_COPY_TO_TREE_ENABLED) \
+   || ((!defined(BUFF_COPY_TO_TREE_VENDOR_EXTERNAL)) && BUFF_COPY_TO_TREE_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS) \
+   || ((!defined(BUFF_COPY_TREE_TO_TREE_EXTERNAL)) && BUFF_COPY_TREE_TO_TREE_ENABLED) \
+   || ((!defined(BUFF_READABLE_TREE_FLATTEN_EXTERNAL)) && BUFF_READABLE_TREE_FLATTEN_ENABLED) \
+   || ((!defined(BUFF_WRITEABLE_TREE_FLATTEN_EXTERNAL)) && BUFF_WRITEABLE_TREE_FLATTEN_ENABLED) )
+/**
+ * Returns next non-empty linear part of the tree or invalid pointer if end of the tree has been reached.
+ */
+static const Buff_Readable_Vector_XT *buff_readable_tree_walker_next_part(Buff_Readable_Tree_Cursor_XT *walker)
 {
-   BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
+   const Buff_Readable_Vector_XT *result = BUFF_MAKE_INVALID_PTR(const Buff_Readable_Vector_XT);
+   const Buff_Readable_Vector_XT *vector_elem;
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   do
    {
-      BUFF_PROTECTION_UNLOCK(buf);
-   }
+      while(walker->vector.elem < walker->vector.vector_num_elems)
+      {
+         vector_elem = &(walker->vector.vector[walker->vector.elem]);
+         walker->vector.elem++;
 
-   BUFF_DEBUG_RING(buf);
-   BUFF_EXIT_FUNC();
-} /* Buff_Unlock_Protection */
+         if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, vector_elem->data) && (vector_elem->size > 0)))
+         {
+            result = vector_elem;
+            break;
+         }
+      }
+   }while((!BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, result)) && BUFF_BOOL_IS_TRUE(buff_readable_tree_walker_next_vector(walker)));
+
+   return result;
+} /* buff_readable_tree_walker_next_part */
 #endif
 
 
 
-#if( (!defined(RING_BUF_IS_EMPTY_EXTERNAL)) && BUFF_RING_IS_EMPTY_ENABLED )
-Buff_Bool_DT Buff_Ring_Is_Empty(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
+#if( (!defined(BUFF_GET_READABLE_TREE_DATA_SIZE_EXTERNAL)) && (BUFF_GET_READABLE_TREE_DATA_SIZE_ENABLED || BUFF_GET_WRITEABLE_TREE_DATA_SIZE_ENABLED) )
+Buff_Size_DT Buff_Get_Readable_Tree_Data_Size(const Buff_Readable_Tree_XT *tree, Buff_Num_Elems_DT tree_num_elems)
 {
-   Buff_Bool_DT result = BUFF_TRUE;
-
-#if(!BUFF_RING_USE_PROTECTION)
-   BUFF_UNUSED_PARAM(use_protection);
-#endif
+   Buff_Readable_Tree_Cursor_XT   walker;
+   const Buff_Readable_Vector_XT *part;
+   Buff_Size_DT                   result = 0;
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Tree_XT, tree)))
    {
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
+      buff_readable_tree_walker_init(&walker, tree, tree_num_elems);
+
+      for(part = buff_readable_tree_walker_next_part(&walker);
+         BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, part);
+         part = buff_readable_tree_walker_next_part(&walker))
       {
-         BUFF_PROTECTION_LOCK(buf);
+         result += part->size;
       }
-#endif
-
-      result = BUFF_RING_IS_EMPTY(buf);
 
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
+      if(BUFF_UNLIKELY(BUFF_BOOL_IS_TRUE(walker.is_too_deep)))
       {
-         BUFF_PROTECTION_UNLOCK(buf);
+         result = 0;
       }
-#endif
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Ring_Is_Empty */
+} /* Buff_Get_Readable_Tree_Data_size */
 #endif
 
 
 
-#if( (!defined(RING_BUF_IS_FULL_EXTERNAL)) && BUFF_RING_IS_FULL_ENABLED )
-Buff_Bool_DT Buff_Ring_Is_Full(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
+#if( (!defined(BUFF_GET_WRITEABLE_TREE_DATA_SIZE_EXTERNAL)) && BUFF_GET_WRITEABLE_TREE_DATA_SIZE_ENABLED )
+Buff_Size_DT Buff_Get_Writeable_Tree_Data_Size(const Buff_Writeable_Tree_XT *tree, Buff_Num_Elems_DT tree_num_elems)
 {
-   Buff_Bool_DT result = BUFF_TRUE;
-
-#if(!BUFF_RING_USE_PROTECTION)
-   BUFF_UNUSED_PARAM(use_protection);
-#endif
+   Buff_Size_DT result;
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
-
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
-   {
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_LOCK(buf);
-      }
-#endif
-
-      result = BUFF_RING_IS_FULL(buf);
 
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_UNLOCK(buf);
-      }
-#endif
-   }
+   result = Buff_Get_Readable_Tree_Data_Size((const Buff_Readable_Tree_XT*)tree, tree_num_elems);
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Ring_Is_Full */
+} /* Buff_Get_Writeable_Tree_Data_size */
 #endif
 
 
 
-#if( (!defined(RING_BUF_GET_SIZE_EXTERNAL)) && BUFF_RING_GET_SIZE_ENABLED )
-Buff_Size_DT Buff_Ring_Get_Size(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
+#if(( (!defined(BUFF_READABLE_TREE_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_READABLE_TREE_GET_CONTINEOUS_SIZE_ENABLED ) || ( (!defined(BUFF_WRITEABLE_TREE_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_WRITEABLE_TREE_GET_CONTINEOUS_SIZE_ENABLED ) )
+static Buff_Size_DT buff_readable_tree_get_contineous_size_internal(
+   const Buff_Readable_Tree_XT *tree, Buff_Num_Elems_DT tree_num_elems, Buff_Size_DT offset)
 {
-   Buff_Size_DT result = 0;
-
-#if(!BUFF_RING_USE_PROTECTION)
-   BUFF_UNUSED_PARAM(use_protection);
-#endif
+   Buff_Readable_Tree_Cursor_XT   walker;
+   const Buff_Readable_Vector_XT *part;
+   Buff_Size_DT                   pos = 0;
+   Buff_Size_DT                   result = 0;
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Tree_XT, tree)))
    {
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
+      buff_readable_tree_walker_init(&walker, tree, tree_num_elems);
+
+      for(part = buff_readable_tree_walker_next_part(&walker);
+         BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, part);
+         part = buff_readable_tree_walker_next_part(&walker))
       {
-         BUFF_PROTECTION_LOCK(buf);
-      }
-#endif
+         pos += part->size;
 
-      result = BUFF_RING_GET_SIZE(buf);
+         if(offset < pos)
+         {
+            result = pos - offset;
+            break;
+         }
+      }
 
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
+      if(BUFF_UNLIKELY(BUFF_BOOL_IS_TRUE(walker.is_too_deep)))
       {
-         BUFF_PROTECTION_UNLOCK(buf);
+         result = 0;
       }
-#endif
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Ring_Get_Size */
+} /* buff_readable_tree_get_contineous_size_internal */
 #endif
 
 
 
-#if( (!defined(RING_BUF_GET_BUSY_SIZE_EXTERNAL)) && BUFF_RING_GET_BUSY_SIZE_ENABLED )
-Buff_Size_DT Buff_Ring_Get_Busy_Size(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
+#if( (!defined(BUFF_READABLE_TREE_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_READABLE_TREE_GET_CONTINEOUS_SIZE_ENABLED )
+Buff_Size_DT Buff_Readable_Tree_Get_Contineous_Size(
+   const Buff_Readable_Tree_XT *tree, Buff_Num_Elems_DT tree_num_elems, Buff_Size_DT offset)
 {
-   Buff_Size_DT result = 0;
-
-#if(!BUFF_RING_USE_PROTECTION)
-   BUFF_UNUSED_PARAM(use_protection);
-#endif
+   Buff_Size_DT                  result = 0;
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
-   {
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_LOCK(buf);
-      }
-#endif
+   result = buff_readable_tree_get_contineous_size_internal(tree, tree_num_elems, offset);
 
-      result = BUFF_RING_GET_BUSY_SIZE(buf);
+   BUFF_EXIT_FUNC();
 
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_UNLOCK(buf);
-      }
+   return result;
+} /* Buff_Readable_Tree_Get_Contineous_Size */
 #endif
-   }
 
-   BUFF_DEBUG_RING(buf);
+
+
+#if( (!defined(BUFF_WRITEABLE_TREE_GET_CONTINEOUS_SIZE_EXTERNAL)) && BUFF_WRITEABLE_TREE_GET_CONTINEOUS_SIZE_ENABLED )
+Buff_Size_DT Buff_Writeable_Tree_Get_Contineous_Size(
+   const Buff_Writeable_Tree_XT *tree, Buff_Num_Elems_DT tree_num_elems, Buff_Size_DT offset)
+{
+   Buff_Size_DT                  result = 0;
+
+   BUFF_ENTER_FUNC();
+
+   result = buff_readable_tree_get_contineous_size_internal((const Buff_Readable_Tree_XT *)tree, tree_num_elems, offset);
+
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Ring_Get_Busy_Size */
+} /* Buff_Writeable_Tree_Get_Contineous_Size */
 #endif
 
 
 
-#if( (!defined(RING_BUF_GET_BUSY_SIZE_EXTERNAL)) && BUFF_RING_GET_BUSY_SIZE_ENABLED && BUFF_RING_USE_BUSY_SIZE_MONITORING )
-Buff_Size_DT Buff_Ring_Get_Max_Busy_Size(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
+#if( (!defined(BUFF_COPY_FROM_TREE_EXTERNAL)) && BUFF_COPY_FROM_TREE_ENABLED )
+Buff_Size_DT Buff_Copy_From_Tree(
+   void                         *dest,
+   const Buff_Readable_Tree_XT  *src,
+   Buff_Num_Elems_DT             src_num_elems,
+   Buff_Size_DT                  size,
+   Buff_Size_DT                  offset_dest,
+   Buff_Size_DT                  offset_src,
+   Buff_Size_DT                 *str_size)
 {
-   Buff_Size_DT result = 0;
+#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VENDOR_BUFFERS)
 
-#if(!BUFF_RING_USE_PROTECTION)
-   BUFF_UNUSED_PARAM(use_protection);
-#endif
+   return Buff_Copy_From_Tree_Vendor(dest, src, src_num_elems, size, offset_dest, offset_src, str_size, buff_vendor_memcpy);
+
+#else
+
+   Buff_Readable_Tree_Cursor_XT   walker;
+   const Buff_Readable_Vector_XT *vector_elem;
+   Buff_Size_DT      result = 0;
+   Buff_Size_DT      pos = 0;
+   Buff_Size_DT      part;
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(void, dest) && BUFF_CHECK_PTR(Buff_Readable_Tree_XT, src) && (src_num_elems > 0)))
    {
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
+      buff_readable_tree_walker_init(&walker, src, src_num_elems);
+
+      for(vector_elem = buff_readable_tree_walker_next_part(&walker);
+         BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, vector_elem);
+         vector_elem = buff_readable_tree_walker_next_part(&walker))
       {
-         BUFF_PROTECTION_LOCK(buf);
+         /* offset_src is never smaller than pos here - it is moved together with copied data */
+         if(offset_src < (pos + vector_elem->size))
+         {
+            part = pos + vector_elem->size - offset_src;
+
+            if(part > size)
+            {
+               part = size;
+            }
+
+            BUFF_MEMCPY( &((uint8_t*)dest)[offset_dest], &((const uint8_t*)(vector_elem->data))[offset_src - pos], part);
+            offset_dest += part;
+            offset_src  += part;
+            result      += part;
+            size        -= part;
+
+            if(0 == size)
+            {
+               pos = offset_src;
+               break;
+            }
+         }
+
+         pos += vector_elem->size;
       }
-#endif
 
-      result = BUFF_RING_GET_MAX_BUSY_SIZE(buf);
+      if(BUFF_UNLIKELY(BUFF_BOOL_IS_TRUE(walker.is_too_deep)))
+      {
+         result = 0;
+         pos    = 0;
+      }
 
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
+      if(BUFF_CHECK_PTR(Buff_Size_DT, str_size))
       {
-         BUFF_PROTECTION_UNLOCK(buf);
+         *str_size = pos;
       }
-#endif
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Ring_Get_Max_Busy_Size */
+
+#endif
+} /* Buff_Copy_From_Tree */
 #endif
 
 
 
-#if( (!defined(RING_BUF_GET_FREE_SIZE_EXTERNAL)) && BUFF_RING_GET_FREE_SIZE_ENABLED )
-Buff_Size_DT Buff_Ring_Get_Free_Size(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
+#if( (!defined(BUFF_COPY_FROM_TREE_VENDOR_EXTERNAL)) && BUFF_COPY_FROM_TREE_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS )
+Buff_Size_DT Buff_Copy_From_Tree_Vendor(
+   void                         *dest,
+   const Buff_Readable_Tree_XT  *src,
+   Buff_Num_Elems_DT             src_num_elems,
+   Buff_Size_DT                  size,
+   Buff_Size_DT                  offset_dest,
+   Buff_Size_DT                  offset_src,
+   Buff_Size_DT                 *str_size,
+   Buff_Vendor_Memcpy_HT         vendor_cpy)
 {
-   Buff_Size_DT result = 0;
-
-#if(!BUFF_RING_USE_PROTECTION)
-   BUFF_UNUSED_PARAM(use_protection);
-#endif
+   Buff_Readable_Tree_Cursor_XT   walker;
+   const Buff_Readable_Vector_XT *vector_elem;
+   Buff_Memcpy_Params_XT memcpy_params;
+   Buff_Size_DT      result = 0;
+   Buff_Size_DT      memcpy_result;
+   Buff_Size_DT      pos = 0;
+   Buff_Size_DT      part;
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(void, dest) && BUFF_CHECK_PTR(Buff_Readable_Tree_XT, src) && (src_num_elems > 0)
+      && BUFF_CHECK_HANDLER(Buff_Vendor_Memcpy_HT, vendor_cpy)))
    {
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_LOCK(buf);
-      }
-#endif
+      memcpy_params.dest = dest;
 
-      result = BUFF_RING_GET_FREE_SIZE(buf);
+      buff_readable_tree_walker_init(&walker, src, src_num_elems);
 
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
+      for(vector_elem = buff_readable_tree_walker_next_part(&walker);
+         BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, vector_elem);
+         vector_elem = buff_readable_tree_walker_next_part(&walker))
       {
-         BUFF_PROTECTION_UNLOCK(buf);
-      }
-#endif
-   }
+         if(offset_src < (pos + vector_elem->size))
+         {
+            part = pos + vector_elem->size - offset_src;
 
-   BUFF_DEBUG_RING(buf);
-   BUFF_EXIT_FUNC();
+            memcpy_params.src          = vector_elem->data;
+            memcpy_params.dest_offset  = offset_dest;
+            memcpy_params.src_offset   = offset_src - pos;
+            memcpy_params.is_last_part = BUFF_FALSE;
 
-   return result;
-} /* Buff_Ring_Get_Free_Size */
-#endif
+            if(part >= size)
+            {
+               part = size;
+               memcpy_params.is_last_part = BUFF_TRUE;
+            }
 
+            memcpy_params.size = part;
 
+            memcpy_result = vendor_cpy(&memcpy_params);
 
-#if( (!defined(RING_BUF_GET_CONTINOUS_FREE_SIZE_EXTERNAL)) && BUFF_RING_GET_CONTINOUS_FREE_SIZE_ENABLED )
-Buff_Size_DT Buff_Ring_Get_Continous_Free_Size(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
-{
-   Buff_Size_DT result = 0;
+            /* vendor memcpy took less data than provided - copying is finished */
+            if(BUFF_UNLIKELY(memcpy_result < part))
+            {
+               part = memcpy_result;
+               size = part;
+            }
 
-#if(!BUFF_RING_USE_PROTECTION)
-   BUFF_UNUSED_PARAM(use_protection);
-#endif
+            offset_dest += part;
+            offset_src  += part;
+            result      += part;
+            size        -= part;
 
-   BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
+            if(0 == size)
+            {
+               pos = offset_src;
+               break;
+            }
+         }
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
-   {
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_LOCK(buf);
+         pos += vector_elem->size;
       }
-#endif
 
-      if(BUFF_RING_IS_FREE_SPACE_CONTINOUS(buf))
-      {
-         result = BUFF_RING_GET_FREE_SIZE(buf);
-      }
-      else
+      if(BUFF_UNLIKELY(BUFF_BOOL_IS_TRUE(walker.is_too_deep)))
       {
-         result = buf->size - buf->first_free;
+         result = 0;
+         pos    = 0;
       }
 
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
+      if(BUFF_CHECK_PTR(Buff_Size_DT, str_size))
       {
-         BUFF_PROTECTION_UNLOCK(buf);
+         *str_size = pos;
       }
-#endif
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Ring_Get_Continous_Free_Size */
+} /* Buff_Copy_From_Tree_Vendor */
 #endif
 
 
 
-#if( (!defined(BUFF_RING_GET_CURRENT_POS_EXTERNAL)) && BUFF_RING_GET_CURRENT_POS_ENABLED )
-Buff_Size_DT Buff_Ring_Get_Current_Pos(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
+#if( (!defined(BUFF_COPY_FROM_TREE_CHECKSUM_EXTERNAL)) && BUFF_COPY_FROM_TREE_CHECKSUM_ENABLED && BUFF_COPY_FROM_TREE_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS && BUFF_USE_CHECKSUM \
+   && BUFF_MEMCPY_CHECKSUM_ENABLED )
+Buff_Size_DT Buff_Copy_From_Tree_Checksum(
+   void                         *dest,
+   const Buff_Readable_Tree_XT  *src,
+   Buff_Num_Elems_DT             src_num_elems,
+   Buff_Size_DT                  size,
+   Buff_Size_DT                  offset_dest,
+   Buff_Size_DT                  offset_src,
+   Buff_Size_DT                 *str_size,
+   Buff_Checksum_XT             *checksum)
 {
-   Buff_Size_DT result = 0;
-
-#if(!BUFF_RING_USE_PROTECTION)
-   BUFF_UNUSED_PARAM(use_protection);
-#endif
+   buff_checksum_context_XT context;
+   Buff_Size_DT             result = 0;
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, dest) && BUFF_CHECK_PTR(Buff_Checksum_XT, checksum)))
    {
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_LOCK(buf);
-      }
-#endif
-
-      result = BUFF_RING_GET_CURRENT_POS(buf);
+      context.dest     = dest;
+      context.checksum = checksum;
 
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_UNLOCK(buf);
-      }
-#endif
+      result = Buff_Copy_From_Tree_Vendor(
+         &context, src, src_num_elems, size, offset_dest, offset_src, str_size, buff_checksum_vendor_memcpy_to_context);
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
    return result;
-}/* Buff_Ring_Get_Current_Pos */
+} /* Buff_Copy_From_Tree_Checksum */
 #endif
 
 
 
-#if( (!defined(BUFF_RING_DATA_CHECK_OUT_EXTERNAL)) && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED )
-void *Buff_Ring_Data_Check_Out(
-   Buff_Ring_XT  *buf,
-   Buff_Size_DT   size_needed,
-   Buff_Bool_DT   overwrite_if_no_free_space,
-   Buff_Bool_DT   use_protection)
+#if( (!defined(BUFF_COPY_TO_TREE_EXTERNAL)) && BUFF_COPY_TO_TREE_ENABLED )
+Buff_Size_DT Buff_Copy_To_Tree(
+   const Buff_Writeable_Tree_XT *dest,
+   Buff_Num_Elems_DT             dest_num_elems,
+   const void                   *src,
+   Buff_Size_DT                  size,
+   Buff_Size_DT                  offset_dest,
+   Buff_Size_DT                  offset_src,
+   Buff_Size_DT                 *str_size)
 {
-   void          *result = BUFF_MAKE_INVALID_PTR(void);
-   Buff_Bool_DT   resize_occured = BUFF_FALSE;
+#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VENDOR_BUFFERS)
 
-#if(!BUFF_RING_USE_PROTECTION)
-   BUFF_UNUSED_PARAM(use_protection);
-#endif
-#if(!BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
-   BUFF_UNUSED_PARAM(overwrite_if_no_free_space);
-#endif
+   return Buff_Copy_To_Tree_Vendor(dest, dest_num_elems, src, size, offset_dest, offset_src, str_size, buff_vendor_memcpy);
+
+#else
+
+   Buff_Readable_Tree_Cursor_XT   walker;
+   const Buff_Readable_Vector_XT *vector_elem;
+   Buff_Size_DT      result = 0;
+   Buff_Size_DT      pos = 0;
+   Buff_Size_DT      part;
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && (size_needed <= buf->original_size)))
+   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(const void, src) && BUFF_CHECK_PTR(Buff_Writeable_Tree_XT, dest)
+      && (dest_num_elems > 0)))
    {
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_LOCK(buf);
-      }
-#endif
+      /* writeable tree has same layout as readable one - it is walked the same way */
+      buff_readable_tree_walker_init(&walker, (const Buff_Readable_Tree_XT*)dest, dest_num_elems);
 
-      /* free space is not continous - part of free space is at the end of the buffer, part on the begining */
-      if(!BUFF_RING_IS_FREE_SPACE_CONTINOUS(buf))
+      for(vector_elem = buff_readable_tree_walker_next_part(&walker);
+         BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, vector_elem);
+         vector_elem = buff_readable_tree_walker_next_part(&walker))
       {
-         /* part of free space at the end of the buffer is too small to contain requested size */
-         if(size_needed > (buf->size - buf->first_free))
+         /* offset_dest is never smaller than pos here - it is moved together with copied data */
+         if(offset_dest < (pos + vector_elem->size))
          {
-            buf->size         = buf->first_free;
-            buf->first_free   = 0;
-            resize_occured    = BUFF_TRUE;
+            part = pos + vector_elem->size - offset_dest;
+
+            if(part > size)
+            {
+               part = size;
+            }
+
+            BUFF_MEMCPY( &((uint8_t*)(vector_elem->data))[offset_dest - pos], &((const uint8_t*)src)[offset_src], part);
+            offset_dest += part;
+            offset_src  += part;
+            result      += part;
+            size        -= part;
+
+            if(0 == size)
+            {
+               pos = offset_dest;
+               break;
+            }
          }
-      }
 
-#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
-      if((size_needed > BUFF_RING_GET_FREE_SIZE(buf)) && BUFF_BOOL_IS_TRUE(overwrite_if_no_free_space))
-      {
-         Buff_Ring_Remove(buf, size_needed - BUFF_RING_GET_FREE_SIZE(buf), BUFF_FALSE);
+         pos += vector_elem->size;
       }
-#endif
 
-      /* return pointer if there is enough free space */
-      if(size_needed <= BUFF_RING_GET_FREE_SIZE(buf))
+      if(BUFF_UNLIKELY(BUFF_BOOL_IS_TRUE(walker.is_too_deep)))
       {
-         result = (void*)(&((uint8_t*)(buf->memory))[BUFF_RING_GET_CURRENT_POS(buf)]);
+         result = 0;
+         pos    = 0;
       }
-      /* there is not enough space so invalid pointer is returned. anyway, if resize occured restore original size. */
-      else if(BUFF_BOOL_IS_TRUE(resize_occured))
+
+      if(BUFF_CHECK_PTR(Buff_Size_DT, str_size))
       {
-         buf->first_free   = buf->size;
-         buf->size         = buf->original_size;
+         *str_size = pos;
       }
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Ring_Data_Check_Out */
+
+#endif
+} /* Buff_Copy_To_Tree */
 #endif
 
 
 
-#if( (!defined(BUFF_RING_DATA_CHECK_IN_EXTERNAL)) && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED )
-Buff_Size_DT Buff_Ring_Data_Check_In(Buff_Ring_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection)
+#if( (!defined(BUFF_COPY_TO_TREE_VENDOR_EXTERNAL)) && BUFF_COPY_TO_TREE_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS )
+Buff_Size_DT Buff_Copy_To_Tree_Vendor(
+   const Buff_Writeable_Tree_XT *dest,
+   Buff_Num_Elems_DT             dest_num_elems,
+   const void                   *src,
+   Buff_Size_DT                  size,
+   Buff_Size_DT                  offset_dest,
+   Buff_Size_DT                  offset_src,
+   Buff_Size_DT                 *str_size,
+   Buff_Vendor_Memcpy_HT         vendor_cpy)
 {
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Ring_Extensions_XT *extension;
-   Buff_Ring_Extension_On_Write on_write;
-#endif
-   Buff_Size_DT result = (Buff_Size_DT)(-1);
-   Buff_Size_DT part_at_the_end_size = 0;
-   Buff_Size_DT cntr;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Bool_DT rewind_occured = BUFF_FALSE;
-#endif
-
-#if(!BUFF_RING_USE_PROTECTION)
-   BUFF_UNUSED_PARAM(use_protection);
-#endif
+   Buff_Readable_Tree_Cursor_XT   walker;
+   const Buff_Readable_Vector_XT *vector_elem;
+   Buff_Memcpy_Params_XT memcpy_params;
+   Buff_Size_DT      result = 0;
+   Buff_Size_DT      memcpy_result;
+   Buff_Size_DT      pos = 0;
+   Buff_Size_DT      part;
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(const void, src) && BUFF_CHECK_PTR(Buff_Writeable_Tree_XT, dest) && (dest_num_elems > 0)
+      && BUFF_CHECK_HANDLER(Buff_Vendor_Memcpy_HT, vendor_cpy)))
    {
-      if(BUFF_LIKELY((size <= BUFF_RING_GET_FREE_SIZE(buf)) && (size > 0)))
-      {
-         buf->busy_size += size;
+      memcpy_params.src = src;
 
-#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
-         if(buf->busy_size >= buf->max_busy_size)
-         {
-            buf->max_busy_size = buf->busy_size;
-         }
-#endif
+      buff_readable_tree_walker_init(&walker, (const Buff_Readable_Tree_XT*)dest, dest_num_elems);
 
-         /* do buffer de-fragmentation */
-         if(BUFF_UNLIKELY((0 == buf->first_free) && (buf->size != buf->original_size)))
+      for(vector_elem = buff_readable_tree_walker_next_part(&walker);
+         BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, vector_elem);
+         vector_elem = buff_readable_tree_walker_next_part(&walker))
+      {
+         if(offset_dest < (pos + vector_elem->size))
          {
-            part_at_the_end_size = (size <= (buf->original_size - buf->size)) ? size : buf->original_size - buf->size;
-
-            memcpy(&(((uint8_t*)(buf->memory))[buf->size]), buf->memory, part_at_the_end_size);
+            part = pos + vector_elem->size - offset_dest;
 
-            size -= part_at_the_end_size;
+            memcpy_params.dest         = (void*)(vector_elem->data);
+            memcpy_params.dest_offset  = offset_dest - pos;
+            memcpy_params.src_offset   = offset_src;
+            memcpy_params.is_last_part = BUFF_FALSE;
 
-            for(cntr = 0; cntr < size; cntr++)
+            if(part >= size)
             {
-               ((uint8_t*)(buf->memory))[cntr] = ((uint8_t*)(buf->memory))[cntr + part_at_the_end_size];
+               part = size;
+               memcpy_params.is_last_part = BUFF_TRUE;
             }
 
-            result          = buf->size;
-            buf->first_free = buf->size + part_at_the_end_size;
-            buf->size       = buf->original_size;
+            memcpy_params.size = part;
 
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            if(size > 0)
+            memcpy_result = vendor_cpy(&memcpy_params);
+
+            /* vendor memcpy took less data than provided - copying is finished */
+            if(BUFF_UNLIKELY(memcpy_result < part))
             {
-               rewind_occured = BUFF_TRUE;
+               part = memcpy_result;
+               size = part;
             }
-#endif
-         }
-         else
-         {
-            result = buf->first_free;
-         }
-         buf->first_free += size;
-
-         if(BUFF_UNLIKELY(buf->first_free >= buf->size))
-         {
-            buf->first_free -= buf->size;
-         }
-
-#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
-         extension = buf->protected_extension;
 
-         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
-         {
-            on_write = extension->on_write;
+            offset_dest += part;
+            offset_src  += part;
+            result      += part;
+            size        -= part;
 
-            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+            if(0 == size)
             {
-               on_write(buf, extension, part_at_the_end_size + size, rewind_occured);
+               pos = offset_dest;
+               break;
             }
          }
-#endif
+
+         pos += vector_elem->size;
       }
 
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
+      if(BUFF_UNLIKELY(BUFF_BOOL_IS_TRUE(walker.is_too_deep)))
       {
-         BUFF_PROTECTION_UNLOCK(buf);
+         result = 0;
+         pos    = 0;
       }
-#endif
-
-#if(BUFF_RING_USE_EXTENSIONS)
-      extension = buf->extension;
 
-      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && ((Buff_Size_DT)(-1) != result))
+      if(BUFF_CHECK_PTR(Buff_Size_DT, str_size))
       {
-         on_write = extension->on_write;
-
-         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
-         {
-            on_write(buf, extension, part_at_the_end_size + size, rewind_occured);
-         }
+         *str_size = pos;
       }
-#endif
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Ring_Data_Check_In */
+} /* Buff_Copy_To_Tree_Vendor */
 #endif
 
 
 
-#if( (!defined(RING_BUF_WRITE_EXTERNAL)) && BUFF_RING_WRITE_ENABLED )
-Buff_Size_DT Buff_Ring_Write(
-   Buff_Ring_XT  *buf,
-   const void    *data,
-   Buff_Size_DT   size,
-   Buff_Bool_DT   overwrite_if_no_free_space,
-   Buff_Bool_DT   use_protection)
+#if( (!defined(BUFF_COPY_TO_TREE_CHECKSUM_EXTERNAL)) && BUFF_COPY_TO_TREE_CHECKSUM_ENABLED && BUFF_COPY_TO_TREE_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS && BUFF_USE_CHECKSUM \
+   && BUFF_MEMCPY_CHECKSUM_ENABLED )
+Buff_Size_DT Buff_Copy_To_Tree_Checksum(
+   const Buff_Writeable_Tree_XT *dest,
+   Buff_Num_Elems_DT             dest_num_elems,
+   const void                   *src,
+   Buff_Size_DT                  size,
+   Buff_Size_DT                  offset_dest,
+   Buff_Size_DT                  offset_src,
+   Buff_Size_DT                 *str_size,
+   Buff_Checksum_XT             *checksum)
 {
-#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VENDOR_BUFFERS)
-
-   return Buff_Ring_Write_Vendor(buf, data, size, buff_vendor_memcpy, overwrite_if_no_free_space, use_protection);
+   buff_checksum_context_XT context;
+   Buff_Size_DT             result = 0;
 
-#elif(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+   BUFF_ENTER_FUNC();
 
-   Buff_Readable_Tree_XT tree;
-   Buff_Readable_Vector_XT vector;
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, src) && BUFF_CHECK_PTR(Buff_Checksum_XT, checksum)))
+   {
+      context.src      = src;
+      context.checksum = checksum;
 
-   tree.is_branch = BUFF_FALSE;
-   tree.elem_type.vector.vector           = &vector;
-   tree.elem_type.vector.vector_num_elems = 1;
+      result = Buff_Copy_To_Tree_Vendor(
+         dest, dest_num_elems, &context, size, offset_dest, offset_src, str_size, buff_checksum_vendor_memcpy_from_context);
+   }
 
-   vector.data = data;
-   vector.size = size;
+   BUFF_EXIT_FUNC();
 
-   return Buff_Ring_Write_From_Tree(
-      buf, &tree, 1, size, 0, overwrite_if_no_free_space, use_protection);
+   return result;
+} /* Buff_Copy_To_Tree_Checksum */
+#endif
 
-#elif(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VECTOR_BUFFERS)
 
-   Buff_Readable_Vector_XT vector;
 
-   vector.data = data;
-   vector.size = size;
+#if( (!defined(BUFF_COPY_TREE_TO_TREE_EXTERNAL)) && BUFF_COPY_TREE_TO_TREE_ENABLED )
+Buff_Size_DT Buff_Copy_Tree_To_Tree(
+   const Buff_Writeable_Tree_XT *dest,
+   Buff_Num_Elems_DT             dest_num_elems,
+   const Buff_Readable_Tree_XT  *src,
+   Buff_Num_Elems_DT             src_num_elems,
+   Buff_Size_DT                  size,
+   Buff_Size_DT                  offset_dest,
+   Buff_Size_DT                  offset_src,
+   Buff_Size_DT                 *str_size,
+   Buff_Bool_DT                 *end_of_destination_reached)
+{
+   Buff_Readable_Tree_Cursor_XT   src_walker;
+   Buff_Readable_Tree_Cursor_XT   dest_walker;
+   const Buff_Readable_Vector_XT *src_part;
+   const Buff_Readable_Vector_XT *dest_part;
+   Buff_Size_DT      result = 0;
+   Buff_Size_DT      src_pos = 0;
+   Buff_Size_DT      part;
+   Buff_Bool_DT      end_of_destination = BUFF_FALSE;
 
-   return Buff_Ring_Write_From_Vector(
-      buf, &vector, 1, size, 0, overwrite_if_no_free_space, use_protection);
+   BUFF_ENTER_FUNC();
 
-#else
+   if(BUFF_LIKELY((size > 0)
+      && BUFF_CHECK_PTR(Buff_Writeable_Tree_XT, dest) && (dest_num_elems > 0)
+      && BUFF_CHECK_PTR(Buff_Readable_Tree_XT, src) && (src_num_elems > 0)))
+   {
+      buff_readable_tree_walker_init(&src_walker, src, src_num_elems);
+      buff_readable_tree_walker_init(&dest_walker, (const Buff_Readable_Tree_XT*)dest, dest_num_elems);
 
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Ring_Extensions_XT *extension;
-   Buff_Ring_Extension_On_Write on_write;
-#endif
-   Buff_Size_DT part_size;
-   Buff_Size_DT count = 0;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Bool_DT rewind_occured = BUFF_FALSE;
-#if(BUFF_RING_USE_EXTENSIONS)
-   Buff_Bool_DT data_changed = BUFF_FALSE;
-#endif
-#endif
+      src_part  = buff_readable_tree_walker_next_part(&src_walker);
+      dest_part = buff_readable_tree_walker_next_part(&dest_walker);
 
-#if(!BUFF_RING_USE_PROTECTION)
-   BUFF_UNUSED_PARAM(use_protection);
-#endif
+      /* both trees are walked together - one memcpy per each pair of overlapping parts of source and destination */
+      while(size > 0)
+      {
+         /* offsets are relative to current parts; skip parts which are already behind them */
+         while(BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, src_part) && (offset_src >= src_part->size))
+         {
+            offset_src -= src_part->size;
+            src_pos    += src_part->size;
+            src_part    = buff_readable_tree_walker_next_part(&src_walker);
+         }
+         while(BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, dest_part) && (offset_dest >= dest_part->size))
+         {
+            offset_dest-= dest_part->size;
+            dest_part   = buff_readable_tree_walker_next_part(&dest_walker);
+         }
 
-   BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
+         if(!BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, src_part))
+         {
+            break;
+         }
+         else if(!BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, dest_part))
+         {
+            /* less data was copied to destination than requested */
+            end_of_destination = BUFF_TRUE;
+            break;
+         }
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
-   {
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_LOCK(buf);
+         part = src_part->size - offset_src;
+
+         if(part > (dest_part->size - offset_dest))
+         {
+            part = dest_part->size - offset_dest;
+         }
+         if(part > size)
+         {
+            part = size;
+         }
+
+         BUFF_MEMCPY( &((uint8_t*)(dest_part->data))[offset_dest], &((const uint8_t*)(src_part->data))[offset_src], part);
+         offset_dest += part;
+         offset_src  += part;
+         result      += part;
+         size        -= part;
       }
-#endif
 
-      count = BUFF_RING_GET_FREE_SIZE(buf);
+      if(BUFF_UNLIKELY(BUFF_BOOL_IS_TRUE(src_walker.is_too_deep) || BUFF_BOOL_IS_TRUE(dest_walker.is_too_deep)))
+      {
+         result   = 0;
+         src_pos  = 0;
+         src_part = BUFF_MAKE_INVALID_PTR(const Buff_Readable_Vector_XT);
+      }
 
-      if(BUFF_LIKELY(size <= count))
+      if(BUFF_CHECK_PTR(Buff_Bool_DT, end_of_destination_reached))
       {
-         count = size;
+         *end_of_destination_reached = end_of_destination;
       }
-#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
-      else if(BUFF_BOOL_IS_TRUE(overwrite_if_no_free_space))
+
+      if(BUFF_CHECK_PTR(Buff_Size_DT, str_size))
       {
-         if(BUFF_LIKELY(size < buf->size))
-         {
-            Buff_Ring_Remove(buf, size - count, BUFF_FALSE);
+         /* position in source on which copying stopped or size of source if it has ended */
+         *str_size = BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, src_part) ? (src_pos + offset_src) : src_pos;
+      }
+   }
 
-            count = size;
-         }
-         else
-         {
-            Buff_Ring_Clear(buf, BUFF_FALSE);
+   BUFF_EXIT_FUNC();
 
-            count = buf->size;
-         }
-      }
+   return result;
+} /* Buff_Copy_Tree_To_Tree */
 #endif
 
-      if(BUFF_LIKELY(count > 0))
+
+
+#if( ((!defined(BUFF_READABLE_TREE_FLATTEN_EXTERNAL)) && BUFF_READABLE_TREE_FLATTEN_ENABLED) || ((!defined(BUFF_WRITEABLE_TREE_FLATTEN_EXTERNAL)) && BUFF_WRITEABLE_TREE_FLATTEN_ENABLED) )
+static Buff_Bool_DT buff_readable_tree_flatten_internal(
+   Buff_Readable_Flat_Tree_XT *flat, Buff_Num_Elems_DT max_num_elems, const Buff_Readable_Tree_XT *tree, Buff_Num_Elems_DT tree_num_elems)
+{
+   Buff_Readable_Tree_Cursor_XT   walker;
+   const Buff_Readable_Vector_XT *vector_elem;
+   Buff_Bool_DT                   result = BUFF_TRUE;
+
+   buff_readable_tree_walker_init(&walker, tree, tree_num_elems);
+
+   /* walker skips empty parts - they are never copied so binary search doesn't have to consider them */
+   for(vector_elem = buff_readable_tree_walker_next_part(&walker);
+      BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, vector_elem);
+      vector_elem = buff_readable_tree_walker_next_part(&walker))
+   {
+      if(BUFF_UNLIKELY(flat->vector_num_elems >= max_num_elems))
       {
-#if(BUFF_RING_USE_EXTENSIONS)
-         data_changed = BUFF_TRUE;
-#endif
-         if(BUFF_LIKELY(buf->first_free <= (buf->size - count)))
-         {
-            memcpy( &((uint8_t*)(buf->memory))[buf->first_free], data, count);
+         result = BUFF_FALSE;
+         break;
+      }
 
-            buf->busy_size      += count;
-            buf->first_free     += count;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            rewind_occured       = BUFF_FALSE;
-#endif
+      flat->vector[flat->vector_num_elems] = *vector_elem;
+      flat->offset[flat->vector_num_elems] = flat->size;
+      flat->vector_num_elems++;
+      flat->size += vector_elem->size;
+   }
 
-            if(BUFF_UNLIKELY(buf->first_free >= buf->size))
-            {
-               buf->first_free   = 0;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-               rewind_occured    = BUFF_TRUE;
-#endif
-            }
-         }
-         else
-         {
-            part_size            = buf->size - buf->first_free;
-            memcpy( &((uint8_t*)(buf->memory))[buf->first_free], data, part_size);
-            data                 = &((uint8_t*)data)[part_size];
-            part_size            = count - part_size;
-            memcpy(buf->memory, data, part_size);
+   if(BUFF_UNLIKELY(BUFF_BOOL_IS_TRUE(walker.is_too_deep)))
+   {
+      result = BUFF_FALSE;
+   }
 
-            buf->busy_size      += count;
-            buf->first_free      = part_size;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            rewind_occured       = BUFF_TRUE;
+   return result;
+} /* buff_readable_tree_flatten_internal */
 #endif
-         }
 
-#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
-         if(buf->busy_size >= buf->max_busy_size)
-         {
-            buf->max_busy_size = buf->busy_size;
-         }
-#endif
 
-#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
-         extension = buf->protected_extension;
 
-         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
-         {
-            on_write = extension->on_write;
+#if( ((!defined(BUFF_COPY_FROM_FLAT_TREE_EXTERNAL)) && BUFF_COPY_FROM_FLAT_TREE_ENABLED) || ((!defined(BUFF_COPY_TO_FLAT_TREE_EXTERNAL)) && BUFF_COPY_TO_FLAT_TREE_ENABLED) )
+/**
+ * Returns index of flattened tree part which contains byte "pos" (pos must be less than flattened tree size).
+ */
+static Buff_Num_Elems_DT buff_flat_tree_find_elem(const Buff_Size_DT *offset, Buff_Num_Elems_DT num_elems, Buff_Size_DT pos)
+{
+   Buff_Num_Elems_DT first = 0;
+   Buff_Num_Elems_DT middle;
 
-            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
-            {
-               on_write(buf, extension, count, rewind_occured);
-            }
-         }
-#endif
-      }
+   /* last element which offset is not bigger than pos */
+   while(num_elems > 1)
+   {
+      middle = num_elems / 2;
 
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
+      if(offset[first + middle] <= pos)
       {
-         BUFF_PROTECTION_UNLOCK(buf);
+         first     += middle;
+         num_elems -= middle;
+      }
+      else
+      {
+         num_elems  = middle;
       }
+   }
+
+   return first;
+} /* buff_flat_tree_find_elem */
 #endif
 
-#if(BUFF_RING_USE_EXTENSIONS)
-      extension = buf->extension;
 
-      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
-      {
-         on_write = extension->on_write;
 
-         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
-         {
-            on_write(buf, extension, count, rewind_occured);
-         }
+#if( (!defined(BUFF_READABLE_TREE_FLATTEN_EXTERNAL)) && BUFF_READABLE_TREE_FLATTEN_ENABLED )
+Buff_Bool_DT Buff_Readable_Tree_Flatten(
+   Buff_Readable_Flat_Tree_XT   *flat,
+   Buff_Readable_Vector_XT      *vector,
+   Buff_Size_DT                 *offset,
+   Buff_Num_Elems_DT             max_num_elems,
+   const Buff_Readable_Tree_XT  *tree,
+   Buff_Num_Elems_DT             tree_num_elems)
+{
+   Buff_Bool_DT result = BUFF_FALSE;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Flat_Tree_XT, flat)
+      && BUFF_CHECK_PTR(Buff_Readable_Vector_XT, vector) && BUFF_CHECK_PTR(Buff_Size_DT, offset)))
+   {
+      flat->vector            = vector;
+      flat->offset            = offset;
+      flat->vector_num_elems  = 0;
+      flat->size              = 0;
+
+      result = buff_readable_tree_flatten_internal(flat, max_num_elems, tree, tree_num_elems);
+
+      if(BUFF_UNLIKELY(!BUFF_BOOL_IS_TRUE(result)))
+      {
+         flat->vector_num_elems  = 0;
+         flat->size              = 0;
       }
-#endif
+
+      flat->tree.elem_type.vector.vector           = vector;
+      flat->tree.elem_type.vector.vector_num_elems = flat->vector_num_elems;
+      flat->tree.is_branch                         = BUFF_FALSE;
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
-   return count;
-
-#endif
-} /* Buff_Ring_Write */
+   return result;
+} /* Buff_Readable_Tree_Flatten */
 #endif
 
 
 
-#if( (!defined(BUFF_RING_WRITE_VENDOR_EXTERNAL)) && BUFF_RING_WRITE_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS )
-Buff_Size_DT Buff_Ring_Write_Vendor(
-   Buff_Ring_XT           *buf,
-   const void             *data,
-   Buff_Size_DT            size,
-   Buff_Vendor_Memcpy_HT   vendor_cpy,
-   Buff_Bool_DT            overwrite_if_no_free_space,
-   Buff_Bool_DT            use_protection)
+#if( (!defined(BUFF_WRITEABLE_TREE_FLATTEN_EXTERNAL)) && BUFF_WRITEABLE_TREE_FLATTEN_ENABLED )
+Buff_Bool_DT Buff_Writeable_Tree_Flatten(
+   Buff_Writeable_Flat_Tree_XT  *flat,
+   Buff_Writeable_Vector_XT     *vector,
+   Buff_Size_DT                 *offset,
+   Buff_Num_Elems_DT             max_num_elems,
+   const Buff_Writeable_Tree_XT *tree,
+   Buff_Num_Elems_DT             tree_num_elems)
 {
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Ring_Extensions_XT *extension;
-   Buff_Ring_Extension_On_Write on_write;
-#endif
-   Buff_Memcpy_Params_XT params;
-   Buff_Size_DT part_size;
-   Buff_Size_DT count = 0;
-   Buff_Size_DT ret_count;
-   Buff_Size_DT ret_count2;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Bool_DT rewind_occured = BUFF_FALSE;
-#if(BUFF_RING_USE_EXTENSIONS)
-   Buff_Bool_DT data_changed = BUFF_FALSE;
-#endif
-#endif
-
-#if(!BUFF_RING_USE_PROTECTION)
-   BUFF_UNUSED_PARAM(use_protection);
-#endif
-#if(!BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
-   BUFF_UNUSED_PARAM(overwrite_if_no_free_space);
-#endif
+   Buff_Bool_DT result = BUFF_FALSE;
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data)
-      && BUFF_CHECK_HANDLER(Buff_Vendor_Memcpy_HT, vendor_cpy)
-      && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Writeable_Flat_Tree_XT, flat)
+      && BUFF_CHECK_PTR(Buff_Writeable_Vector_XT, vector) && BUFF_CHECK_PTR(Buff_Size_DT, offset)))
    {
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
+      flat->vector            = vector;
+      flat->offset            = offset;
+      flat->vector_num_elems  = 0;
+      flat->size              = 0;
+
+      result = buff_readable_tree_flatten_internal(
+         (Buff_Readable_Flat_Tree_XT*)flat, max_num_elems, (const Buff_Readable_Tree_XT*)tree, tree_num_elems);
+
+      if(BUFF_UNLIKELY(!BUFF_BOOL_IS_TRUE(result)))
       {
-         BUFF_PROTECTION_LOCK(buf);
+         flat->vector_num_elems  = 0;
+         flat->size              = 0;
       }
+
+      flat->tree.elem_type.vector.vector           = vector;
+      flat->tree.elem_type.vector.vector_num_elems = flat->vector_num_elems;
+      flat->tree.is_branch                         = BUFF_FALSE;
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Writeable_Tree_Flatten */
 #endif
 
-      count = BUFF_RING_GET_FREE_SIZE(buf);
 
-      if(BUFF_LIKELY(size <= count))
-      {
-         count = size;
-      }
-#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
-      else if(BUFF_BOOL_IS_TRUE(overwrite_if_no_free_space))
+
+#if( (!defined(BUFF_COPY_FROM_FLAT_TREE_EXTERNAL)) && BUFF_COPY_FROM_FLAT_TREE_ENABLED )
+Buff_Size_DT Buff_Copy_From_Flat_Tree(
+   void                              *dest,
+   const Buff_Readable_Flat_Tree_XT  *src,
+   Buff_Size_DT                       size,
+   Buff_Size_DT                       offset_dest,
+   Buff_Size_DT                       offset_src)
+{
+   const Buff_Readable_Vector_XT *vector_elem;
+   Buff_Size_DT                   part;
+   Buff_Size_DT                   result = 0;
+   Buff_Num_Elems_DT              cntr;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, dest) && BUFF_CHECK_PTR(Buff_Readable_Flat_Tree_XT, src)))
+   {
+      if(BUFF_LIKELY(offset_src < src->size))
       {
-         if(BUFF_LIKELY(size < buf->size))
+         if(size > (src->size - offset_src))
          {
-            Buff_Ring_Remove(buf, size - count, BUFF_FALSE);
-
-            count = size;
+            size = src->size - offset_src;
          }
-         else
+
+         cntr        = buff_flat_tree_find_elem(src->offset, src->vector_num_elems, offset_src);
+         offset_src -= src->offset[cntr];
+
+         while(result < size)
          {
-            Buff_Ring_Clear(buf, BUFF_FALSE);
+            vector_elem = &(src->vector[cntr]);
+            part        = vector_elem->size - offset_src;
 
-            count = buf->size;
+            if(part > (size - result))
+            {
+               part = size - result;
+            }
+
+            BUFF_MEMCPY(&((uint8_t*)dest)[offset_dest], &((const uint8_t*)(vector_elem->data))[offset_src], part);
+
+            offset_dest += part;
+            result      += part;
+            offset_src   = 0;
+            cntr++;
          }
       }
-#endif
+   }
 
-      if(BUFF_LIKELY(count > 0))
-      {
-#if(BUFF_RING_USE_EXTENSIONS)
-         data_changed = BUFF_TRUE;
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Copy_From_Flat_Tree */
 #endif
-         params.dest             = buf->memory;
-         params.src              = data;
-         params.dest_offset      = buf->first_free;
-         params.src_offset       = 0;
 
-         if(BUFF_LIKELY(buf->first_free <= (buf->size - count)))
+
+
+#if( (!defined(BUFF_COPY_TO_FLAT_TREE_EXTERNAL)) && BUFF_COPY_TO_FLAT_TREE_ENABLED )
+Buff_Size_DT Buff_Copy_To_Flat_Tree(
+   const Buff_Writeable_Flat_Tree_XT *dest,
+   const void                        *src,
+   Buff_Size_DT                       size,
+   Buff_Size_DT                       offset_dest,
+   Buff_Size_DT                       offset_src)
+{
+   const Buff_Writeable_Vector_XT *vector_elem;
+   Buff_Size_DT                    part;
+   Buff_Size_DT                    result = 0;
+   Buff_Num_Elems_DT               cntr;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Writeable_Flat_Tree_XT, dest) && BUFF_CHECK_PTR(const void, src)))
+   {
+      if(BUFF_LIKELY(offset_dest < dest->size))
+      {
+         if(size > (dest->size - offset_dest))
          {
-            params.size          = count;
-            params.is_last_part  = BUFF_TRUE;
+            size = dest->size - offset_dest;
+         }
 
-            ret_count = vendor_cpy(&params);
+         cntr         = buff_flat_tree_find_elem(dest->offset, dest->vector_num_elems, offset_dest);
+         offset_dest -= dest->offset[cntr];
 
-            /* vendor_cpy might copy less data than requested - depends on vendor_cpy - in this case reduce count */
-            if(BUFF_LIKELY(ret_count <= count))
+         while(result < size)
+         {
+            vector_elem = &(dest->vector[cntr]);
+            part        = vector_elem->size - offset_dest;
+
+            if(part > (size - result))
             {
-               count = ret_count;
+               part = size - result;
             }
 
-            buf->busy_size      += count;
-            buf->first_free     += count;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            rewind_occured       = BUFF_FALSE;
-#endif
+            BUFF_MEMCPY(&((uint8_t*)(vector_elem->data))[offset_dest], &((const uint8_t*)src)[offset_src], part);
 
-            if(BUFF_UNLIKELY(buf->first_free >= buf->size))
-            {
-               buf->first_free   = 0;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-               rewind_occured    = BUFF_TRUE;
-#endif
-            }
+            offset_src  += part;
+            result      += part;
+            offset_dest  = 0;
+            cntr++;
          }
-         else
-         {
-            part_size            = buf->size - buf->first_free;
+      }
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Copy_To_Flat_Tree */
+#endif
+
+
+
+#if( (!defined(BUFF_READABLE_TREE_CURSOR_EXTERNAL)) && BUFF_READABLE_TREE_CURSOR_ENABLED )
+/**
+ * Copies data from position of tree cursor and moves the cursor; if dest is invalid pointer then data is only skipped.
+ */
+static Buff_Size_DT buff_readable_tree_cursor_copy(uint8_t *dest, Buff_Readable_Tree_Cursor_XT *cursor, Buff_Size_DT size)
+{
+   Buff_Size_DT result = 0;
+
+   while(result < size)
+   {
+      result += buff_readable_vector_cursor_copy(
+         BUFF_CHECK_PTR(uint8_t, dest) ? &dest[result] : dest, &(cursor->vector), size - result);
+
+      if((result < size) && (!BUFF_BOOL_IS_TRUE(buff_readable_tree_walker_next_vector(cursor))))
+      {
+         break;
+      }
+   }
+
+   return result;
+} /* buff_readable_tree_cursor_copy */
+
+
+
+void Buff_Readable_Tree_Cursor_Init(
+   Buff_Readable_Tree_Cursor_XT    *cursor,
+   const Buff_Readable_Tree_XT     *tree,
+   Buff_Num_Elems_DT                tree_num_elems,
+   Buff_Size_DT                     offset)
+{
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Tree_Cursor_XT, cursor)))
+   {
+      buff_readable_tree_walker_init(cursor, tree, tree_num_elems);
+
+      (void)buff_readable_tree_cursor_copy(BUFF_MAKE_INVALID_PTR(uint8_t), cursor, offset);
+   }
+
+   BUFF_EXIT_FUNC();
+} /* Buff_Readable_Tree_Cursor_Init */
+
+
+
+Buff_Size_DT Buff_Copy_From_Tree_Cursor(
+   void                            *dest,
+   Buff_Readable_Tree_Cursor_XT    *cursor,
+   Buff_Size_DT                     size)
+{
+   Buff_Size_DT result = 0;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, dest) && BUFF_CHECK_PTR(Buff_Readable_Tree_Cursor_XT, cursor)))
+   {
+      result = buff_readable_tree_cursor_copy((uint8_t*)dest, cursor, size);
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Copy_From_Tree_Cursor */
+#endif
+
+
+
+#if( (!defined(BUFF_TREE_TO_IOVEC_EXTERNAL)) && BUFF_TREE_TO_IOVEC_ENABLED && BUFF_USE_IOVEC && BUFF_READABLE_TREE_CURSOR_ENABLED )
+Buff_Size_DT Buff_Tree_To_Iovec(
+   struct iovec                    *iov,
+   Buff_Num_Elems_DT               *iov_num_elems,
+   Buff_Readable_Tree_Cursor_XT    *cursor,
+   Buff_Size_DT                     size,
+   Buff_Bool_DT                    *truncated)
+{
+   Buff_Num_Elems_DT iov_used = 0;
+   Buff_Bool_DT      is_truncated = BUFF_FALSE;
+   Buff_Size_DT      result = 0;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(struct iovec, iov) && BUFF_CHECK_PTR(Buff_Num_Elems_DT, iov_num_elems)
+      && BUFF_CHECK_PTR(Buff_Readable_Tree_Cursor_XT, cursor)))
+   {
+      while(result < size)
+      {
+         result += buff_readable_vector_cursor_to_iovec(
+            iov, *iov_num_elems, &iov_used, &(cursor->vector), size - result, &is_truncated);
+
+         if(BUFF_BOOL_IS_TRUE(is_truncated)
+            || ((result < size) && (!BUFF_BOOL_IS_TRUE(buff_readable_tree_walker_next_vector(cursor)))))
+         {
+            break;
+         }
+      }
+
+      *iov_num_elems = iov_used;
+   }
+
+   if(BUFF_CHECK_PTR(Buff_Bool_DT, truncated))
+   {
+      *truncated = is_truncated;
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Tree_To_Iovec */
+#endif
+
+#endif /* #if(BUFF_USE_TREE_BUFFERS) */
+
+
+
+#if(BUFF_USE_RING_BUFFERS)
+
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && (BUFF_RING_GET_CONTINOUS_FREE_SIZE_ENABLED || BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED))
+static Buff_Size_DT buff_ring_spsc_get_continous_free_size(Buff_Ring_XT *buf)
+{
+   Buff_Size_DT first_busy = BUFF_RING_GET_FIRST_BUSY(buf);
+   Buff_Size_DT result;
+
+   /* byte just before first_busy is never written - otherwise full buffer would look like empty one */
+   if(BUFF_RING_IS_MIRRORED(buf))
+   {
+      result = first_busy + buf->size - buf->first_free - 1;
+
+      result = BUFF_RING_WRAP_POS(buf, result);
+   }
+   else if(buf->first_free < first_busy)
+   {
+      result = first_busy - buf->first_free - 1;
+   }
+   else if(0 == first_busy)
+   {
+      result = buf->size - buf->first_free - 1;
+   }
+   else
+   {
+      result = buf->size - buf->first_free;
+   }
+
+   return result;
+} /* buff_ring_spsc_get_continous_free_size */
+#endif
+
+
+
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_PADDED_LAYOUT)
+static Buff_Size_DT buff_ring_producer_get_free_size(Buff_Ring_XT *buf, Buff_Size_DT size_needed)
+{
+   Buff_Size_DT result = buf->cached_first_busy + buf->size - buf->first_free - 1;
+
+   result = BUFF_RING_WRAP_POS(buf, result);
+
+   /* consumer's cache line is touched only if local copy of first_busy shows not enough free space */
+   if(result < size_needed)
+   {
+      buf->cached_first_busy = BUFF_RING_GET_FIRST_BUSY(buf);
+
+      result = buf->cached_first_busy + buf->size - buf->first_free - 1;
+
+      result = BUFF_RING_WRAP_POS(buf, result);
+   }
+
+   return result;
+} /* buff_ring_producer_get_free_size */
+
+
+
+static Buff_Size_DT buff_ring_consumer_get_busy_size(Buff_Ring_XT *buf, Buff_Size_DT size_needed)
+{
+   Buff_Size_DT result = buf->cached_first_free + buf->size - buf->first_busy;
+
+   result = BUFF_RING_WRAP_POS(buf, result);
+
+   /* producer's cache line is touched only if local copy of first_free shows not enough data */
+   if(result < size_needed)
+   {
+      buf->cached_first_free = BUFF_RING_GET_FIRST_FREE(buf);
+
+      result = buf->cached_first_free + buf->size - buf->first_busy;
+
+      result = BUFF_RING_WRAP_POS(buf, result);
+   }
+
+   return result;
+} /* buff_ring_consumer_get_busy_size */
+#endif
+
+
+
+#if( ((!defined(BUFF_RING_RESIZE_EXTERNAL)) && BUFF_RING_RESIZE_ENABLED) || (BUFF_RING_USE_AUTO_GROW && (!BUFF_RING_USE_LOCK_FREE_SPSC)) )
+/**
+ * Moves busy data to the begining of new memory and switches buffer to it; called with buffer locked.
+ */
+static Buff_Bool_DT buff_ring_resize(Buff_Ring_XT *buf, void *memory, Buff_Size_DT size)
+{
+   Buff_Size_DT busy = BUFF_RING_GET_BUSY_SIZE(buf);
+   Buff_Size_DT first_busy = BUFF_RING_GET_FIRST_BUSY(buf);
+   Buff_Size_DT part_size;
+   Buff_Bool_DT result = BUFF_FALSE;
+
+   /* spliced data is referenced by the pipe and posted read writes to free space - memory can't be exchanged until they end */
+   if(BUFF_LIKELY((!BUFF_RING_IS_MIRRORED(buf)) && (!BUFF_RING_IS_FILE_BACKED(buf)) && (!BUFF_RING_IS_SPLICED(buf))
+      && (!BUFF_RING_IS_READ_POSTED(buf))
+      && BUFF_CHECK_PTR(void, memory)
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
+      && (buf->size == buf->original_size)
+#endif
+#if(BUFF_RING_USE_LOCK_FREE_SPSC)
+      && (busy < size)
+#else
+      && (busy <= size) && (size > 0)
+#endif
+#if(BUFF_RING_USE_POWER_OF_2_SIZE)
+      && (0 == (size & (size - 1)))
+#endif
+      ))
+   {
+      /* data is linearized - in new memory it starts from the begining and is never wrapped */
+      part_size = buf->size - first_busy;
+
+      if(busy <= part_size)
+      {
+         BUFF_MEMCPY(memory, &((const uint8_t*)(buf->memory))[first_busy], busy);
+      }
+      else
+      {
+         BUFF_MEMCPY(memory, &((const uint8_t*)(buf->memory))[first_busy], part_size);
+         BUFF_MEMCPY(&((uint8_t*)memory)[part_size], buf->memory, busy - part_size);
+      }
+
+      buf->memory          = memory;
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
+      buf->original_size   = size;
+#endif
+      buf->size            = size;
+
+      BUFF_RING_SET_FIRST_BUSY(buf, 0);
+      BUFF_RING_SET_FIRST_FREE(buf, BUFF_RING_WRAP_POS(buf, busy));
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_MULTI_PRODUCER)
+      buf->first_reserved  = buf->first_free;
+#endif
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_PADDED_LAYOUT)
+      buf->cached_first_busy = 0;
+      buf->cached_first_free = buf->first_free;
+#endif
+
+      result = BUFF_TRUE;
+   }
+
+   return result;
+} /* buff_ring_resize */
+#endif
+
+
+
+#if(BUFF_RING_USE_AUTO_GROW && (!BUFF_RING_USE_LOCK_FREE_SPSC))
+/**
+ * Called by write functions with buffer locked, before free space is checked.
+ * If there is not enough free space, memory is exchanged for bigger one (up to max_size) taken from user allocator.
+ */
+static void buff_ring_auto_grow(Buff_Ring_XT *buf, Buff_Size_DT size_needed)
+{
+   void        *memory;
+   void        *old_memory;
+   Buff_Size_DT busy = BUFF_RING_GET_BUSY_SIZE(buf);
+   Buff_Size_DT old_size;
+   Buff_Size_DT size;
+   Buff_Bool_DT was_memory_allocated;
+
+   if(BUFF_UNLIKELY(BUFF_CHECK_HANDLER(Buff_Ring_Memory_Alloc_HT, buf->memory_alloc) && (size_needed > BUFF_RING_GET_FREE_SIZE(buf))
+      && (busy <= buf->max_size) && (size_needed <= (buf->max_size - busy)) && (!BUFF_RING_IS_SPLICED(buf))
+      && (!BUFF_RING_IS_FILE_BACKED(buf)) && (!BUFF_RING_IS_READ_POSTED(buf))))
+   {
+      old_size = BUFF_RING_GET_MEMORY_SIZE(buf);
+      size     = old_size;
+
+      while(size < (busy + size_needed))
+      {
+         size = (size <= (buf->max_size / buf->growth_factor)) ? (size * buf->growth_factor) : buf->max_size;
+      }
+
+      memory = buf->memory_alloc(buf, size);
+
+      if(BUFF_CHECK_PTR(void, memory))
+      {
+         old_memory           = buf->memory;
+         was_memory_allocated = buf->is_memory_allocated;
+
+         if(BUFF_LIKELY(buff_ring_resize(buf, memory, size)))
+         {
+            buf->is_memory_allocated = BUFF_TRUE;
+
+            if(BUFF_BOOL_IS_TRUE(was_memory_allocated) && BUFF_CHECK_HANDLER(Buff_Ring_Memory_Free_HT, buf->memory_free))
+            {
+               buf->memory_free(buf, old_memory, old_size);
+            }
+         }
+         else if(BUFF_CHECK_HANDLER(Buff_Ring_Memory_Free_HT, buf->memory_free))
+         {
+            buf->memory_free(buf, memory, size);
+         }
+      }
+   }
+} /* buff_ring_auto_grow */
+#endif
+
+
+
+#if( (!defined(RING_BUF_INIT_EXTERNAL)) && BUFF_RING_INIT_ENABLED )
+Buff_Bool_DT Buff_Ring_Init(Buff_Ring_XT *buf, void *memory, Buff_Size_DT size)
+{
+   Buff_Bool_DT result = BUFF_FALSE;
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_LOCK_FREE_SPSC)
+      /* one byte is always left unused to distinguish full buffer from empty one */
+      if((size > 1) && BUFF_CHECK_PTR(void, memory)
+#else
+      if((size > 0) && BUFF_CHECK_PTR(void, memory)
+#endif
+#if(BUFF_RING_USE_POWER_OF_2_SIZE)
+         && (0 == (size & (size - 1)))
+#endif
+         )
+      {
+#if(BUFF_RING_USE_EXTENSIONS)
+         buf->extension  = BUFF_MAKE_INVALID_PTR(Buff_Ring_Extensions_XT);
+#endif
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         buf->protected_extension  = BUFF_MAKE_INVALID_PTR(Buff_Ring_Extensions_XT);
+#endif
+         buf->memory          = memory;
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
+         buf->original_size   = size;
+#endif
+         buf->size            = size;
+#if(BUFF_RING_USE_MIRRORED_MEMORY)
+         buf->is_mirrored     = BUFF_FALSE;
+#endif
+#if(BUFF_RING_USE_FILE)
+         buf->is_file_backed  = BUFF_FALSE;
+#endif
+#if(BUFF_RING_USE_NON_TEMPORAL_COPY)
+         buf->use_non_temporal_copy = BUFF_FALSE;
+#endif
+#if(BUFF_RING_USE_SPLICE)
+         buf->spliced_size    = 0;
+#endif
+#if(BUFF_RING_USE_IO_URING && (!BUFF_RING_USE_LOCK_FREE_SPSC))
+         buf->is_read_posted  = BUFF_FALSE;
+#endif
+#if(BUFF_RING_USE_AUTO_GROW)
+         buf->memory_alloc    = BUFF_MAKE_INVALID_HANDLER(Buff_Ring_Memory_Alloc_HT);
+         buf->memory_free     = BUFF_MAKE_INVALID_HANDLER(Buff_Ring_Memory_Free_HT);
+         buf->max_size        = 0;
+         buf->growth_factor   = 0;
+         buf->is_memory_allocated = BUFF_FALSE;
+#endif
+#if(!BUFF_RING_USE_LOCK_FREE_SPSC)
+         buf->busy_size       = 0;
+#endif
+#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
+         buf->max_busy_size   = 0;
+#endif
+         buf->first_free      = 0;
+         buf->first_busy      = 0;
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_MULTI_PRODUCER)
+         buf->first_reserved  = 0;
+#endif
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_PADDED_LAYOUT)
+         buf->cached_first_busy = 0;
+         buf->cached_first_free = 0;
+#endif
+
+#if(BUFF_RING_USE_PROTECTION)
+         if(BUFF_PROTECTION_CREATE(buf))
+         {
+            if(BUFF_PROTECTION_INIT(buf))
+            {
+               result = BUFF_TRUE;
+            }
+         }
+#else
+         result = BUFF_TRUE;
+#endif
+      }
+
+      if(!result)
+      {
+#if(BUFF_RING_USE_EXTENSIONS)
+         buf->extension  = BUFF_MAKE_INVALID_PTR(Buff_Ring_Extensions_XT);
+#endif
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         buf->protected_extension  = BUFF_MAKE_INVALID_PTR(Buff_Ring_Extensions_XT);
+#endif
+         buf->memory          = BUFF_MAKE_INVALID_PTR(void);
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
+         buf->original_size   = 0;
+#endif
+         buf->size            = 0;
+#if(BUFF_RING_USE_MIRRORED_MEMORY)
+         buf->is_mirrored     = BUFF_FALSE;
+#endif
+#if(BUFF_RING_USE_FILE)
+         buf->is_file_backed  = BUFF_FALSE;
+#endif
+#if(BUFF_RING_USE_NON_TEMPORAL_COPY)
+         buf->use_non_temporal_copy = BUFF_FALSE;
+#endif
+#if(BUFF_RING_USE_SPLICE)
+         buf->spliced_size    = 0;
+#endif
+#if(BUFF_RING_USE_IO_URING && (!BUFF_RING_USE_LOCK_FREE_SPSC))
+         buf->is_read_posted  = BUFF_FALSE;
+#endif
+#if(BUFF_RING_USE_AUTO_GROW)
+         buf->memory_alloc    = BUFF_MAKE_INVALID_HANDLER(Buff_Ring_Memory_Alloc_HT);
+         buf->memory_free     = BUFF_MAKE_INVALID_HANDLER(Buff_Ring_Memory_Free_HT);
+         buf->max_size        = 0;
+         buf->growth_factor   = 0;
+         buf->is_memory_allocated = BUFF_FALSE;
+#endif
+#if(!BUFF_RING_USE_LOCK_FREE_SPSC)
+         buf->busy_size       = 0;
+#endif
+#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
+         buf->max_busy_size   = 0;
+#endif
+         buf->first_free      = 0;
+         buf->first_busy      = 0;
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_MULTI_PRODUCER)
+         buf->first_reserved  = 0;
+#endif
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_PADDED_LAYOUT)
+         buf->cached_first_busy = 0;
+         buf->cached_first_free = 0;
+#endif
+      }
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Init */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_DEINIT_EXTERNAL)) && BUFF_RING_DEINIT_ENABLED )
+void   Buff_Ring_Deinit(Buff_Ring_XT *buf)
+{
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      BUFF_PROTECTION_LOCK(buf);
+#endif
+
+#if(BUFF_RING_USE_EXTENSIONS)
+      buf->extension  = BUFF_MAKE_INVALID_PTR(Buff_Ring_Extensions_XT);
+#endif
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+      buf->protected_extension  = BUFF_MAKE_INVALID_PTR(Buff_Ring_Extensions_XT);
+#endif
+      buf->memory          = BUFF_MAKE_INVALID_PTR(void);
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
+      buf->original_size   = 0;
+#endif
+      buf->size            = 0;
+#if(BUFF_RING_USE_MIRRORED_MEMORY)
+      buf->is_mirrored     = BUFF_FALSE;
+#endif
+#if(BUFF_RING_USE_FILE)
+      buf->is_file_backed  = BUFF_FALSE;
+#endif
+#if(BUFF_RING_USE_NON_TEMPORAL_COPY)
+      buf->use_non_temporal_copy = BUFF_FALSE;
+#endif
+#if(BUFF_RING_USE_SPLICE)
+      buf->spliced_size    = 0;
+#endif
+#if(BUFF_RING_USE_IO_URING && (!BUFF_RING_USE_LOCK_FREE_SPSC))
+      buf->is_read_posted  = BUFF_FALSE;
+#endif
+#if(BUFF_RING_USE_AUTO_GROW)
+      buf->memory_alloc    = BUFF_MAKE_INVALID_HANDLER(Buff_Ring_Memory_Alloc_HT);
+      buf->memory_free     = BUFF_MAKE_INVALID_HANDLER(Buff_Ring_Memory_Free_HT);
+      buf->max_size        = 0;
+      buf->growth_factor   = 0;
+      buf->is_memory_allocated = BUFF_FALSE;
+#endif
+#if(!BUFF_RING_USE_LOCK_FREE_SPSC)
+      buf->busy_size       = 0;
+#endif
+#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
+      buf->max_busy_size   = 0;
+#endif
+      buf->first_free      = 0;
+      buf->first_busy      = 0;
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_MULTI_PRODUCER)
+      buf->first_reserved  = 0;
+#endif
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_PADDED_LAYOUT)
+      buf->cached_first_busy = 0;
+      buf->cached_first_free = 0;
+#endif
+
+#if(BUFF_RING_USE_PROTECTION)
+      BUFF_PROTECTION_UNLOCK(buf);
+
+      BUFF_PROTECTION_DEINIT(buf);
+      BUFF_PROTECTION_DESTROY(buf);
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+} /* Buff_Ring_Deinit */
+#endif
+
+
+
+#if( (!defined(RING_BUF_INIT_MIRRORED_EXTERNAL)) && BUFF_RING_INIT_MIRRORED_ENABLED && BUFF_RING_USE_MIRRORED_MEMORY && BUFF_RING_INIT_ENABLED && BUFF_RING_DEINIT_ENABLED )
+Buff_Bool_DT Buff_Ring_Init_Mirrored(Buff_Ring_XT *buf, Buff_Size_DT size)
+{
+   uint8_t     *memory;
+   Buff_Size_DT page_size;
+   int          fd;
+   Buff_Bool_DT result = BUFF_FALSE;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && (size > 0)))
+   {
+      page_size   = (Buff_Size_DT)sysconf(_SC_PAGESIZE);
+      size        = ((size + page_size - 1) / page_size) * page_size;
+
+#if(BUFF_RING_USE_POWER_OF_2_SIZE)
+      /* page size is power of 2, so power of 2 not smaller than page size is also multiple of page size */
+      while(0 != (size & (size - 1)))
+      {
+         size += size & (~size + 1);
+      }
+#endif
+
+      fd = (int)syscall(SYS_memfd_create, "buff_ring", 0);
+
+      if(fd >= 0)
+      {
+         /* reserve address space for both mappings, next map the same file twice over it */
+         memory = (uint8_t*)mmap(NULL, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+         if(MAP_FAILED != (void*)memory)
+         {
+            if((0 == ftruncate(fd, (off_t)size))
+               && (MAP_FAILED != mmap(memory, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0))
+               && (MAP_FAILED != mmap(&memory[size], size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0))
+               && Buff_Ring_Init(buf, memory, size))
+            {
+               buf->is_mirrored = BUFF_TRUE;
+               result           = BUFF_TRUE;
+            }
+            else
+            {
+               (void)munmap(memory, 2 * size);
+            }
+         }
+
+         /* mappings keep the file alive */
+         (void)close(fd);
+      }
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Init_Mirrored */
+
+
+
+void   Buff_Ring_Deinit_Mirrored(Buff_Ring_XT *buf)
+{
+   void        *memory;
+   Buff_Size_DT size;
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && BUFF_RING_IS_MIRRORED(buf)))
+   {
+      memory   = buf->memory;
+      size     = buf->size;
+
+      Buff_Ring_Deinit(buf);
+
+      (void)munmap(memory, 2 * size);
+   }
+
+   BUFF_EXIT_FUNC();
+} /* Buff_Ring_Deinit_Mirrored */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_INIT_FILE_EXTERNAL)) && BUFF_RING_INIT_FILE_ENABLED && BUFF_RING_USE_FILE && BUFF_RING_USE_PROTECTED_EXTENSIONS \
+   && (!BUFF_RING_USE_LOCK_FREE_SPSC) && BUFF_RING_INIT_ENABLED && BUFF_RING_DEINIT_ENABLED )
+
+#ifndef BUFF_RING_FILE_MAGIC
+#define BUFF_RING_FILE_MAGIC                       0x52465542
+#endif
+
+/**
+ * Publishes indexes of the buffer to the file header and synchronizes the file according to policy.
+ * Called inside protection, after data and indexes of the buffer have been modified.
+ */
+static void buff_ring_file_publish(Buff_Ring_XT *buf, Buff_Ring_File_XT *file, Buff_Size_DT size)
+{
+   Buff_Ring_File_Header_XT *header = file->header;
+   Buff_Size_DT              slot   = (header->sequence + 1) & 1;
+
+   header->state[slot].size         = buf->size;
+   header->state[slot].first_busy   = buf->first_busy;
+   header->state[slot].first_free   = buf->first_free;
+   header->state[slot].busy_size    = buf->busy_size;
+
+   /* new state is complete before it becomes valid */
+   BUFF_ATOMIC_STORE_RELEASE(&(header->sequence), header->sequence + 1);
+
+   if(BUFF_RING_FILE_SYNC_NONE != file->sync_mode)
+   {
+      file->unsynced_size += size;
+
+      if(file->unsynced_size >= file->sync_threshold)
+      {
+         (void)msync(header, file->mapping_size, (BUFF_RING_FILE_SYNC_SYNC == file->sync_mode) ? MS_SYNC : MS_ASYNC);
+         file->unsynced_size = 0;
+      }
+   }
+} /* buff_ring_file_publish */
+
+
+
+static void buff_ring_file_on_read(
+   Buff_Ring_XT *buf, struct Buff_Ring_Extensions_eXtended_Tag *extension, Buff_Size_DT size, Buff_Bool_DT rewind_occured)
+{
+   BUFF_UNUSED_PARAM(size);
+   BUFF_UNUSED_PARAM(rewind_occured);
+
+   buff_ring_file_publish(buf, (Buff_Ring_File_XT*)(extension->on_read_params), 0);
+} /* buff_ring_file_on_read */
+
+
+
+static void buff_ring_file_on_write(
+   Buff_Ring_XT *buf, struct Buff_Ring_Extensions_eXtended_Tag *extension, Buff_Size_DT size, Buff_Bool_DT rewind_occured)
+{
+   BUFF_UNUSED_PARAM(rewind_occured);
+
+   buff_ring_file_publish(buf, (Buff_Ring_File_XT*)(extension->on_write_params), size);
+} /* buff_ring_file_on_write */
+
+
+
+static void buff_ring_file_on_overwrite(
+   Buff_Ring_XT *buf, struct Buff_Ring_Extensions_eXtended_Tag *extension, Buff_Size_DT pos, Buff_Size_DT size, Buff_Bool_DT rewind_occured)
+{
+   BUFF_UNUSED_PARAM(pos);
+   BUFF_UNUSED_PARAM(rewind_occured);
+
+   buff_ring_file_publish(buf, (Buff_Ring_File_XT*)(extension->on_overwrite_params), size);
+} /* buff_ring_file_on_overwrite */
+
+
+
+static void buff_ring_file_on_remove(
+   Buff_Ring_XT *buf, struct Buff_Ring_Extensions_eXtended_Tag *extension, Buff_Bool_DT rewind_occured)
+{
+   BUFF_UNUSED_PARAM(rewind_occured);
+
+   buff_ring_file_publish(buf, (Buff_Ring_File_XT*)(extension->on_remove_params), 0);
+} /* buff_ring_file_on_remove */
+
+
+
+/**
+ * Installs extension publishing indexes of the buffer as its protected extension and sets default synchronization policy.
+ */
+static void buff_ring_file_attach(Buff_Ring_XT *buf, Buff_Ring_File_XT *file)
+{
+   file->extension.on_read_params      = file;
+   file->extension.on_write_params     = file;
+   file->extension.on_overwrite_params = file;
+   file->extension.on_remove_params    = file;
+   file->extension.on_read             = buff_ring_file_on_read;
+   file->extension.on_write            = buff_ring_file_on_write;
+   file->extension.on_overwrite        = buff_ring_file_on_overwrite;
+   file->extension.on_remove           = buff_ring_file_on_remove;
+   file->sync_mode                     = BUFF_RING_FILE_SYNC_NONE;
+   file->sync_threshold                = 0;
+   file->unsynced_size                 = 0;
+
+   buf->protected_extension            = &(file->extension);
+   buf->is_file_backed                 = BUFF_TRUE;
+} /* buff_ring_file_attach */
+
+
+
+Buff_Bool_DT Buff_Ring_Init_File(Buff_Ring_XT *buf, Buff_Ring_File_XT *file, const char *path, Buff_Size_DT size)
+{
+   uint8_t     *mapping;
+   Buff_Size_DT header_size;
+   Buff_Bool_DT result = BUFF_FALSE;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && BUFF_CHECK_PTR(Buff_Ring_File_XT, file) && BUFF_CHECK_PTR(const char, path)
+      && (size > 0)))
+   {
+      /* header takes whole page, so buffer memory is page aligned */
+      header_size = (Buff_Size_DT)sysconf(_SC_PAGESIZE);
+      file->fd    = open(path, O_RDWR | O_CREAT, 0644);
+
+      if(file->fd >= 0)
+      {
+         file->mapping_size = header_size + size;
+
+         if(0 == ftruncate(file->fd, (off_t)(file->mapping_size)))
+         {
+            mapping = (uint8_t*)mmap(NULL, file->mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, file->fd, 0);
+
+            if(MAP_FAILED != (void*)mapping)
+            {
+               if(Buff_Ring_Init(buf, &mapping[header_size], size))
+               {
+                  file->header = (Buff_Ring_File_Header_XT*)mapping;
+
+                  /* header becomes valid for Buff_Ring_Recover when magic is stored - after rest of it */
+                  file->header->magic               = 0;
+                  file->header->header_size         = (uint32_t)header_size;
+                  file->header->memory_size         = size;
+                  file->header->sequence            = 0;
+                  file->header->state[0].size       = size;
+                  file->header->state[0].first_busy = 0;
+                  file->header->state[0].first_free = 0;
+                  file->header->state[0].busy_size  = 0;
+                  BUFF_ATOMIC_STORE_RELEASE(&(file->header->magic), (uint32_t)BUFF_RING_FILE_MAGIC);
+
+                  buff_ring_file_attach(buf, file);
+
+                  result = BUFF_TRUE;
+               }
+               else
+               {
+                  (void)munmap(mapping, file->mapping_size);
+               }
+            }
+         }
+
+         if(!BUFF_BOOL_IS_TRUE(result))
+         {
+            (void)close(file->fd);
+            file->fd = -1;
+         }
+      }
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Init_File */
+
+
+
+Buff_Bool_DT Buff_Ring_Recover(Buff_Ring_XT *buf, Buff_Ring_File_XT *file, const char *path)
+{
+   Buff_Ring_File_Header_XT header;
+   struct stat  file_stat;
+   uint8_t     *mapping;
+   Buff_Size_DT slot;
+   Buff_Size_DT size;
+   Buff_Bool_DT result = BUFF_FALSE;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && BUFF_CHECK_PTR(Buff_Ring_File_XT, file) && BUFF_CHECK_PTR(const char, path)))
+   {
+      file->fd = open(path, O_RDWR);
+
+      if(file->fd >= 0)
+      {
+         if(((ssize_t)sizeof(header) == pread(file->fd, &header, sizeof(header), 0))
+            && (BUFF_RING_FILE_MAGIC == header.magic) && (header.header_size >= sizeof(header)) && (header.memory_size > 0)
+            && (0 == fstat(file->fd, &file_stat)) && ((Buff_Size_DT)(file_stat.st_size) >= header.header_size)
+            && (((Buff_Size_DT)(file_stat.st_size) - header.header_size) >= header.memory_size))
+         {
+            file->mapping_size = header.header_size + header.memory_size;
+
+            mapping = (uint8_t*)mmap(NULL, file->mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, file->fd, 0);
+
+            if(MAP_FAILED != (void*)mapping)
+            {
+               file->header = (Buff_Ring_File_Header_XT*)mapping;
+               slot         = file->header->sequence & 1;
+               size         = file->header->state[slot].size;
+
+               /* last published state must describe consistent buffer */
+               if((size > 0) && (size <= header.memory_size)
+#if(!BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
+                  && (size == header.memory_size)
+#endif
+                  && (file->header->state[slot].first_busy < size) && (file->header->state[slot].first_free < size)
+                  && (file->header->state[slot].busy_size <= size)
+                  && (((file->header->state[slot].first_free + size - file->header->state[slot].first_busy) % size)
+                     == (file->header->state[slot].busy_size % size))
+                  && Buff_Ring_Init(buf, &mapping[header.header_size], header.memory_size))
+               {
+                  buf->size            = size;
+                  buf->first_busy      = file->header->state[slot].first_busy;
+                  buf->first_free      = file->header->state[slot].first_free;
+                  buf->busy_size       = file->header->state[slot].busy_size;
+#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
+                  buf->max_busy_size   = buf->busy_size;
+#endif
+
+                  buff_ring_file_attach(buf, file);
+
+                  result = BUFF_TRUE;
+               }
+               else
+               {
+                  (void)munmap(mapping, file->mapping_size);
+               }
+            }
+         }
+
+         if(!BUFF_BOOL_IS_TRUE(result))
+         {
+            (void)close(file->fd);
+            file->fd = -1;
+         }
+      }
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Recover */
+
+
+
+void Buff_Ring_File_Set_Sync(Buff_Ring_File_XT *file, uint8_t sync_mode, Buff_Size_DT sync_threshold)
+{
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_File_XT, file)))
+   {
+      file->sync_mode      = sync_mode;
+      file->sync_threshold = sync_threshold;
+      file->unsynced_size  = 0;
+   }
+
+   BUFF_EXIT_FUNC();
+} /* Buff_Ring_File_Set_Sync */
+
+
+
+Buff_Bool_DT Buff_Ring_File_Sync(Buff_Ring_XT *buf, Buff_Ring_File_XT *file, Buff_Bool_DT use_protection)
+{
+   Buff_Bool_DT result = BUFF_FALSE;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && BUFF_CHECK_PTR(Buff_Ring_File_XT, file) && (file->fd >= 0)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      if(0 == msync(file->header, file->mapping_size, MS_SYNC))
+      {
+         file->unsynced_size = 0;
+         result              = BUFF_TRUE;
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_File_Sync */
+
+
+
+void   Buff_Ring_Deinit_File(Buff_Ring_XT *buf, Buff_Ring_File_XT *file)
+{
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && BUFF_CHECK_PTR(Buff_Ring_File_XT, file) && (file->fd >= 0)))
+   {
+      Buff_Ring_Deinit(buf);
+
+      (void)msync(file->header, file->mapping_size, MS_SYNC);
+      (void)munmap(file->header, file->mapping_size);
+      (void)close(file->fd);
+
+      file->header = BUFF_MAKE_INVALID_PTR(Buff_Ring_File_Header_XT);
+      file->fd     = -1;
+   }
+
+   BUFF_EXIT_FUNC();
+} /* Buff_Ring_Deinit_File */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_INIT_EXTENSION_EXTERNAL)) && BUFF_RING_INIT_EXTENSION_ENABLED && BUFF_RING_USE_EXTENSIONS )
+void Buff_Ring_Init_Extension(Buff_Ring_Extensions_XT *extension)
+{
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension)))
+   {
+      extension->on_read_params        = BUFF_MAKE_INVALID_PTR(void);
+      extension->on_write_params       = BUFF_MAKE_INVALID_PTR(void);
+      extension->on_overwrite_params   = BUFF_MAKE_INVALID_PTR(void);
+      extension->on_remove_params      = BUFF_MAKE_INVALID_PTR(void);
+      extension->on_read               = BUFF_MAKE_INVALID_HANDLER(Buff_Ring_Extension_On_Read);
+      extension->on_write              = BUFF_MAKE_INVALID_HANDLER(Buff_Ring_Extension_On_Write);
+      extension->on_overwrite          = BUFF_MAKE_INVALID_HANDLER(Buff_Ring_Extension_On_Overwrite);
+      extension->on_remove             = BUFF_MAKE_INVALID_HANDLER(Buff_Ring_Extension_On_Remove);
+   }
+} /* Buff_Ring_Init_Extension */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_ADD_EXTENSION_EXTERNAL)) && BUFF_RING_ADD_EXTENSION_ENABLED && BUFF_RING_USE_EXTENSIONS )
+Buff_Bool_DT Buff_Ring_Add_Extension(Buff_Ring_XT *buf, Buff_Ring_Extensions_XT *extension)
+{
+   Buff_Bool_DT result = BUFF_FALSE;
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+      buf->extension = extension;
+
+      result = BUFF_TRUE;
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Add_Extension */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_ADD_PROTECTED_EXTENSION_EXTERNAL)) && BUFF_RING_ADD_PROTECTED_EXTENSION_ENABLED && BUFF_RING_USE_PROTECTED_EXTENSIONS )
+Buff_Bool_DT Buff_Ring_Add_Protected_Extension(Buff_Ring_XT *buf, Buff_Ring_Extensions_XT *protected_extension)
+{
+   Buff_Bool_DT result = BUFF_FALSE;
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   /* protected extension slot of file-backed buffer is taken by extension publishing its indexes */
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && (!BUFF_RING_IS_FILE_BACKED(buf))))
+   {
+      buf->protected_extension = protected_extension;
+
+      result = BUFF_TRUE;
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Add_Protected_Extension */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_SET_NON_TEMPORAL_COPY_EXTERNAL)) && BUFF_RING_SET_NON_TEMPORAL_COPY_ENABLED && BUFF_RING_USE_NON_TEMPORAL_COPY )
+void Buff_Ring_Set_Non_Temporal_Copy(Buff_Ring_XT *buf, Buff_Bool_DT use_non_temporal_copy)
+{
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+      buf->use_non_temporal_copy = use_non_temporal_copy;
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+} /* Buff_Ring_Set_Non_Temporal_Copy */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_RESIZE_EXTERNAL)) && BUFF_RING_RESIZE_ENABLED )
+Buff_Bool_DT Buff_Ring_Resize(Buff_Ring_XT *buf, void *memory, Buff_Size_DT size, Buff_Bool_DT use_protection)
+{
+#if(BUFF_RING_USE_AUTO_GROW)
+   void        *old_memory;
+   Buff_Size_DT old_size;
+#endif
+   Buff_Bool_DT result = BUFF_FALSE;
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#else
+      BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+#if(BUFF_RING_USE_AUTO_GROW)
+      old_memory = buf->memory;
+      old_size   = BUFF_RING_GET_MEMORY_SIZE(buf);
+#endif
+
+      result = buff_ring_resize(buf, memory, size);
+
+#if(BUFF_RING_USE_AUTO_GROW)
+      /* memory given by the user is never released by the buffer */
+      if(BUFF_BOOL_IS_TRUE(result) && BUFF_BOOL_IS_TRUE(buf->is_memory_allocated))
+      {
+         buf->is_memory_allocated = BUFF_FALSE;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Memory_Free_HT, buf->memory_free))
+         {
+            buf->memory_free(buf, old_memory, old_size);
+         }
+      }
+#endif
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Resize */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_SET_AUTO_GROW_EXTERNAL)) && BUFF_RING_SET_AUTO_GROW_ENABLED && BUFF_RING_USE_AUTO_GROW )
+void Buff_Ring_Set_Auto_Grow(
+   Buff_Ring_XT               *buf,
+   Buff_Ring_Memory_Alloc_HT   memory_alloc,
+   Buff_Ring_Memory_Free_HT    memory_free,
+   Buff_Size_DT                growth_factor,
+   Buff_Size_DT                max_size)
+{
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      BUFF_PROTECTION_LOCK(buf);
+#endif
+
+      /* growth factor below 2 would never make the buffer bigger - automatic growing is switched off */
+      buf->memory_alloc    = (growth_factor >= 2) ? memory_alloc : BUFF_MAKE_INVALID_HANDLER(Buff_Ring_Memory_Alloc_HT);
+      buf->memory_free     = memory_free;
+      buf->growth_factor   = growth_factor;
+      buf->max_size        = max_size;
+
+#if(BUFF_RING_USE_PROTECTION)
+      BUFF_PROTECTION_UNLOCK(buf);
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+} /* Buff_Ring_Set_Auto_Grow */
+#endif
+
+
+
+#if( (!defined(BUFF_PROTECTION_LOCK_EXTERNAL)) && BUFF_PROTECTION_LOCK_ENABLED && BUFF_RING_USE_PROTECTION )
+void Buff_Protection_Lock(Buff_Ring_XT *buf)
+{
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+      BUFF_PROTECTION_LOCK(buf);
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+} /* Buff_Lock_Protection */
+#endif
+
+
+
+#if( (!defined(BUFF_PROTECTION_UNLOCK_EXTERNAL)) && BUFF_PROTECTION_UNLOCK_ENABLED && BUFF_RING_USE_PROTECTION )
+void Buff_Protection_Unlock(Buff_Ring_XT *buf)
+{
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+      BUFF_PROTECTION_UNLOCK(buf);
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+} /* Buff_Unlock_Protection */
+#endif
+
+
+
+#if( (!defined(RING_BUF_IS_EMPTY_EXTERNAL)) && BUFF_RING_IS_EMPTY_ENABLED )
+Buff_Bool_DT Buff_Ring_Is_Empty(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
+{
+   Buff_Bool_DT result = BUFF_TRUE;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      result = BUFF_RING_IS_EMPTY(buf);
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Is_Empty */
+#endif
+
+
+
+#if( (!defined(RING_BUF_IS_FULL_EXTERNAL)) && BUFF_RING_IS_FULL_ENABLED )
+Buff_Bool_DT Buff_Ring_Is_Full(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
+{
+   Buff_Bool_DT result = BUFF_TRUE;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      result = BUFF_RING_IS_FULL(buf);
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Is_Full */
+#endif
+
+
+
+#if( (!defined(RING_BUF_GET_SIZE_EXTERNAL)) && BUFF_RING_GET_SIZE_ENABLED )
+Buff_Size_DT Buff_Ring_Get_Size(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
+{
+   Buff_Size_DT result = 0;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      result = BUFF_RING_GET_SIZE(buf);
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Get_Size */
+#endif
+
+
+
+#if( (!defined(RING_BUF_GET_BUSY_SIZE_EXTERNAL)) && BUFF_RING_GET_BUSY_SIZE_ENABLED )
+Buff_Size_DT Buff_Ring_Get_Busy_Size(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
+{
+   Buff_Size_DT result = 0;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      result = BUFF_RING_GET_BUSY_SIZE(buf);
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Get_Busy_Size */
+#endif
+
+
+
+#if( (!defined(RING_BUF_GET_BUSY_SIZE_EXTERNAL)) && BUFF_RING_GET_BUSY_SIZE_ENABLED && BUFF_RING_USE_BUSY_SIZE_MONITORING )
+Buff_Size_DT Buff_Ring_Get_Max_Busy_Size(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
+{
+   Buff_Size_DT result = 0;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      result = BUFF_RING_GET_MAX_BUSY_SIZE(buf);
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Get_Max_Busy_Size */
+#endif
+
+
+
+#if( (!defined(RING_BUF_GET_FREE_SIZE_EXTERNAL)) && BUFF_RING_GET_FREE_SIZE_ENABLED )
+Buff_Size_DT Buff_Ring_Get_Free_Size(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
+{
+   Buff_Size_DT result = 0;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      result = BUFF_RING_GET_FREE_SIZE(buf);
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Get_Free_Size */
+#endif
+
+
+
+#if( (!defined(RING_BUF_GET_CONTINOUS_FREE_SIZE_EXTERNAL)) && BUFF_RING_GET_CONTINOUS_FREE_SIZE_ENABLED )
+Buff_Size_DT Buff_Ring_Get_Continous_Free_Size(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
+{
+   Buff_Size_DT result = 0;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+#if(BUFF_RING_USE_LOCK_FREE_SPSC)
+      result = buff_ring_spsc_get_continous_free_size(buf);
+#else
+      if(BUFF_RING_IS_FREE_SPACE_CONTINOUS(buf))
+      {
+         result = BUFF_RING_GET_FREE_SIZE(buf);
+      }
+      else
+      {
+         result = buf->size - buf->first_free;
+      }
+#endif
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Get_Continous_Free_Size */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_GET_CURRENT_POS_EXTERNAL)) && BUFF_RING_GET_CURRENT_POS_ENABLED )
+Buff_Size_DT Buff_Ring_Get_Current_Pos(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
+{
+   Buff_Size_DT result = 0;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      result = BUFF_RING_GET_CURRENT_POS(buf);
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+}/* Buff_Ring_Get_Current_Pos */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_DATA_CHECK_OUT_EXTERNAL)) && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED )
+void *Buff_Ring_Data_Check_Out(
+   Buff_Ring_XT  *buf,
+   Buff_Size_DT   size_needed,
+   Buff_Bool_DT   overwrite_if_no_free_space,
+   Buff_Bool_DT   use_protection)
+{
+   void          *result = BUFF_MAKE_INVALID_PTR(void);
+#if((!BUFF_RING_USE_LOCK_FREE_SPSC) && (!BUFF_RING_USE_POWER_OF_2_SIZE))
+   Buff_Bool_DT   resize_occured = BUFF_FALSE;
+#endif
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+#if((!BUFF_RING_ALLOW_OLD_DATA_OVERWRITE) || BUFF_RING_USE_LOCK_FREE_SPSC || BUFF_RING_USE_POWER_OF_2_SIZE)
+   BUFF_UNUSED_PARAM(overwrite_if_no_free_space);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && (size_needed <= buf->original_size)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+#if(BUFF_RING_USE_LOCK_FREE_SPSC)
+      /* consumer works in parallel so buffer cannot be resized - only continous free space can be checked out */
+      if(size_needed <= buff_ring_spsc_get_continous_free_size(buf))
+      {
+         result = (void*)(&((uint8_t*)(buf->memory))[BUFF_RING_GET_CURRENT_POS(buf)]);
+      }
+#elif(BUFF_RING_USE_POWER_OF_2_SIZE)
+      /* size of buffer must stay power of 2 so buffer cannot be resized - only continous free space can be checked out */
+      if((size_needed <= BUFF_RING_PRODUCER_GET_FREE_SIZE(buf, size_needed))
+         && (BUFF_RING_IS_FREE_SPACE_CONTINOUS(buf) || (size_needed <= (buf->size - buf->first_free))))
+      {
+         result = (void*)(&((uint8_t*)(buf->memory))[BUFF_RING_GET_CURRENT_POS(buf)]);
+      }
+#else
+      /* free space is not continous - part of free space is at the end of the buffer, part on the begining */
+      if(!BUFF_RING_IS_FREE_SPACE_CONTINOUS(buf))
+      {
+         /* part of free space at the end of the buffer is too small to contain requested size */
+         if(size_needed > (buf->size - buf->first_free))
+         {
+            buf->size         = buf->first_free;
+            buf->first_free   = 0;
+            resize_occured    = BUFF_TRUE;
+         }
+      }
+
+#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+      if((size_needed > BUFF_RING_GET_FREE_SIZE(buf)) && BUFF_BOOL_IS_TRUE(overwrite_if_no_free_space) && (!BUFF_RING_IS_SPLICED(buf))
+         && (!BUFF_RING_IS_READ_POSTED(buf)))
+      {
+         Buff_Ring_Remove(buf, size_needed - BUFF_RING_GET_FREE_SIZE(buf), BUFF_FALSE);
+      }
+#endif
+
+      /* return pointer if there is enough free space */
+      if(size_needed <= BUFF_RING_PRODUCER_GET_FREE_SIZE(buf, size_needed))
+      {
+         result = (void*)(&((uint8_t*)(buf->memory))[BUFF_RING_GET_CURRENT_POS(buf)]);
+      }
+      /* there is not enough space so invalid pointer is returned. anyway, if resize occured restore original size. */
+      else if(BUFF_BOOL_IS_TRUE(resize_occured))
+      {
+         buf->first_free   = buf->size;
+         buf->size         = buf->original_size;
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Data_Check_Out */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_DATA_CHECK_OUT_VECTOR_EXTERNAL)) && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED )
+Buff_Size_DT Buff_Ring_Data_Check_Out_Vector(
+   Buff_Ring_XT                *buf,
+   Buff_Writeable_Vector_XT     vector[2],
+   Buff_Size_DT                 size_needed,
+   Buff_Bool_DT                 overwrite_if_no_free_space,
+   Buff_Bool_DT                 use_protection)
+{
+   Buff_Size_DT count = 0;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+#if(!BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+   BUFF_UNUSED_PARAM(overwrite_if_no_free_space);
+#if(!(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_PADDED_LAYOUT))
+   BUFF_UNUSED_PARAM(size_needed);
+#endif
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Writeable_Vector_XT, vector) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      count = BUFF_RING_PRODUCER_GET_FREE_SIZE(buf, size_needed);
+
+#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+      if((size_needed > count) && BUFF_BOOL_IS_TRUE(overwrite_if_no_free_space) && (!BUFF_RING_IS_SPLICED(buf))
+         && (!BUFF_RING_IS_READ_POSTED(buf)))
+      {
+         if(BUFF_LIKELY(size_needed < buf->size))
+         {
+            Buff_Ring_Remove(buf, size_needed - count, BUFF_FALSE);
+         }
+         else
+         {
+            Buff_Ring_Clear(buf, BUFF_FALSE);
+         }
+
+         count = BUFF_RING_GET_FREE_SIZE(buf);
+      }
+#endif
+
+      vector[0].data = &((uint8_t*)(buf->memory))[buf->first_free];
+      vector[1].data = buf->memory;
+
+      if(BUFF_LIKELY(BUFF_RING_IS_MIRRORED(buf) || (buf->first_free <= (buf->size - count))))
+      {
+         vector[0].size = count;
+         vector[1].size = 0;
+      }
+      else
+      {
+         vector[0].size = buf->size - buf->first_free;
+         vector[1].size = count - vector[0].size;
+      }
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+} /* Buff_Ring_Data_Check_Out_Vector */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_DATA_CHECK_IN_EXTERNAL)) && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED )
+Buff_Size_DT Buff_Ring_Data_Check_In(Buff_Ring_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection)
+{
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Write on_write;
+#endif
+   Buff_Size_DT result = (Buff_Size_DT)(-1);
+   Buff_Size_DT part_at_the_end_size = 0;
+   Buff_Size_DT first_free;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+#endif
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+      if(BUFF_LIKELY((size <= BUFF_RING_PRODUCER_GET_FREE_SIZE(buf, size)) && (size > 0)))
+      {
+         BUFF_RING_INCREASE_BUSY_SIZE(buf, size);
+
+         /* do buffer de-fragmentation */
+         if(BUFF_UNLIKELY((0 == buf->first_free) && (buf->size != buf->original_size)))
+         {
+            part_at_the_end_size = (size <= (buf->original_size - buf->size)) ? size : buf->original_size - buf->size;
+
+            BUFF_MEMCPY(&(((uint8_t*)(buf->memory))[buf->size]), buf->memory, part_at_the_end_size);
+
+            size -= part_at_the_end_size;
+
+            memmove(buf->memory, &(((uint8_t*)(buf->memory))[part_at_the_end_size]), size);
+
+            result          = buf->size;
+            buf->first_free = buf->size + part_at_the_end_size;
+            buf->size       = buf->original_size;
+
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            if(size > 0)
+            {
+               rewind_occured = BUFF_TRUE;
+            }
+#endif
+         }
+         else
+         {
+            result = buf->first_free;
+         }
+         first_free = BUFF_RING_WRAP_POS(buf, buf->first_free + size);
+
+         BUFF_RING_SET_FIRST_FREE(buf, first_free);
+
+#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
+         if(BUFF_RING_GET_BUSY_SIZE(buf) >= buf->max_busy_size)
+         {
+            buf->max_busy_size = BUFF_RING_GET_BUSY_SIZE(buf);
+         }
+#endif
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         extension = buf->protected_extension;
+
+         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+         {
+            on_write = extension->on_write;
+
+            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+            {
+               on_write(buf, extension, part_at_the_end_size + size, rewind_occured);
+            }
+         }
+#endif
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && ((Buff_Size_DT)(-1) != result))
+      {
+         on_write = extension->on_write;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+         {
+            on_write(buf, extension, part_at_the_end_size + size, rewind_occured);
+         }
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Data_Check_In */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_RESERVE_EXTERNAL)) && BUFF_RING_RESERVE_ENABLED && BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_MULTI_PRODUCER )
+Buff_Size_DT Buff_Ring_Reserve(Buff_Ring_XT *buf, Buff_Writeable_Vector_XT vector[2], Buff_Size_DT size)
+{
+   Buff_Size_DT result = (Buff_Size_DT)(-1);
+   Buff_Size_DT first_reserved;
+   Buff_Size_DT next_reserved;
+   Buff_Size_DT busy_size;
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && BUFF_CHECK_PTR(Buff_Writeable_Vector_XT, vector) && (size > 0)))
+   {
+      first_reserved = BUFF_ATOMIC_LOAD_ACQUIRE(&(buf->first_reserved));
+
+      for(;;)
+      {
+         /* space reserved but not committed yet is treated as busy */
+         busy_size = first_reserved + buf->size - BUFF_RING_GET_FIRST_BUSY(buf);
+
+         busy_size = BUFF_RING_WRAP_POS(buf, busy_size);
+
+         if(BUFF_UNLIKELY(size >= (buf->size - busy_size)))
+         {
+            break;
+         }
+
+         next_reserved = first_reserved + size;
+
+         next_reserved = BUFF_RING_WRAP_POS(buf, next_reserved);
+
+         /* if other producer reserved space in meantime then first_reserved is updated and calculation is repeated */
+         if(BUFF_ATOMIC_COMPARE_EXCHANGE(&(buf->first_reserved), &first_reserved, next_reserved))
+         {
+            result = first_reserved;
+            break;
+         }
+      }
+
+      if((Buff_Size_DT)(-1) != result)
+      {
+         vector[0].data = &(((uint8_t*)(buf->memory))[result]);
+         vector[1].data = buf->memory;
+
+         if(size <= (buf->size - result))
+         {
+            vector[0].size = size;
+            vector[1].size = 0;
+         }
+         else
+         {
+            vector[0].size = buf->size - result;
+            vector[1].size = size - vector[0].size;
+         }
+      }
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Reserve */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_COMMIT_EXTERNAL)) && BUFF_RING_COMMIT_ENABLED && BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_MULTI_PRODUCER )
+Buff_Bool_DT Buff_Ring_Commit(Buff_Ring_XT *buf, Buff_Size_DT pos, Buff_Size_DT size)
+{
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Write on_write;
+#endif
+   Buff_Size_DT first_free;
+   Buff_Bool_DT result = BUFF_FALSE;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && (pos < buf->size) && (size > 0) && (size < buf->size)))
+   {
+      /* commits are published in reservation order - wait until all previous reservations are committed */
+      while(pos != BUFF_RING_GET_FIRST_FREE(buf))
+      {
+         BUFF_ATOMIC_CPU_RELAX();
+      }
+
+      first_free = pos + size;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+      rewind_occured = (first_free >= buf->size) ? BUFF_TRUE : BUFF_FALSE;
+#endif
+      first_free = BUFF_RING_WRAP_POS(buf, first_free);
+
+      /* until first_free is published no other producer can commit, so below part is executed exclusively */
+#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
+      if(BUFF_RING_MODULO_SIZE(buf, first_free + buf->size - BUFF_RING_GET_FIRST_BUSY(buf)) >= buf->max_busy_size)
+      {
+         buf->max_busy_size = BUFF_RING_MODULO_SIZE(buf, first_free + buf->size - BUFF_RING_GET_FIRST_BUSY(buf));
+      }
+#endif
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+      extension = buf->protected_extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+      {
+         on_write = extension->on_write;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+         {
+            on_write(buf, extension, size, rewind_occured);
+         }
+      }
+#endif
+
+      BUFF_RING_SET_FIRST_FREE(buf, first_free);
+
+      result = BUFF_TRUE;
+
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+      {
+         on_write = extension->on_write;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+         {
+            on_write(buf, extension, size, rewind_occured);
+         }
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Commit */
+#endif
+
+
+
+#if( (!defined(RING_BUF_WRITE_EXTERNAL)) && BUFF_RING_WRITE_ENABLED )
+Buff_Size_DT Buff_Ring_Write(
+   Buff_Ring_XT  *buf,
+   const void    *data,
+   Buff_Size_DT   size,
+   Buff_Bool_DT   overwrite_if_no_free_space,
+   Buff_Bool_DT   use_protection)
+{
+#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VENDOR_BUFFERS)
+
+   return Buff_Ring_Write_Vendor(buf, data, size, buff_vendor_memcpy, overwrite_if_no_free_space, use_protection);
+
+#elif(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+
+   Buff_Readable_Tree_XT tree;
+   Buff_Readable_Vector_XT vector;
+
+   tree.is_branch = BUFF_FALSE;
+   tree.elem_type.vector.vector           = &vector;
+   tree.elem_type.vector.vector_num_elems = 1;
+
+   vector.data = data;
+   vector.size = size;
+
+   return Buff_Ring_Write_From_Tree(
+      buf, &tree, 1, size, 0, overwrite_if_no_free_space, use_protection);
+
+#elif(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VECTOR_BUFFERS)
+
+   Buff_Readable_Vector_XT vector;
+
+   vector.data = data;
+   vector.size = size;
+
+   return Buff_Ring_Write_From_Vector(
+      buf, &vector, 1, size, 0, overwrite_if_no_free_space, use_protection);
+
+#else
+
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Write on_write;
+#endif
+   Buff_Size_DT part_size;
+   Buff_Size_DT first_free;
+   Buff_Size_DT count = 0;
+#if(BUFF_RING_USE_NON_TEMPORAL_COPY)
+   Buff_Bool_DT non_temporal;
+#endif
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+#if(BUFF_RING_USE_EXTENSIONS)
+   Buff_Bool_DT data_changed = BUFF_FALSE;
+#endif
+#endif
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+#if(!BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+   BUFF_UNUSED_PARAM(overwrite_if_no_free_space);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      BUFF_RING_AUTO_GROW(buf, size);
+
+      count = BUFF_RING_PRODUCER_GET_FREE_SIZE(buf, size);
+
+      if(BUFF_LIKELY(size <= count))
+      {
+         count = size;
+      }
+#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+      else if(BUFF_BOOL_IS_TRUE(overwrite_if_no_free_space) && (!BUFF_RING_IS_SPLICED(buf)) && (!BUFF_RING_IS_READ_POSTED(buf)))
+      {
+         if(BUFF_LIKELY(size < buf->size))
+         {
+            Buff_Ring_Remove(buf, size - count, BUFF_FALSE);
+
+            count = size;
+         }
+         else
+         {
+            Buff_Ring_Clear(buf, BUFF_FALSE);
+
+            count = buf->size;
+         }
+      }
+#endif
+
+      if(BUFF_LIKELY(count > 0))
+      {
+#if(BUFF_RING_USE_EXTENSIONS)
+         data_changed = BUFF_TRUE;
+#endif
+#if(BUFF_RING_USE_NON_TEMPORAL_COPY)
+         non_temporal = BUFF_RING_IS_NON_TEMPORAL_COPY(buf, count);
+#endif
+         /* in mirrored buffer data written after end of memory appears on its begining */
+         if(BUFF_LIKELY(BUFF_RING_IS_MIRRORED(buf) || (buf->first_free <= (buf->size - count))))
+         {
+            BUFF_RING_MEMCPY(non_temporal, &((uint8_t*)(buf->memory))[buf->first_free], data, count);
+#if(BUFF_RING_USE_NON_TEMPORAL_COPY)
+            if(BUFF_BOOL_IS_TRUE(non_temporal))
+            {
+               BUFF_NON_TEMPORAL_FENCE();
+            }
+#endif
+
+            BUFF_RING_INCREASE_BUSY_SIZE(buf, count);
+            first_free           = buf->first_free + count;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            rewind_occured       = (first_free >= buf->size) ? BUFF_TRUE : BUFF_FALSE;
+#endif
+            first_free           = BUFF_RING_WRAP_POS(buf, first_free);
+
+            BUFF_RING_SET_FIRST_FREE(buf, first_free);
+         }
+         else
+         {
+            part_size            = buf->size - buf->first_free;
+            BUFF_RING_MEMCPY(non_temporal, &((uint8_t*)(buf->memory))[buf->first_free], data, part_size);
+            data                 = &((uint8_t*)data)[part_size];
+            part_size            = count - part_size;
+            BUFF_RING_MEMCPY(non_temporal, buf->memory, data, part_size);
+#if(BUFF_RING_USE_NON_TEMPORAL_COPY)
+            if(BUFF_BOOL_IS_TRUE(non_temporal))
+            {
+               BUFF_NON_TEMPORAL_FENCE();
+            }
+#endif
+
+            BUFF_RING_INCREASE_BUSY_SIZE(buf, count);
+            BUFF_RING_SET_FIRST_FREE(buf, part_size);
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            rewind_occured       = BUFF_TRUE;
+#endif
+         }
+
+#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
+         if(BUFF_RING_GET_BUSY_SIZE(buf) >= buf->max_busy_size)
+         {
+            buf->max_busy_size = BUFF_RING_GET_BUSY_SIZE(buf);
+         }
+#endif
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         extension = buf->protected_extension;
+
+         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+         {
+            on_write = extension->on_write;
+
+            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+            {
+               on_write(buf, extension, count, rewind_occured);
+            }
+         }
+#endif
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+      {
+         on_write = extension->on_write;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+         {
+            on_write(buf, extension, count, rewind_occured);
+         }
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+
+#endif
+} /* Buff_Ring_Write */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_WRITE_VENDOR_EXTERNAL)) && BUFF_RING_WRITE_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS )
+Buff_Size_DT Buff_Ring_Write_Vendor(
+   Buff_Ring_XT           *buf,
+   const void             *data,
+   Buff_Size_DT            size,
+   Buff_Vendor_Memcpy_HT   vendor_cpy,
+   Buff_Bool_DT            overwrite_if_no_free_space,
+   Buff_Bool_DT            use_protection)
+{
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Write on_write;
+#endif
+   Buff_Memcpy_Params_XT params;
+   Buff_Size_DT part_size;
+   Buff_Size_DT first_free;
+   Buff_Size_DT count = 0;
+   Buff_Size_DT ret_count;
+   Buff_Size_DT ret_count2;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+#if(BUFF_RING_USE_EXTENSIONS)
+   Buff_Bool_DT data_changed = BUFF_FALSE;
+#endif
+#endif
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+#if(!BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+   BUFF_UNUSED_PARAM(overwrite_if_no_free_space);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data)
+      && BUFF_CHECK_HANDLER(Buff_Vendor_Memcpy_HT, vendor_cpy)
+      && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      BUFF_RING_AUTO_GROW(buf, size);
+
+      count = BUFF_RING_PRODUCER_GET_FREE_SIZE(buf, size);
+
+      if(BUFF_LIKELY(size <= count))
+      {
+         count = size;
+      }
+#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+      else if(BUFF_BOOL_IS_TRUE(overwrite_if_no_free_space) && (!BUFF_RING_IS_SPLICED(buf)) && (!BUFF_RING_IS_READ_POSTED(buf)))
+      {
+         if(BUFF_LIKELY(size < buf->size))
+         {
+            Buff_Ring_Remove(buf, size - count, BUFF_FALSE);
+
+            count = size;
+         }
+         else
+         {
+            Buff_Ring_Clear(buf, BUFF_FALSE);
+
+            count = buf->size;
+         }
+      }
+#endif
+
+      if(BUFF_LIKELY(count > 0))
+      {
+#if(BUFF_RING_USE_EXTENSIONS)
+         data_changed = BUFF_TRUE;
+#endif
+         params.dest             = buf->memory;
+         params.src              = data;
+         params.dest_offset      = buf->first_free;
+         params.src_offset       = 0;
+
+         if(BUFF_LIKELY(buf->first_free <= (buf->size - count)))
+         {
+            params.size          = count;
+            params.is_last_part  = BUFF_TRUE;
+
+            ret_count = vendor_cpy(&params);
+
+            /* vendor_cpy might copy less data than requested - depends on vendor_cpy - in this case reduce count */
+            if(BUFF_LIKELY(ret_count <= count))
+            {
+               count = ret_count;
+            }
+
+            BUFF_RING_INCREASE_BUSY_SIZE(buf, count);
+            first_free           = buf->first_free + count;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            rewind_occured       = (first_free >= buf->size) ? BUFF_TRUE : BUFF_FALSE;
+#endif
+            first_free           = BUFF_RING_WRAP_POS(buf, first_free);
+
+            BUFF_RING_SET_FIRST_FREE(buf, first_free);
+         }
+         else
+         {
+            part_size            = buf->size - buf->first_free;
+
+            params.size          = part_size;
+            params.is_last_part  = BUFF_FALSE;
+
+            ret_count = vendor_cpy(&params);
+
+            /* if vendor_cpy copied less data than requested then don't process second buff part */
+            if(ret_count < part_size)
+            {
+               count                = ret_count;
+               BUFF_RING_INCREASE_BUSY_SIZE(buf, ret_count);
+               BUFF_RING_SET_FIRST_FREE(buf, buf->first_free + ret_count);
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+               rewind_occured       = BUFF_FALSE;
+#endif
+            }
+            else
+            {
+               ret_count            = part_size;
+               params.dest          = buf->memory;
+               params.src           = data;
+               params.dest_offset   = 0;
+               params.src_offset    = part_size;
+               part_size            = count - part_size;
+               params.size          = part_size;
+               params.is_last_part  = BUFF_TRUE;
+
+               ret_count2 = vendor_cpy(&params);
+
+               /* vendor_cpy might copy in second step less data than requested - in this case reduce count and part_size */
+               if(BUFF_LIKELY(ret_count2 <= part_size))
+               {
+                  count     = ret_count + ret_count2;
+                  part_size = ret_count2;
+               }
+
+               BUFF_RING_INCREASE_BUSY_SIZE(buf, ret_count + part_size);
+               BUFF_RING_SET_FIRST_FREE(buf, part_size);
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+               rewind_occured       = BUFF_TRUE;
+#endif
+            }
+         }
+
+#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
+         if(BUFF_RING_GET_BUSY_SIZE(buf) >= buf->max_busy_size)
+         {
+            buf->max_busy_size = BUFF_RING_GET_BUSY_SIZE(buf);
+         }
+#endif
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         extension = buf->protected_extension;
+
+         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+         {
+            on_write = extension->on_write;
+
+            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+            {
+               on_write(buf, extension, count, rewind_occured);
+            }
+         }
+#endif
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+      {
+         on_write = extension->on_write;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+         {
+            on_write(buf, extension, count, rewind_occured);
+         }
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+} /* Buff_Ring_Write_Vendor */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_WRITE_CHECKSUM_EXTERNAL)) && BUFF_RING_WRITE_CHECKSUM_ENABLED && BUFF_RING_WRITE_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS && BUFF_USE_CHECKSUM \
+   && BUFF_MEMCPY_CHECKSUM_ENABLED )
+Buff_Size_DT Buff_Ring_Write_Checksum(
+   Buff_Ring_XT           *buf,
+   const void             *data,
+   Buff_Size_DT            size,
+   Buff_Checksum_XT       *checksum,
+   Buff_Bool_DT            overwrite_if_no_free_space,
+   Buff_Bool_DT            use_protection)
+{
+   buff_checksum_context_XT context;
+   Buff_Size_DT             result = 0;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, data) && BUFF_CHECK_PTR(Buff_Checksum_XT, checksum)))
+   {
+      context.src      = data;
+      context.checksum = checksum;
+
+      result = Buff_Ring_Write_Vendor(
+         buf, &context, size, buff_checksum_vendor_memcpy_from_context, overwrite_if_no_free_space, use_protection);
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Write_Checksum */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_WRITE_FROM_VECTOR_EXTERNAL)) && BUFF_RING_WRITE_FROM_VECTOR_ENABLED && BUFF_USE_VECTOR_BUFFERS )
+Buff_Size_DT Buff_Ring_Write_From_Vector(
+   Buff_Ring_XT                    *buf,
+   const Buff_Readable_Vector_XT   *data,
+   Buff_Num_Elems_DT                data_num_elems,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_data,
+   Buff_Bool_DT                     overwrite_if_no_free_space,
+   Buff_Bool_DT                     use_protection)
+{
+#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+
+   Buff_Readable_Tree_XT tree;
+
+   tree.is_branch = BUFF_FALSE;
+   tree.elem_type.vector.vector           = data;
+   tree.elem_type.vector.vector_num_elems = data_num_elems;
+
+   return Buff_Ring_Write_From_Tree(buf, &tree, 1, size, offset_data, overwrite_if_no_free_space, use_protection);
+
+#else
+
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Write on_write;
+#endif
+   Buff_Writeable_Vector_XT vector[2];
+   Buff_Size_DT      count = 0;
+   Buff_Size_DT      first_free;
+   Buff_Size_DT      first_busy;
+   Buff_Num_Elems_DT vector_num_elems;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT      rewind_occured = BUFF_FALSE;
+#if(BUFF_RING_USE_EXTENSIONS)
+   Buff_Bool_DT      data_changed = BUFF_FALSE;
+#endif
+#endif
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+#if(!BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+   BUFF_UNUSED_PARAM(overwrite_if_no_free_space);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Vector_XT, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      BUFF_RING_AUTO_GROW(buf, size);
+
+      count = BUFF_RING_PRODUCER_GET_FREE_SIZE(buf, size);
+
+      if(BUFF_LIKELY(size <= count))
+      {
+         count = size;
+      }
+#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+      else if(BUFF_BOOL_IS_TRUE(overwrite_if_no_free_space) && (!BUFF_RING_IS_SPLICED(buf)) && (!BUFF_RING_IS_READ_POSTED(buf)))
+      {
+         if(BUFF_LIKELY(size < buf->size))
+         {
+            Buff_Ring_Remove(buf, size - count, BUFF_FALSE);
+
+            count = size;
+         }
+         else
+         {
+            Buff_Ring_Clear(buf, BUFF_FALSE);
+
+            count = buf->size;
+         }
+      }
+#endif
+
+      if(BUFF_LIKELY(count > 0))
+      {
+#if(BUFF_RING_USE_EXTENSIONS)
+         data_changed = BUFF_TRUE;
+#endif
+         first_busy = BUFF_RING_PRODUCER_GET_FIRST_BUSY(buf);
+
+         if(buf->first_free >= first_busy)
+         {
+            if(BUFF_LIKELY(first_busy > 0))
+            {
+               vector_num_elems  = 2;
+               vector[1].data    = buf->memory;
+               vector[1].size    = first_busy;
+            }
+            else
+            {
+               vector_num_elems  = 1;
+            }
+            vector[0].size       = buf->size - buf->first_free;
+         }
+         else
+         {
+            vector_num_elems     = 1;
+            vector[0].size       = first_busy - buf->first_free;
+         }
+         vector[0].data          = &((uint8_t*)(buf->memory))[buf->first_free];
+
+         count = Buff_Copy_Vector_To_Vector(vector, vector_num_elems, data, data_num_elems, count, 0, offset_data);
+
+         if(BUFF_LIKELY(buf->first_free <= (buf->size - count)))
+         {
+            BUFF_RING_INCREASE_BUSY_SIZE(buf, count);
+            first_free           = buf->first_free + count;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            rewind_occured       = (first_free >= buf->size) ? BUFF_TRUE : BUFF_FALSE;
+#endif
+            first_free           = BUFF_RING_WRAP_POS(buf, first_free);
+
+            BUFF_RING_SET_FIRST_FREE(buf, first_free);
+         }
+         else
+         {
+            BUFF_RING_INCREASE_BUSY_SIZE(buf, count);
+            BUFF_RING_SET_FIRST_FREE(buf, buf->first_free + count - buf->size);
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            rewind_occured       = BUFF_TRUE;
+#endif
+         }
+
+#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
+         if(BUFF_RING_GET_BUSY_SIZE(buf) >= buf->max_busy_size)
+         {
+            buf->max_busy_size = BUFF_RING_GET_BUSY_SIZE(buf);
+         }
+#endif
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         extension = buf->protected_extension;
+
+         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+         {
+            on_write = extension->on_write;
+
+            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+            {
+               on_write(buf, extension, count, rewind_occured);
+            }
+         }
+#endif
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+      {
+         on_write = extension->on_write;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+         {
+            on_write(buf, extension, count, rewind_occured);
+         }
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+
+#endif
+} /* Buff_Ring_Write_From_Vector */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_WRITE_FROM_TREE_EXTERNAL)) && BUFF_RING_WRITE_FROM_TREE_ENABLED && BUFF_USE_TREE_BUFFERS )
+Buff_Size_DT Buff_Ring_Write_From_Tree(
+   Buff_Ring_XT                 *buf,
+   const Buff_Readable_Tree_XT  *data,
+   Buff_Num_Elems_DT             data_num_elems,
+   Buff_Size_DT                  size,
+   Buff_Size_DT                  offset_data,
+   Buff_Bool_DT                  overwrite_if_no_free_space,
+   Buff_Bool_DT                  use_protection)
+{
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Write on_write;
+#endif
+   Buff_Writeable_Vector_XT vector[2];
+   Buff_Writeable_Tree_XT tree;
+   Buff_Size_DT count = 0;
+   Buff_Size_DT first_free;
+   Buff_Size_DT first_busy;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+#if(BUFF_RING_USE_EXTENSIONS)
+   Buff_Bool_DT data_changed = BUFF_FALSE;
+#endif
+#endif
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+#if(!BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+   BUFF_UNUSED_PARAM(overwrite_if_no_free_space);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Tree_XT, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      BUFF_RING_AUTO_GROW(buf, size);
+
+      count = BUFF_RING_PRODUCER_GET_FREE_SIZE(buf, size);
+
+      if(BUFF_LIKELY(size <= count))
+      {
+         count = size;
+      }
+#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+      else if(BUFF_BOOL_IS_TRUE(overwrite_if_no_free_space) && (!BUFF_RING_IS_SPLICED(buf)) && (!BUFF_RING_IS_READ_POSTED(buf)))
+      {
+         if(BUFF_LIKELY(size < buf->size))
+         {
+            Buff_Ring_Remove(buf, size - count, BUFF_FALSE);
+
+            count = size;
+         }
+         else
+         {
+            Buff_Ring_Clear(buf, BUFF_FALSE);
+
+            count = buf->size;
+         }
+      }
+#endif
+
+      if(BUFF_LIKELY(count > 0))
+      {
+#if(BUFF_RING_USE_EXTENSIONS)
+         data_changed = BUFF_TRUE;
+#endif
+         tree.elem_type.vector.vector  = vector;
+         tree.is_branch                = BUFF_FALSE;
+
+         first_busy                    = BUFF_RING_PRODUCER_GET_FIRST_BUSY(buf);
+
+         if(buf->first_free >= first_busy)
+         {
+            if(BUFF_LIKELY(first_busy > 0))
+            {
+               vector[1].data                         = buf->memory;
+               vector[1].size                         = first_busy;
+               tree.elem_type.vector.vector_num_elems = 2;
+            }
+            else
+            {
+               tree.elem_type.vector.vector_num_elems = 1;
+            }
+            vector[0].size                            = buf->size - buf->first_free;
+         }
+         else
+         {
+            tree.elem_type.vector.vector_num_elems    = 1;
+            vector[0].size                            = first_busy - buf->first_free;
+         }
+         vector[0].data                               = &((uint8_t*)(buf->memory))[buf->first_free];
+
+         count = Buff_Copy_Tree_To_Tree(
+            &tree,
+            1,
+            data,
+            data_num_elems,
+            count,
+            0,
+            offset_data,
+            BUFF_MAKE_INVALID_PTR(Buff_Size_DT),
+            BUFF_MAKE_INVALID_PTR(Buff_Bool_DT));
+
+         if(BUFF_LIKELY(buf->first_free <= (buf->size - count)))
+         {
+            BUFF_RING_INCREASE_BUSY_SIZE(buf, count);
+            first_free           = buf->first_free + count;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            rewind_occured       = (first_free >= buf->size) ? BUFF_TRUE : BUFF_FALSE;
+#endif
+            first_free           = BUFF_RING_WRAP_POS(buf, first_free);
+
+            BUFF_RING_SET_FIRST_FREE(buf, first_free);
+         }
+         else
+         {
+            BUFF_RING_INCREASE_BUSY_SIZE(buf, count);
+            BUFF_RING_SET_FIRST_FREE(buf, buf->first_free + count - buf->size);
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            rewind_occured       = BUFF_TRUE;
+#endif
+         }
+
+#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
+         if(BUFF_RING_GET_BUSY_SIZE(buf) >= buf->max_busy_size)
+         {
+            buf->max_busy_size = BUFF_RING_GET_BUSY_SIZE(buf);
+         }
+#endif
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         extension = buf->protected_extension;
+
+         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+         {
+            on_write = extension->on_write;
+
+            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+            {
+               on_write(buf, extension, count, rewind_occured);
+            }
+         }
+#endif
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+      {
+         on_write = extension->on_write;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+         {
+            on_write(buf, extension, count, rewind_occured);
+         }
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+} /* Buff_Ring_Write_From_Tree */
+#endif
+
+
+
+#if( ((!defined(BUFF_RING_WRITE_FROM_VECTOR_CURSOR_EXTERNAL)) && BUFF_RING_WRITE_FROM_VECTOR_CURSOR_ENABLED && BUFF_USE_VECTOR_BUFFERS && BUFF_READABLE_VECTOR_CURSOR_ENABLED) || ((!defined(BUFF_RING_WRITE_FROM_TREE_CURSOR_EXTERNAL)) && BUFF_RING_WRITE_FROM_TREE_CURSOR_ENABLED && BUFF_USE_TREE_BUFFERS && BUFF_READABLE_TREE_CURSOR_ENABLED) )
+/**
+ * Type of function which copies data from cursor (vector or tree cursor) to linear buffer and moves the cursor.
+ */
+typedef Buff_Size_DT (*buff_ring_cursor_copy_HT)(void *dest, void *cursor, Buff_Size_DT size);
+
+static Buff_Size_DT buff_ring_write_from_cursor(
+   Buff_Ring_XT              *buf,
+   buff_ring_cursor_copy_HT   cursor_copy,
+   void                      *cursor,
+   Buff_Size_DT               size,
+   Buff_Bool_DT               overwrite_if_no_free_space,
+   Buff_Bool_DT               use_protection)
+{
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Write on_write;
+#endif
+   Buff_Writeable_Vector_XT vector[2];
+   Buff_Size_DT      count = 0;
+   Buff_Size_DT      part;
+   Buff_Size_DT      first_free;
+   Buff_Size_DT      first_busy;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT      rewind_occured = BUFF_FALSE;
+#if(BUFF_RING_USE_EXTENSIONS)
+   Buff_Bool_DT      data_changed = BUFF_FALSE;
+#endif
+#endif
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+#if(!BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+   BUFF_UNUSED_PARAM(overwrite_if_no_free_space);
+#endif
+
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, cursor) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      BUFF_RING_AUTO_GROW(buf, size);
+
+      count = BUFF_RING_PRODUCER_GET_FREE_SIZE(buf, size);
+
+      if(BUFF_LIKELY(size <= count))
+      {
+         count = size;
+      }
+#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+      else if(BUFF_BOOL_IS_TRUE(overwrite_if_no_free_space) && (!BUFF_RING_IS_SPLICED(buf)) && (!BUFF_RING_IS_READ_POSTED(buf)))
+      {
+         if(BUFF_LIKELY(size < buf->size))
+         {
+            Buff_Ring_Remove(buf, size - count, BUFF_FALSE);
+
+            count = size;
+         }
+         else
+         {
+            Buff_Ring_Clear(buf, BUFF_FALSE);
+
+            count = buf->size;
+         }
+      }
+#endif
+
+      if(BUFF_LIKELY(count > 0))
+      {
+         first_busy = BUFF_RING_PRODUCER_GET_FIRST_BUSY(buf);
+
+         if(BUFF_RING_IS_MIRRORED(buf) || (buf->first_free < first_busy))
+         {
+            vector[0].size       = count;
+            vector[1].size       = 0;
+         }
+         else
+         {
+            vector[0].size       = buf->size - buf->first_free;
+            vector[1].size       = first_busy;
+         }
+         vector[0].data          = &((uint8_t*)(buf->memory))[buf->first_free];
+         vector[1].data          = buf->memory;
+
+         /* data is copied directly from position of the cursor - no searching of offset in vector / tree */
+         part = (count < vector[0].size) ? count : vector[0].size;
+         part = cursor_copy(vector[0].data, cursor, part);
+
+         if((part == vector[0].size) && (count > part))
+         {
+            part += cursor_copy(vector[1].data, cursor, count - part);
+         }
+
+         count = part;
+
+         if(BUFF_LIKELY(count > 0))
+         {
+#if(BUFF_RING_USE_EXTENSIONS)
+            data_changed = BUFF_TRUE;
+#endif
+            if(BUFF_LIKELY(BUFF_RING_IS_MIRRORED(buf) || (buf->first_free <= (buf->size - count))))
+            {
+               BUFF_RING_INCREASE_BUSY_SIZE(buf, count);
+               first_free           = buf->first_free + count;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+               rewind_occured       = (first_free >= buf->size) ? BUFF_TRUE : BUFF_FALSE;
+#endif
+               first_free           = BUFF_RING_WRAP_POS(buf, first_free);
+
+               BUFF_RING_SET_FIRST_FREE(buf, first_free);
+            }
+            else
+            {
+               BUFF_RING_INCREASE_BUSY_SIZE(buf, count);
+               BUFF_RING_SET_FIRST_FREE(buf, buf->first_free + count - buf->size);
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+               rewind_occured       = BUFF_TRUE;
+#endif
+            }
+
+#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
+            if(BUFF_RING_GET_BUSY_SIZE(buf) >= buf->max_busy_size)
+            {
+               buf->max_busy_size = BUFF_RING_GET_BUSY_SIZE(buf);
+            }
+#endif
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            extension = buf->protected_extension;
+
+            if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+            {
+               on_write = extension->on_write;
+
+               if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+               {
+                  on_write(buf, extension, count, rewind_occured);
+               }
+            }
+#endif
+         }
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+      {
+         on_write = extension->on_write;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+         {
+            on_write(buf, extension, count, rewind_occured);
+         }
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+
+   return count;
+} /* buff_ring_write_from_cursor */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_WRITE_FROM_VECTOR_CURSOR_EXTERNAL)) && BUFF_RING_WRITE_FROM_VECTOR_CURSOR_ENABLED && BUFF_USE_VECTOR_BUFFERS && BUFF_READABLE_VECTOR_CURSOR_ENABLED )
+static Buff_Size_DT buff_ring_vector_cursor_copy(void *dest, void *cursor, Buff_Size_DT size)
+{
+   return Buff_Copy_From_Vector_Cursor(dest, (Buff_Readable_Vector_Cursor_XT*)cursor, size);
+} /* buff_ring_vector_cursor_copy */
+
+
+
+Buff_Size_DT Buff_Ring_Write_From_Vector_Cursor(
+   Buff_Ring_XT                    *buf,
+   Buff_Readable_Vector_Cursor_XT  *cursor,
+   Buff_Size_DT                     size,
+   Buff_Bool_DT                     overwrite_if_no_free_space,
+   Buff_Bool_DT                     use_protection)
+{
+   Buff_Size_DT result;
+
+   BUFF_ENTER_FUNC();
+
+   result = buff_ring_write_from_cursor(buf, buff_ring_vector_cursor_copy, cursor, size, overwrite_if_no_free_space, use_protection);
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Write_From_Vector_Cursor */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_WRITE_FROM_TREE_CURSOR_EXTERNAL)) && BUFF_RING_WRITE_FROM_TREE_CURSOR_ENABLED && BUFF_USE_TREE_BUFFERS && BUFF_READABLE_TREE_CURSOR_ENABLED )
+static Buff_Size_DT buff_ring_tree_cursor_copy(void *dest, void *cursor, Buff_Size_DT size)
+{
+   return Buff_Copy_From_Tree_Cursor(dest, (Buff_Readable_Tree_Cursor_XT*)cursor, size);
+} /* buff_ring_tree_cursor_copy */
+
+
+
+Buff_Size_DT Buff_Ring_Write_From_Tree_Cursor(
+   Buff_Ring_XT                    *buf,
+   Buff_Readable_Tree_Cursor_XT    *cursor,
+   Buff_Size_DT                     size,
+   Buff_Bool_DT                     overwrite_if_no_free_space,
+   Buff_Bool_DT                     use_protection)
+{
+   Buff_Size_DT result;
+
+   BUFF_ENTER_FUNC();
+
+   result = buff_ring_write_from_cursor(buf, buff_ring_tree_cursor_copy, cursor, size, overwrite_if_no_free_space, use_protection);
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Write_From_Tree_Cursor */
+#endif
+
+
+
+#if( (!defined(RING_BUF_OVERWRITE_IF_EXIST_EXTERNAL)) && BUFF_RING_OVERWRITE_IF_EXIST_ENABLED )
+Buff_Size_DT Buff_Ring_OverWrite_If_Exist(
+   Buff_Ring_XT  *buf,
+   const void    *data,
+   Buff_Size_DT   size,
+   Buff_Size_DT   pos,
+   Buff_Bool_DT   use_protection)
+{
+#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VENDOR_BUFFERS)
+
+   return Buff_Ring_OverWrite_If_Exist_Vendor(buf, data, size, pos, buff_vendor_memcpy, use_protection);
+
+#else
+
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Overwrite on_overwrite;
+#endif
+   Buff_Size_DT part_size;
+   Buff_Size_DT first_free;
+   Buff_Size_DT count = 0;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+#if(BUFF_RING_USE_EXTENSIONS)
+   Buff_Bool_DT data_changed = BUFF_FALSE;
+#endif
+#endif
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      count      = BUFF_RING_GET_BUSY_SIZE(buf);
+      first_free = BUFF_RING_GET_FIRST_FREE(buf);
+
+      if(BUFF_LIKELY((size <= count) && (pos < buf->size)))
+      {
+         count = size;
+
+         if(BUFF_LIKELY(count > 0))
+         {
+#if(BUFF_RING_USE_EXTENSIONS)
+            data_changed = BUFF_TRUE;
+#endif
+            /* check if busy area is continous (doesn't start at end of memory and ends on begining) */
+            if(first_free > buf->first_busy)
+            {
+               /* check if whole memory requested to be modified is on busy area */
+               if(BUFF_LIKELY((pos >= buf->first_busy) && (pos <= (first_free - size))))
+               {
+                  BUFF_MEMCPY( &((uint8_t*)(buf->memory))[pos], data, count);
+               }
+               /* memory requested to be modified is not fully inside busy area */
+               else
+               {
+                  count = 0;
+               }
+            }
+            else
+            {
+               /* check if begining of memory requested to be modified is on the begining of busy area (end of memory) */
+               if(pos >= buf->first_busy)
+               {
+                  /* check if whole memory requested to be modified is on the begining of busy area (end of memory) */
+                  if(pos <= (buf->size - size))
+                  {
+                     BUFF_MEMCPY( &((uint8_t*)(buf->memory))[pos], data, count);
+                  }
+                  /*
+                  * check if memory requested to be modified is partially on the begining of busy area (end of memory)
+                  * and partially on the end of busy area (begining of memory)
+                  */
+                  else if((pos + size - buf->size) <= first_free)
+                  {
+                     part_size      = buf->size - pos;
+                     BUFF_MEMCPY( &((uint8_t*)(buf->memory))[pos], data, part_size);
+                     data           = &((uint8_t*)data)[part_size];
+                     part_size      = count - part_size;
+                     BUFF_MEMCPY(buf->memory, data, part_size);
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+                     rewind_occured = BUFF_TRUE;
+#endif
+                  }
+                  /* memory requested to be modified is not fully inside busy area */
+                  else
+                  {
+                     count = 0;
+                  }
+               }
+               /* check if whole memory requested to be modified is on the end of busy area (begining of memory) */
+               else if(pos < first_free)
+               {
+                  if(size <= (first_free - pos))
+                  {
+                     BUFF_MEMCPY( &((uint8_t*)(buf->memory))[pos], data, count);
+                  }
+                  /* memory requested to be modified is not fully inside busy area */
+                  else
+                  {
+                     count = 0;
+                  }
+               }
+               /* memory requested to be modified starts outside busy area */
+               else
+               {
+                  count = 0;
+               }
+            }
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            extension = buf->protected_extension;
+
+            if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+            {
+               on_overwrite = extension->on_overwrite;
+
+               if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Overwrite, on_overwrite))
+               {
+                  on_overwrite(buf, extension, pos, count, rewind_occured);
+               }
+            }
+#endif
+         }
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+      {
+         on_overwrite = extension->on_overwrite;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Overwrite, on_overwrite))
+         {
+            on_overwrite(buf, extension, pos, count, rewind_occured);
+         }
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+
+#endif
+} /* Buff_Ring_OverWrite_If_Exist */
+#endif
+
+
+
+#if( (!defined(RING_BUF_OVERWRITE_IF_EXIST_VENDOR_EXTERNAL)) && BUFF_RING_OVERWRITE_IF_EXIST_VENDOR_ENABLED )
+Buff_Size_DT Buff_Ring_OverWrite_If_Exist_Vendor(
+   Buff_Ring_XT           *buf,
+   const void             *data,
+   Buff_Size_DT            size,
+   Buff_Size_DT            pos,
+   Buff_Vendor_Memcpy_HT   vendor_cpy,
+   Buff_Bool_DT            use_protection)
+{
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Overwrite on_overwrite;
+#endif
+   Buff_Memcpy_Params_XT params;
+   Buff_Size_DT part_size;
+   Buff_Size_DT first_free;
+   Buff_Size_DT count = 0;
+   Buff_Size_DT ret_count;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+#if(BUFF_RING_USE_EXTENSIONS)
+   Buff_Bool_DT data_changed = BUFF_FALSE;
+#endif
+#endif
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data)
+      && BUFF_CHECK_HANDLER(Buff_Vendor_Memcpy_HT, vendor_cpy)
+      && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      count      = BUFF_RING_GET_BUSY_SIZE(buf);
+      first_free = BUFF_RING_GET_FIRST_FREE(buf);
+
+      if(BUFF_LIKELY((size <= count) && (pos < buf->size)))
+      {
+         count = size;
+
+         if(BUFF_LIKELY(count > 0))
+         {
+#if(BUFF_RING_USE_EXTENSIONS)
+            data_changed = BUFF_TRUE;
+#endif
+            params.dest          = buf->memory;
+            params.src           = data;
+            params.dest_offset   = pos;
+            params.src_offset    = 0;
+
+            /* check if busy area is continous (doesn't start at end of memory and ends on begining) */
+            if(first_free > buf->first_busy)
+            {
+               /* check if whole memory requested to be modified is on busy area */
+               if(BUFF_LIKELY((pos >= buf->first_busy) && (pos <= (first_free - size))))
+               {
+                  params.size          = count;
+                  params.is_last_part  = BUFF_TRUE;
+
+                  ret_count = vendor_cpy(&params);
+
+                  if(BUFF_LIKELY(ret_count <= count))
+                  {
+                     count = ret_count;
+                  }
+               }
+               /* memory requested to be modified is not fully inside busy area */
+               else
+               {
+                  count = 0;
+               }
+            }
+            else
+            {
+               /* check if begining of memory requested to be modified is on the begining of busy area (end of memory) */
+               if(pos >= buf->first_busy)
+               {
+                  /* check if whole memory requested to be modified is on the begining of busy area (end of memory) */
+                  if(pos <= (buf->size - size))
+                  {
+                     params.size          = count;
+                     params.is_last_part  = BUFF_TRUE;
+
+                     ret_count = vendor_cpy(&params);
+
+                     if(BUFF_LIKELY(ret_count <= count))
+                     {
+                        count = ret_count;
+                     }
+                  }
+                  /*
+                  * check if memory requested to be modified is partially on the begining of busy area (end of memory)
+                  * and partially on the end of busy area (begining of memory)
+                  */
+                  else if((pos + size - buf->size) <= first_free)
+                  {
+                     part_size            = buf->size - pos;
+
+                     params.size          = part_size;
+                     params.is_last_part  = BUFF_FALSE;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+                     rewind_occured       = BUFF_TRUE;
+#endif
+
+                     ret_count = vendor_cpy(&params);
+
+                     /* copy second part only if size returned in first copy is same as requested */
+                     if(BUFF_LIKELY(part_size <= ret_count))
+                     {
+                        ret_count            = part_size;
+                        params.dest          = buf->memory;
+                        params.src           = data;
+                        params.dest_offset   = 0;
+                        params.src_offset    = part_size;
+                        part_size            = count - part_size;
+                        params.size          = part_size;
+                        params.is_last_part  = BUFF_TRUE;
+
+                        ret_count += vendor_cpy(&params);
+
+                        if(BUFF_LIKELY(ret_count <= count))
+                        {
+                           count = ret_count;
+                        }
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+                        rewind_occured       = BUFF_TRUE;
+#endif
+                     }
+                     else
+                     {
+                        count = ret_count;
+                     }
+                  }
+                  /* memory requested to be modified is not fully inside busy area */
+                  else
+                  {
+                     count = 0;
+                  }
+               }
+               /* check if whole memory requested to be modified is on the end of busy area (begining of memory) */
+               else if(pos < first_free)
+               {
+                  if(size <= (first_free - pos))
+                  {
+                     params.size          = count;
+                     params.is_last_part  = BUFF_TRUE;
+
+                     ret_count = vendor_cpy(&params);
+
+                     if(BUFF_LIKELY(ret_count <= count))
+                     {
+                        count = ret_count;
+                     }
+                  }
+                  /* memory requested to be modified is not fully inside busy area */
+                  else
+                  {
+                     count = 0;
+                  }
+               }
+               /* memory requested to be modified is outside busy area */
+               else
+               {
+                  count = 0;
+               }
+            }
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            extension = buf->protected_extension;
+
+            if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+            {
+               on_overwrite = extension->on_overwrite;
+
+               if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Overwrite, on_overwrite))
+               {
+                  on_overwrite(buf, extension, pos, count, rewind_occured);
+               }
+            }
+#endif
+         }
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+      {
+         on_overwrite = extension->on_overwrite;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Overwrite, on_overwrite))
+         {
+            on_overwrite(buf, extension, pos, count, rewind_occured);
+         }
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+} /* Buff_Ring_OverWrite_If_Exist_Vendor */
+#endif
+
+
+
+#if( (!defined(RING_BUF_PEAK_EXTERNAL)) && BUFF_RING_PEAK_ENABLED )
+Buff_Size_DT Buff_Ring_Peak(
+   Buff_Ring_XT  *buf,
+   void          *data,
+   Buff_Size_DT   size,
+   Buff_Size_DT   buf_offset,
+   Buff_Bool_DT   use_protection)
+{
+#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VENDOR_BUFFERS)
+
+   return Buff_Ring_Peak_Vendor(buf, data, size, buf_offset, buff_vendor_memcpy, use_protection);
+
+#elif(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+
+   Buff_Writeable_Tree_XT tree;
+   Buff_Writeable_Vector_XT vector;
+
+   tree.is_branch = BUFF_FALSE;
+   tree.elem_type.vector.vector           = &vector;
+   tree.elem_type.vector.vector_num_elems = 1;
+
+   vector.data = data;
+   vector.size = size;
+
+   return Buff_Ring_Peak_To_Tree(
+      buf, &tree, 1, size, buf_offset, 0, use_protection);
+
+#elif(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VECTOR_BUFFERS)
+
+   Buff_Writeable_Vector_XT vector;
+
+   vector.data = data;
+   vector.size = size;
+
+   return Buff_Ring_Peak_To_Vector(
+      buf, &vector, 1, size, buf_offset, 0, use_protection);
+
+#else
+
+   Buff_Size_DT read_start;
+   Buff_Size_DT part_size;
+   Buff_Size_DT count = 0;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      if(BUFF_LIKELY(buf_offset < BUFF_RING_GET_BUSY_SIZE(buf)))
+      {
+         count = BUFF_RING_GET_BUSY_SIZE(buf) - buf_offset;
+      }
+
+      if(BUFF_LIKELY(size <= count))
+      {
+         count = size;
+      }
+
+      if(BUFF_LIKELY(count > 0))
+      {
+         read_start = buf->first_busy + buf_offset - buf->size;
+
+         if(BUFF_LIKELY(buf->first_busy < (buf->size - buf_offset)))
+         {
+            read_start += buf->size;
+         }
+
+         if(BUFF_LIKELY(BUFF_RING_IS_MIRRORED(buf) || (read_start <= (buf->size - count))))
+         {
+            BUFF_MEMCPY(data, &((const uint8_t*)(buf->memory))[read_start], count);
+         }
+         else
+         {
+            part_size   = buf->size - read_start;
+            BUFF_MEMCPY(data, &((const uint8_t*)(buf->memory))[read_start], part_size);
+
+            data        = &((uint8_t*)data)[part_size];
+            part_size   = count - part_size;
+            BUFF_MEMCPY(data, buf->memory, part_size);
+         }
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+
+#endif
+} /* Buff_Ring_Peak */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_PEAK_VENDOR_EXTERNAL)) && BUFF_RING_PEAK_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS )
+Buff_Size_DT Buff_Ring_Peak_Vendor(
+   Buff_Ring_XT           *buf,
+   void                   *data,
+   Buff_Size_DT            size,
+   Buff_Size_DT            buf_offset,
+   Buff_Vendor_Memcpy_HT   vendor_cpy,
+   Buff_Bool_DT            use_protection)
+{
+   Buff_Memcpy_Params_XT params;
+   Buff_Size_DT read_start;
+   Buff_Size_DT part_size;
+   Buff_Size_DT count = 0;
+   Buff_Size_DT ret_count;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data)
+      && BUFF_CHECK_HANDLER(Buff_Vendor_Memcpy_HT, vendor_cpy)
+      && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      if(BUFF_LIKELY(buf_offset < BUFF_RING_GET_BUSY_SIZE(buf)))
+      {
+         count = BUFF_RING_GET_BUSY_SIZE(buf) - buf_offset;
+      }
+
+      if(BUFF_LIKELY(size <= count))
+      {
+         count = size;
+      }
+
+      if(BUFF_LIKELY(count > 0))
+      {
+         read_start = buf->first_busy + buf_offset - buf->size;
+
+         if(BUFF_LIKELY(buf->first_busy < (buf->size - buf_offset)))
+         {
+            read_start += buf->size;
+         }
+
+         params.dest             = data;
+         params.src              = buf->memory;
+         params.dest_offset      = 0;
+         params.src_offset       = read_start;
+
+         if(BUFF_LIKELY(read_start <= (buf->size - count)))
+         {
+            params.size          = count;
+            params.is_last_part  = BUFF_TRUE;
+
+            ret_count = vendor_cpy(&params);
+
+            if(BUFF_LIKELY(ret_count <= count))
+            {
+               count = ret_count;
+            }
+         }
+         else
+         {
+            part_size = buf->size - read_start;
+
+            params.size          = part_size;
+            params.is_last_part  = BUFF_FALSE;
+
+            ret_count = vendor_cpy(&params);
+
+            if(BUFF_LIKELY(part_size <= ret_count))
+            {
+               ret_count            = part_size;
+               params.dest          = data;
+               params.src           = buf->memory;
+               params.dest_offset   = part_size;
+               params.src_offset    = 0;
+               part_size            = count - part_size;
+               params.size          = part_size;
+               params.is_last_part  = BUFF_TRUE;
+
+               ret_count += vendor_cpy(&params);
+
+               if(BUFF_LIKELY(ret_count <= count))
+               {
+                  count = ret_count;
+               }
+            }
+            else
+            {
+               count = ret_count;
+            }
+         }
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+} /* Buff_Ring_Peak_Vendor */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_PEAK_TO_VECTOR_EXTERNAL)) && BUFF_RING_PEAK_TO_VECTOR_ENABLED && BUFF_USE_VECTOR_BUFFERS )
+Buff_Size_DT Buff_Ring_Peak_To_Vector(
+   Buff_Ring_XT                    *buf,
+   const Buff_Writeable_Vector_XT  *data,
+   Buff_Num_Elems_DT                data_num_elems,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     buf_offset,
+   Buff_Size_DT                     offset_data,
+   Buff_Bool_DT                     use_protection)
+{
+#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+
+   Buff_Writeable_Tree_XT tree;
+
+   tree.is_branch = BUFF_FALSE;
+   tree.elem_type.vector.vector           = data;
+   tree.elem_type.vector.vector_num_elems = data_num_elems;
+
+   return Buff_Ring_Peak_To_Tree(buf, &tree, 1, size, buf_offset, offset_data, use_protection);
+
+#else
+
+   Buff_Readable_Vector_XT vector[2];
+   Buff_Size_DT      read_start;
+   Buff_Size_DT      count = 0;
+   Buff_Num_Elems_DT vector_num_elems;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Writeable_Vector_XT, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      if(BUFF_LIKELY(buf_offset < BUFF_RING_GET_BUSY_SIZE(buf)))
+      {
+         count = BUFF_RING_GET_BUSY_SIZE(buf) - buf_offset;
+      }
+
+      if(BUFF_LIKELY(size <= count))
+      {
+         count = size;
+      }
+
+      if(BUFF_LIKELY(count > 0))
+      {
+         read_start = buf->first_busy + buf_offset - buf->size;
+
+         if(BUFF_LIKELY(buf->first_busy < (buf->size - buf_offset)))
+         {
+            read_start += buf->size;
+         }
+
+         if(read_start >= buf->first_free)
+         {
+            if(BUFF_LIKELY(buf->first_free > 0))
+            {
+               vector[1].data    = buf->memory;
+               vector[1].size    = buf->first_free;
+               vector_num_elems  = 2;
+            }
+            else
+            {
+               vector_num_elems  = 1;
+            }
+            vector[0].size       = buf->size - read_start;
+         }
+         else
+         {
+            vector_num_elems     = 1;
+            vector[0].size       = buf->first_free - read_start;
+         }
+         vector[0].data          = &((const uint8_t*)(buf->memory))[read_start];
+
+         count = Buff_Copy_Vector_To_Vector(data, data_num_elems, vector, vector_num_elems, count, offset_data, 0);
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+
+#endif
+} /* Buff_Ring_Peak_To_Vector */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_PEAK_TO_TREE_EXTERNAL)) && BUFF_RING_PEAK_TO_TREE_ENABLED && BUFF_USE_TREE_BUFFERS )
+Buff_Size_DT Buff_Ring_Peak_To_Tree(
+   Buff_Ring_XT                 *buf,
+   const Buff_Writeable_Tree_XT *data,
+   Buff_Num_Elems_DT             data_num_elems,
+   Buff_Size_DT                  size,
+   Buff_Size_DT                  buf_offset,
+   Buff_Size_DT                  offset_data,
+   Buff_Bool_DT                  use_protection)
+{
+   Buff_Readable_Vector_XT vector[2];
+   Buff_Readable_Tree_XT tree;
+   Buff_Size_DT read_start;
+   Buff_Size_DT count = 0;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Writeable_Tree_XT, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      if(BUFF_LIKELY(buf_offset < BUFF_RING_GET_BUSY_SIZE(buf)))
+      {
+         count = BUFF_RING_GET_BUSY_SIZE(buf) - buf_offset;
+      }
+
+      if(BUFF_LIKELY(size <= count))
+      {
+         count = size;
+      }
+
+      if(BUFF_LIKELY(count > 0))
+      {
+         read_start = buf->first_busy + buf_offset - buf->size;
+
+         if(BUFF_LIKELY(buf->first_busy < (buf->size - buf_offset)))
+         {
+            read_start += buf->size;
+         }
+
+         tree.elem_type.vector.vector  = vector;
+         tree.is_branch = BUFF_FALSE;
+
+         if(read_start >= buf->first_free)
+         {
+            if(BUFF_LIKELY(buf->first_free > 0))
+            {
+               vector[1].data                         = buf->memory;
+               vector[1].size                         = buf->first_free;
+               tree.elem_type.vector.vector_num_elems = 2;
+            }
+            else
+            {
+               tree.elem_type.vector.vector_num_elems = 1;
+            }
+            vector[0].size                            = buf->size - read_start;
+         }
+         else
+         {
+            tree.elem_type.vector.vector_num_elems    = 1;
+            vector[0].size                            = buf->first_free - read_start;
+         }
+         vector[0].data                               = &((const uint8_t*)(buf->memory))[read_start];
+
+         count = Buff_Copy_Tree_To_Tree(
+            data,
+            data_num_elems,
+            &tree,
+            1,
+            count,
+            offset_data,
+            0,
+            BUFF_MAKE_INVALID_PTR(Buff_Size_DT),
+            BUFF_MAKE_INVALID_PTR(Buff_Bool_DT));
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+} /* Buff_Ring_Peak_To_Tree */
+#endif
+
+
+
+#if( ((!defined(BUFF_RING_FIND_BYTE_EXTERNAL)) && BUFF_RING_FIND_BYTE_ENABLED) || ((!defined(BUFF_RING_FIND_PATTERN_EXTERNAL)) && BUFF_RING_FIND_PATTERN_ENABLED) )
+/**
+ * Functions below search linear memory area for pattern (pattern_size bigger than 0) - only positions on which whole pattern
+ * fits inside the area are checked. Returned value is index of first matching position or "size" if pattern has not been found.
+ */
+typedef Buff_Size_DT (*buff_ring_find_HT)(const uint8_t *data, Buff_Size_DT size, const uint8_t *pattern, Buff_Size_DT pattern_size);
+
+static Buff_Size_DT buff_ring_find_std(const uint8_t *data, Buff_Size_DT size, const uint8_t *pattern, Buff_Size_DT pattern_size)
+{
+   const uint8_t *found;
+   Buff_Size_DT   pos = 0;
+   Buff_Size_DT   result = size;
+
+   while((pos + pattern_size) <= size)
+   {
+      found = (const uint8_t*)memchr(&data[pos], pattern[0], size - pattern_size + 1 - pos);
+
+      if(!BUFF_CHECK_PTR(const uint8_t, found))
+      {
+         break;
+      }
+
+      pos = (Buff_Size_DT)(found - data);
+
+      if(0 == memcmp(&data[pos + 1], &pattern[1], pattern_size - 1))
+      {
+         result = pos;
+         break;
+      }
+
+      pos++;
+   }
+
+   return result;
+} /* buff_ring_find_std */
+
+
+
+#if(defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)))
+
+typedef char buff_ring_find_v16_DT __attribute__((vector_size(16)));
+typedef char buff_ring_find_v32_DT __attribute__((vector_size(32)));
+
+/* first and last byte of pattern are compared with 16 / 32 positions at once; only positions on which both match
+   are compared with middle part of the pattern */
+__attribute__((target("sse2")))
+static Buff_Size_DT buff_ring_find_sse2(const uint8_t *data, Buff_Size_DT size, const uint8_t *pattern, Buff_Size_DT pattern_size)
+{
+   buff_ring_find_v16_DT first;
+   buff_ring_find_v16_DT last;
+   buff_ring_find_v16_DT block_first;
+   buff_ring_find_v16_DT block_last;
+   Buff_Size_DT          last_offset = pattern_size - 1;
+   Buff_Size_DT          pos;
+   Buff_Size_DT          bit;
+   Buff_Size_DT          result = size;
+   unsigned int          mask;
+
+   first = (buff_ring_find_v16_DT){0} + (char)pattern[0];
+   last  = (buff_ring_find_v16_DT){0} + (char)pattern[last_offset];
+
+   for(pos = 0; (size == result) && ((pos + last_offset + 16) <= size); pos += 16)
+   {
+      memcpy(&block_first, &data[pos], 16);
+      memcpy(&block_last, &data[pos + last_offset], 16);
+
+      mask = (unsigned int)__builtin_ia32_pmovmskb128(
+         (buff_ring_find_v16_DT)((block_first == first) & (block_last == last)));
+
+      while(0 != mask)
+      {
+         bit = (Buff_Size_DT)__builtin_ctz(mask);
+
+         if((pattern_size <= 2) || (0 == memcmp(&data[pos + bit + 1], &pattern[1], pattern_size - 2)))
+         {
+            result = pos + bit;
+            break;
+         }
+
+         mask &= mask - 1;
+      }
+   }
+
+   if((size == result) && (pos < size))
+   {
+      bit = buff_ring_find_std(&data[pos], size - pos, pattern, pattern_size);
+
+      if(bit < (size - pos))
+      {
+         result = pos + bit;
+      }
+   }
+
+   return result;
+} /* buff_ring_find_sse2 */
+
+
+
+__attribute__((target("avx2")))
+static Buff_Size_DT buff_ring_find_avx2(const uint8_t *data, Buff_Size_DT size, const uint8_t *pattern, Buff_Size_DT pattern_size)
+{
+   buff_ring_find_v32_DT first;
+   buff_ring_find_v32_DT last;
+   buff_ring_find_v32_DT block_first;
+   buff_ring_find_v32_DT block_last;
+   Buff_Size_DT          last_offset = pattern_size - 1;
+   Buff_Size_DT          pos;
+   Buff_Size_DT          bit;
+   Buff_Size_DT          result = size;
+   unsigned int          mask;
+
+   first = (buff_ring_find_v32_DT){0} + (char)pattern[0];
+   last  = (buff_ring_find_v32_DT){0} + (char)pattern[last_offset];
+
+   for(pos = 0; (size == result) && ((pos + last_offset + 32) <= size); pos += 32)
+   {
+      memcpy(&block_first, &data[pos], 32);
+      memcpy(&block_last, &data[pos + last_offset], 32);
+
+      mask = (unsigned int)__builtin_ia32_pmovmskb256(
+         (buff_ring_find_v32_DT)((block_first == first) & (block_last == last)));
+
+      while(0 != mask)
+      {
+         bit = (Buff_Size_DT)__builtin_ctz(mask);
+
+         if((pattern_size <= 2) || (0 == memcmp(&data[pos + bit + 1], &pattern[1], pattern_size - 2)))
+         {
+            result = pos + bit;
+            break;
+         }
+
+         mask &= mask - 1;
+      }
+   }
+
+   if((size == result) && (pos < size))
+   {
+      bit = buff_ring_find_sse2(&data[pos], size - pos, pattern, pattern_size);
+
+      if(bit < (size - pos))
+      {
+         result = pos + bit;
+      }
+   }
+
+   return result;
+} /* buff_ring_find_avx2 */
+
+
+
+static Buff_Size_DT buff_ring_find_select(const uint8_t *data, Buff_Size_DT size, const uint8_t *pattern, Buff_Size_DT pattern_size);
+
+static buff_ring_find_HT buff_ring_find_linear = buff_ring_find_select;
+
+static Buff_Size_DT buff_ring_find_select(const uint8_t *data, Buff_Size_DT size, const uint8_t *pattern, Buff_Size_DT pattern_size)
+{
+   buff_ring_find_HT selected;
+
+   BUFF_CPU_DISPATCH_SELECT(buff_ring_find_linear, selected,
+      BUFF_CPU_IMPLEMENTATION("avx2", buff_ring_find_avx2, BUFF_CPU_IMPLEMENTATION("sse2", buff_ring_find_sse2, buff_ring_find_std)));
+
+   return selected(data, size, pattern, pattern_size);
+} /* buff_ring_find_select */
+
+#define BUFF_RING_FIND_LINEAR(data, size, pattern, pattern_size) \
+   BUFF_CPU_DISPATCH_GET(buff_ring_find_linear)((data), (size), (pattern), (pattern_size))
+
+#else
+
+#define BUFF_RING_FIND_LINEAR(data, size, pattern, pattern_size) \
+   buff_ring_find_std((data), (size), (pattern), (pattern_size))
+
+#endif
+
+
+
+/**
+ * Searches busy data of ring buffer (starting from buf_offset) for pattern; both parts of data divided by the end
+ * of buffer memory are searched in place, as well as positions on which pattern crosses the end of buffer memory.
+ */
+static Buff_Bool_DT buff_ring_find(
+   Buff_Ring_XT *buf, const uint8_t *pattern, Buff_Size_DT pattern_size, Buff_Size_DT buf_offset, Buff_Size_DT *pos)
+{
+   const uint8_t *memory = (const uint8_t*)(buf->memory);
+   Buff_Size_DT   read_start;
+   Buff_Size_DT   count;
+   Buff_Size_DT   first_part;
+   Buff_Size_DT   found;
+   Buff_Size_DT   cntr;
+   Buff_Bool_DT   result = BUFF_FALSE;
+
+   count = BUFF_RING_GET_BUSY_SIZE(buf);
+
+   if(BUFF_LIKELY((buf_offset < count) && (pattern_size <= (count - buf_offset))))
+   {
+      count     -= buf_offset;
+      read_start = buf->first_busy + buf_offset - buf->size;
+
+      if(BUFF_LIKELY(buf->first_busy < (buf->size - buf_offset)))
+      {
+         read_start += buf->size;
+      }
+
+      first_part = count;
+
+      if(BUFF_UNLIKELY((!BUFF_RING_IS_MIRRORED(buf)) && (read_start > (buf->size - count))))
+      {
+         first_part = buf->size - read_start;
+      }
+
+      found = BUFF_RING_FIND_LINEAR(&memory[read_start], first_part, pattern, pattern_size);
+
+      if(found < first_part)
+      {
+         *pos   = buf_offset + found;
+         result = BUFF_TRUE;
+      }
+      else if(first_part < count)
+      {
+         /* positions on which pattern crosses the end of buffer memory */
+         cntr = (first_part >= pattern_size) ? (first_part - pattern_size + 1) : 0;
+
+         for(; (cntr < first_part) && ((cntr + pattern_size) <= count); cntr++)
+         {
+            if((0 == memcmp(&memory[read_start + cntr], pattern, first_part - cntr))
+               && (0 == memcmp(memory, &pattern[first_part - cntr], pattern_size - (first_part - cntr))))
+            {
+               *pos   = buf_offset + cntr;
+               result = BUFF_TRUE;
+               break;
+            }
+         }
+
+         if(!BUFF_BOOL_IS_TRUE(result))
+         {
+            found = BUFF_RING_FIND_LINEAR(memory, count - first_part, pattern, pattern_size);
+
+            if(found < (count - first_part))
+            {
+               *pos   = buf_offset + first_part + found;
+               result = BUFF_TRUE;
+            }
+         }
+      }
+   }
+
+   return result;
+} /* buff_ring_find */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_FIND_BYTE_EXTERNAL)) && BUFF_RING_FIND_BYTE_ENABLED )
+Buff_Bool_DT Buff_Ring_Find_Byte(
+   Buff_Ring_XT  *buf,
+   uint8_t        byte,
+   Buff_Size_DT   buf_offset,
+   Buff_Size_DT  *pos,
+   Buff_Bool_DT   use_protection)
+{
+   Buff_Bool_DT result = BUFF_FALSE;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && BUFF_CHECK_PTR(Buff_Size_DT, pos)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      result = buff_ring_find(buf, &byte, 1, buf_offset, pos);
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Find_Byte */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_FIND_PATTERN_EXTERNAL)) && BUFF_RING_FIND_PATTERN_ENABLED )
+Buff_Bool_DT Buff_Ring_Find_Pattern(
+   Buff_Ring_XT  *buf,
+   const void    *pattern,
+   Buff_Size_DT   pattern_size,
+   Buff_Size_DT   buf_offset,
+   Buff_Size_DT  *pos,
+   Buff_Bool_DT   use_protection)
+{
+   Buff_Bool_DT result = BUFF_FALSE;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && BUFF_CHECK_PTR(const void, pattern) && (pattern_size > 0)
+      && BUFF_CHECK_PTR(Buff_Size_DT, pos)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      result = buff_ring_find(buf, (const uint8_t*)pattern, pattern_size, buf_offset, pos);
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Find_Pattern */
+#endif
+
+
+
+#if( (!defined(RING_BUF_READ_EXTERNAL)) && BUFF_RING_READ_ENABLED )
+Buff_Size_DT Buff_Ring_Read(
+   Buff_Ring_XT  *buf,
+   void          *data,
+   Buff_Size_DT   size,
+   Buff_Bool_DT   use_protection)
+{
+#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VENDOR_BUFFERS)
+
+   return Buff_Ring_Read_Vendor(buf, data, size, buff_vendor_memcpy, use_protection);
+
+#elif(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+
+   Buff_Writeable_Tree_XT tree;
+   Buff_Writeable_Vector_XT vector;
+
+   tree.is_branch = BUFF_FALSE;
+   tree.elem_type.vector.vector           = &vector;
+   tree.elem_type.vector.vector_num_elems = 1;
+
+   vector.data = data;
+   vector.size = size;
+
+   return Buff_Ring_Read_To_Tree(
+      buf, &tree, 1, size, 0, use_protection);
+
+#elif(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VECTOR_BUFFERS)
+
+   Buff_Writeable_Vector_XT vector;
+
+   vector.data = data;
+   vector.size = size;
+
+   return Buff_Ring_Read_To_Vector(
+      buf, &vector, 1, size, 0, use_protection);
+
+#else
+
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Read on_read;
+#endif
+   Buff_Size_DT part_size;
+   Buff_Size_DT first_busy;
+   Buff_Size_DT count = 0;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+#if(BUFF_RING_USE_EXTENSIONS)
+   Buff_Bool_DT data_changed = BUFF_FALSE;
+#endif
+#endif
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      count = BUFF_RING_CONSUMER_GET_BUSY_SIZE(buf, size);
+
+      if(BUFF_LIKELY(size <= count))
+      {
+         count = size;
+      }
+
+      /* data given to the pipe by Buff_Ring_Splice_Out can be removed only by Buff_Ring_Splice_Release */
+      if(BUFF_UNLIKELY(BUFF_RING_IS_SPLICED(buf)))
+      {
+         count = 0;
+      }
+
+      if(BUFF_LIKELY(count > 0))
+      {
+#if(BUFF_RING_USE_EXTENSIONS)
+         data_changed = BUFF_TRUE;
+#endif
+         if(BUFF_LIKELY(BUFF_RING_IS_MIRRORED(buf) || (buf->first_busy <= (buf->size - count))))
+         {
+            BUFF_MEMCPY(data, &((const uint8_t*)(buf->memory))[buf->first_busy], count);
+
+            BUFF_RING_DECREASE_BUSY_SIZE(buf, count);
+            first_busy           = buf->first_busy + count;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            rewind_occured       = (first_busy >= buf->size) ? BUFF_TRUE : BUFF_FALSE;
+#endif
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && (!BUFF_RING_USE_LOCK_FREE_SPSC) && (!BUFF_RING_USE_POWER_OF_2_SIZE))
+            /* buffer shrunk by Buff_Ring_Data_Check_Out gets back its original size when it is rewound */
+            if(BUFF_UNLIKELY(first_busy >= buf->size))
+            {
+               first_busy -= buf->size;
+               buf->size   = buf->original_size;
+            }
+#else
+            first_busy           = BUFF_RING_WRAP_POS(buf, first_busy);
+#endif
+
+            BUFF_RING_SET_FIRST_BUSY(buf, first_busy);
+         }
+         else
+         {
+            part_size            = buf->size - buf->first_busy;
+            BUFF_MEMCPY(data, &((const uint8_t*)(buf->memory))[buf->first_busy], part_size);
+            data                 = &((uint8_t*)data)[part_size];
+            part_size            = count - part_size;
+            BUFF_MEMCPY(data, buf->memory, part_size);
+
+            BUFF_RING_DECREASE_BUSY_SIZE(buf, count);
+            BUFF_RING_SET_FIRST_BUSY(buf, part_size);
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && (!BUFF_RING_USE_LOCK_FREE_SPSC))
+            buf->size            = buf->original_size;
+#endif
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            rewind_occured       = BUFF_TRUE;
+#endif
+         }
+
+#if(!BUFF_RING_USE_LOCK_FREE_SPSC)
+         if(BUFF_UNLIKELY((0 == buf->busy_size) && BUFF_RING_IS_POS_RESET_ALLOWED(buf)))
+         {
+            buf->first_busy = 0;
+            buf->first_free = 0;
+         }
+#endif
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         extension = buf->protected_extension;
+
+         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+         {
+            on_read = extension->on_read;
+
+            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
+            {
+               on_read(buf, extension, count, rewind_occured);
+            }
+         }
+#endif
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+      {
+         on_read = extension->on_read;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
+         {
+            on_read(buf, extension, count, rewind_occured);
+         }
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+
+#endif
+} /* Buff_Ring_Read */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_READ_VENDOR_EXTERNAL)) && BUFF_RING_READ_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS )
+Buff_Size_DT Buff_Ring_Read_Vendor(
+   Buff_Ring_XT           *buf,
+   void                   *data,
+   Buff_Size_DT            size,
+   Buff_Vendor_Memcpy_HT   vendor_cpy,
+   Buff_Bool_DT            use_protection)
+{
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Read on_read;
+#endif
+   Buff_Memcpy_Params_XT params;
+   Buff_Size_DT part_size;
+   Buff_Size_DT first_busy;
+   Buff_Size_DT count = 0;
+   Buff_Size_DT ret_count;
+   Buff_Size_DT ret_count2;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+#if(BUFF_RING_USE_EXTENSIONS)
+   Buff_Bool_DT data_changed = BUFF_FALSE;
+#endif
+#endif
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data)
+      && BUFF_CHECK_HANDLER(Buff_Vendor_Memcpy_HT, vendor_cpy)
+      && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      count = BUFF_RING_CONSUMER_GET_BUSY_SIZE(buf, size);
+
+      if(BUFF_LIKELY(size <= count))
+      {
+         count = size;
+      }
+
+      /* data given to the pipe by Buff_Ring_Splice_Out can be removed only by Buff_Ring_Splice_Release */
+      if(BUFF_UNLIKELY(BUFF_RING_IS_SPLICED(buf)))
+      {
+         count = 0;
+      }
+
+      if(BUFF_LIKELY(count > 0))
+      {
+#if(BUFF_RING_USE_EXTENSIONS)
+         data_changed = BUFF_TRUE;
+#endif
+         params.dest             = data;
+         params.src              = buf->memory;
+         params.dest_offset      = 0;
+         params.src_offset       = buf->first_busy;
+
+         if(BUFF_LIKELY(buf->first_busy <= (buf->size - count)))
+         {
+            params.size          = count;
+            params.is_last_part  = BUFF_TRUE;
+
+            ret_count = vendor_cpy(&params);
+
+            /* vendor_cpy might copy less data than requested - depends on vendor_cpy - in this case reduce count */
+            if(BUFF_LIKELY(ret_count <= count))
+            {
+               count = ret_count;
+            }
+
+            BUFF_RING_DECREASE_BUSY_SIZE(buf, count);
+            first_busy           = buf->first_busy + count;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            rewind_occured       = (first_busy >= buf->size) ? BUFF_TRUE : BUFF_FALSE;
+#endif
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && (!BUFF_RING_USE_LOCK_FREE_SPSC) && (!BUFF_RING_USE_POWER_OF_2_SIZE))
+            /* buffer shrunk by Buff_Ring_Data_Check_Out gets back its original size when it is rewound */
+            if(BUFF_UNLIKELY(first_busy >= buf->size))
+            {
+               first_busy -= buf->size;
+               buf->size   = buf->original_size;
+            }
+#else
+            first_busy           = BUFF_RING_WRAP_POS(buf, first_busy);
+#endif
+
+            BUFF_RING_SET_FIRST_BUSY(buf, first_busy);
+         }
+         else
+         {
+            part_size            = buf->size - buf->first_busy;
+
+            params.size          = part_size;
+            params.is_last_part  = BUFF_FALSE;
+
+            ret_count = vendor_cpy(&params);
+
+            /* if vendor_cpy copied less data than requested then don't process second buff part */
+            if(ret_count < part_size)
+            {
+               count                = ret_count;
+               BUFF_RING_DECREASE_BUSY_SIZE(buf, count);
+               BUFF_RING_SET_FIRST_BUSY(buf, buf->first_busy + count);
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+               rewind_occured       = BUFF_FALSE;
+#endif
+            }
+            else
+            {
+               ret_count            = part_size;
+               params.dest          = data;
+               params.src           = buf->memory;
+               params.dest_offset   = part_size;
+               params.src_offset    = 0;
+               part_size            = count - part_size;
+               params.size          = part_size;
+               params.is_last_part  = BUFF_TRUE;
+
+               ret_count2 = vendor_cpy(&params);
+
+               /* vendor_cpy might copy in second step less data than requested - in this case reduce count and part_size */
+               if(BUFF_LIKELY(ret_count2 <= part_size))
+               {
+                  count     = ret_count + ret_count2;
+                  part_size = ret_count2;
+               }
+
+               BUFF_RING_DECREASE_BUSY_SIZE(buf, ret_count + part_size);
+               BUFF_RING_SET_FIRST_BUSY(buf, part_size);
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && (!BUFF_RING_USE_LOCK_FREE_SPSC))
+               buf->size            = buf->original_size;
+#endif
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+               rewind_occured       = BUFF_TRUE;
+#endif
+            }
+         }
+
+#if(!BUFF_RING_USE_LOCK_FREE_SPSC)
+         if(BUFF_UNLIKELY((0 == buf->busy_size) && BUFF_RING_IS_POS_RESET_ALLOWED(buf)))
+         {
+            buf->first_busy = 0;
+            buf->first_free = 0;
+         }
+#endif
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         extension = buf->protected_extension;
+
+         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+         {
+            on_read = extension->on_read;
+
+            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
+            {
+               on_read(buf, extension, count, rewind_occured);
+            }
+         }
+#endif
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+      {
+         on_read = extension->on_read;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
+         {
+            on_read(buf, extension, count, rewind_occured);
+         }
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+} /* Buff_Ring_Read_Vendor */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_READ_CHECKSUM_EXTERNAL)) && BUFF_RING_READ_CHECKSUM_ENABLED && BUFF_RING_READ_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS && BUFF_USE_CHECKSUM \
+   && BUFF_MEMCPY_CHECKSUM_ENABLED )
+Buff_Size_DT Buff_Ring_Read_Checksum(
+   Buff_Ring_XT           *buf,
+   void                   *data,
+   Buff_Size_DT            size,
+   Buff_Checksum_XT       *checksum,
+   Buff_Bool_DT            use_protection)
+{
+   buff_checksum_context_XT context;
+   Buff_Size_DT             result = 0;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data) && BUFF_CHECK_PTR(Buff_Checksum_XT, checksum)))
+   {
+      context.dest     = data;
+      context.checksum = checksum;
+
+      result = Buff_Ring_Read_Vendor(
+         buf, &context, size, buff_checksum_vendor_memcpy_to_context, use_protection);
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Read_Checksum */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_READ_TO_VECTOR_EXTERNAL)) && BUFF_RING_READ_TO_VECTOR_ENABLED && BUFF_USE_VECTOR_BUFFERS )
+Buff_Size_DT Buff_Ring_Read_To_Vector(
+   Buff_Ring_XT                    *buf,
+   const Buff_Writeable_Vector_XT  *data,
+   Buff_Num_Elems_DT                data_num_elems,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_data,
+   Buff_Bool_DT                     use_protection)
+{
+#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+
+   Buff_Writeable_Tree_XT tree;
+
+   tree.is_branch = BUFF_FALSE;
+   tree.elem_type.vector.vector           = data;
+   tree.elem_type.vector.vector_num_elems = data_num_elems;
+
+   return Buff_Ring_Read_To_Tree(buf, &tree, 1, size, offset_data, use_protection);
+
+#else
+
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Read on_read;
+#endif
+   Buff_Readable_Vector_XT vector[2];
+   Buff_Size_DT      count = 0;
+   Buff_Size_DT      first_free;
+   Buff_Size_DT      first_busy;
+   Buff_Num_Elems_DT vector_num_elems;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT      rewind_occured = BUFF_FALSE;
+#if(BUFF_RING_USE_EXTENSIONS)
+   Buff_Bool_DT      data_changed = BUFF_FALSE;
+#endif
+#endif
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Writeable_Vector_XT, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      count = BUFF_RING_CONSUMER_GET_BUSY_SIZE(buf, size);
+
+      if(BUFF_LIKELY(size <= count))
+      {
+         count = size;
+      }
+
+      /* data given to the pipe by Buff_Ring_Splice_Out can be removed only by Buff_Ring_Splice_Release */
+      if(BUFF_UNLIKELY(BUFF_RING_IS_SPLICED(buf)))
+      {
+         count = 0;
+      }
+
+      if(BUFF_LIKELY(count > 0))
+      {
+#if(BUFF_RING_USE_EXTENSIONS)
+         data_changed = BUFF_TRUE;
+#endif
+         first_free = BUFF_RING_CONSUMER_GET_FIRST_FREE(buf);
+
+         if(buf->first_busy >= first_free)
+         {
+            if(BUFF_LIKELY(first_free > 0))
+            {
+               vector[1].data    = buf->memory;
+               vector[1].size    = first_free;
+               vector_num_elems  = 2;
+            }
+            else
+            {
+               vector_num_elems  = 1;
+            }
+            vector[0].size       = buf->size - buf->first_busy;
+         }
+         else
+         {
+            vector_num_elems     = 1;
+            vector[0].size       = first_free - buf->first_busy;
+         }
+         vector[0].data          = &((const uint8_t*)(buf->memory))[buf->first_busy];
+
+         count = Buff_Copy_Vector_To_Vector(data, data_num_elems, vector, vector_num_elems, count, offset_data, 0);
+
+         if(BUFF_LIKELY(buf->first_busy <= (buf->size - count)))
+         {
+            BUFF_RING_DECREASE_BUSY_SIZE(buf, count);
+            first_busy           = buf->first_busy + count;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            rewind_occured       = (first_busy >= buf->size) ? BUFF_TRUE : BUFF_FALSE;
+#endif
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && (!BUFF_RING_USE_LOCK_FREE_SPSC) && (!BUFF_RING_USE_POWER_OF_2_SIZE))
+            /* buffer shrunk by Buff_Ring_Data_Check_Out gets back its original size when it is rewound */
+            if(BUFF_UNLIKELY(first_busy >= buf->size))
+            {
+               first_busy -= buf->size;
+               buf->size   = buf->original_size;
+            }
+#else
+            first_busy           = BUFF_RING_WRAP_POS(buf, first_busy);
+#endif
+
+            BUFF_RING_SET_FIRST_BUSY(buf, first_busy);
+         }
+         else
+         {
+            BUFF_RING_DECREASE_BUSY_SIZE(buf, count);
+            BUFF_RING_SET_FIRST_BUSY(buf, buf->first_busy + count - buf->size);
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && (!BUFF_RING_USE_LOCK_FREE_SPSC))
+            buf->size            = buf->original_size;
+#endif
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            rewind_occured       = BUFF_TRUE;
+#endif
+         }
+
+#if(!BUFF_RING_USE_LOCK_FREE_SPSC)
+         if(BUFF_UNLIKELY((0 == buf->busy_size) && BUFF_RING_IS_POS_RESET_ALLOWED(buf)))
+         {
+            buf->first_busy = 0;
+            buf->first_free = 0;
+         }
+#endif
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         extension = buf->protected_extension;
+
+         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+         {
+            on_read = extension->on_read;
+
+            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
+            {
+               on_read(buf, extension, count, rewind_occured);
+            }
+         }
+#endif
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+      {
+         on_read = extension->on_read;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
+         {
+            on_read(buf, extension, count, rewind_occured);
+         }
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+
+#endif
+} /* Buff_Ring_Read_To_Vector */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_READ_TO_TREE_EXTERNAL)) && BUFF_RING_READ_TO_TREE_ENABLED && BUFF_USE_TREE_BUFFERS )
+Buff_Size_DT Buff_Ring_Read_To_Tree(
+   Buff_Ring_XT                 *buf,
+   const Buff_Writeable_Tree_XT *data,
+   Buff_Num_Elems_DT             data_num_elems,
+   Buff_Size_DT                  size,
+   Buff_Size_DT                  offset_data,
+   Buff_Bool_DT                  use_protection)
+{
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Read on_read;
+#endif
+   Buff_Readable_Vector_XT vector[2];
+   Buff_Readable_Tree_XT tree;
+   Buff_Size_DT count = 0;
+   Buff_Size_DT first_free;
+   Buff_Size_DT first_busy;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+#if(BUFF_RING_USE_EXTENSIONS)
+   Buff_Bool_DT data_changed = BUFF_FALSE;
+#endif
+#endif
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Writeable_Tree_XT, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      count = BUFF_RING_CONSUMER_GET_BUSY_SIZE(buf, size);
+
+      if(BUFF_LIKELY(size <= count))
+      {
+         count = size;
+      }
+
+      /* data given to the pipe by Buff_Ring_Splice_Out can be removed only by Buff_Ring_Splice_Release */
+      if(BUFF_UNLIKELY(BUFF_RING_IS_SPLICED(buf)))
+      {
+         count = 0;
+      }
+
+      if(BUFF_LIKELY(count > 0))
+      {
+#if(BUFF_RING_USE_EXTENSIONS)
+         data_changed = BUFF_TRUE;
+#endif
+         tree.elem_type.vector.vector  = vector;
+         tree.is_branch = BUFF_FALSE;
+
+         first_free                    = BUFF_RING_CONSUMER_GET_FIRST_FREE(buf);
+
+         if(buf->first_busy >= first_free)
+         {
+            if(BUFF_LIKELY(first_free > 0))
+            {
+               vector[1].data                         = buf->memory;
+               vector[1].size                         = first_free;
+               tree.elem_type.vector.vector_num_elems = 2;
+            }
+            else
+            {
+               tree.elem_type.vector.vector_num_elems = 1;
+            }
+            vector[0].size                            = buf->size - buf->first_busy;
+         }
+         else
+         {
+            tree.elem_type.vector.vector_num_elems    = 1;
+            vector[0].size                            = first_free - buf->first_busy;
+         }
+         vector[0].data                               = &((const uint8_t*)(buf->memory))[buf->first_busy];
+
+         count = Buff_Copy_Tree_To_Tree(
+            data,
+            data_num_elems,
+            &tree,
+            1,
+            count,
+            offset_data,
+            0,
+            BUFF_MAKE_INVALID_PTR(Buff_Size_DT),
+            BUFF_MAKE_INVALID_PTR(Buff_Bool_DT));
+
+         if(BUFF_LIKELY(buf->first_busy <= (buf->size - count)))
+         {
+            BUFF_RING_DECREASE_BUSY_SIZE(buf, count);
+            first_busy           = buf->first_busy + count;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            rewind_occured       = (first_busy >= buf->size) ? BUFF_TRUE : BUFF_FALSE;
+#endif
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && (!BUFF_RING_USE_LOCK_FREE_SPSC) && (!BUFF_RING_USE_POWER_OF_2_SIZE))
+            /* buffer shrunk by Buff_Ring_Data_Check_Out gets back its original size when it is rewound */
+            if(BUFF_UNLIKELY(first_busy >= buf->size))
+            {
+               first_busy -= buf->size;
+               buf->size   = buf->original_size;
+            }
+#else
+            first_busy           = BUFF_RING_WRAP_POS(buf, first_busy);
+#endif
+
+            BUFF_RING_SET_FIRST_BUSY(buf, first_busy);
+         }
+         else
+         {
+            BUFF_RING_DECREASE_BUSY_SIZE(buf, count);
+            BUFF_RING_SET_FIRST_BUSY(buf, buf->first_busy + count - buf->size);
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && (!BUFF_RING_USE_LOCK_FREE_SPSC))
+            buf->size            = buf->original_size;
+#endif
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            rewind_occured       = BUFF_TRUE;
+#endif
+         }
+
+#if(!BUFF_RING_USE_LOCK_FREE_SPSC)
+         if(BUFF_UNLIKELY((0 == buf->busy_size) && BUFF_RING_IS_POS_RESET_ALLOWED(buf)))
+         {
+            buf->first_busy = 0;
+            buf->first_free = 0;
+         }
+#endif
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         extension = buf->protected_extension;
+
+         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+         {
+            on_read = extension->on_read;
+
+            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
+            {
+               on_read(buf, extension, count, rewind_occured);
+            }
+         }
+#endif
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+      {
+         on_read = extension->on_read;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
+         {
+            on_read(buf, extension, count, rewind_occured);
+         }
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+} /* Buff_Ring_Read_To_Tree */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_READ_CHECK_OUT_EXTERNAL)) && BUFF_RING_READ_CHECK_IN_CHECK_OUT_ENABLED )
+Buff_Size_DT Buff_Ring_Read_Check_Out(Buff_Ring_XT *buf, Buff_Readable_Vector_XT vector[2], Buff_Bool_DT use_protection)
+{
+   Buff_Size_DT count = 0;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Vector_XT, vector) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      count = BUFF_RING_CONSUMER_GET_BUSY_SIZE(buf, (Buff_Size_DT)(-1));
+
+      vector[0].data = &((const uint8_t*)(buf->memory))[buf->first_busy];
+      vector[1].data = buf->memory;
+
+      if(BUFF_LIKELY(BUFF_RING_IS_MIRRORED(buf) || (buf->first_busy <= (buf->size - count))))
+      {
+         vector[0].size = count;
+         vector[1].size = 0;
+      }
+      else
+      {
+         vector[0].size = buf->size - buf->first_busy;
+         vector[1].size = count - vector[0].size;
+      }
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+} /* Buff_Ring_Read_Check_Out */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_READ_CHECK_IN_EXTERNAL)) && BUFF_RING_READ_CHECK_IN_CHECK_OUT_ENABLED )
+Buff_Size_DT Buff_Ring_Read_Check_In(Buff_Ring_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection)
+{
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Read on_read;
+#endif
+   Buff_Size_DT first_busy;
+   Buff_Size_DT count = 0;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+#endif
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+      count = BUFF_RING_CONSUMER_GET_BUSY_SIZE(buf, size);
+
+      if(BUFF_LIKELY(size <= count))
+      {
+         count = size;
+      }
+
+      if(BUFF_LIKELY(count > 0))
+      {
+         BUFF_RING_DECREASE_BUSY_SIZE(buf, count);
+         first_busy              = buf->first_busy + count;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         rewind_occured              = (first_busy >= buf->size) ? BUFF_TRUE : BUFF_FALSE;
+#endif
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && (!BUFF_RING_USE_LOCK_FREE_SPSC) && (!BUFF_RING_USE_POWER_OF_2_SIZE))
+         /* buffer shrunk by Buff_Ring_Data_Check_Out gets back its original size when it is rewound */
+         if(BUFF_UNLIKELY(first_busy >= buf->size))
+         {
+            first_busy -= buf->size;
+            buf->size   = buf->original_size;
+         }
+#else
+         first_busy              = BUFF_RING_WRAP_POS(buf, first_busy);
+#endif
+
+         BUFF_RING_SET_FIRST_BUSY(buf, first_busy);
+
+#if(!BUFF_RING_USE_LOCK_FREE_SPSC)
+         if(BUFF_UNLIKELY((0 == buf->busy_size) && BUFF_RING_IS_POS_RESET_ALLOWED(buf)))
+         {
+            buf->first_busy = 0;
+            buf->first_free = 0;
+         }
+#endif
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         extension = buf->protected_extension;
+
+         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+         {
+            on_read = extension->on_read;
+
+            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
+            {
+               on_read(buf, extension, count, rewind_occured);
+            }
+         }
+#endif
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
+
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && (count > 0))
+      {
+         on_read = extension->on_read;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
+         {
+            on_read(buf, extension, count, rewind_occured);
+         }
+      }
+#endif
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+} /* Buff_Ring_Read_Check_In */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_WRITE_FROM_FD_EXTERNAL)) && BUFF_RING_WRITE_FROM_FD_ENABLED && BUFF_RING_USE_FD_IO && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED )
+Buff_Size_DT Buff_Ring_Write_From_Fd(
+   Buff_Ring_XT  *buf,
+   int            fd,
+   Buff_Size_DT   size,
+   int           *error,
+   Buff_Bool_DT   use_protection)
+{
+   Buff_Writeable_Vector_XT vector[2];
+   struct iovec iov[2];
+   ssize_t ret;
+   Buff_Size_DT count = 0;
+   int iov_cnt = 0;
+   int result_error = 0;
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      BUFF_RING_AUTO_GROW(buf, size);
+
+      (void)Buff_Ring_Data_Check_Out_Vector(buf, vector, size, BUFF_FALSE, BUFF_FALSE);
+
+      /* free space is limited to requested size; empty parts are not given to readv */
+      if(vector[0].size > 0)
+      {
+         iov[0].iov_base   = vector[0].data;
+         iov[0].iov_len    = (size < vector[0].size) ? size : vector[0].size;
+         size             -= iov[0].iov_len;
+         iov_cnt           = 1;
+
+         if((size > 0) && (vector[1].size > 0))
+         {
+            iov[1].iov_base   = vector[1].data;
+            iov[1].iov_len    = (size < vector[1].size) ? size : vector[1].size;
+            iov_cnt           = 2;
+         }
+      }
+
+      if(iov_cnt > 0)
+      {
+         do
+         {
+            ret = readv(fd, iov, iov_cnt);
+         }while((ret < 0) && (EINTR == errno));
+
+         if(ret > 0)
+         {
+            count = (Buff_Size_DT)ret;
+         }
+         else if(ret < 0)
+         {
+            result_error = errno;
+         }
+      }
+
+      /* check-in unlocks the buffer also when nothing has been read */
+      (void)Buff_Ring_Data_Check_In(buf, count, use_protection);
+   }
+
+   if(BUFF_CHECK_PTR(int, error))
+   {
+      *error = result_error;
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+} /* Buff_Ring_Write_From_Fd */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_READ_TO_FD_EXTERNAL)) && BUFF_RING_READ_TO_FD_ENABLED && BUFF_RING_USE_FD_IO && BUFF_RING_READ_CHECK_IN_CHECK_OUT_ENABLED )
+Buff_Size_DT Buff_Ring_Read_To_Fd(
+   Buff_Ring_XT  *buf,
+   int            fd,
+   Buff_Size_DT   size,
+   int           *error,
+   Buff_Bool_DT   use_protection)
+{
+   Buff_Readable_Vector_XT vector[2];
+   struct iovec iov[2];
+   ssize_t ret;
+   Buff_Size_DT count = 0;
+   int iov_cnt = 0;
+   int result_error = 0;
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+      (void)Buff_Ring_Read_Check_Out(buf, vector, use_protection);
+
+      /* busy area is limited to requested size; empty parts are not given to writev */
+      if(vector[0].size > 0)
+      {
+         iov[0].iov_base   = (void*)(vector[0].data);
+         iov[0].iov_len    = (size < vector[0].size) ? size : vector[0].size;
+         size             -= iov[0].iov_len;
+         iov_cnt           = 1;
+
+         if((size > 0) && (vector[1].size > 0))
+         {
+            iov[1].iov_base   = (void*)(vector[1].data);
+            iov[1].iov_len    = (size < vector[1].size) ? size : vector[1].size;
+            iov_cnt           = 2;
+         }
+      }
+
+      if(iov_cnt > 0)
+      {
+         do
+         {
+            ret = writev(fd, iov, iov_cnt);
+         }while((ret < 0) && (EINTR == errno));
+
+         if(ret > 0)
+         {
+            count = (Buff_Size_DT)ret;
+         }
+         else if(ret < 0)
+         {
+            result_error = errno;
+         }
+      }
+
+      /* check-in unlocks the buffer also when nothing has been written */
+      count = Buff_Ring_Read_Check_In(buf, count, use_protection);
+   }
+
+   if(BUFF_CHECK_PTR(int, error))
+   {
+      *error = result_error;
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+} /* Buff_Ring_Read_To_Fd */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_SPLICE_OUT_EXTERNAL)) && BUFF_RING_SPLICE_OUT_ENABLED && BUFF_RING_USE_SPLICE && BUFF_RING_READ_CHECK_IN_CHECK_OUT_ENABLED )
+Buff_Size_DT Buff_Ring_Splice_Out(
+   Buff_Ring_XT  *buf,
+   int            pipe_fd,
+   Buff_Size_DT   size,
+   int           *error,
+   Buff_Bool_DT   use_protection)
+{
+   Buff_Readable_Vector_XT vector[2];
+   struct iovec iov[2];
+   long ret;
+   Buff_Size_DT skip;
+   Buff_Size_DT count = 0;
+   int cntr;
+   int iov_cnt = 0;
+   int result_error = 0;
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+      (void)Buff_Ring_Read_Check_Out(buf, vector, use_protection);
+
+      /* data already given to the pipe is skipped; rest of busy area is limited to requested size */
+      skip = buf->spliced_size;
+
+      for(cntr = 0; (cntr < 2) && (size > 0); cntr++)
+      {
+         if(skip >= vector[cntr].size)
+         {
+            skip -= vector[cntr].size;
+         }
+         else
+         {
+            iov[iov_cnt].iov_base   = (void*)(&((const uint8_t*)(vector[cntr].data))[skip]);
+            iov[iov_cnt].iov_len    = ((vector[cntr].size - skip) < size) ? (vector[cntr].size - skip) : size;
+            size                   -= iov[iov_cnt].iov_len;
+            skip                    = 0;
+            iov_cnt++;
+         }
+      }
+
+      if(iov_cnt > 0)
+      {
+         do
+         {
+            ret = syscall(SYS_vmsplice, pipe_fd, iov, (unsigned long)iov_cnt, (unsigned int)SPLICE_F_NONBLOCK);
+         }while((ret < 0) && (EINTR == errno));
+
+         if(ret > 0)
+         {
+            count              = (Buff_Size_DT)ret;
+            buf->spliced_size += count;
+         }
+         else if(ret < 0)
+         {
+            result_error = errno;
+         }
+      }
+
+      /* nothing is removed - check-in only unlocks the buffer */
+      (void)Buff_Ring_Read_Check_In(buf, 0, use_protection);
+   }
+
+   if(BUFF_CHECK_PTR(int, error))
+   {
+      *error = result_error;
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+} /* Buff_Ring_Splice_Out */
+
+
+
+Buff_Size_DT Buff_Ring_Splice_Release(Buff_Ring_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection)
+{
+   Buff_Size_DT count = 0;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      if(size > buf->spliced_size)
+      {
+         size = buf->spliced_size;
+      }
+
+      /* check-in calls read extensions and unlocks the buffer */
+      count              = Buff_Ring_Read_Check_In(buf, size, use_protection);
+      buf->spliced_size -= count;
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+} /* Buff_Ring_Splice_Release */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_SPLICE_IN_EXTERNAL)) && BUFF_RING_SPLICE_IN_ENABLED && BUFF_RING_USE_SPLICE && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED )
+Buff_Size_DT Buff_Ring_Splice_In(
+   Buff_Ring_XT  *buf,
+   int            pipe_fd,
+   Buff_Size_DT   size,
+   int           *error,
+   Buff_Bool_DT   use_protection)
+{
+   Buff_Writeable_Vector_XT vector[2];
+   struct iovec iov[2];
+   long ret;
+   Buff_Size_DT count = 0;
+   int cntr;
+   int iov_cnt = 0;
+   int result_error = 0;
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      BUFF_RING_AUTO_GROW(buf, size);
+
+      (void)Buff_Ring_Data_Check_Out_Vector(buf, vector, size, BUFF_FALSE, BUFF_FALSE);
+
+      /* free space is limited to requested size; empty parts are not given to vmsplice */
+      for(cntr = 0; (cntr < 2) && (size > 0) && (vector[cntr].size > 0); cntr++)
+      {
+         iov[iov_cnt].iov_base   = vector[cntr].data;
+         iov[iov_cnt].iov_len    = (size < vector[cntr].size) ? size : vector[cntr].size;
+         size                   -= iov[iov_cnt].iov_len;
+         iov_cnt++;
+      }
+
+      if(iov_cnt > 0)
+      {
+         do
+         {
+            ret = syscall(SYS_vmsplice, pipe_fd, iov, (unsigned long)iov_cnt, (unsigned int)SPLICE_F_NONBLOCK);
+         }while((ret < 0) && (EINTR == errno));
+
+         if(ret > 0)
+         {
+            count = (Buff_Size_DT)ret;
+         }
+         else if(ret < 0)
+         {
+            result_error = errno;
+         }
+      }
+
+      /* check-in unlocks the buffer also when nothing has been read */
+      (void)Buff_Ring_Data_Check_In(buf, count, use_protection);
+   }
+
+   if(BUFF_CHECK_PTR(int, error))
+   {
+      *error = result_error;
+   }
+
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return count;
+} /* Buff_Ring_Splice_In */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_URING_EXTERNAL)) && BUFF_RING_URING_ENABLED && BUFF_RING_USE_IO_URING && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED )
+Buff_Bool_DT Buff_Ring_Uring_Init(Buff_Ring_Uring_XT *uring, Buff_Num_Elems_DT num_entries)
+{
+   struct io_uring_params params;
+   uint8_t     *sq_ring;
+   uint8_t     *cq_ring;
+   Buff_Bool_DT result = BUFF_FALSE;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_Uring_XT, uring) && (num_entries > 0)))
+   {
+      memset(&params, 0, sizeof(params));
+
+      uring->fd = (int)syscall(SYS_io_uring_setup, (unsigned)num_entries, &params);
+
+      if(uring->fd >= 0)
+      {
+         uring->sq_ring_size  = (Buff_Size_DT)(params.sq_off.array + params.sq_entries * sizeof(unsigned));
+         uring->cq_ring_size  = (Buff_Size_DT)(params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe));
+         uring->sqes_size     = (Buff_Size_DT)(params.sq_entries * sizeof(struct io_uring_sqe));
+
+         /* newer kernels map both queue rings by one mmap - then cq_ring is the same as sq_ring */
+         if(0 != (params.features & IORING_FEAT_SINGLE_MMAP))
+         {
+            if(uring->cq_ring_size > uring->sq_ring_size)
+            {
+               uring->sq_ring_size = uring->cq_ring_size;
+            }
+            uring->cq_ring_size = uring->sq_ring_size;
+         }
+
+         sq_ring = (uint8_t*)mmap(
+            NULL, uring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, uring->fd, IORING_OFF_SQ_RING);
+
+         if(MAP_FAILED != (void*)sq_ring)
+         {
+            cq_ring = (0 != (params.features & IORING_FEAT_SINGLE_MMAP)) ? sq_ring : (uint8_t*)mmap(
+               NULL, uring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, uring->fd, IORING_OFF_CQ_RING);
+
+            if(MAP_FAILED != (void*)cq_ring)
+            {
+               uring->sqes = mmap(
+                  NULL, uring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, uring->fd, IORING_OFF_SQES);
+
+               if(MAP_FAILED != uring->sqes)
+               {
+                  uring->sq_ring       = sq_ring;
+                  uring->cq_ring       = cq_ring;
+                  uring->sq_head       = (unsigned*)(&sq_ring[params.sq_off.head]);
+                  uring->sq_tail       = (unsigned*)(&sq_ring[params.sq_off.tail]);
+                  uring->sq_ring_mask  = (unsigned*)(&sq_ring[params.sq_off.ring_mask]);
+                  uring->sq_array      = (unsigned*)(&sq_ring[params.sq_off.array]);
+                  uring->cq_head       = (unsigned*)(&cq_ring[params.cq_off.head]);
+                  uring->cq_tail       = (unsigned*)(&cq_ring[params.cq_off.tail]);
+                  uring->cq_ring_mask  = (unsigned*)(&cq_ring[params.cq_off.ring_mask]);
+                  uring->cqes          = &cq_ring[params.cq_off.cqes];
+                  uring->num_entries   = (Buff_Num_Elems_DT)(params.sq_entries);
+                  uring->num_in_flight = 0;
+                  uring->to_submit     = 0;
+                  result               = BUFF_TRUE;
+               }
+               else if(cq_ring != sq_ring)
+               {
+                  (void)munmap(cq_ring, uring->cq_ring_size);
+               }
+            }
+
+            if(!BUFF_BOOL_IS_TRUE(result))
+            {
+               (void)munmap(sq_ring, uring->sq_ring_size);
+            }
+         }
+
+         if(!BUFF_BOOL_IS_TRUE(result))
+         {
+            (void)close(uring->fd);
+            uring->fd = -1;
+         }
+      }
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Uring_Init */
+
+
+
+void Buff_Ring_Uring_Deinit(Buff_Ring_Uring_XT *uring)
+{
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_Uring_XT, uring) && (uring->fd >= 0)))
+   {
+      (void)munmap(uring->sqes, uring->sqes_size);
+
+      if(uring->cq_ring != uring->sq_ring)
+      {
+         (void)munmap(uring->cq_ring, uring->cq_ring_size);
+      }
+
+      (void)munmap(uring->sq_ring, uring->sq_ring_size);
+      (void)close(uring->fd);
+
+      uring->fd            = -1;
+      uring->num_in_flight = 0;
+      uring->to_submit     = 0;
+   }
+
+   BUFF_EXIT_FUNC();
+} /* Buff_Ring_Uring_Deinit */
+
+
+
+void Buff_Ring_Uring_Feed_Init(
+   Buff_Ring_Uring_Feed_XT *feed,
+   Buff_Ring_XT            *buf,
+   int                      fd,
+   Buff_Size_DT             size,
+   Buff_Bool_DT             use_protection)
+{
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_Uring_Feed_XT, feed)))
+   {
+      feed->buf            = buf;
+      feed->size           = size;
+      feed->posted_pos     = 0;
+      feed->fd             = fd;
+      feed->error          = 0;
+      feed->is_posted      = BUFF_FALSE;
+      feed->is_eof         = BUFF_FALSE;
+      feed->use_protection = use_protection;
+   }
+
+   BUFF_EXIT_FUNC();
+} /* Buff_Ring_Uring_Feed_Init */
+
+
+
+Buff_Num_Elems_DT Buff_Ring_Uring_Process(
+   Buff_Ring_Uring_XT      *uring,
+   Buff_Ring_Uring_Feed_XT *feeds,
+   Buff_Num_Elems_DT        feeds_num_elems,
+   Buff_Num_Elems_DT        min_complete,
+   int                     *error)
+{
+   Buff_Writeable_Vector_XT vector[2];
+   struct io_uring_sqe     *sqe;
+   struct io_uring_cqe     *cqe;
+   Buff_Ring_Uring_Feed_XT *feed;
+   Buff_Num_Elems_DT        cntr;
+   Buff_Num_Elems_DT        result = 0;
+   unsigned                 index;
+   unsigned                 tail;
+   unsigned                 head;
+   int                      ret;
+   int                      result_error = 0;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_Uring_XT, uring) && BUFF_CHECK_PTR(Buff_Ring_Uring_Feed_XT, feeds) && (uring->fd >= 0)))
+   {
+      /* submission queue tail is modified only by user space */
+      tail = *(uring->sq_tail);
+
+      /* number of requests in flight is limited to number of entries, so neither submission nor completion queue can overflow */
+      for(cntr = 0; (cntr < feeds_num_elems) && (uring->num_in_flight < uring->num_entries); cntr++)
+      {
+         feed = &feeds[cntr];
+
+         if(!(BUFF_BOOL_IS_TRUE(feed->is_posted) || BUFF_BOOL_IS_TRUE(feed->is_eof) || (0 != feed->error))
+            && BUFF_CHECK_PTR(Buff_Ring_XT, feed->buf) && (feed->size > 0))
+         {
+#if(BUFF_RING_USE_PROTECTION)
+            if(BUFF_BOOL_IS_TRUE(feed->use_protection))
+            {
+               BUFF_PROTECTION_LOCK(feed->buf);
+            }
+#endif
+
+            (void)Buff_Ring_Data_Check_Out_Vector(feed->buf, vector, feed->size, BUFF_FALSE, BUFF_FALSE);
+
+            feed->posted_pos = BUFF_RING_GET_FIRST_FREE(feed->buf);
+
+#if(!BUFF_RING_USE_LOCK_FREE_SPSC)
+            /* consumer which empties the buffer must not move its positions until posted read is checked-in */
+            feed->buf->is_read_posted = (vector[0].size > 0) ? BUFF_TRUE : BUFF_FALSE;
+#endif
+
+#if(BUFF_RING_USE_PROTECTION)
+            if(BUFF_BOOL_IS_TRUE(feed->use_protection))
+            {
+               BUFF_PROTECTION_UNLOCK(feed->buf);
+            }
+#endif
+
+            /* only continous part of free space is given to the kernel; rest of it will be used by next request */
+            if(vector[0].size > 0)
+            {
+               index = tail & *(uring->sq_ring_mask);
+               sqe   = &((struct io_uring_sqe*)(uring->sqes))[index];
+
+               memset(sqe, 0, sizeof(*sqe));
+               sqe->opcode    = IORING_OP_READ;
+               sqe->fd        = feed->fd;
+               sqe->addr      = (uint64_t)(uintptr_t)(vector[0].data);
+               sqe->len       = (uint32_t)((feed->size < vector[0].size) ? feed->size : vector[0].size);
+               /* read from current position - the only valid one for pipes and sockets */
+               sqe->off       = (uint64_t)(-1);
+               sqe->user_data = (uint64_t)(uintptr_t)feed;
+
+               uring->sq_array[index] = index;
+               tail++;
+
+               feed->is_posted = BUFF_TRUE;
+               uring->num_in_flight++;
+               uring->to_submit++;
+            }
+         }
+      }
+
+      BUFF_ATOMIC_STORE_RELEASE(uring->sq_tail, tail);
+
+      if(min_complete > uring->num_in_flight)
+      {
+         min_complete = uring->num_in_flight;
+      }
+
+      /* submission of all new requests and waiting for completions by one system call */
+      if((uring->to_submit > 0) || (min_complete > 0))
+      {
+         do
+         {
+            ret = (int)syscall(
+               SYS_io_uring_enter, uring->fd, (unsigned)(uring->to_submit), (unsigned)min_complete,
+               (min_complete > 0) ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+         }while((ret < 0) && (EINTR == errno));
+
+         if(ret >= 0)
+         {
+            uring->to_submit -= (Buff_Num_Elems_DT)ret;
+         }
+         else
+         {
+            result_error = errno;
+         }
+      }
+
+      /* completion queue head is modified only by user space */
+      head = *(uring->cq_head);
+
+      while(head != BUFF_ATOMIC_LOAD_ACQUIRE(uring->cq_tail))
+      {
+         cqe  = &((struct io_uring_cqe*)(uring->cqes))[head & *(uring->cq_ring_mask)];
+         feed = (Buff_Ring_Uring_Feed_XT*)(uintptr_t)(cqe->user_data);
+
+         feed->is_posted = BUFF_FALSE;
+
+#if(BUFF_RING_USE_PROTECTION)
+         if(BUFF_BOOL_IS_TRUE(feed->use_protection))
+         {
+            BUFF_PROTECTION_LOCK(feed->buf);
+         }
+#endif
+
+#if(!BUFF_RING_USE_LOCK_FREE_SPSC)
+         feed->buf->is_read_posted = BUFF_FALSE;
+#endif
+
+         /*
+          * kernel has written data where the request was posted - producers see buffer with posted read as full,
+          * but in lock-free SPSC mode buffer has no such flag so data is valid only if buffer has not been written meantime
+          */
+         if((cqe->res > 0) && (BUFF_RING_GET_FIRST_FREE(feed->buf) == feed->posted_pos))
+         {
+            /* check-in calls write extensions and unlocks the buffer */
+            (void)Buff_Ring_Data_Check_In(feed->buf, (Buff_Size_DT)(cqe->res), feed->use_protection);
+         }
+         else
+         {
+#if(BUFF_RING_USE_PROTECTION)
+            if(BUFF_BOOL_IS_TRUE(feed->use_protection))
+            {
+               BUFF_PROTECTION_UNLOCK(feed->buf);
+            }
+#endif
+
+            if(cqe->res > 0)
+            {
+               feed->error = EIO;
+            }
+            else if(0 == cqe->res)
+            {
+               feed->is_eof = BUFF_TRUE;
+            }
+            else if((-EAGAIN != cqe->res) && (-EINTR != cqe->res))
+            {
+               feed->error = -(cqe->res);
+            }
+         }
+
+         head++;
+         uring->num_in_flight--;
+         result++;
+      }
+
+      BUFF_ATOMIC_STORE_RELEASE(uring->cq_head, head);
+   }
+
+   if(BUFF_CHECK_PTR(int, error))
+   {
+      *error = result_error;
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Uring_Process */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_TO_RING_COPY_EXTERNAL)) && BUFF_RING_TO_RING_COPY_ENABLED )
+Buff_Size_DT Buff_Ring_To_Ring_Copy(
+   Buff_Ring_XT                 *dest,
+   Buff_Ring_XT                 *src,
+   Buff_Size_DT                  size,
+   Buff_Size_DT                  src_offset,
+   Buff_Bool_DT                  overwrite_if_no_free_space,
+   Buff_Bool_DT                  use_protection)
+{
+   uint8_t *data_to;
+   const uint8_t *data_from;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Write on_write;
+#endif
+   Buff_Size_DT read_start;
+   Buff_Size_DT first_free;
+   Buff_Size_DT part_size_src;
+   Buff_Size_DT part_size_dest;
+   Buff_Size_DT size_to_copy = 0;
+   Buff_Size_DT size_to_read = 0;
+#if(BUFF_RING_USE_NON_TEMPORAL_COPY)
+   Buff_Bool_DT non_temporal;
+#endif
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+#if(BUFF_RING_USE_EXTENSIONS)
+   Buff_Bool_DT data_changed = BUFF_FALSE;
+#endif
+#endif
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+#if(!BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+   BUFF_UNUSED_PARAM(overwrite_if_no_free_space);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(dest);
+   BUFF_DEBUG_RING(src);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, dest) && BUFF_CHECK_PTR(Buff_Ring_XT, src)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(dest);
+         BUFF_PROTECTION_LOCK(src);
+      }
+#endif
+
+      /* check if src_offset points to busy area of source buffer - otherwise copying will not be executed */
+      if(BUFF_LIKELY(src_offset < BUFF_RING_GET_BUSY_SIZE(src)))
+      {
+         size_to_read = BUFF_RING_GET_BUSY_SIZE(src) - src_offset;
+
+         if(BUFF_LIKELY(size <= size_to_read))
+         {
+            size_to_read = size;
+         }
+
+         BUFF_RING_AUTO_GROW(dest, size_to_read);
+
+         size_to_copy = BUFF_RING_PRODUCER_GET_FREE_SIZE(dest, size_to_read);
+
+         if(BUFF_LIKELY(size_to_read <= size_to_copy))
+         {
+            size_to_copy = size_to_read;
+         }
+#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+         else if(BUFF_BOOL_IS_TRUE(overwrite_if_no_free_space) && (!BUFF_RING_IS_SPLICED(dest))
+            && (!BUFF_RING_IS_READ_POSTED(dest)))
+         {
+            if(BUFF_LIKELY(size_to_read < dest->size))
+            {
+               Buff_Ring_Remove(dest, size_to_read - size_to_copy, BUFF_FALSE);
+
+               size_to_copy = size_to_read;
+            }
+            else
+            {
+               Buff_Ring_Clear(dest, BUFF_FALSE);
+
+               size_to_copy = dest->size;
+            }
+         }
+#endif
+         if(BUFF_LIKELY(size_to_copy > 0))
+         {
+#if(BUFF_RING_USE_EXTENSIONS)
+            data_changed = BUFF_TRUE;
+#endif
+#if(BUFF_RING_USE_NON_TEMPORAL_COPY)
+            non_temporal = BUFF_RING_IS_NON_TEMPORAL_COPY(dest, size_to_copy);
+#endif
+            read_start = src->first_busy + src_offset - src->size;
+
+            if(BUFF_LIKELY(src->first_busy < (src->size - src_offset)))
+            {
+               read_start += src->size;
+            }
+
+            /* destination memory is continous */
+            if(BUFF_LIKELY(dest->first_free <= (dest->size - size_to_copy)))
+            {
+               data_to = &((uint8_t*)(dest->memory))[dest->first_free];
+
+               /* source memory is continous */
+               if(BUFF_LIKELY(read_start <= (src->size - size_to_copy)))
+               {
+                  BUFF_RING_MEMCPY(non_temporal, data_to, &((const uint8_t*)(src->memory))[read_start], size_to_copy);
+               }
+               /* source memory is split */
+               else
+               {
+                  part_size_src  = src->size - read_start;
+                  BUFF_RING_MEMCPY(non_temporal, data_to, &((const uint8_t*)(src->memory))[read_start], part_size_src);
+
+                  data_to        = &((uint8_t*)data_to)[part_size_src];
+                  part_size_src  = size_to_copy - part_size_src;
+                  BUFF_RING_MEMCPY(non_temporal, data_to, src->memory, part_size_src);
+               }
+#if(BUFF_RING_USE_NON_TEMPORAL_COPY)
+               if(BUFF_BOOL_IS_TRUE(non_temporal))
+               {
+                  BUFF_NON_TEMPORAL_FENCE();
+               }
+#endif
+
+               BUFF_RING_INCREASE_BUSY_SIZE(dest, size_to_copy);
+               first_free           = dest->first_free + size_to_copy;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+               rewind_occured       = (first_free >= dest->size) ? BUFF_TRUE : BUFF_FALSE;
+#endif
+               first_free           = BUFF_RING_WRAP_POS(dest, first_free);
+
+               BUFF_RING_SET_FIRST_FREE(dest, first_free);
+            }
+            /* destination memory is split */
+            else
+            {
+               data_from      = &((const uint8_t*)(src->memory))[read_start];
+               part_size_dest = dest->size - dest->first_free;
+
+               /* source memory is continous */
+               if(BUFF_LIKELY(read_start <= (src->size - size_to_copy)))
+               {
+                  BUFF_RING_MEMCPY(non_temporal, &((uint8_t*)(dest->memory))[dest->first_free], data_from, part_size_dest);
+                  data_from            = &((uint8_t*)data_from)[part_size_dest];
+                  part_size_dest       = size_to_copy - part_size_dest;
+                  BUFF_RING_MEMCPY(non_temporal, dest->memory, data_from, part_size_dest);
+
+                  first_free           = part_size_dest;
+               }
+               /* source memory is split */
+               else
+               {
+                  part_size_src  = src->size - read_start;
+
+                  if(part_size_src > part_size_dest)
+                  {
+                     BUFF_RING_MEMCPY(non_temporal, &((uint8_t*)(dest->memory))[dest->first_free], data_from, part_size_dest);
+                     data_from            = &((uint8_t*)data_from)[part_size_dest];
+                     BUFF_RING_MEMCPY(non_temporal, dest->memory, data_from, part_size_src - part_size_dest);
+                     first_free        = part_size_src - part_size_dest;
+                     part_size_src     = size_to_copy - part_size_src;
+                     BUFF_RING_MEMCPY(non_temporal, &((uint8_t*)(dest->memory))[first_free], src->memory, part_size_src);
+                     first_free       += part_size_src;
+                  }
+                  else
+                  {
+                     first_free        = dest->first_free;
+                     BUFF_RING_MEMCPY(non_temporal, &((uint8_t*)(dest->memory))[first_free], data_from, part_size_src);
+                     first_free       += part_size_src;
+                     BUFF_RING_MEMCPY(non_temporal, &((uint8_t*)(dest->memory))[first_free], src->memory, part_size_dest - part_size_src);
+                     src_offset        = part_size_dest - part_size_src;
+                     part_size_dest    = size_to_copy - part_size_dest;
+                     BUFF_RING_MEMCPY(non_temporal, dest->memory, &((uint8_t*)(src->memory))[src_offset], part_size_dest);
+                     first_free        = part_size_dest;
+                  }
+               }
+#if(BUFF_RING_USE_NON_TEMPORAL_COPY)
+               if(BUFF_BOOL_IS_TRUE(non_temporal))
+               {
+                  BUFF_NON_TEMPORAL_FENCE();
+               }
+#endif
+
+               BUFF_RING_INCREASE_BUSY_SIZE(dest, size_to_copy);
+               BUFF_RING_SET_FIRST_FREE(dest, first_free);
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+               rewind_occured       = BUFF_TRUE;
+#endif
+            }
+
+#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
+            if(BUFF_RING_GET_BUSY_SIZE(dest) >= dest->max_busy_size)
+            {
+               dest->max_busy_size = BUFF_RING_GET_BUSY_SIZE(dest);
+            }
+#endif
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            extension = dest->protected_extension;
+
+            if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+            {
+               on_write = extension->on_write;
+
+               if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+               {
+                  on_write(dest, extension, size_to_copy, rewind_occured);
+               }
+            }
+#endif
+         }
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(dest);
+         BUFF_PROTECTION_UNLOCK(src);
+      }
+#endif
+
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = dest->extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+      {
+         on_write = extension->on_write;
 
-            params.size          = part_size;
-            params.is_last_part  = BUFF_FALSE;
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+         {
+            on_write(dest, extension, size_to_copy, rewind_occured);
+         }
+      }
+#endif
+   }
 
-            ret_count = vendor_cpy(&params);
+   BUFF_DEBUG_RING(dest);
+   BUFF_DEBUG_RING(src);
 
-            /* if vendor_cpy copied less data than requested then don't process second buff part */
-            if(ret_count < part_size)
-            {
-               count                = ret_count;
-               buf->busy_size      += ret_count;
-               buf->first_free     += ret_count;
+   BUFF_EXIT_FUNC();
+
+   return size_to_copy;
+} /* Buff_Ring_To_Ring_Copy */
+#endif
+
+
+
+#if( (!defined(RING_BUF_REMOVE_EXTERNAL)) && BUFF_RING_REMOVE_ENABLED )
+Buff_Size_DT Buff_Ring_Remove(Buff_Ring_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection)
+{
 #if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-               rewind_occured       = BUFF_FALSE;
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Remove on_remove;
+#endif
+   Buff_Size_DT result = 0;
+   Buff_Size_DT first_busy;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+#endif
+#if(BUFF_RING_USE_EXTENSIONS)
+   Buff_Bool_DT data_changed = BUFF_FALSE;
 #endif
-            }
-            else
-            {
-               ret_count            = part_size;
-               params.dest          = buf->memory;
-               params.src           = data;
-               params.dest_offset   = 0;
-               params.src_offset    = part_size;
-               part_size            = count - part_size;
-               params.size          = part_size;
-               params.is_last_part  = BUFF_TRUE;
 
-               buf->busy_size      += ret_count;
-               buf->first_free      = 0;
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
 
-               ret_count2 = vendor_cpy(&params);
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
 
-               /* vendor_cpy might copy in second step less data than requested - in this case reduce count and part_size */
-               if(BUFF_LIKELY(ret_count2 <= part_size))
-               {
-                  count     = ret_count + ret_count2;
-                  part_size = ret_count2;
-               }
+   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(buf);
+      }
+#endif
+
+      /* data given to the pipe by Buff_Ring_Splice_Out can be removed only by Buff_Ring_Splice_Release */
+      if(BUFF_LIKELY(!BUFF_RING_IS_SPLICED(buf)))
+      {
+#if(BUFF_RING_USE_EXTENSIONS)
+         data_changed = BUFF_TRUE;
+#endif
 
-               buf->busy_size      += part_size;
-               buf->first_free      = part_size;
+         if(BUFF_LIKELY(size < BUFF_RING_CONSUMER_GET_BUSY_SIZE(buf, size + 1)))
+         {
+            BUFF_RING_DECREASE_BUSY_SIZE(buf, size);
+            first_busy           = buf->first_busy + size;
 #if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-               rewind_occured       = BUFF_TRUE;
+            rewind_occured           = (first_busy >= buf->size) ? BUFF_TRUE : BUFF_FALSE;
 #endif
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && (!BUFF_RING_USE_LOCK_FREE_SPSC) && (!BUFF_RING_USE_POWER_OF_2_SIZE))
+            /* buffer shrunk by Buff_Ring_Data_Check_Out gets back its original size when it is rewound */
+            if(BUFF_UNLIKELY(first_busy >= buf->size))
+            {
+               first_busy -= buf->size;
+               buf->size   = buf->original_size;
             }
+#else
+            first_busy           = BUFF_RING_WRAP_POS(buf, first_busy);
+#endif
+            BUFF_RING_SET_FIRST_BUSY(buf, first_busy);
+            result               = size;
          }
-
-#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
-         if(buf->busy_size >= buf->max_busy_size)
+         else
          {
-            buf->max_busy_size = buf->busy_size;
-         }
+#if(BUFF_RING_USE_LOCK_FREE_SPSC)
+            /* first_free belongs to producer - all the data is removed by moving first_busy to first_free */
+            first_busy           = BUFF_RING_GET_FIRST_FREE(buf);
+#if(BUFF_RING_USE_PADDED_LAYOUT)
+            buf->cached_first_free = first_busy;
+#endif
+
+            if(first_busy >= buf->first_busy)
+            {
+               result            = first_busy - buf->first_busy;
+            }
+            else
+            {
+               result            = buf->size - buf->first_busy + first_busy;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+               rewind_occured    = BUFF_TRUE;
+#endif
+            }
+
+            BUFF_RING_SET_FIRST_BUSY(buf, first_busy);
+#else
+            result               = buf->busy_size;
+            if(BUFF_RING_IS_POS_RESET_ALLOWED(buf))
+            {
+               buf->first_free   = 0;
+            }
+            buf->first_busy      = buf->first_free;
+            buf->busy_size       = 0;
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && (!BUFF_RING_USE_LOCK_FREE_SPSC))
+            buf->size            = buf->original_size;
+#endif
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            rewind_occured       = BUFF_TRUE;
+#endif
 #endif
+         }
 
 #if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
          extension = buf->protected_extension;
 
          if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
          {
-            on_write = extension->on_write;
+            on_remove = extension->on_remove;
 
-            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Remove, on_remove))
             {
-               on_write(buf, extension, count, rewind_occured);
+               on_remove(buf, extension, rewind_occured);
             }
          }
 #endif
@@ -2644,11 +8904,11 @@ Buff_Size_DT Buff_Ring_Write_Vendor(
 
       if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
       {
-         on_write = extension->on_write;
+         on_remove = extension->on_remove;
 
-         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Remove, on_remove))
          {
-            on_write(buf, extension, count, rewind_occured);
+            on_remove(buf, extension, rewind_occured);
          }
       }
 #endif
@@ -2657,59 +8917,31 @@ Buff_Size_DT Buff_Ring_Write_Vendor(
    BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
-   return count;
-} /* Buff_Ring_Write_Vendor */
+   return result;
+} /* Buff_Ring_Remove */
 #endif
 
 
 
-#if( (!defined(BUFF_RING_WRITE_FROM_VECTOR_EXTERNAL)) && BUFF_RING_WRITE_FROM_VECTOR_ENABLED && BUFF_USE_VECTOR_BUFFERS )
-Buff_Size_DT Buff_Ring_Write_From_Vector(
-   Buff_Ring_XT                    *buf,
-   const Buff_Readable_Vector_XT   *data,
-   Buff_Num_Elems_DT                data_num_elems,
-   Buff_Size_DT                     size,
-   Buff_Size_DT                     offset_data,
-   Buff_Bool_DT                     overwrite_if_no_free_space,
-   Buff_Bool_DT                     use_protection)
+#if( (!defined(RING_BUF_CLEAR_EXTERNAL)) && BUFF_RING_CLEAR_ENABLED )
+void Buff_Ring_Clear(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
 {
-#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
-
-   Buff_Readable_Tree_XT tree;
-
-   tree.is_branch = BUFF_FALSE;
-   tree.elem_type.vector.vector           = data;
-   tree.elem_type.vector.vector_num_elems = data_num_elems;
-
-   return Buff_Ring_Write_From_Tree(buf, &tree, 1, size, offset_data, overwrite_if_no_free_space, use_protection);
-
-#else
-
 #if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
    Buff_Ring_Extensions_XT *extension;
-   Buff_Ring_Extension_On_Write on_write;
+   Buff_Ring_Extension_On_Remove on_remove;
 #endif
-   Buff_Writeable_Vector_XT vector[2];
-   Buff_Size_DT      count = 0;
-   Buff_Num_Elems_DT vector_num_elems;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Bool_DT      rewind_occured = BUFF_FALSE;
 #if(BUFF_RING_USE_EXTENSIONS)
-   Buff_Bool_DT      data_changed = BUFF_FALSE;
-#endif
+   Buff_Bool_DT data_changed = BUFF_FALSE;
 #endif
 
 #if(!BUFF_RING_USE_PROTECTION)
    BUFF_UNUSED_PARAM(use_protection);
 #endif
-#if(!BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
-   BUFF_UNUSED_PARAM(overwrite_if_no_free_space);
-#endif
 
    BUFF_ENTER_FUNC();
    BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Vector_XT, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
    {
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
@@ -2718,161 +8950,186 @@ Buff_Size_DT Buff_Ring_Write_From_Vector(
       }
 #endif
 
-      count = BUFF_RING_GET_FREE_SIZE(buf);
-
-      if(BUFF_LIKELY(size <= count))
-      {
-         count = size;
-      }
-#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
-      else if(BUFF_BOOL_IS_TRUE(overwrite_if_no_free_space))
+      /* data given to the pipe by Buff_Ring_Splice_Out can be removed only by Buff_Ring_Splice_Release */
+      if(BUFF_LIKELY(!BUFF_RING_IS_SPLICED(buf)))
       {
-         if(BUFF_LIKELY(size < buf->size))
-         {
-            Buff_Ring_Remove(buf, size - count, BUFF_FALSE);
+#if(BUFF_RING_USE_EXTENSIONS)
+         data_changed = BUFF_TRUE;
+#endif
 
-            count = size;
-         }
-         else
+#if(BUFF_RING_USE_LOCK_FREE_SPSC)
+         /* first_free belongs to producer - buffer is cleared by moving first_busy to first_free */
+#if(BUFF_RING_USE_PADDED_LAYOUT)
+         buf->cached_first_free = BUFF_RING_GET_FIRST_FREE(buf);
+         BUFF_RING_SET_FIRST_BUSY(buf, buf->cached_first_free);
+#else
+         BUFF_RING_SET_FIRST_BUSY(buf, BUFF_RING_GET_FIRST_FREE(buf));
+#endif
+#else
+         if(BUFF_RING_IS_POS_RESET_ALLOWED(buf))
          {
-            Buff_Ring_Clear(buf, BUFF_FALSE);
-
-            count = buf->size;
+            buf->first_free = 0;
          }
-      }
+         buf->first_busy   = buf->first_free;
+         buf->busy_size    = 0;
+#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
+         buf->size         = buf->original_size;
 #endif
-
-      if(BUFF_LIKELY(count > 0))
-      {
-#if(BUFF_RING_USE_EXTENSIONS)
-         data_changed = BUFF_TRUE;
 #endif
-         if(buf->first_free >= buf->first_busy)
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         extension = buf->protected_extension;
+
+         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
          {
-            if(BUFF_LIKELY(buf->first_busy > 0))
-            {
-               vector_num_elems  = 2;
-               vector[1].data    = buf->memory;
-               vector[1].size    = buf->first_busy;
-            }
-            else
+            on_remove = extension->on_remove;
+
+            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Remove, on_remove))
             {
-               vector_num_elems  = 1;
+               on_remove(buf, extension, BUFF_TRUE);
             }
-            vector[0].size       = buf->size - buf->first_free;
-         }
-         else
-         {
-            vector_num_elems     = 1;
-            vector[0].size       = buf->first_busy - buf->first_free;
          }
-         vector[0].data          = &((uint8_t*)(buf->memory))[buf->first_free];
+#endif
+      }
 
-         count = Buff_Copy_Vector_To_Vector(vector, vector_num_elems, data, data_num_elems, count, 0, offset_data);
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
+      }
+#endif
 
-         if(BUFF_LIKELY(buf->first_free <= (buf->size - count)))
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->extension;
+
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+      {
+         on_remove = extension->on_remove;
+
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Remove, on_remove))
          {
-            buf->busy_size      += count;
-            buf->first_free     += count;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            rewind_occured       = BUFF_FALSE;
+            on_remove(buf, extension, BUFF_TRUE);
+         }
+      }
 #endif
+   }
 
-            if(BUFF_UNLIKELY(buf->first_free >= buf->size))
-            {
-               buf->first_free   = 0;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-               rewind_occured    = BUFF_TRUE;
-#endif
-            }
-         }
-         else
-         {
-            buf->busy_size      += count;
-            buf->first_free      = buf->first_free + count - buf->size;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            rewind_occured       = BUFF_TRUE;
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+} /* Buff_Ring_Clear */
 #endif
-         }
 
-#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
-         if(buf->busy_size >= buf->max_busy_size)
-         {
-            buf->max_busy_size = buf->busy_size;
-         }
+
+
+#if( ((!defined(BUFF_RING_PEAK_RECORD_EXTERNAL)) && BUFF_RING_PEAK_RECORD_ENABLED && BUFF_RING_PEAK_ENABLED) \
+   || ((!defined(BUFF_RING_READ_RECORD_EXTERNAL)) && BUFF_RING_READ_RECORD_ENABLED && BUFF_RING_PEAK_ENABLED && BUFF_RING_REMOVE_ENABLED) \
+   || (BUFF_RING_ALLOW_OLD_DATA_OVERWRITE && BUFF_RING_PEAK_ENABLED && BUFF_RING_REMOVE_ENABLED && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED \
+      && (BUFF_RING_WRITE_RECORD_ENABLED || BUFF_RING_WRITE_RECORD_FROM_VECTOR_ENABLED || BUFF_RING_WRITE_RECORD_FROM_TREE_ENABLED)) )
+/**
+ * Reads header of oldest record; returns BUFF_TRUE only if whole record is present in the buffer.
+ */
+static Buff_Bool_DT buff_ring_get_record_size(Buff_Ring_XT *buf, Buff_Size_DT *record_size)
+{
+   Buff_Size_DT header;
+   Buff_Size_DT busy;
+   Buff_Bool_DT result = BUFF_FALSE;
+
+   busy = BUFF_RING_CONSUMER_GET_BUSY_SIZE(buf, sizeof(header));
+
+   if(BUFF_LIKELY(busy >= sizeof(header)))
+   {
+      (void)Buff_Ring_Peak(buf, &header, sizeof(header), 0, BUFF_FALSE);
+
+      /* in lock-free SPSC mode header can be already visible while record data is still being written by producer */
+      if(BUFF_UNLIKELY((busy - sizeof(header)) < header))
+      {
+         busy = BUFF_RING_CONSUMER_GET_BUSY_SIZE(buf, header + sizeof(header));
+      }
+
+      if(BUFF_LIKELY((busy - sizeof(header)) >= header))
+      {
+         *record_size = header;
+         result       = BUFF_TRUE;
+      }
+   }
+
+   return result;
+} /* buff_ring_get_record_size */
 #endif
 
-#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
-         extension = buf->protected_extension;
 
-         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
-         {
-            on_write = extension->on_write;
 
-            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
-            {
-               on_write(buf, extension, count, rewind_occured);
-            }
-         }
+#if( BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && BUFF_COPY_TO_VECTOR_ENABLED && BUFF_USE_VECTOR_BUFFERS && ( \
+      ((!defined(BUFF_RING_WRITE_RECORD_EXTERNAL)) && BUFF_RING_WRITE_RECORD_ENABLED) \
+   || ((!defined(BUFF_RING_WRITE_RECORD_FROM_VECTOR_EXTERNAL)) && BUFF_RING_WRITE_RECORD_FROM_VECTOR_ENABLED \
+      && BUFF_COPY_VECTOR_TO_VECTOR_ENABLED && BUFF_GET_READABLE_VECTOR_DATA_SIZE_ENABLED) \
+   || ((!defined(BUFF_RING_WRITE_RECORD_FROM_TREE_EXTERNAL)) && BUFF_RING_WRITE_RECORD_FROM_TREE_ENABLED \
+      && BUFF_COPY_TREE_TO_TREE_ENABLED && BUFF_GET_READABLE_TREE_DATA_SIZE_ENABLED && BUFF_USE_TREE_BUFFERS) ) )
+/**
+ * Makes space for whole record (removing oldest records if allowed), checks it out and copies header to it.
+ * After BUFF_TRUE is returned, caller must copy exactly "size" bytes of record data to "vector" after the header
+ * and check in whole record - so record appears in the buffer (and extensions are called) once, with its header.
+ */
+static Buff_Bool_DT buff_ring_check_out_record(
+   Buff_Ring_XT               *buf,
+   Buff_Writeable_Vector_XT    vector[2],
+   Buff_Size_DT                size,
+   Buff_Bool_DT                overwrite_if_no_free_space)
+{
+#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE && BUFF_RING_PEAK_ENABLED && BUFF_RING_REMOVE_ENABLED)
+   Buff_Size_DT oldest_size;
 #endif
-      }
+   Buff_Size_DT record_size;
+   Buff_Bool_DT result = BUFF_FALSE;
 
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_UNLOCK(buf);
-      }
+#if(!(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE && BUFF_RING_PEAK_ENABLED && BUFF_RING_REMOVE_ENABLED))
+   BUFF_UNUSED_PARAM(overwrite_if_no_free_space);
 #endif
 
-#if(BUFF_RING_USE_EXTENSIONS)
-      extension = buf->extension;
+   BUFF_RING_AUTO_GROW(buf, size + sizeof(size));
 
-      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
-      {
-         on_write = extension->on_write;
+   /* record must fit into empty buffer; compared this way to avoid overflow of record_size */
+   if(BUFF_LIKELY((buf->size >= sizeof(size)) && (size <= (buf->size - sizeof(size)))))
+   {
+      record_size = size + sizeof(size);
 
-         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE && BUFF_RING_PEAK_ENABLED && BUFF_RING_REMOVE_ENABLED)
+      if(BUFF_BOOL_IS_TRUE(overwrite_if_no_free_space) && (!BUFF_RING_IS_SPLICED(buf)) && (!BUFF_RING_IS_READ_POSTED(buf)))
+      {
+         /* oldest records are removed as a whole, so buffer never starts in the middle of a record */
+         while((BUFF_RING_PRODUCER_GET_FREE_SIZE(buf, record_size) < record_size)
+            && BUFF_BOOL_IS_TRUE(buff_ring_get_record_size(buf, &oldest_size)))
          {
-            on_write(buf, extension, count, rewind_occured);
+            (void)Buff_Ring_Remove(buf, oldest_size + sizeof(oldest_size), BUFF_FALSE);
          }
       }
 #endif
-   }
 
-   BUFF_DEBUG_RING(buf);
-   BUFF_EXIT_FUNC();
+      if(BUFF_LIKELY(BUFF_RING_PRODUCER_GET_FREE_SIZE(buf, record_size) >= record_size))
+      {
+         (void)Buff_Ring_Data_Check_Out_Vector(buf, vector, record_size, BUFF_FALSE, BUFF_FALSE);
+         (void)Buff_Copy_To_Vector(vector, 2, &size, sizeof(size), 0, 0);
 
-   return count;
+         result = BUFF_TRUE;
+      }
+   }
 
-#endif
-} /* Buff_Ring_Write_From_Vector */
+   return result;
+} /* buff_ring_check_out_record */
 #endif
 
 
 
-#if( (!defined(BUFF_RING_WRITE_FROM_TREE_EXTERNAL)) && BUFF_RING_WRITE_FROM_TREE_ENABLED && BUFF_USE_TREE_BUFFERS )
-Buff_Size_DT Buff_Ring_Write_From_Tree(
-   Buff_Ring_XT                 *buf,
-   const Buff_Readable_Tree_XT  *data,
-   Buff_Num_Elems_DT             data_num_elems,
-   Buff_Size_DT                  size,
-   Buff_Size_DT                  offset_data,
-   Buff_Bool_DT                  overwrite_if_no_free_space,
-   Buff_Bool_DT                  use_protection)
+#if( (!defined(BUFF_RING_WRITE_RECORD_EXTERNAL)) && BUFF_RING_WRITE_RECORD_ENABLED && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && BUFF_COPY_TO_VECTOR_ENABLED && BUFF_USE_VECTOR_BUFFERS )
+Buff_Bool_DT Buff_Ring_Write_Record(
+   Buff_Ring_XT  *buf,
+   const void    *data,
+   Buff_Size_DT   size,
+   Buff_Bool_DT   overwrite_if_no_free_space,
+   Buff_Bool_DT   use_protection)
 {
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Ring_Extensions_XT *extension;
-   Buff_Ring_Extension_On_Write on_write;
-#endif
    Buff_Writeable_Vector_XT vector[2];
-   Buff_Writeable_Tree_XT tree;
-   Buff_Size_DT count = 0;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Bool_DT rewind_occured = BUFF_FALSE;
-#if(BUFF_RING_USE_EXTENSIONS)
-   Buff_Bool_DT data_changed = BUFF_FALSE;
-#endif
-#endif
+   Buff_Bool_DT result = BUFF_FALSE;
 
 #if(!BUFF_RING_USE_PROTECTION)
    BUFF_UNUSED_PARAM(use_protection);
@@ -2881,7 +9138,7 @@ Buff_Size_DT Buff_Ring_Write_From_Tree(
    BUFF_ENTER_FUNC();
    BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Tree_XT, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && ((0 == size) || BUFF_CHECK_PTR(const void, data))))
    {
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
@@ -2890,174 +9147,191 @@ Buff_Size_DT Buff_Ring_Write_From_Tree(
       }
 #endif
 
-      count = BUFF_RING_GET_FREE_SIZE(buf);
+      result = buff_ring_check_out_record(buf, vector, size, overwrite_if_no_free_space);
 
-      if(BUFF_LIKELY(size <= count))
-      {
-         count = size;
-      }
-#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
-      else if(BUFF_BOOL_IS_TRUE(overwrite_if_no_free_space))
+      if(BUFF_LIKELY(BUFF_BOOL_IS_TRUE(result)))
       {
-         if(BUFF_LIKELY(size < buf->size))
+         if(size > 0)
          {
-            Buff_Ring_Remove(buf, size - count, BUFF_FALSE);
-
-            count = size;
+            (void)Buff_Copy_To_Vector(vector, 2, data, size, sizeof(size), 0);
          }
-         else
-         {
-            Buff_Ring_Clear(buf, BUFF_FALSE);
 
-            count = buf->size;
-         }
+         (void)Buff_Ring_Data_Check_In(buf, size + sizeof(size), BUFF_FALSE);
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(buf);
       }
 #endif
+   }
 
-      if(BUFF_LIKELY(count > 0))
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Ring_Write_Record */
+#endif
+
+
+
+#if( (!defined(BUFF_RING_WRITE_RECORD_FROM_VECTOR_EXTERNAL)) && BUFF_RING_WRITE_RECORD_FROM_VECTOR_ENABLED && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && BUFF_COPY_TO_VECTOR_ENABLED \
+   && BUFF_COPY_VECTOR_TO_VECTOR_ENABLED && BUFF_GET_READABLE_VECTOR_DATA_SIZE_ENABLED && BUFF_USE_VECTOR_BUFFERS )
+Buff_Bool_DT Buff_Ring_Write_Record_From_Vector(
+   Buff_Ring_XT                    *buf,
+   const Buff_Readable_Vector_XT   *data,
+   Buff_Num_Elems_DT                data_num_elems,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_data,
+   Buff_Bool_DT                     overwrite_if_no_free_space,
+   Buff_Bool_DT                     use_protection)
+{
+   Buff_Writeable_Vector_XT vector[2];
+   Buff_Size_DT data_size;
+   Buff_Bool_DT result = BUFF_FALSE;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, data)))
+   {
+      /* size of record is stored before its data, so whole data must be available */
+      data_size = Buff_Get_Readable_Vector_Data_Size(data, data_num_elems);
+
+      if(BUFF_LIKELY((offset_data <= data_size) && (size <= (data_size - offset_data))))
       {
-#if(BUFF_RING_USE_EXTENSIONS)
-         data_changed = BUFF_TRUE;
+#if(BUFF_RING_USE_PROTECTION)
+         if(BUFF_BOOL_IS_TRUE(use_protection))
+         {
+            BUFF_PROTECTION_LOCK(buf);
+         }
 #endif
-         tree.elem_type.vector.vector  = vector;
-         tree.is_branch                = BUFF_FALSE;
 
-         if(buf->first_free >= buf->first_busy)
+         result = buff_ring_check_out_record(buf, vector, size, overwrite_if_no_free_space);
+
+         if(BUFF_LIKELY(BUFF_BOOL_IS_TRUE(result)))
          {
-            if(BUFF_LIKELY(buf->first_busy > 0))
-            {
-               vector[1].data                         = buf->memory;
-               vector[1].size                         = buf->first_busy;
-               tree.elem_type.vector.vector_num_elems = 2;
-            }
-            else
+            if(size > 0)
             {
-               tree.elem_type.vector.vector_num_elems = 1;
+               (void)Buff_Copy_Vector_To_Vector(vector, 2, data, data_num_elems, size, sizeof(size), offset_data);
             }
-            vector[0].size                            = buf->size - buf->first_free;
+
+            (void)Buff_Ring_Data_Check_In(buf, size + sizeof(size), BUFF_FALSE);
          }
-         else
+
+#if(BUFF_RING_USE_PROTECTION)
+         if(BUFF_BOOL_IS_TRUE(use_protection))
          {
-            tree.elem_type.vector.vector_num_elems    = 1;
-            vector[0].size                            = buf->first_busy - buf->first_free;
+            BUFF_PROTECTION_UNLOCK(buf);
          }
-         vector[0].data                               = &((uint8_t*)(buf->memory))[buf->first_free];
+#endif
+      }
+   }
 
-         count = Buff_Copy_Tree_To_Tree(
-            &tree,
-            1,
-            data,
-            data_num_elems,
-            count,
-            0,
-            offset_data,
-            BUFF_MAKE_INVALID_PTR(Buff_Size_DT),
-            BUFF_MAKE_INVALID_PTR(Buff_Bool_DT));
+   BUFF_DEBUG_RING(buf);
+   BUFF_EXIT_FUNC();
 
-         if(BUFF_LIKELY(buf->first_free <= (buf->size - count)))
-         {
-            buf->busy_size      += count;
-            buf->first_free     += count;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            rewind_occured       = BUFF_FALSE;
+   return result;
+} /* Buff_Ring_Write_Record_From_Vector */
 #endif
 
-            if(BUFF_UNLIKELY(buf->first_free >= buf->size))
-            {
-               buf->first_free   = 0;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-               rewind_occured    = BUFF_TRUE;
-#endif
-            }
-         }
-         else
-         {
-            buf->busy_size      += count;
-            buf->first_free      = buf->first_free + count - buf->size;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            rewind_occured       = BUFF_TRUE;
+
+
+#if( (!defined(BUFF_RING_WRITE_RECORD_FROM_TREE_EXTERNAL)) && BUFF_RING_WRITE_RECORD_FROM_TREE_ENABLED && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && BUFF_COPY_TO_VECTOR_ENABLED \
+   && BUFF_COPY_TREE_TO_TREE_ENABLED && BUFF_GET_READABLE_TREE_DATA_SIZE_ENABLED && BUFF_USE_VECTOR_BUFFERS && BUFF_USE_TREE_BUFFERS )
+Buff_Bool_DT Buff_Ring_Write_Record_From_Tree(
+   Buff_Ring_XT                 *buf,
+   const Buff_Readable_Tree_XT  *data,
+   Buff_Num_Elems_DT             data_num_elems,
+   Buff_Size_DT                  size,
+   Buff_Size_DT                  offset_data,
+   Buff_Bool_DT                  overwrite_if_no_free_space,
+   Buff_Bool_DT                  use_protection)
+{
+   Buff_Writeable_Vector_XT vector[2];
+   Buff_Writeable_Tree_XT tree;
+   Buff_Size_DT data_size;
+   Buff_Bool_DT result = BUFF_FALSE;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
 #endif
-         }
 
-#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
-         if(buf->busy_size >= buf->max_busy_size)
+   BUFF_ENTER_FUNC();
+   BUFF_DEBUG_RING(buf);
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && BUFF_CHECK_PTR(const Buff_Readable_Tree_XT, data)))
+   {
+      /* size of record is stored before its data, so whole data must be available */
+      data_size = Buff_Get_Readable_Tree_Data_Size(data, data_num_elems);
+
+      if(BUFF_LIKELY((offset_data <= data_size) && (size <= (data_size - offset_data))))
+      {
+#if(BUFF_RING_USE_PROTECTION)
+         if(BUFF_BOOL_IS_TRUE(use_protection))
          {
-            buf->max_busy_size = buf->busy_size;
+            BUFF_PROTECTION_LOCK(buf);
          }
 #endif
 
-#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
-         extension = buf->protected_extension;
+         result = buff_ring_check_out_record(buf, vector, size, overwrite_if_no_free_space);
 
-         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+         if(BUFF_LIKELY(BUFF_BOOL_IS_TRUE(result)))
          {
-            on_write = extension->on_write;
-
-            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+            if(size > 0)
             {
-               on_write(buf, extension, count, rewind_occured);
+               tree.elem_type.vector.vector           = vector;
+               tree.elem_type.vector.vector_num_elems = 2;
+               tree.is_branch                         = BUFF_FALSE;
+
+               (void)Buff_Copy_Tree_To_Tree(
+                  &tree,
+                  1,
+                  data,
+                  data_num_elems,
+                  size,
+                  sizeof(size),
+                  offset_data,
+                  BUFF_MAKE_INVALID_PTR(Buff_Size_DT),
+                  BUFF_MAKE_INVALID_PTR(Buff_Bool_DT));
             }
+
+            (void)Buff_Ring_Data_Check_In(buf, size + sizeof(size), BUFF_FALSE);
          }
-#endif
-      }
 
 #if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_UNLOCK(buf);
-      }
-#endif
-
-#if(BUFF_RING_USE_EXTENSIONS)
-      extension = buf->extension;
-
-      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
-      {
-         on_write = extension->on_write;
-
-         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+         if(BUFF_BOOL_IS_TRUE(use_protection))
          {
-            on_write(buf, extension, count, rewind_occured);
+            BUFF_PROTECTION_UNLOCK(buf);
          }
-      }
 #endif
+      }
    }
 
    BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
-   return count;
-} /* Buff_Ring_Write_From_Tree */
+   return result;
+} /* Buff_Ring_Write_Record_From_Tree */
 #endif
 
 
 
-#if( (!defined(RING_BUF_OVERWRITE_IF_EXIST_EXTERNAL)) && BUFF_RING_OVERWRITE_IF_EXIST_ENABLED )
-Buff_Size_DT Buff_Ring_OverWrite_If_Exist(
+#if( (!defined(BUFF_RING_PEAK_RECORD_EXTERNAL)) && BUFF_RING_PEAK_RECORD_ENABLED && BUFF_RING_PEAK_ENABLED )
+Buff_Bool_DT Buff_Ring_Peak_Record(
    Buff_Ring_XT  *buf,
-   const void    *data,
+   void          *data,
    Buff_Size_DT   size,
-   Buff_Size_DT   pos,
+   Buff_Size_DT  *record_size,
    Buff_Bool_DT   use_protection)
 {
-#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VENDOR_BUFFERS)
-
-   return Buff_Ring_OverWrite_If_Exist_Vendor(buf, data, size, pos, buff_vendor_memcpy, use_protection);
-
-#else
-
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Ring_Extensions_XT *extension;
-   Buff_Ring_Extension_On_Overwrite on_overwrite;
-#endif
-   Buff_Size_DT part_size;
-   Buff_Size_DT count = 0;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Bool_DT rewind_occured = BUFF_FALSE;
-#if(BUFF_RING_USE_EXTENSIONS)
-   Buff_Bool_DT data_changed = BUFF_FALSE;
-#endif
-#endif
+   Buff_Size_DT found_size;
+   Buff_Bool_DT result = BUFF_FALSE;
 
 #if(!BUFF_RING_USE_PROTECTION)
    BUFF_UNUSED_PARAM(use_protection);
@@ -3066,7 +9340,8 @@ Buff_Size_DT Buff_Ring_OverWrite_If_Exist(
    BUFF_ENTER_FUNC();
    BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && BUFF_CHECK_PTR(Buff_Size_DT, record_size)
+      && ((0 == size) || BUFF_CHECK_PTR(void, data))))
    {
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
@@ -3075,95 +9350,18 @@ Buff_Size_DT Buff_Ring_OverWrite_If_Exist(
       }
 #endif
 
-      count = buf->busy_size;
-
-      if(BUFF_LIKELY((size <= count) && (pos < buf->size)))
+      if(BUFF_BOOL_IS_TRUE(buff_ring_get_record_size(buf, &found_size)))
       {
-         count = size;
+         *record_size = found_size;
 
-         if(BUFF_LIKELY(count > 0))
+         if(BUFF_LIKELY(found_size <= size))
          {
-#if(BUFF_RING_USE_EXTENSIONS)
-            data_changed = BUFF_TRUE;
-#endif
-            /* check if busy area is continous (doesn't start at end of memory and ends on begining) */
-            if(buf->first_free > buf->first_busy)
-            {
-               /* check if whole memory requested to be modified is on busy area */
-               if(BUFF_LIKELY((pos >= buf->first_busy) && (pos <= (buf->first_free - size))))
-               {
-                  memcpy( &((uint8_t*)(buf->memory))[pos], data, count);
-               }
-               /* memory requested to be modified is not fully inside busy area */
-               else
-               {
-                  count = 0;
-               }
-            }
-            else
+            if(found_size > 0)
             {
-               /* check if begining of memory requested to be modified is on the begining of busy area (end of memory) */
-               if(pos >= buf->first_busy)
-               {
-                  /* check if whole memory requested to be modified is on the begining of busy area (end of memory) */
-                  if(pos <= (buf->size - size))
-                  {
-                     memcpy( &((uint8_t*)(buf->memory))[pos], data, count);
-                  }
-                  /*
-                  * check if memory requested to be modified is partially on the begining of busy area (end of memory)
-                  * and partially on the end of busy area (begining of memory)
-                  */
-                  else if((pos + size - buf->size) <= buf->first_free)
-                  {
-                     part_size      = buf->size - pos;
-                     memcpy( &((uint8_t*)(buf->memory))[pos], data, part_size);
-                     data           = &((uint8_t*)data)[part_size];
-                     part_size      = count - part_size;
-                     memcpy(buf->memory, data, part_size);
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-                     rewind_occured = BUFF_TRUE;
-#endif
-                  }
-                  /* memory requested to be modified is not fully inside busy area */
-                  else
-                  {
-                     count = 0;
-                  }
-               }
-               /* check if whole memory requested to be modified is on the end of busy area (begining of memory) */
-               else if(pos < buf->first_free)
-               {
-                  if(size <= (buf->first_free - pos))
-                  {
-                     memcpy( &((uint8_t*)(buf->memory))[pos], data, count);
-                  }
-                  /* memory requested to be modified is not fully inside busy area */
-                  else
-                  {
-                     count = 0;
-                  }
-               }
-               /* memory requested to be modified starts outside busy area */
-               else
-               {
-                  count = 0;
-               }
+               (void)Buff_Ring_Peak(buf, data, found_size, sizeof(found_size), BUFF_FALSE);
             }
 
-#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            extension = buf->protected_extension;
-
-            if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
-            {
-               on_overwrite = extension->on_overwrite;
-
-               if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Overwrite, on_overwrite))
-               {
-                  on_overwrite(buf, extension, pos, count, rewind_occured);
-               }
-            }
-#endif
+            result = BUFF_TRUE;
          }
       }
 
@@ -3173,56 +9371,27 @@ Buff_Size_DT Buff_Ring_OverWrite_If_Exist(
          BUFF_PROTECTION_UNLOCK(buf);
       }
 #endif
-
-#if(BUFF_RING_USE_EXTENSIONS)
-      extension = buf->extension;
-
-      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
-      {
-         on_overwrite = extension->on_overwrite;
-
-         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Overwrite, on_overwrite))
-         {
-            on_overwrite(buf, extension, pos, count, rewind_occured);
-         }
-      }
-#endif
    }
 
    BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
-   return count;
-
-#endif
-} /* Buff_Ring_OverWrite_If_Exist */
+   return result;
+} /* Buff_Ring_Peak_Record */
 #endif
 
 
 
-#if( (!defined(RING_BUF_OVERWRITE_IF_EXIST_VENDOR_EXTERNAL)) && BUFF_RING_OVERWRITE_IF_EXIST_VENDOR_ENABLED )
-Buff_Size_DT Buff_Ring_OverWrite_If_Exist_Vendor(
-   Buff_Ring_XT           *buf,
-   const void             *data,
-   Buff_Size_DT            size,
-   Buff_Size_DT            pos,
-   Buff_Vendor_Memcpy_HT   vendor_cpy,
-   Buff_Bool_DT            use_protection)
+#if( (!defined(BUFF_RING_READ_RECORD_EXTERNAL)) && BUFF_RING_READ_RECORD_ENABLED && BUFF_RING_PEAK_ENABLED && BUFF_RING_REMOVE_ENABLED )
+Buff_Bool_DT Buff_Ring_Read_Record(
+   Buff_Ring_XT  *buf,
+   void          *data,
+   Buff_Size_DT   size,
+   Buff_Size_DT  *record_size,
+   Buff_Bool_DT   use_protection)
 {
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Ring_Extensions_XT *extension;
-   Buff_Ring_Extension_On_Overwrite on_overwrite;
-#endif
-   Buff_Memcpy_Params_XT params;
-   Buff_Size_DT part_size;
-   Buff_Size_DT count = 0;
-   Buff_Size_DT ret_count;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Bool_DT rewind_occured = BUFF_FALSE;
-#if(BUFF_RING_USE_EXTENSIONS)
-   Buff_Bool_DT data_changed = BUFF_FALSE;
-#endif
-#endif
+   Buff_Size_DT found_size;
+   Buff_Bool_DT result = BUFF_FALSE;
 
 #if(!BUFF_RING_USE_PROTECTION)
    BUFF_UNUSED_PARAM(use_protection);
@@ -3231,9 +9400,8 @@ Buff_Size_DT Buff_Ring_OverWrite_If_Exist_Vendor(
    BUFF_ENTER_FUNC();
    BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data)
-      && BUFF_CHECK_HANDLER(Buff_Vendor_Memcpy_HT, vendor_cpy)
-      && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf) && BUFF_CHECK_PTR(Buff_Size_DT, record_size)
+      && ((0 == size) || BUFF_CHECK_PTR(void, data))))
    {
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
@@ -3242,152 +9410,22 @@ Buff_Size_DT Buff_Ring_OverWrite_If_Exist_Vendor(
       }
 #endif
 
-      count = buf->busy_size;
-
-      if(BUFF_LIKELY((size <= count) && (pos < buf->size)))
+      if(BUFF_BOOL_IS_TRUE(buff_ring_get_record_size(buf, &found_size)))
       {
-         count = size;
+         *record_size = found_size;
 
-         if(BUFF_LIKELY(count > 0))
+         /* record is not read while spliced data is in the buffer - Buff_Ring_Remove would not remove it */
+         if(BUFF_LIKELY((found_size <= size) && (!BUFF_RING_IS_SPLICED(buf))))
          {
-#if(BUFF_RING_USE_EXTENSIONS)
-            data_changed = BUFF_TRUE;
-#endif
-            params.dest          = buf->memory;
-            params.src           = data;
-            params.dest_offset   = pos;
-            params.src_offset    = 0;
-
-            /* check if busy area is continous (doesn't start at end of memory and ends on begining) */
-            if(buf->first_free > buf->first_busy)
-            {
-               /* check if whole memory requested to be modified is on busy area */
-               if(BUFF_LIKELY((pos >= buf->first_busy) && (pos <= (buf->first_free - size))))
-               {
-                  params.size          = count;
-                  params.is_last_part  = BUFF_TRUE;
-
-                  ret_count = vendor_cpy(&params);
-
-                  if(BUFF_LIKELY(ret_count <= count))
-                  {
-                     count = ret_count;
-                  }
-               }
-               /* memory requested to be modified is not fully inside busy area */
-               else
-               {
-                  count = 0;
-               }
-            }
-            else
+            if(found_size > 0)
             {
-               /* check if begining of memory requested to be modified is on the begining of busy area (end of memory) */
-               if(pos >= buf->first_busy)
-               {
-                  /* check if whole memory requested to be modified is on the begining of busy area (end of memory) */
-                  if(pos <= (buf->size - size))
-                  {
-                     params.size          = count;
-                     params.is_last_part  = BUFF_TRUE;
-
-                     ret_count = vendor_cpy(&params);
-
-                     if(BUFF_LIKELY(ret_count <= count))
-                     {
-                        count = ret_count;
-                     }
-                  }
-                  /*
-                  * check if memory requested to be modified is partially on the begining of busy area (end of memory)
-                  * and partially on the end of busy area (begining of memory)
-                  */
-                  else if((pos + size - buf->size) <= buf->first_free)
-                  {
-                     part_size            = buf->size - pos;
-
-                     params.size          = part_size;
-                     params.is_last_part  = BUFF_FALSE;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-                     rewind_occured       = BUFF_TRUE;
-#endif
-
-                     ret_count = vendor_cpy(&params);
-
-                     /* copy second part only if size returned in first copy is same as requested */
-                     if(BUFF_LIKELY(part_size <= ret_count))
-                     {
-                        ret_count            = part_size;
-                        params.dest          = buf->memory;
-                        params.src           = data;
-                        params.dest_offset   = 0;
-                        params.src_offset    = part_size;
-                        part_size            = count - part_size;
-                        params.size          = part_size;
-                        params.is_last_part  = BUFF_TRUE;
-
-                        ret_count += vendor_cpy(&params);
-
-                        if(BUFF_LIKELY(ret_count <= count))
-                        {
-                           count = ret_count;
-                        }
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-                        rewind_occured       = BUFF_TRUE;
-#endif
-                     }
-                     else
-                     {
-                        count = ret_count;
-                     }
-                  }
-                  /* memory requested to be modified is not fully inside busy area */
-                  else
-                  {
-                     count = 0;
-                  }
-               }
-               /* check if whole memory requested to be modified is on the end of busy area (begining of memory) */
-               else if(pos < buf->first_free)
-               {
-                  if(size <= (buf->first_free - pos))
-                  {
-                     params.size          = count;
-                     params.is_last_part  = BUFF_TRUE;
-
-                     ret_count = vendor_cpy(&params);
-
-                     if(BUFF_LIKELY(ret_count <= count))
-                     {
-                        count = ret_count;
-                     }
-                  }
-                  /* memory requested to be modified is not fully inside busy area */
-                  else
-                  {
-                     count = 0;
-                  }
-               }
-               /* memory requested to be modified is outside busy area */
-               else
-               {
-                  count = 0;
-               }
+               (void)Buff_Ring_Peak(buf, data, found_size, sizeof(found_size), BUFF_FALSE);
             }
 
-#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            extension = buf->protected_extension;
-
-            if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
-            {
-               on_overwrite = extension->on_overwrite;
+            /* header and data are removed at once - one on_remove event per record */
+            (void)Buff_Ring_Remove(buf, found_size + sizeof(found_size), BUFF_FALSE);
 
-               if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Overwrite, on_overwrite))
-               {
-                  on_overwrite(buf, extension, pos, count, rewind_occured);
-               }
-            }
-#endif
+            result = BUFF_TRUE;
          }
       }
 
@@ -3397,1586 +9435,1647 @@ Buff_Size_DT Buff_Ring_OverWrite_If_Exist_Vendor(
          BUFF_PROTECTION_UNLOCK(buf);
       }
 #endif
-
-#if(BUFF_RING_USE_EXTENSIONS)
-      extension = buf->extension;
-
-      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
-      {
-         on_overwrite = extension->on_overwrite;
-
-         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Overwrite, on_overwrite))
-         {
-            on_overwrite(buf, extension, pos, count, rewind_occured);
-         }
-      }
-#endif
    }
 
    BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
-   return count;
-} /* Buff_Ring_OverWrite_If_Exist_Vendor */
+   return result;
+} /* Buff_Ring_Read_Record */
 #endif
+#endif /* #if(BUFF_USE_RING_BUFFERS) */
 
 
 
-#if( (!defined(RING_BUF_PEAK_EXTERNAL)) && BUFF_RING_PEAK_ENABLED )
-Buff_Size_DT Buff_Ring_Peak(
-   Buff_Ring_XT  *buf,
-   void          *data,
-   Buff_Size_DT   size,
-   Buff_Size_DT   buf_offset,
-   Buff_Bool_DT   use_protection)
+#if(BUFF_USE_BIP_BUFFERS && BUFF_USE_RING_BUFFERS)
+
+#if( (!defined(BUFF_BIP_INIT_EXTERNAL)) && BUFF_BIP_INIT_ENABLED && BUFF_RING_INIT_ENABLED )
+Buff_Bool_DT Buff_Bip_Init(Buff_Bip_XT *buf, void *memory, Buff_Size_DT size)
 {
-#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VENDOR_BUFFERS)
+   Buff_Bool_DT result = BUFF_FALSE;
 
-   return Buff_Ring_Peak_Vendor(buf, data, size, buf_offset, buff_vendor_memcpy, use_protection);
+   BUFF_ENTER_FUNC();
 
-#elif(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Bip_XT, buf)))
+   {
+      buf->region_a_start  = 0;
+      buf->region_a_end    = 0;
+      buf->region_b_end    = 0;
+      buf->reserved_start  = 0;
+      buf->reserved_size   = 0;
+      buf->region_b_in_use = BUFF_FALSE;
+
+      /* memory, protection and extensions are kept by ring buffer */
+      result = Buff_Ring_Init(&buf->ring, memory, size);
+   }
 
-   Buff_Writeable_Tree_XT tree;
-   Buff_Writeable_Vector_XT vector;
+   BUFF_EXIT_FUNC();
 
-   tree.is_branch = BUFF_FALSE;
-   tree.elem_type.vector.vector           = &vector;
-   tree.elem_type.vector.vector_num_elems = 1;
+   return result;
+} /* Buff_Bip_Init */
+#endif
 
-   vector.data = data;
-   vector.size = size;
 
-   return Buff_Ring_Peak_To_Tree(
-      buf, &tree, 1, size, buf_offset, 0, use_protection);
 
-#elif(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VECTOR_BUFFERS)
+#if( (!defined(BUFF_BIP_DEINIT_EXTERNAL)) && BUFF_BIP_DEINIT_ENABLED && BUFF_RING_DEINIT_ENABLED )
+void   Buff_Bip_Deinit(Buff_Bip_XT *buf)
+{
+   BUFF_ENTER_FUNC();
 
-   Buff_Writeable_Vector_XT vector;
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Bip_XT, buf)))
+   {
+#if(BUFF_RING_USE_PROTECTION)
+      BUFF_PROTECTION_LOCK(&buf->ring);
+#endif
 
-   vector.data = data;
-   vector.size = size;
+      buf->region_a_start  = 0;
+      buf->region_a_end    = 0;
+      buf->region_b_end    = 0;
+      buf->reserved_start  = 0;
+      buf->reserved_size   = 0;
+      buf->region_b_in_use = BUFF_FALSE;
 
-   return Buff_Ring_Peak_To_Vector(
-      buf, &vector, 1, size, buf_offset, 0, use_protection);
+#if(BUFF_RING_USE_PROTECTION)
+      BUFF_PROTECTION_UNLOCK(&buf->ring);
+#endif
 
-#else
+      Buff_Ring_Deinit(&buf->ring);
+   }
 
-   Buff_Size_DT read_start;
-   Buff_Size_DT part_size;
-   Buff_Size_DT count = 0;
+   BUFF_EXIT_FUNC();
+} /* Buff_Bip_Deinit */
+#endif
+
+
+
+#if( (!defined(BUFF_BIP_GET_BUSY_SIZE_EXTERNAL)) && BUFF_BIP_GET_BUSY_SIZE_ENABLED )
+Buff_Size_DT Buff_Bip_Get_Busy_Size(Buff_Bip_XT *buf, Buff_Bool_DT use_protection)
+{
+   Buff_Size_DT result = 0;
 
 #if(!BUFF_RING_USE_PROTECTION)
    BUFF_UNUSED_PARAM(use_protection);
 #endif
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Bip_XT, buf)))
    {
+      BUFF_DEBUG_RING(&buf->ring);
+
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         BUFF_PROTECTION_LOCK(buf);
+         BUFF_PROTECTION_LOCK(&buf->ring);
       }
 #endif
 
-      if(BUFF_LIKELY(buf_offset < buf->busy_size))
+      result = buf->region_a_end - buf->region_a_start;
+
+      if(BUFF_BOOL_IS_TRUE(buf->region_b_in_use))
       {
-         count = buf->busy_size - buf_offset;
+         result += buf->region_b_end;
       }
 
-      if(BUFF_LIKELY(size <= count))
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         count = size;
+         BUFF_PROTECTION_UNLOCK(&buf->ring);
       }
+#endif
 
-      if(BUFF_LIKELY(count > 0))
+      BUFF_DEBUG_RING(&buf->ring);
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Bip_Get_Busy_Size */
+#endif
+
+
+
+#if( (!defined(BUFF_BIP_RESERVE_EXTERNAL)) && BUFF_BIP_RESERVE_ENABLED )
+void *Buff_Bip_Reserve(Buff_Bip_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection)
+{
+   void *result = BUFF_MAKE_INVALID_PTR(void);
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Bip_XT, buf) && (size > 0)))
+   {
+      BUFF_DEBUG_RING(&buf->ring);
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         read_start = buf->first_busy + buf_offset - buf->size;
+         BUFF_PROTECTION_LOCK(&buf->ring);
+      }
+#endif
 
-         if(BUFF_LIKELY(buf->first_busy < (buf->size - buf_offset)))
-         {
-            read_start += buf->size;
-         }
+      /* previous, not committed reservation is replaced */
+      buf->reserved_size = 0;
 
-         if(BUFF_LIKELY(read_start <= (buf->size - count)))
+      /* empty region A is moved to the begining of memory, so region B is never started while region A is empty */
+      if((!BUFF_BOOL_IS_TRUE(buf->region_b_in_use)) && (buf->region_a_start == buf->region_a_end))
+      {
+         buf->region_a_start  = 0;
+         buf->region_a_end    = 0;
+      }
+
+      if(BUFF_BOOL_IS_TRUE(buf->region_b_in_use))
+      {
+         /* region B can grow only up to begining of region A */
+         if(size <= (buf->region_a_start - buf->region_b_end))
          {
-            memcpy(data, &((const uint8_t*)(buf->memory))[read_start], count);
+            buf->reserved_start = buf->region_b_end;
+            buf->reserved_size  = size;
          }
-         else
-         {
-            part_size   = buf->size - read_start;
-            memcpy(data, &((const uint8_t*)(buf->memory))[read_start], part_size);
+      }
+      else if(size <= (buf->ring.size - buf->region_a_end))
+      {
+         buf->reserved_start = buf->region_a_end;
+         buf->reserved_size  = size;
+      }
+      else if(size <= buf->region_a_start)
+      {
+         /* not enough space after region A - region B is started from the begining of memory; space after region A is left unused */
+         buf->reserved_start = 0;
+         buf->reserved_size  = size;
+      }
 
-            data        = &((uint8_t*)data)[part_size];
-            part_size   = count - part_size;
-            memcpy(data, buf->memory, part_size);
-         }
+      if(buf->reserved_size > 0)
+      {
+         result = &((uint8_t*)(buf->ring.memory))[buf->reserved_start];
       }
 
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         BUFF_PROTECTION_UNLOCK(buf);
+         BUFF_PROTECTION_UNLOCK(&buf->ring);
       }
 #endif
+
+      BUFF_DEBUG_RING(&buf->ring);
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
-   return count;
-
-#endif
-} /* Buff_Ring_Peak */
+   return result;
+} /* Buff_Bip_Reserve */
 #endif
 
 
 
-#if( (!defined(BUFF_RING_PEAK_VENDOR_EXTERNAL)) && BUFF_RING_PEAK_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS )
-Buff_Size_DT Buff_Ring_Peak_Vendor(
-   Buff_Ring_XT           *buf,
-   void                   *data,
-   Buff_Size_DT            size,
-   Buff_Size_DT            buf_offset,
-   Buff_Vendor_Memcpy_HT   vendor_cpy,
-   Buff_Bool_DT            use_protection)
+#if( (!defined(BUFF_BIP_COMMIT_EXTERNAL)) && BUFF_BIP_COMMIT_ENABLED )
+Buff_Bool_DT Buff_Bip_Commit(Buff_Bip_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection)
 {
-   Buff_Memcpy_Params_XT params;
-   Buff_Size_DT read_start;
-   Buff_Size_DT part_size;
-   Buff_Size_DT count = 0;
-   Buff_Size_DT ret_count;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Write on_write;
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+#endif
+   Buff_Bool_DT result = BUFF_FALSE;
 
 #if(!BUFF_RING_USE_PROTECTION)
    BUFF_UNUSED_PARAM(use_protection);
 #endif
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data)
-      && BUFF_CHECK_HANDLER(Buff_Vendor_Memcpy_HT, vendor_cpy)
-      && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Bip_XT, buf)))
    {
+      BUFF_DEBUG_RING(&buf->ring);
+
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         BUFF_PROTECTION_LOCK(buf);
+         BUFF_PROTECTION_LOCK(&buf->ring);
       }
 #endif
 
-      if(BUFF_LIKELY(buf_offset < buf->busy_size))
-      {
-         count = buf->busy_size - buf_offset;
-      }
-
-      if(BUFF_LIKELY(size <= count))
-      {
-         count = size;
-      }
-
-      if(BUFF_LIKELY(count > 0))
+      if(BUFF_LIKELY((size <= buf->reserved_size) && ((size > 0) || (buf->reserved_size > 0))))
       {
-         read_start = buf->first_busy + buf_offset - buf->size;
-
-         if(BUFF_LIKELY(buf->first_busy < (buf->size - buf_offset)))
-         {
-            read_start += buf->size;
-         }
-
-         params.dest             = data;
-         params.src              = buf->memory;
-         params.dest_offset      = 0;
-         params.src_offset       = read_start;
+         result = BUFF_TRUE;
 
-         if(BUFF_LIKELY(read_start <= (buf->size - count)))
+         if(size > 0)
          {
-            params.size          = count;
-            params.is_last_part  = BUFF_TRUE;
-
-            ret_count = vendor_cpy(&params);
-
-            if(BUFF_LIKELY(ret_count <= count))
+            if((!BUFF_BOOL_IS_TRUE(buf->region_b_in_use)) && (buf->reserved_start == buf->region_a_end))
             {
-               count = ret_count;
+               buf->region_a_end += size;
+            }
+            else
+            {
+               /* reservation has been made in region B (possibly first one in it) */
+               buf->region_b_in_use = BUFF_TRUE;
+               buf->region_b_end    = buf->reserved_start + size;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+               rewind_occured       = BUFF_TRUE;
+#endif
             }
-         }
-         else
-         {
-            part_size = buf->size - read_start;
-
-            params.size          = part_size;
-            params.is_last_part  = BUFF_FALSE;
 
-            ret_count = vendor_cpy(&params);
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+            extension = buf->ring.protected_extension;
 
-            if(BUFF_LIKELY(part_size <= ret_count))
+            if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
             {
-               ret_count            = part_size;
-               params.dest          = data;
-               params.src           = buf->memory;
-               params.dest_offset   = part_size;
-               params.src_offset    = 0;
-               part_size            = count - part_size;
-               params.size          = part_size;
-               params.is_last_part  = BUFF_TRUE;
-
-               ret_count += vendor_cpy(&params);
+               on_write = extension->on_write;
 
-               if(BUFF_LIKELY(ret_count <= count))
+               if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
                {
-                  count = ret_count;
+                  on_write(&buf->ring, extension, size, rewind_occured);
                }
             }
-            else
-            {
-               count = ret_count;
-            }
+#endif
+         }
+
+         buf->reserved_size = 0;
+
+         /* reservation has been cancelled after region A has been read - emptied region A is moved to the begining of memory */
+         if((!BUFF_BOOL_IS_TRUE(buf->region_b_in_use)) && (buf->region_a_start == buf->region_a_end))
+         {
+            buf->region_a_start  = 0;
+            buf->region_a_end    = 0;
          }
       }
 
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         BUFF_PROTECTION_UNLOCK(buf);
+         BUFF_PROTECTION_UNLOCK(&buf->ring);
       }
 #endif
-   }
-
-   BUFF_DEBUG_RING(buf);
-   BUFF_EXIT_FUNC();
-
-   return count;
-} /* Buff_Ring_Peak_Vendor */
-#endif
 
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->ring.extension;
 
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(result) && (size > 0))
+      {
+         on_write = extension->on_write;
 
-#if( (!defined(BUFF_RING_PEAK_TO_VECTOR_EXTERNAL)) && BUFF_RING_PEAK_TO_VECTOR_ENABLED && BUFF_USE_VECTOR_BUFFERS )
-Buff_Size_DT Buff_Ring_Peak_To_Vector(
-   Buff_Ring_XT                    *buf,
-   const Buff_Writeable_Vector_XT  *data,
-   Buff_Num_Elems_DT                data_num_elems,
-   Buff_Size_DT                     size,
-   Buff_Size_DT                     buf_offset,
-   Buff_Size_DT                     offset_data,
-   Buff_Bool_DT                     use_protection)
-{
-#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+         {
+            on_write(&buf->ring, extension, size, rewind_occured);
+         }
+      }
+#endif
 
-   Buff_Writeable_Tree_XT tree;
+      BUFF_DEBUG_RING(&buf->ring);
+   }
 
-   tree.is_branch = BUFF_FALSE;
-   tree.elem_type.vector.vector           = data;
-   tree.elem_type.vector.vector_num_elems = data_num_elems;
+   BUFF_EXIT_FUNC();
 
-   return Buff_Ring_Peak_To_Tree(buf, &tree, 1, size, buf_offset, offset_data, use_protection);
+   return result;
+} /* Buff_Bip_Commit */
+#endif
 
-#else
 
-   Buff_Readable_Vector_XT vector[2];
-   Buff_Size_DT      read_start;
-   Buff_Size_DT      count = 0;
-   Buff_Num_Elems_DT vector_num_elems;
+
+#if( (!defined(BUFF_BIP_READ_EXTERNAL)) && BUFF_BIP_READ_ENABLED )
+const void *Buff_Bip_Read(Buff_Bip_XT *buf, Buff_Size_DT *size, Buff_Bool_DT use_protection)
+{
+   const void *result = BUFF_MAKE_INVALID_PTR(const void);
 
 #if(!BUFF_RING_USE_PROTECTION)
    BUFF_UNUSED_PARAM(use_protection);
 #endif
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Writeable_Vector_XT, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Bip_XT, buf) && BUFF_CHECK_PTR(Buff_Size_DT, size)))
    {
+      BUFF_DEBUG_RING(&buf->ring);
+
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         BUFF_PROTECTION_LOCK(buf);
+         BUFF_PROTECTION_LOCK(&buf->ring);
       }
 #endif
 
-      if(BUFF_LIKELY(buf_offset < buf->busy_size))
-      {
-         count = buf->busy_size - buf_offset;
-      }
-
-      if(BUFF_LIKELY(size <= count))
-      {
-         count = size;
-      }
+      /* region A is never empty if region B is in use, so oldest data is always at its begining */
+      *size = buf->region_a_end - buf->region_a_start;
 
-      if(BUFF_LIKELY(count > 0))
+      if(*size > 0)
       {
-         read_start = buf->first_busy + buf_offset - buf->size;
-
-         if(BUFF_LIKELY(buf->first_busy < (buf->size - buf_offset)))
-         {
-            read_start += buf->size;
-         }
-
-         if(read_start >= buf->first_free)
-         {
-            if(BUFF_LIKELY(buf->first_free > 0))
-            {
-               vector[1].data    = buf->memory;
-               vector[1].size    = buf->first_free;
-               vector_num_elems  = 2;
-            }
-            else
-            {
-               vector_num_elems  = 1;
-            }
-            vector[0].size       = buf->size - read_start;
-         }
-         else
-         {
-            vector_num_elems     = 1;
-            vector[0].size       = buf->first_free - read_start;
-         }
-         vector[0].data          = &((const uint8_t*)(buf->memory))[read_start];
-
-         count = Buff_Copy_Vector_To_Vector(data, data_num_elems, vector, vector_num_elems, count, offset_data, 0);
+         result = &((const uint8_t*)(buf->ring.memory))[buf->region_a_start];
       }
 
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         BUFF_PROTECTION_UNLOCK(buf);
+         BUFF_PROTECTION_UNLOCK(&buf->ring);
       }
 #endif
+
+      BUFF_DEBUG_RING(&buf->ring);
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
-   return count;
-
-#endif
-} /* Buff_Ring_Peak_To_Vector */
+   return result;
+} /* Buff_Bip_Read */
 #endif
 
 
 
-#if( (!defined(BUFF_RING_PEAK_TO_TREE_EXTERNAL)) && BUFF_RING_PEAK_TO_TREE_ENABLED && BUFF_USE_TREE_BUFFERS )
-Buff_Size_DT Buff_Ring_Peak_To_Tree(
-   Buff_Ring_XT                 *buf,
-   const Buff_Writeable_Tree_XT *data,
-   Buff_Num_Elems_DT             data_num_elems,
-   Buff_Size_DT                  size,
-   Buff_Size_DT                  buf_offset,
-   Buff_Size_DT                  offset_data,
-   Buff_Bool_DT                  use_protection)
+#if( (!defined(BUFF_BIP_DECOMMIT_EXTERNAL)) && BUFF_BIP_DECOMMIT_ENABLED )
+Buff_Bool_DT Buff_Bip_Decommit(Buff_Bip_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection)
 {
-   Buff_Readable_Vector_XT vector[2];
-   Buff_Readable_Tree_XT tree;
-   Buff_Size_DT read_start;
-   Buff_Size_DT count = 0;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Ring_Extensions_XT *extension;
+   Buff_Ring_Extension_On_Read on_read;
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+#endif
+   Buff_Bool_DT result = BUFF_FALSE;
 
 #if(!BUFF_RING_USE_PROTECTION)
    BUFF_UNUSED_PARAM(use_protection);
 #endif
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Writeable_Tree_XT, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Bip_XT, buf)))
    {
+      BUFF_DEBUG_RING(&buf->ring);
+
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         BUFF_PROTECTION_LOCK(buf);
+         BUFF_PROTECTION_LOCK(&buf->ring);
       }
 #endif
 
-      if(BUFF_LIKELY(buf_offset < buf->busy_size))
-      {
-         count = buf->busy_size - buf_offset;
-      }
-
-      if(BUFF_LIKELY(size <= count))
-      {
-         count = size;
-      }
-
-      if(BUFF_LIKELY(count > 0))
+      if(BUFF_LIKELY((size > 0) && (size <= (buf->region_a_end - buf->region_a_start))))
       {
-         read_start = buf->first_busy + buf_offset - buf->size;
-
-         if(BUFF_LIKELY(buf->first_busy < (buf->size - buf_offset)))
-         {
-            read_start += buf->size;
-         }
+         result = BUFF_TRUE;
 
-         tree.elem_type.vector.vector  = vector;
-         tree.is_branch = BUFF_FALSE;
+         buf->region_a_start += size;
 
-         if(read_start >= buf->first_free)
+         if(buf->region_a_start == buf->region_a_end)
          {
-            if(BUFF_LIKELY(buf->first_free > 0))
+            if(BUFF_BOOL_IS_TRUE(buf->region_b_in_use))
             {
-               vector[1].data                         = buf->memory;
-               vector[1].size                         = buf->first_free;
-               tree.elem_type.vector.vector_num_elems = 2;
+               /* region A has been read - region B becomes region A */
+               buf->region_a_start  = 0;
+               buf->region_a_end    = buf->region_b_end;
+               buf->region_b_end    = 0;
+               buf->region_b_in_use = BUFF_FALSE;
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+               rewind_occured       = BUFF_TRUE;
+#endif
             }
-            else
+            /* empty buffer is moved to the begining of memory, unless area just after it is reserved right now */
+            else if((0 == buf->reserved_size) || (buf->reserved_start != buf->region_a_end))
             {
-               tree.elem_type.vector.vector_num_elems = 1;
+               buf->region_a_start  = 0;
+               buf->region_a_end    = 0;
             }
-            vector[0].size                            = buf->size - read_start;
          }
-         else
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         extension = buf->ring.protected_extension;
+
+         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
          {
-            tree.elem_type.vector.vector_num_elems    = 1;
-            vector[0].size                            = buf->first_free - read_start;
-         }
-         vector[0].data                               = &((const uint8_t*)(buf->memory))[read_start];
+            on_read = extension->on_read;
 
-         count = Buff_Copy_Tree_To_Tree(
-            data,
-            data_num_elems,
-            &tree,
-            1,
-            count,
-            offset_data,
-            0,
-            BUFF_MAKE_INVALID_PTR(Buff_Size_DT),
-            BUFF_MAKE_INVALID_PTR(Buff_Bool_DT));
+            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
+            {
+               on_read(&buf->ring, extension, size, rewind_occured);
+            }
+         }
+#endif
       }
 
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         BUFF_PROTECTION_UNLOCK(buf);
+         BUFF_PROTECTION_UNLOCK(&buf->ring);
       }
 #endif
-   }
 
-   BUFF_DEBUG_RING(buf);
-   BUFF_EXIT_FUNC();
-
-   return count;
-} /* Buff_Ring_Peak_To_Tree */
-#endif
+#if(BUFF_RING_USE_EXTENSIONS)
+      extension = buf->ring.extension;
 
+      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(result))
+      {
+         on_read = extension->on_read;
 
+         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
+         {
+            on_read(&buf->ring, extension, size, rewind_occured);
+         }
+      }
+#endif
 
-#if( (!defined(RING_BUF_READ_EXTERNAL)) && BUFF_RING_READ_ENABLED )
-Buff_Size_DT Buff_Ring_Read(
-   Buff_Ring_XT  *buf,
-   void          *data,
-   Buff_Size_DT   size,
-   Buff_Bool_DT   use_protection)
-{
-#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VENDOR_BUFFERS)
+      BUFF_DEBUG_RING(&buf->ring);
+   }
 
-   return Buff_Ring_Read_Vendor(buf, data, size, buff_vendor_memcpy, use_protection);
+   BUFF_EXIT_FUNC();
 
-#elif(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+   return result;
+} /* Buff_Bip_Decommit */
+#endif
 
-   Buff_Writeable_Tree_XT tree;
-   Buff_Writeable_Vector_XT vector;
+#endif /* #if(BUFF_USE_BIP_BUFFERS && BUFF_USE_RING_BUFFERS) */
 
-   tree.is_branch = BUFF_FALSE;
-   tree.elem_type.vector.vector           = &vector;
-   tree.elem_type.vector.vector_num_elems = 1;
 
-   vector.data = data;
-   vector.size = size;
 
-   return Buff_Ring_Read_To_Tree(
-      buf, &tree, 1, size, 0, use_protection);
+#if(BUFF_USE_POOL_BUFFERS && BUFF_USE_RING_BUFFERS)
 
-#elif(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_VECTOR_BUFFERS)
+#if( (!defined(BUFF_POOL_INIT_EXTERNAL)) && BUFF_POOL_INIT_ENABLED && BUFF_RING_INIT_ENABLED )
+Buff_Bool_DT Buff_Pool_Init(Buff_Pool_XT *buf, void *memory, Buff_Size_DT slot_size, Buff_Size_DT num_slots)
+{
+   Buff_Bool_DT result = BUFF_FALSE;
 
-   Buff_Writeable_Vector_XT vector;
+   BUFF_ENTER_FUNC();
 
-   vector.data = data;
-   vector.size = size;
+   /* memory size must not overflow Buff_Size_DT */
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Pool_XT, buf) && (slot_size > 0) && (num_slots > 0)
+      && (num_slots <= (((Buff_Size_DT)(-1)) / slot_size))))
+   {
+      buf->slot_size       = slot_size;
+      buf->num_slots       = num_slots;
+      buf->num_busy_slots  = 0;
+      buf->first_busy      = 0;
+      buf->first_free      = 0;
+      buf->slot_acquired   = BUFF_FALSE;
 
-   return Buff_Ring_Read_To_Vector(
-      buf, &vector, 1, size, 0, use_protection);
+      /* memory, protection and extensions are kept by ring buffer */
+      result = Buff_Ring_Init(&buf->ring, memory, slot_size * num_slots);
+   }
 
-#else
+   BUFF_EXIT_FUNC();
 
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Ring_Extensions_XT *extension;
-   Buff_Ring_Extension_On_Read on_read;
-#endif
-   Buff_Size_DT part_size;
-   Buff_Size_DT count = 0;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Bool_DT rewind_occured = BUFF_FALSE;
-#if(BUFF_RING_USE_EXTENSIONS)
-   Buff_Bool_DT data_changed = BUFF_FALSE;
-#endif
+   return result;
+} /* Buff_Pool_Init */
 #endif
 
-#if(!BUFF_RING_USE_PROTECTION)
-   BUFF_UNUSED_PARAM(use_protection);
-#endif
 
+
+#if( (!defined(BUFF_POOL_DEINIT_EXTERNAL)) && BUFF_POOL_DEINIT_ENABLED && BUFF_RING_DEINIT_ENABLED )
+void   Buff_Pool_Deinit(Buff_Pool_XT *buf)
+{
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Pool_XT, buf)))
    {
 #if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_LOCK(buf);
-      }
+      BUFF_PROTECTION_LOCK(&buf->ring);
 #endif
 
-      count = buf->busy_size;
-
-      if(BUFF_LIKELY(size <= buf->busy_size))
-      {
-         count = size;
-      }
-
-      if(BUFF_LIKELY(count > 0))
-      {
-#if(BUFF_RING_USE_EXTENSIONS)
-         data_changed = BUFF_TRUE;
-#endif
-         if(BUFF_LIKELY(buf->first_busy <= (buf->size - count)))
-         {
-            memcpy(data, &((const uint8_t*)(buf->memory))[buf->first_busy], count);
+      buf->slot_size       = 0;
+      buf->num_slots       = 0;
+      buf->num_busy_slots  = 0;
+      buf->first_busy      = 0;
+      buf->first_free      = 0;
+      buf->slot_acquired   = BUFF_FALSE;
 
-            buf->busy_size      -= count;
-            buf->first_busy     += count;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            rewind_occured       = BUFF_FALSE;
+#if(BUFF_RING_USE_PROTECTION)
+      BUFF_PROTECTION_UNLOCK(&buf->ring);
 #endif
 
-            if(BUFF_UNLIKELY(buf->first_busy >= buf->size))
-            {
-               buf->first_busy   = 0;
-#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
-               buf->size         = buf->original_size;
-#endif
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-               rewind_occured    = BUFF_TRUE;
-#endif
-            }
-         }
-         else
-         {
-            part_size            = buf->size - buf->first_busy;
-            memcpy(data, &((const uint8_t*)(buf->memory))[buf->first_busy], part_size);
-            data                 = &((uint8_t*)data)[part_size];
-            part_size            = count - part_size;
-            memcpy(data, buf->memory, part_size);
+      Buff_Ring_Deinit(&buf->ring);
+   }
 
-            buf->busy_size      -= count;
-            buf->first_busy      = part_size;
-#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
-            buf->size            = buf->original_size;
-#endif
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            rewind_occured       = BUFF_TRUE;
+   BUFF_EXIT_FUNC();
+} /* Buff_Pool_Deinit */
 #endif
-         }
 
-         if(BUFF_UNLIKELY(0 == buf->busy_size))
-         {
-            buf->first_busy = 0;
-            buf->first_free = 0;
-         }
 
-#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
-         extension = buf->protected_extension;
 
-         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
-         {
-            on_read = extension->on_read;
+#if( (!defined(BUFF_POOL_GET_BUSY_SLOTS_EXTERNAL)) && BUFF_POOL_GET_BUSY_SLOTS_ENABLED )
+Buff_Size_DT Buff_Pool_Get_Busy_Slots(Buff_Pool_XT *buf, Buff_Bool_DT use_protection)
+{
+   Buff_Size_DT result = 0;
 
-            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
-            {
-               on_read(buf, extension, count, rewind_occured);
-            }
-         }
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
 #endif
-      }
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Pool_XT, buf)))
+   {
+      BUFF_DEBUG_RING(&buf->ring);
 
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         BUFF_PROTECTION_UNLOCK(buf);
+         BUFF_PROTECTION_LOCK(&buf->ring);
       }
 #endif
 
-#if(BUFF_RING_USE_EXTENSIONS)
-      extension = buf->extension;
+      result = buf->num_busy_slots;
 
-      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         on_read = extension->on_read;
-
-         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
-         {
-            on_read(buf, extension, count, rewind_occured);
-         }
+         BUFF_PROTECTION_UNLOCK(&buf->ring);
       }
 #endif
+
+      BUFF_DEBUG_RING(&buf->ring);
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
-   return count;
-
-#endif
-} /* Buff_Ring_Read */
+   return result;
+} /* Buff_Pool_Get_Busy_Slots */
 #endif
 
 
 
-#if( (!defined(BUFF_RING_READ_VENDOR_EXTERNAL)) && BUFF_RING_READ_VENDOR_ENABLED && BUFF_USE_VENDOR_BUFFERS )
-Buff_Size_DT Buff_Ring_Read_Vendor(
-   Buff_Ring_XT           *buf,
-   void                   *data,
-   Buff_Size_DT            size,
-   Buff_Vendor_Memcpy_HT   vendor_cpy,
-   Buff_Bool_DT            use_protection)
+#if( (!defined(BUFF_POOL_GET_FREE_SLOTS_EXTERNAL)) && BUFF_POOL_GET_FREE_SLOTS_ENABLED )
+Buff_Size_DT Buff_Pool_Get_Free_Slots(Buff_Pool_XT *buf, Buff_Bool_DT use_protection)
 {
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Ring_Extensions_XT *extension;
-   Buff_Ring_Extension_On_Read on_read;
-#endif
-   Buff_Memcpy_Params_XT params;
-   Buff_Size_DT part_size;
-   Buff_Size_DT count = 0;
-   Buff_Size_DT ret_count;
-   Buff_Size_DT ret_count2;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Bool_DT rewind_occured = BUFF_FALSE;
-#if(BUFF_RING_USE_EXTENSIONS)
-   Buff_Bool_DT data_changed = BUFF_FALSE;
-#endif
-#endif
+   Buff_Size_DT result = 0;
 
 #if(!BUFF_RING_USE_PROTECTION)
    BUFF_UNUSED_PARAM(use_protection);
 #endif
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(void, data)
-      && BUFF_CHECK_HANDLER(Buff_Vendor_Memcpy_HT, vendor_cpy)
-      && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Pool_XT, buf)))
    {
+      BUFF_DEBUG_RING(&buf->ring);
+
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         BUFF_PROTECTION_LOCK(buf);
+         BUFF_PROTECTION_LOCK(&buf->ring);
       }
 #endif
 
-      count = buf->busy_size;
+      result = buf->num_slots - buf->num_busy_slots;
 
-      if(BUFF_LIKELY(size <= buf->busy_size))
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         count = size;
+         BUFF_PROTECTION_UNLOCK(&buf->ring);
       }
+#endif
 
-      if(BUFF_LIKELY(count > 0))
-      {
-#if(BUFF_RING_USE_EXTENSIONS)
-         data_changed = BUFF_TRUE;
+      BUFF_DEBUG_RING(&buf->ring);
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Pool_Get_Free_Slots */
 #endif
-         params.dest             = data;
-         params.src              = buf->memory;
-         params.dest_offset      = 0;
-         params.src_offset       = buf->first_busy;
 
-         if(BUFF_LIKELY(buf->first_busy <= (buf->size - count)))
-         {
-            params.size          = count;
-            params.is_last_part  = BUFF_TRUE;
 
-            ret_count = vendor_cpy(&params);
 
-            /* vendor_cpy might copy less data than requested - depends on vendor_cpy - in this case reduce count */
-            if(BUFF_LIKELY(ret_count <= count))
-            {
-               count = ret_count;
-            }
+#if( ((!defined(BUFF_POOL_COMMIT_EXTERNAL)) && BUFF_POOL_COMMIT_ENABLED) || ((!defined(BUFF_POOL_WRITE_EXTERNAL)) && BUFF_POOL_WRITE_ENABLED) )
+/**
+ * Adds slot at position first_free to the queue; called with pool locked.
+ * Returns BUFF_TRUE if first_free has been rewound to the begining of memory.
+ */
+static Buff_Bool_DT buff_pool_push(Buff_Pool_XT *buf)
+{
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
 
-            buf->busy_size      -= count;
-            buf->first_busy     += count;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            rewind_occured       = BUFF_FALSE;
-#endif
+   /* slots never cross the end of memory - position is only moved by slot size */
+   buf->first_free += buf->slot_size;
 
-            if(BUFF_UNLIKELY(buf->first_busy >= buf->size))
-            {
-               buf->first_busy   = 0;
-#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
-               buf->size         = buf->original_size;
-#endif
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-               rewind_occured    = BUFF_TRUE;
+   if(buf->first_free >= buf->ring.size)
+   {
+      buf->first_free = 0;
+      rewind_occured  = BUFF_TRUE;
+   }
+
+   buf->num_busy_slots++;
+   buf->slot_acquired = BUFF_FALSE;
+
+#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
+   if((buf->num_busy_slots * buf->slot_size) > buf->ring.max_busy_size)
+   {
+      buf->ring.max_busy_size = buf->num_busy_slots * buf->slot_size;
+   }
 #endif
-            }
-         }
-         else
-         {
-            part_size            = buf->size - buf->first_busy;
 
-            params.size          = part_size;
-            params.is_last_part  = BUFF_FALSE;
+   return rewind_occured;
+} /* buff_pool_push */
+
 
-            ret_count = vendor_cpy(&params);
 
-            /* if vendor_cpy copied less data than requested then don't process second buff part */
-            if(ret_count < part_size)
-            {
-               count                = ret_count;
-               buf->busy_size      -= count;
-               buf->first_busy     += count;
 #if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-               rewind_occured       = BUFF_FALSE;
+static void buff_pool_on_write(Buff_Pool_XT *buf, Buff_Ring_Extensions_XT *extension, Buff_Bool_DT rewind_occured)
+{
+   Buff_Ring_Extension_On_Write on_write;
+
+   if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+   {
+      on_write = extension->on_write;
+
+      if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
+      {
+         on_write(&buf->ring, extension, buf->slot_size, rewind_occured);
+      }
+   }
+} /* buff_pool_on_write */
+#endif
 #endif
-            }
-            else
-            {
-               ret_count            = part_size;
-               params.dest          = data;
-               params.src           = buf->memory;
-               params.dest_offset   = part_size;
-               params.src_offset    = 0;
-               part_size            = count - part_size;
-               params.size          = part_size;
-               params.is_last_part  = BUFF_TRUE;
 
-               buf->busy_size      -= ret_count;
-               buf->first_busy      = 0;
 
-               ret_count2 = vendor_cpy(&params);
 
-               /* vendor_cpy might copy in second step less data than requested - in this case reduce count and part_size */
-               if(BUFF_LIKELY(ret_count2 <= part_size))
-               {
-                  count     = ret_count + ret_count2;
-                  part_size = ret_count2;
-               }
+#if( ((!defined(BUFF_POOL_RELEASE_EXTERNAL)) && BUFF_POOL_RELEASE_ENABLED) || ((!defined(BUFF_POOL_READ_EXTERNAL)) && BUFF_POOL_READ_ENABLED) )
+/**
+ * Removes slot at position first_busy from the queue; called with pool locked.
+ * Returns BUFF_TRUE if first_busy has been rewound to the begining of memory.
+ */
+static Buff_Bool_DT buff_pool_pop(Buff_Pool_XT *buf)
+{
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+
+   buf->first_busy += buf->slot_size;
+
+   if(buf->first_busy >= buf->ring.size)
+   {
+      buf->first_busy = 0;
+      rewind_occured  = BUFF_TRUE;
+   }
+
+   buf->num_busy_slots--;
+
+   return rewind_occured;
+} /* buff_pool_pop */
+
+
 
-               buf->busy_size      -= part_size;
-               buf->first_busy      = part_size;
-#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
-               buf->size            = buf->original_size;
-#endif
 #if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-               rewind_occured       = BUFF_TRUE;
+static void buff_pool_on_read(Buff_Pool_XT *buf, Buff_Ring_Extensions_XT *extension, Buff_Bool_DT rewind_occured)
+{
+   Buff_Ring_Extension_On_Read on_read;
+
+   if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+   {
+      on_read = extension->on_read;
+
+      if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
+      {
+         on_read(&buf->ring, extension, buf->slot_size, rewind_occured);
+      }
+   }
+} /* buff_pool_on_read */
+#endif
 #endif
-            }
-         }
 
-         if(BUFF_UNLIKELY(0 == buf->busy_size))
-         {
-            buf->first_busy = 0;
-            buf->first_free = 0;
-         }
 
-#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
-         extension = buf->protected_extension;
 
-         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
-         {
-            on_read = extension->on_read;
+#if( (!defined(BUFF_POOL_ACQUIRE_EXTERNAL)) && BUFF_POOL_ACQUIRE_ENABLED )
+void *Buff_Pool_Acquire(Buff_Pool_XT *buf, Buff_Bool_DT use_protection)
+{
+   void *result = BUFF_MAKE_INVALID_PTR(void);
 
-            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
-            {
-               on_read(buf, extension, count, rewind_occured);
-            }
-         }
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
 #endif
-      }
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Pool_XT, buf)))
+   {
+      BUFF_DEBUG_RING(&buf->ring);
 
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         BUFF_PROTECTION_UNLOCK(buf);
+         BUFF_PROTECTION_LOCK(&buf->ring);
       }
 #endif
 
-#if(BUFF_RING_USE_EXTENSIONS)
-      extension = buf->extension;
-
-      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+      if(BUFF_LIKELY(buf->num_busy_slots < buf->num_slots))
       {
-         on_read = extension->on_read;
+         buf->slot_acquired = BUFF_TRUE;
 
-         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
-         {
-            on_read(buf, extension, count, rewind_occured);
-         }
+         result = &((uint8_t*)(buf->ring.memory))[buf->first_free];
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(&buf->ring);
       }
 #endif
+
+      BUFF_DEBUG_RING(&buf->ring);
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
-   return count;
-} /* Buff_Ring_Read_Vendor */
+   return result;
+} /* Buff_Pool_Acquire */
 #endif
 
 
 
-#if( (!defined(BUFF_RING_READ_TO_VECTOR_EXTERNAL)) && BUFF_RING_READ_TO_VECTOR_ENABLED && BUFF_USE_VECTOR_BUFFERS )
-Buff_Size_DT Buff_Ring_Read_To_Vector(
-   Buff_Ring_XT                    *buf,
-   const Buff_Writeable_Vector_XT  *data,
-   Buff_Num_Elems_DT                data_num_elems,
-   Buff_Size_DT                     size,
-   Buff_Size_DT                     offset_data,
-   Buff_Bool_DT                     use_protection)
+#if( (!defined(BUFF_POOL_COMMIT_EXTERNAL)) && BUFF_POOL_COMMIT_ENABLED )
+Buff_Bool_DT Buff_Pool_Commit(Buff_Pool_XT *buf, Buff_Bool_DT use_protection)
 {
-#if(BUFF_SAVE_PROGRAM_MEMORY && BUFF_USE_TREE_BUFFERS)
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
+#endif
+   Buff_Bool_DT result = BUFF_FALSE;
 
-   Buff_Writeable_Tree_XT tree;
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
+#endif
 
-   tree.is_branch = BUFF_FALSE;
-   tree.elem_type.vector.vector           = data;
-   tree.elem_type.vector.vector_num_elems = data_num_elems;
+   BUFF_ENTER_FUNC();
 
-   return Buff_Ring_Read_To_Tree(buf, &tree, 1, size, offset_data, use_protection);
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Pool_XT, buf)))
+   {
+      BUFF_DEBUG_RING(&buf->ring);
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(&buf->ring);
+      }
+#endif
 
+      if(BUFF_LIKELY(BUFF_BOOL_IS_TRUE(buf->slot_acquired)))
+      {
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         rewind_occured = buff_pool_push(buf);
 #else
+         (void)buff_pool_push(buf);
+#endif
+         result         = BUFF_TRUE;
 
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Ring_Extensions_XT *extension;
-   Buff_Ring_Extension_On_Read on_read;
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         buff_pool_on_write(buf, buf->ring.protected_extension, rewind_occured);
 #endif
-   Buff_Readable_Vector_XT vector[2];
-   Buff_Size_DT      count = 0;
-   Buff_Num_Elems_DT vector_num_elems;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Bool_DT      rewind_occured = BUFF_FALSE;
+      }
+
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_UNLOCK(&buf->ring);
+      }
+#endif
+
 #if(BUFF_RING_USE_EXTENSIONS)
-   Buff_Bool_DT      data_changed = BUFF_FALSE;
+      if(BUFF_BOOL_IS_TRUE(result))
+      {
+         buff_pool_on_write(buf, buf->ring.extension, rewind_occured);
+      }
 #endif
+
+      BUFF_DEBUG_RING(&buf->ring);
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Pool_Commit */
 #endif
 
+
+
+#if( (!defined(BUFF_POOL_PEAK_EXTERNAL)) && BUFF_POOL_PEAK_ENABLED )
+void *Buff_Pool_Peak(Buff_Pool_XT *buf, Buff_Bool_DT use_protection)
+{
+   void *result = BUFF_MAKE_INVALID_PTR(void);
+
 #if(!BUFF_RING_USE_PROTECTION)
    BUFF_UNUSED_PARAM(use_protection);
 #endif
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Writeable_Vector_XT, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Pool_XT, buf)))
    {
+      BUFF_DEBUG_RING(&buf->ring);
+
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         BUFF_PROTECTION_LOCK(buf);
+         BUFF_PROTECTION_LOCK(&buf->ring);
       }
 #endif
 
-      count = buf->busy_size;
-
-      if(BUFF_LIKELY(size <= buf->busy_size))
+      if(BUFF_LIKELY(buf->num_busy_slots > 0))
       {
-         count = size;
+         result = &((uint8_t*)(buf->ring.memory))[buf->first_busy];
       }
 
-      if(BUFF_LIKELY(count > 0))
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-#if(BUFF_RING_USE_EXTENSIONS)
-         data_changed = BUFF_TRUE;
+         BUFF_PROTECTION_UNLOCK(&buf->ring);
+      }
 #endif
-         if(buf->first_busy >= buf->first_free)
-         {
-            if(BUFF_LIKELY(buf->first_free > 0))
-            {
-               vector[1].data    = buf->memory;
-               vector[1].size    = buf->first_free;
-               vector_num_elems  = 2;
-            }
-            else
-            {
-               vector_num_elems  = 1;
-            }
-            vector[0].size       = buf->size - buf->first_busy;
-         }
-         else
-         {
-            vector_num_elems     = 1;
-            vector[0].size       = buf->first_free - buf->first_busy;
-         }
-         vector[0].data          = &((const uint8_t*)(buf->memory))[buf->first_busy];
 
-         count = Buff_Copy_Vector_To_Vector(data, data_num_elems, vector, vector_num_elems, count, offset_data, 0);
+      BUFF_DEBUG_RING(&buf->ring);
+   }
 
-         if(BUFF_LIKELY(buf->first_busy <= (buf->size - count)))
-         {
-            buf->busy_size      -= count;
-            buf->first_busy     += count;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            rewind_occured       = BUFF_FALSE;
-#endif
+   BUFF_EXIT_FUNC();
 
-            if(BUFF_UNLIKELY(buf->first_busy >= buf->size))
-            {
-               buf->first_busy   = 0;
-#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
-               buf->size         = buf->original_size;
+   return result;
+} /* Buff_Pool_Peak */
 #endif
+
+
+
+#if( (!defined(BUFF_POOL_RELEASE_EXTERNAL)) && BUFF_POOL_RELEASE_ENABLED )
+Buff_Bool_DT Buff_Pool_Release(Buff_Pool_XT *buf, Buff_Bool_DT use_protection)
+{
 #if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-               rewind_occured    = BUFF_TRUE;
-#endif
-            }
-         }
-         else
-         {
-            buf->busy_size      -= count;
-            buf->first_busy      = buf->first_busy + count - buf->size;
-#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
-            buf->size            = buf->original_size;
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
 #endif
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            rewind_occured       = BUFF_TRUE;
+   Buff_Bool_DT result = BUFF_FALSE;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
 #endif
-         }
 
-         if(BUFF_UNLIKELY(0 == buf->busy_size))
-         {
-            buf->first_busy = 0;
-            buf->first_free = 0;
-         }
+   BUFF_ENTER_FUNC();
 
-#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
-         extension = buf->protected_extension;
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Pool_XT, buf)))
+   {
+      BUFF_DEBUG_RING(&buf->ring);
 
-         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
-         {
-            on_read = extension->on_read;
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(&buf->ring);
+      }
+#endif
 
-            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
-            {
-               on_read(buf, extension, count, rewind_occured);
-            }
-         }
+      if(BUFF_LIKELY(buf->num_busy_slots > 0))
+      {
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         rewind_occured = buff_pool_pop(buf);
+#else
+         (void)buff_pool_pop(buf);
+#endif
+         result         = BUFF_TRUE;
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         buff_pool_on_read(buf, buf->ring.protected_extension, rewind_occured);
 #endif
       }
 
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         BUFF_PROTECTION_UNLOCK(buf);
+         BUFF_PROTECTION_UNLOCK(&buf->ring);
       }
 #endif
 
 #if(BUFF_RING_USE_EXTENSIONS)
-      extension = buf->extension;
-
-      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+      if(BUFF_BOOL_IS_TRUE(result))
       {
-         on_read = extension->on_read;
-
-         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
-         {
-            on_read(buf, extension, count, rewind_occured);
-         }
+         buff_pool_on_read(buf, buf->ring.extension, rewind_occured);
       }
 #endif
+
+      BUFF_DEBUG_RING(&buf->ring);
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
-   return count;
-
-#endif
-} /* Buff_Ring_Read_To_Vector */
+   return result;
+} /* Buff_Pool_Release */
 #endif
 
 
 
-#if( (!defined(BUFF_RING_READ_TO_TREE_EXTERNAL)) && BUFF_RING_READ_TO_TREE_ENABLED && BUFF_USE_TREE_BUFFERS )
-Buff_Size_DT Buff_Ring_Read_To_Tree(
-   Buff_Ring_XT                 *buf,
-   const Buff_Writeable_Tree_XT *data,
-   Buff_Num_Elems_DT             data_num_elems,
-   Buff_Size_DT                  size,
-   Buff_Size_DT                  offset_data,
-   Buff_Bool_DT                  use_protection)
+#if( (!defined(BUFF_POOL_WRITE_EXTERNAL)) && BUFF_POOL_WRITE_ENABLED )
+Buff_Bool_DT Buff_Pool_Write(Buff_Pool_XT *buf, const void *data, Buff_Bool_DT use_protection)
 {
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Ring_Extensions_XT *extension;
-   Buff_Ring_Extension_On_Read on_read;
-#endif
-   Buff_Readable_Vector_XT vector[2];
-   Buff_Readable_Tree_XT tree;
-   Buff_Size_DT count = 0;
 #if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
    Buff_Bool_DT rewind_occured = BUFF_FALSE;
-#if(BUFF_RING_USE_EXTENSIONS)
-   Buff_Bool_DT data_changed = BUFF_FALSE;
-#endif
 #endif
+   Buff_Bool_DT result = BUFF_FALSE;
 
 #if(!BUFF_RING_USE_PROTECTION)
    BUFF_UNUSED_PARAM(use_protection);
 #endif
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Writeable_Tree_XT, data) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Pool_XT, buf) && BUFF_CHECK_PTR(const void, data)))
    {
+      BUFF_DEBUG_RING(&buf->ring);
+
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         BUFF_PROTECTION_LOCK(buf);
+         BUFF_PROTECTION_LOCK(&buf->ring);
       }
 #endif
 
-      count = buf->busy_size;
-
-      if(BUFF_LIKELY(size <= buf->busy_size))
+      /* slot acquired by Buff_Pool_Acquire is being filled by the user - it must not be overwritten */
+      if(BUFF_LIKELY(BUFF_BOOL_IS_FALSE(buf->slot_acquired) && (buf->num_busy_slots < buf->num_slots)))
       {
-         count = size;
+         /* whole slot is always continous - single copy of known size */
+         BUFF_MEMCPY(&((uint8_t*)(buf->ring.memory))[buf->first_free], data, buf->slot_size);
+
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         rewind_occured = buff_pool_push(buf);
+#else
+         (void)buff_pool_push(buf);
+#endif
+         result         = BUFF_TRUE;
+
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         buff_pool_on_write(buf, buf->ring.protected_extension, rewind_occured);
+#endif
       }
 
-      if(BUFF_LIKELY(count > 0))
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
       {
+         BUFF_PROTECTION_UNLOCK(&buf->ring);
+      }
+#endif
+
 #if(BUFF_RING_USE_EXTENSIONS)
-         data_changed = BUFF_TRUE;
+      if(BUFF_BOOL_IS_TRUE(result))
+      {
+         buff_pool_on_write(buf, buf->ring.extension, rewind_occured);
+      }
 #endif
-         tree.elem_type.vector.vector  = vector;
-         tree.is_branch = BUFF_FALSE;
 
-         if(buf->first_busy >= buf->first_free)
-         {
-            if(BUFF_LIKELY(buf->first_free > 0))
-            {
-               vector[1].data                         = buf->memory;
-               vector[1].size                         = buf->first_free;
-               tree.elem_type.vector.vector_num_elems = 2;
-            }
-            else
-            {
-               tree.elem_type.vector.vector_num_elems = 1;
-            }
-            vector[0].size                            = buf->size - buf->first_busy;
-         }
-         else
-         {
-            tree.elem_type.vector.vector_num_elems    = 1;
-            vector[0].size                            = buf->first_free - buf->first_busy;
-         }
-         vector[0].data                               = &((const uint8_t*)(buf->memory))[buf->first_busy];
+      BUFF_DEBUG_RING(&buf->ring);
+   }
 
-         count = Buff_Copy_Tree_To_Tree(
-            data,
-            data_num_elems,
-            &tree,
-            1,
-            count,
-            offset_data,
-            0,
-            BUFF_MAKE_INVALID_PTR(Buff_Size_DT),
-            BUFF_MAKE_INVALID_PTR(Buff_Bool_DT));
+   BUFF_EXIT_FUNC();
 
-         if(BUFF_LIKELY(buf->first_busy <= (buf->size - count)))
-         {
-            buf->busy_size      -= count;
-            buf->first_busy     += count;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            rewind_occured       = BUFF_FALSE;
+   return result;
+} /* Buff_Pool_Write */
 #endif
 
-            if(BUFF_UNLIKELY(buf->first_busy >= buf->size))
-            {
-               buf->first_busy   = 0;
-#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
-               buf->size         = buf->original_size;
-#endif
+
+
+#if( (!defined(BUFF_POOL_READ_EXTERNAL)) && BUFF_POOL_READ_ENABLED )
+Buff_Bool_DT Buff_Pool_Read(Buff_Pool_XT *buf, void *data, Buff_Bool_DT use_protection)
+{
 #if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-               rewind_occured    = BUFF_TRUE;
-#endif
-            }
-         }
-         else
-         {
-            buf->busy_size      -= count;
-            buf->first_busy      = buf->first_busy + count - buf->size;
-#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
-            buf->size            = buf->original_size;
+   Buff_Bool_DT rewind_occured = BUFF_FALSE;
 #endif
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            rewind_occured       = BUFF_TRUE;
+   Buff_Bool_DT result = BUFF_FALSE;
+
+#if(!BUFF_RING_USE_PROTECTION)
+   BUFF_UNUSED_PARAM(use_protection);
 #endif
-         }
 
-         if(BUFF_UNLIKELY(0 == buf->busy_size))
-         {
-            buf->first_busy = 0;
-            buf->first_free = 0;
-         }
+   BUFF_ENTER_FUNC();
 
-#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
-         extension = buf->protected_extension;
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Pool_XT, buf) && BUFF_CHECK_PTR(void, data)))
+   {
+      BUFF_DEBUG_RING(&buf->ring);
 
-         if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
-         {
-            on_read = extension->on_read;
+#if(BUFF_RING_USE_PROTECTION)
+      if(BUFF_BOOL_IS_TRUE(use_protection))
+      {
+         BUFF_PROTECTION_LOCK(&buf->ring);
+      }
+#endif
+
+      if(BUFF_LIKELY(buf->num_busy_slots > 0))
+      {
+         BUFF_MEMCPY(data, &((const uint8_t*)(buf->ring.memory))[buf->first_busy], buf->slot_size);
+
+#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         rewind_occured = buff_pool_pop(buf);
+#else
+         (void)buff_pool_pop(buf);
+#endif
+         result         = BUFF_TRUE;
 
-            if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
-            {
-               on_read(buf, extension, count, rewind_occured);
-            }
-         }
+#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
+         buff_pool_on_read(buf, buf->ring.protected_extension, rewind_occured);
 #endif
       }
 
 #if(BUFF_RING_USE_PROTECTION)
       if(BUFF_BOOL_IS_TRUE(use_protection))
       {
-         BUFF_PROTECTION_UNLOCK(buf);
+         BUFF_PROTECTION_UNLOCK(&buf->ring);
       }
 #endif
 
 #if(BUFF_RING_USE_EXTENSIONS)
-      extension = buf->extension;
-
-      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
+      if(BUFF_BOOL_IS_TRUE(result))
       {
-         on_read = extension->on_read;
-
-         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Read, on_read))
-         {
-            on_read(buf, extension, count, rewind_occured);
-         }
+         buff_pool_on_read(buf, buf->ring.extension, rewind_occured);
       }
 #endif
+
+      BUFF_DEBUG_RING(&buf->ring);
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
-   return count;
-} /* Buff_Ring_Read_To_Tree */
+   return result;
+} /* Buff_Pool_Read */
 #endif
 
+#endif /* #if(BUFF_USE_POOL_BUFFERS && BUFF_USE_RING_BUFFERS) */
 
 
-#if( (!defined(BUFF_RING_TO_RING_COPY_EXTERNAL)) && BUFF_RING_TO_RING_COPY_ENABLED )
-Buff_Size_DT Buff_Ring_To_Ring_Copy(
-   Buff_Ring_XT                 *dest,
-   Buff_Ring_XT                 *src,
-   Buff_Size_DT                  size,
-   Buff_Size_DT                  src_offset,
-   Buff_Bool_DT                  overwrite_if_no_free_space,
-   Buff_Bool_DT                  use_protection)
+
+#if(BUFF_USE_CHAIN_BUFFERS)
+
+#if( ((!defined(BUFF_CHAIN_INIT_EXTERNAL)) && BUFF_CHAIN_INIT_ENABLED) || ((!defined(BUFF_CHAIN_ADD_CHUNKS_EXTERNAL)) && BUFF_CHAIN_ADD_CHUNKS_ENABLED) )
+/**
+ * Assigns memory to chunks descriptors and puts them to free list.
+ */
+static void buff_chain_add_chunks(Buff_Chain_XT *buf, Buff_Chain_Chunk_XT *chunks, void *memory, Buff_Size_DT num_chunks)
 {
-   uint8_t *data_to;
-   const uint8_t *data_from;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Ring_Extensions_XT *extension;
-   Buff_Ring_Extension_On_Write on_write;
+   Buff_Size_DT cntr;
+
+   for(cntr = 0; cntr < num_chunks; cntr++)
+   {
+      chunks[cntr].memory  = &((uint8_t*)memory)[cntr * buf->chunk_size];
+      chunks[cntr].next    = buf->free_chunks;
+      buf->free_chunks     = &chunks[cntr];
+   }
+
+   buf->num_free_chunks += num_chunks;
+} /* buff_chain_add_chunks */
 #endif
-   Buff_Size_DT read_start;
-   Buff_Size_DT part_size_src;
-   Buff_Size_DT part_size_dest;
-   Buff_Size_DT size_to_copy = 0;
-   Buff_Size_DT size_to_read = 0;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Bool_DT rewind_occured = BUFF_FALSE;
-#if(BUFF_RING_USE_EXTENSIONS)
-   Buff_Bool_DT data_changed = BUFF_FALSE;
+
+
+
+#if( (!defined(BUFF_CHAIN_INIT_EXTERNAL)) && BUFF_CHAIN_INIT_ENABLED )
+Buff_Bool_DT Buff_Chain_Init(
+   Buff_Chain_XT          *buf,
+   Buff_Chain_Chunk_XT    *chunks,
+   void                   *memory,
+   Buff_Size_DT            chunk_size,
+   Buff_Size_DT            num_chunks)
+{
+   Buff_Bool_DT result = BUFF_FALSE;
+
+   BUFF_ENTER_FUNC();
+
+   /* memory size must not overflow Buff_Size_DT */
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Chain_XT, buf) && (chunk_size > 0)
+      && ((0 == num_chunks) || (BUFF_CHECK_PTR(Buff_Chain_Chunk_XT, chunks) && BUFF_CHECK_PTR(void, memory)
+         && (num_chunks <= (((Buff_Size_DT)(-1)) / chunk_size))))))
+   {
+      buf->first           = BUFF_MAKE_INVALID_PTR(Buff_Chain_Chunk_XT);
+      buf->last            = BUFF_MAKE_INVALID_PTR(Buff_Chain_Chunk_XT);
+      buf->free_chunks     = BUFF_MAKE_INVALID_PTR(Buff_Chain_Chunk_XT);
+      buf->chunk_size      = chunk_size;
+      buf->num_free_chunks = 0;
+      buf->busy_size       = 0;
+      buf->first_busy      = 0;
+      buf->first_free      = 0;
+
+      buff_chain_add_chunks(buf, chunks, memory, num_chunks);
+
+      result = BUFF_TRUE;
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Chain_Init */
 #endif
+
+
+
+#if( (!defined(BUFF_CHAIN_DEINIT_EXTERNAL)) && BUFF_CHAIN_DEINIT_ENABLED )
+void   Buff_Chain_Deinit(Buff_Chain_XT *buf)
+{
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Chain_XT, buf)))
+   {
+      buf->first           = BUFF_MAKE_INVALID_PTR(Buff_Chain_Chunk_XT);
+      buf->last            = BUFF_MAKE_INVALID_PTR(Buff_Chain_Chunk_XT);
+      buf->free_chunks     = BUFF_MAKE_INVALID_PTR(Buff_Chain_Chunk_XT);
+      buf->chunk_size      = 0;
+      buf->num_free_chunks = 0;
+      buf->busy_size       = 0;
+      buf->first_busy      = 0;
+      buf->first_free      = 0;
+   }
+
+   BUFF_EXIT_FUNC();
+} /* Buff_Chain_Deinit */
 #endif
 
-#if(!BUFF_RING_USE_PROTECTION)
-   BUFF_UNUSED_PARAM(use_protection);
+
+
+#if( (!defined(BUFF_CHAIN_ADD_CHUNKS_EXTERNAL)) && BUFF_CHAIN_ADD_CHUNKS_ENABLED )
+Buff_Bool_DT Buff_Chain_Add_Chunks(Buff_Chain_XT *buf, Buff_Chain_Chunk_XT *chunks, void *memory, Buff_Size_DT num_chunks)
+{
+   Buff_Bool_DT result = BUFF_FALSE;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Chain_XT, buf) && BUFF_CHECK_PTR(Buff_Chain_Chunk_XT, chunks) && BUFF_CHECK_PTR(void, memory)
+      && (buf->chunk_size > 0) && (num_chunks > 0) && (num_chunks <= (((Buff_Size_DT)(-1)) / buf->chunk_size))))
+   {
+      buff_chain_add_chunks(buf, chunks, memory, num_chunks);
+
+      result = BUFF_TRUE;
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Chain_Add_Chunks */
 #endif
-#if(!BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
-   BUFF_UNUSED_PARAM(overwrite_if_no_free_space);
+
+
+
+#if( (!defined(BUFF_CHAIN_GET_BUSY_SIZE_EXTERNAL)) && BUFF_CHAIN_GET_BUSY_SIZE_ENABLED )
+Buff_Size_DT Buff_Chain_Get_Busy_Size(const Buff_Chain_XT *buf)
+{
+   Buff_Size_DT result = 0;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(const Buff_Chain_XT, buf)))
+   {
+      result = buf->busy_size;
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Chain_Get_Busy_Size */
 #endif
 
+
+
+#if( (!defined(BUFF_CHAIN_GET_FREE_SIZE_EXTERNAL)) && BUFF_CHAIN_GET_FREE_SIZE_ENABLED )
+Buff_Size_DT Buff_Chain_Get_Free_Size(const Buff_Chain_XT *buf)
+{
+   Buff_Size_DT result = 0;
+
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(dest);
-   BUFF_DEBUG_RING(src);
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, dest) && BUFF_CHECK_PTR(Buff_Ring_XT, src)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(const Buff_Chain_XT, buf)))
    {
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
+      result = buf->num_free_chunks * buf->chunk_size;
+
+      if(BUFF_CHECK_PTR(Buff_Chain_Chunk_XT, buf->last))
       {
-         BUFF_PROTECTION_LOCK(dest);
-         BUFF_PROTECTION_LOCK(src);
+         result += buf->chunk_size - buf->first_free;
       }
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Chain_Get_Free_Size */
 #endif
 
-      /* check if src_offset points to busy area of source buffer - otherwise copying will not be executed */
-      if(BUFF_LIKELY(src_offset < src->busy_size))
-      {
-         size_to_read = src->busy_size - src_offset;
 
-         if(BUFF_LIKELY(size <= size_to_read))
-         {
-            size_to_read = size;
-         }
 
-         size_to_copy = BUFF_RING_GET_FREE_SIZE(dest);
+#if( ((!defined(BUFF_CHAIN_WRITE_EXTERNAL)) && BUFF_CHAIN_WRITE_ENABLED) \
+   || ((!defined(BUFF_CHAIN_WRITE_FROM_VECTOR_EXTERNAL)) && BUFF_CHAIN_WRITE_FROM_VECTOR_ENABLED && BUFF_USE_VECTOR_BUFFERS && BUFF_READABLE_VECTOR_CURSOR_ENABLED) \
+   || ((!defined(BUFF_CHAIN_WRITE_FROM_TREE_EXTERNAL)) && BUFF_CHAIN_WRITE_FROM_TREE_ENABLED && BUFF_USE_TREE_BUFFERS && BUFF_READABLE_TREE_CURSOR_ENABLED) )
+/**
+ * Type of function which copies data from cursor (linear buffer, vector or tree cursor) to linear buffer and moves the cursor.
+ */
+typedef Buff_Size_DT (*buff_chain_cursor_copy_HT)(void *dest, void *cursor, Buff_Size_DT size);
 
-         if(BUFF_LIKELY(size_to_read <= size_to_copy))
-         {
-            size_to_copy = size_to_read;
-         }
-#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
-         else if(BUFF_BOOL_IS_TRUE(overwrite_if_no_free_space))
+/**
+ * Appends data to the end of the chain, part by part - each part fills free space of last chunk,
+ * next chunk is taken from free list only if last one is full.
+ */
+static Buff_Size_DT buff_chain_write_from_cursor(
+   Buff_Chain_XT             *buf,
+   buff_chain_cursor_copy_HT  cursor_copy,
+   void                      *cursor,
+   Buff_Size_DT               size)
+{
+   Buff_Chain_Chunk_XT *chunk;
+   Buff_Size_DT count = 0;
+   Buff_Size_DT part;
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Chain_XT, buf) && BUFF_CHECK_PTR(void, cursor)))
+   {
+      while(count < size)
+      {
+         if((!BUFF_CHECK_PTR(Buff_Chain_Chunk_XT, buf->last)) || (buf->first_free >= buf->chunk_size))
          {
-            if(BUFF_LIKELY(size_to_read < dest->size))
+            chunk = buf->free_chunks;
+
+            if(!BUFF_CHECK_PTR(Buff_Chain_Chunk_XT, chunk))
             {
-               Buff_Ring_Remove(dest, size_to_read - size_to_copy, BUFF_FALSE);
+               break;
+            }
 
-               size_to_copy = size_to_read;
+            buf->free_chunks  = chunk->next;
+            buf->num_free_chunks--;
+            chunk->next       = BUFF_MAKE_INVALID_PTR(Buff_Chain_Chunk_XT);
+
+            if(BUFF_CHECK_PTR(Buff_Chain_Chunk_XT, buf->last))
+            {
+               buf->last->next   = chunk;
             }
             else
             {
-               Buff_Ring_Clear(dest, BUFF_FALSE);
-
-               size_to_copy = dest->size;
+               buf->first        = chunk;
+               buf->first_busy   = 0;
             }
+
+            buf->last         = chunk;
+            buf->first_free   = 0;
          }
-#endif
-         if(BUFF_LIKELY(size_to_copy > 0))
+
+         part = buf->chunk_size - buf->first_free;
+
+         if(part > (size - count))
          {
-#if(BUFF_RING_USE_EXTENSIONS)
-            data_changed = BUFF_TRUE;
+            part = size - count;
+         }
+
+         part = cursor_copy(&((uint8_t*)(buf->last->memory))[buf->first_free], cursor, part);
+
+         buf->first_free  += part;
+         buf->busy_size   += part;
+         count            += part;
+
+         /* end of source data */
+         if(0 == part)
+         {
+            break;
+         }
+      }
+   }
+
+   return count;
+} /* buff_chain_write_from_cursor */
 #endif
-            read_start = src->first_busy + src_offset - src->size;
 
-            if(BUFF_LIKELY(src->first_busy < (src->size - src_offset)))
-            {
-               read_start += src->size;
-            }
 
-            /* destination memory is continous */
-            if(BUFF_LIKELY(dest->first_free <= (dest->size - size_to_copy)))
-            {
-               data_to = &((uint8_t*)(dest->memory))[dest->first_free];
 
-               /* source memory is continous */
-               if(BUFF_LIKELY(read_start <= (src->size - size_to_copy)))
-               {
-                  memcpy(data_to, &((const uint8_t*)(src->memory))[read_start], size_to_copy);
-               }
-               /* source memory is split */
-               else
-               {
-                  part_size_src  = src->size - read_start;
-                  memcpy(data_to, &((const uint8_t*)(src->memory))[read_start], part_size_src);
+#if( (!defined(BUFF_CHAIN_WRITE_EXTERNAL)) && BUFF_CHAIN_WRITE_ENABLED )
+static Buff_Size_DT buff_chain_linear_cursor_copy(void *dest, void *cursor, Buff_Size_DT size)
+{
+   const uint8_t **src = (const uint8_t**)cursor;
 
-                  data_to        = &((uint8_t*)data_to)[part_size_src];
-                  part_size_src  = size_to_copy - part_size_src;
-                  memcpy(data_to, src->memory, part_size_src);
-               }
+   BUFF_MEMCPY(dest, *src, size);
 
-               dest->busy_size     += size_to_copy;
-               dest->first_free    += size_to_copy;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-               rewind_occured       = BUFF_FALSE;
-#endif
+   *src = &((*src)[size]);
 
-               if(BUFF_UNLIKELY(dest->first_free >= dest->size))
-               {
-                  dest->first_free  = 0;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-                  rewind_occured    = BUFF_TRUE;
-#endif
-               }
-            }
-            /* destination memory is split */
-            else
-            {
-               data_from      = &((const uint8_t*)(src->memory))[read_start];
-               part_size_dest = dest->size - dest->first_free;
+   return size;
+} /* buff_chain_linear_cursor_copy */
 
-               /* source memory is continous */
-               if(BUFF_LIKELY(read_start <= (src->size - size_to_copy)))
-               {
-                  memcpy( &((uint8_t*)(dest->memory))[dest->first_free], data_from, part_size_dest);
-                  data_from            = &((uint8_t*)data_from)[part_size_dest];
-                  part_size_dest       = size_to_copy - part_size_dest;
-                  memcpy(dest->memory, data_from, part_size_dest);
 
-                  dest->first_free     = part_size_dest;
-               }
-               /* source memory is split */
-               else
-               {
-                  part_size_src  = src->size - read_start;
 
-                  if(part_size_src > part_size_dest)
-                  {
-                     memcpy( &((uint8_t*)(dest->memory))[dest->first_free], data_from, part_size_dest);
-                     data_from            = &((uint8_t*)data_from)[part_size_dest];
-                     memcpy(dest->memory, data_from, part_size_src - part_size_dest);
-                     dest->first_free  = part_size_src - part_size_dest;
-                     part_size_src     = size_to_copy - part_size_src;
-                     memcpy( &((uint8_t*)(dest->memory))[dest->first_free], src->memory, part_size_src);
-                     dest->first_free += part_size_src;
-                  }
-                  else
-                  {
-                     memcpy( &((uint8_t*)(dest->memory))[dest->first_free], data_from, part_size_src);
-                     dest->first_free += part_size_src;
-                     memcpy( &((uint8_t*)(dest->memory))[dest->first_free], src->memory, part_size_dest - part_size_src);
-                     src_offset        = part_size_dest - part_size_src;
-                     part_size_dest    = size_to_copy - part_size_dest;
-                     memcpy(dest->memory, &((uint8_t*)(src->memory))[src_offset], part_size_dest);
-                     dest->first_free  = part_size_dest;
-                  }
-               }
+Buff_Size_DT Buff_Chain_Write(Buff_Chain_XT *buf, const void *data, Buff_Size_DT size)
+{
+   const uint8_t *cursor = (const uint8_t*)data;
+   Buff_Size_DT result = 0;
 
-               dest->busy_size     += size_to_copy;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-               rewind_occured       = BUFF_TRUE;
-#endif
-            }
+   BUFF_ENTER_FUNC();
 
-#if(BUFF_RING_USE_BUSY_SIZE_MONITORING)
-            if(dest->busy_size >= dest->max_busy_size)
-            {
-               dest->max_busy_size = dest->busy_size;
-            }
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(const void, data)))
+   {
+      result = buff_chain_write_from_cursor(buf, buff_chain_linear_cursor_copy, (void*)(&cursor), size);
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Chain_Write */
 #endif
 
-#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            extension = dest->protected_extension;
 
-            if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
-            {
-               on_write = extension->on_write;
 
-               if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
-               {
-                  on_write(dest, extension, size_to_copy, rewind_occured);
-               }
-            }
-#endif
-         }
-      }
+#if( (!defined(BUFF_CHAIN_WRITE_FROM_VECTOR_EXTERNAL)) && BUFF_CHAIN_WRITE_FROM_VECTOR_ENABLED && BUFF_USE_VECTOR_BUFFERS && BUFF_READABLE_VECTOR_CURSOR_ENABLED )
+static Buff_Size_DT buff_chain_vector_cursor_copy(void *dest, void *cursor, Buff_Size_DT size)
+{
+   return Buff_Copy_From_Vector_Cursor(dest, (Buff_Readable_Vector_Cursor_XT*)cursor, size);
+} /* buff_chain_vector_cursor_copy */
 
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_UNLOCK(dest);
-         BUFF_PROTECTION_UNLOCK(src);
-      }
-#endif
 
-#if(BUFF_RING_USE_EXTENSIONS)
-      extension = dest->extension;
 
-      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension) && BUFF_BOOL_IS_TRUE(data_changed))
-      {
-         on_write = extension->on_write;
+Buff_Size_DT Buff_Chain_Write_From_Vector(
+   Buff_Chain_XT                   *buf,
+   const Buff_Readable_Vector_XT   *data,
+   Buff_Num_Elems_DT                data_num_elems,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_data)
+{
+   Buff_Readable_Vector_Cursor_XT cursor;
+   Buff_Size_DT result = 0;
 
-         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Write, on_write))
-         {
-            on_write(dest, extension, size_to_copy, rewind_occured);
-         }
-      }
-#endif
-   }
+   BUFF_ENTER_FUNC();
 
-   BUFF_DEBUG_RING(dest);
-   BUFF_DEBUG_RING(src);
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(const Buff_Readable_Vector_XT, data)))
+   {
+      /* cursor keeps position in the vector, so each chunk is filled without searching the vector from its begining */
+      Buff_Readable_Vector_Cursor_Init(&cursor, data, data_num_elems, offset_data);
+
+      result = buff_chain_write_from_cursor(buf, buff_chain_vector_cursor_copy, &cursor, size);
+   }
 
    BUFF_EXIT_FUNC();
 
-   return size_to_copy;
-} /* Buff_Ring_To_Ring_Copy */
+   return result;
+} /* Buff_Chain_Write_From_Vector */
 #endif
 
 
 
-#if( (!defined(RING_BUF_REMOVE_EXTERNAL)) && BUFF_RING_REMOVE_ENABLED )
-Buff_Size_DT Buff_Ring_Remove(Buff_Ring_XT *buf, Buff_Size_DT size, Buff_Bool_DT use_protection)
+#if( (!defined(BUFF_CHAIN_WRITE_FROM_TREE_EXTERNAL)) && BUFF_CHAIN_WRITE_FROM_TREE_ENABLED && BUFF_USE_TREE_BUFFERS && BUFF_READABLE_TREE_CURSOR_ENABLED )
+static Buff_Size_DT buff_chain_tree_cursor_copy(void *dest, void *cursor, Buff_Size_DT size)
 {
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Ring_Extensions_XT *extension;
-   Buff_Ring_Extension_On_Remove on_remove;
-#endif
-   Buff_Size_DT result = 0;
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Bool_DT rewind_occured = BUFF_FALSE;
-#endif
+   return Buff_Copy_From_Tree_Cursor(dest, (Buff_Readable_Tree_Cursor_XT*)cursor, size);
+} /* buff_chain_tree_cursor_copy */
 
-#if(!BUFF_RING_USE_PROTECTION)
-   BUFF_UNUSED_PARAM(use_protection);
-#endif
+
+
+Buff_Size_DT Buff_Chain_Write_From_Tree(
+   Buff_Chain_XT                   *buf,
+   const Buff_Readable_Tree_XT     *data,
+   Buff_Num_Elems_DT                data_num_elems,
+   Buff_Size_DT                     size,
+   Buff_Size_DT                     offset_data)
+{
+   Buff_Readable_Tree_Cursor_XT cursor;
+   Buff_Size_DT result = 0;
 
    BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
 
-   if(BUFF_LIKELY((size > 0) && BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(const Buff_Readable_Tree_XT, data)))
    {
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_LOCK(buf);
-      }
+      Buff_Readable_Tree_Cursor_Init(&cursor, data, data_num_elems, offset_data);
+
+      result = buff_chain_write_from_cursor(buf, buff_chain_tree_cursor_copy, &cursor, size);
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Chain_Write_From_Tree */
 #endif
 
-      if(BUFF_LIKELY(size < buf->busy_size))
+
+
+#if( ((!defined(BUFF_CHAIN_PEAK_EXTERNAL)) && BUFF_CHAIN_PEAK_ENABLED) || ((!defined(BUFF_CHAIN_READ_EXTERNAL)) && BUFF_CHAIN_READ_ENABLED) )
+/**
+ * Copies data from the chain to linear buffer without removing it.
+ */
+static Buff_Size_DT buff_chain_peak(const Buff_Chain_XT *buf, uint8_t *data, Buff_Size_DT size, Buff_Size_DT buf_offset)
+{
+   const Buff_Chain_Chunk_XT *chunk;
+   Buff_Size_DT count = 0;
+   Buff_Size_DT pos;
+   Buff_Size_DT part;
+
+   if(BUFF_LIKELY(buf_offset < buf->busy_size))
+   {
+      if(size > (buf->busy_size - buf_offset))
       {
-         buf->busy_size      -= size;
-         buf->first_busy     += size;
-         if(BUFF_UNLIKELY(buf->first_busy >= buf->size))
-         {
-            buf->first_busy  -= buf->size;
-#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
-            buf->size         = buf->original_size;
-#endif
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-            rewind_occured    = BUFF_TRUE;
-#endif
-         }
-         result               = size;
+         size = buf->busy_size - buf_offset;
       }
-      else
+
+      /* chunks before buf_offset are only skipped */
+      chunk = buf->first;
+      pos   = buf->first_busy + buf_offset;
+
+      while(pos >= buf->chunk_size)
       {
-         result               = buf->busy_size;
-         buf->first_free      = 0;
-         buf->first_busy      = 0;
-         buf->busy_size       = 0;
-#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
-         buf->size            = buf->original_size;
-#endif
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-         rewind_occured       = BUFF_TRUE;
-#endif
+         pos  -= buf->chunk_size;
+         chunk = chunk->next;
       }
 
-#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
-      extension = buf->protected_extension;
-
-      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+      while(count < size)
       {
-         on_remove = extension->on_remove;
+         part = buf->chunk_size - pos;
 
-         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Remove, on_remove))
+         if(part > (size - count))
          {
-            on_remove(buf, extension, rewind_occured);
+            part = size - count;
          }
-      }
-#endif
 
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_UNLOCK(buf);
+         BUFF_MEMCPY(&data[count], &((const uint8_t*)(chunk->memory))[pos], part);
+
+         count += part;
+         pos    = 0;
+         chunk  = chunk->next;
       }
+   }
+
+   return count;
+} /* buff_chain_peak */
 #endif
 
-#if(BUFF_RING_USE_EXTENSIONS)
-      extension = buf->extension;
 
-      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
-      {
-         on_remove = extension->on_remove;
 
-         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Remove, on_remove))
-         {
-            on_remove(buf, extension, rewind_occured);
-         }
-      }
-#endif
+#if( (!defined(BUFF_CHAIN_PEAK_EXTERNAL)) && BUFF_CHAIN_PEAK_ENABLED )
+Buff_Size_DT Buff_Chain_Peak(Buff_Chain_XT *buf, void *data, Buff_Size_DT size, Buff_Size_DT buf_offset)
+{
+   Buff_Size_DT result = 0;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Chain_XT, buf) && BUFF_CHECK_PTR(void, data)))
+   {
+      result = buff_chain_peak(buf, (uint8_t*)data, size, buf_offset);
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
 
    return result;
-} /* Buff_Ring_Remove */
+} /* Buff_Chain_Peak */
 #endif
 
 
 
-#if( (!defined(RING_BUF_CLEAR_EXTERNAL)) && BUFF_RING_CLEAR_ENABLED )
-void Buff_Ring_Clear(Buff_Ring_XT *buf, Buff_Bool_DT use_protection)
+#if( ((!defined(BUFF_CHAIN_REMOVE_EXTERNAL)) && BUFF_CHAIN_REMOVE_ENABLED) || ((!defined(BUFF_CHAIN_READ_EXTERNAL)) && BUFF_CHAIN_READ_ENABLED) )
+/**
+ * Removes oldest data from the chain; chunks which become empty are put to free list.
+ */
+static Buff_Size_DT buff_chain_remove(Buff_Chain_XT *buf, Buff_Size_DT size)
 {
-#if(BUFF_RING_USE_EXTENSIONS || BUFF_RING_USE_PROTECTED_EXTENSIONS)
-   Buff_Ring_Extensions_XT *extension;
-   Buff_Ring_Extension_On_Remove on_remove;
-#endif
+   Buff_Chain_Chunk_XT *chunk;
+   Buff_Size_DT count;
+   Buff_Size_DT part;
 
-#if(!BUFF_RING_USE_PROTECTION)
-   BUFF_UNUSED_PARAM(use_protection);
-#endif
+   if(size > buf->busy_size)
+   {
+      size = buf->busy_size;
+   }
 
-   BUFF_ENTER_FUNC();
-   BUFF_DEBUG_RING(buf);
+   count = size;
 
-   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Ring_XT, buf)))
+   while(count > 0)
    {
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
+      part = ((buf->first == buf->last) ? buf->first_free : buf->chunk_size) - buf->first_busy;
+
+      if(count < part)
       {
-         BUFF_PROTECTION_LOCK(buf);
+         buf->first_busy += count;
+         break;
       }
-#endif
 
-      buf->first_free   = 0;
+      /* whole rest of the first chunk is removed - chunk goes back to free list */
+      count -= part;
+
+      chunk             = buf->first;
+      buf->first        = chunk->next;
       buf->first_busy   = 0;
-      buf->busy_size    = 0;
-#if(BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED)
-      buf->size         = buf->original_size;
+      chunk->next       = buf->free_chunks;
+      buf->free_chunks  = chunk;
+      buf->num_free_chunks++;
+   }
+
+   buf->busy_size -= size;
+
+   /* empty chain keeps no chunk, so next write starts from the begining of a chunk */
+   if((0 == buf->busy_size) && BUFF_CHECK_PTR(Buff_Chain_Chunk_XT, buf->first))
+   {
+      chunk             = buf->first;
+      chunk->next       = buf->free_chunks;
+      buf->free_chunks  = chunk;
+      buf->num_free_chunks++;
+      buf->first        = BUFF_MAKE_INVALID_PTR(Buff_Chain_Chunk_XT);
+   }
+
+   if(!BUFF_CHECK_PTR(Buff_Chain_Chunk_XT, buf->first))
+   {
+      buf->last         = BUFF_MAKE_INVALID_PTR(Buff_Chain_Chunk_XT);
+      buf->first_busy   = 0;
+      buf->first_free   = 0;
+   }
+
+   return size;
+} /* buff_chain_remove */
 #endif
 
-#if(BUFF_RING_USE_PROTECTED_EXTENSIONS)
-      extension = buf->protected_extension;
 
-      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
-      {
-         on_remove = extension->on_remove;
 
-         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Remove, on_remove))
-         {
-            on_remove(buf, extension, BUFF_TRUE);
-         }
-      }
+#if( (!defined(BUFF_CHAIN_REMOVE_EXTERNAL)) && BUFF_CHAIN_REMOVE_ENABLED )
+Buff_Size_DT Buff_Chain_Remove(Buff_Chain_XT *buf, Buff_Size_DT size)
+{
+   Buff_Size_DT result = 0;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Chain_XT, buf)))
+   {
+      result = buff_chain_remove(buf, size);
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Chain_Remove */
 #endif
 
-#if(BUFF_RING_USE_PROTECTION)
-      if(BUFF_BOOL_IS_TRUE(use_protection))
-      {
-         BUFF_PROTECTION_UNLOCK(buf);
-      }
+
+
+#if( (!defined(BUFF_CHAIN_READ_EXTERNAL)) && BUFF_CHAIN_READ_ENABLED )
+Buff_Size_DT Buff_Chain_Read(Buff_Chain_XT *buf, void *data, Buff_Size_DT size)
+{
+   Buff_Size_DT result = 0;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Chain_XT, buf) && BUFF_CHECK_PTR(void, data)))
+   {
+      result = buff_chain_peak(buf, (uint8_t*)data, size, 0);
+
+      (void)buff_chain_remove(buf, result);
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Chain_Read */
 #endif
 
-#if(BUFF_RING_USE_EXTENSIONS)
-      extension = buf->extension;
 
-      if(BUFF_CHECK_PTR(Buff_Ring_Extensions_XT, extension))
+
+#if( (!defined(BUFF_CHAIN_TO_VECTOR_EXTERNAL)) && BUFF_CHAIN_TO_VECTOR_ENABLED )
+Buff_Num_Elems_DT Buff_Chain_To_Vector(
+   const Buff_Chain_XT             *buf,
+   Buff_Readable_Vector_XT         *vector,
+   Buff_Num_Elems_DT                vector_num_elems,
+   Buff_Size_DT                    *size)
+{
+   const Buff_Chain_Chunk_XT *chunk;
+   Buff_Size_DT count = 0;
+   Buff_Size_DT pos;
+   Buff_Num_Elems_DT result = 0;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(const Buff_Chain_XT, buf) && BUFF_CHECK_PTR(Buff_Readable_Vector_XT, vector)))
+   {
+      chunk = buf->first;
+      pos   = buf->first_busy;
+
+      while((count < buf->busy_size) && (result < vector_num_elems))
       {
-         on_remove = extension->on_remove;
+         vector[result].data  = &((const uint8_t*)(chunk->memory))[pos];
+         vector[result].size  = ((chunk == buf->last) ? buf->first_free : buf->chunk_size) - pos;
 
-         if(BUFF_CHECK_HANDLER(Buff_Ring_Extension_On_Remove, on_remove))
-         {
-            on_remove(buf, extension, BUFF_TRUE);
-         }
+         count += vector[result].size;
+         result++;
+         pos    = 0;
+         chunk  = chunk->next;
       }
+   }
+
+   if(BUFF_CHECK_PTR(Buff_Size_DT, size))
+   {
+      *size = count;
+   }
+
+   BUFF_EXIT_FUNC();
+
+   return result;
+} /* Buff_Chain_To_Vector */
 #endif
+
+
+
+#if( (!defined(BUFF_CHAIN_TO_TREE_EXTERNAL)) && BUFF_CHAIN_TO_TREE_ENABLED && BUFF_CHAIN_TO_VECTOR_ENABLED )
+Buff_Num_Elems_DT Buff_Chain_To_Tree(
+   const Buff_Chain_XT             *buf,
+   Buff_Readable_Tree_XT           *tree,
+   Buff_Readable_Vector_XT         *vector,
+   Buff_Num_Elems_DT                vector_num_elems,
+   Buff_Size_DT                    *size)
+{
+   Buff_Num_Elems_DT result = 0;
+
+   BUFF_ENTER_FUNC();
+
+   if(BUFF_LIKELY(BUFF_CHECK_PTR(Buff_Readable_Tree_XT, tree)))
+   {
+      result = Buff_Chain_To_Vector(buf, vector, vector_num_elems, size);
+
+      tree->elem_type.vector.vector            = vector;
+      tree->elem_type.vector.vector_num_elems  = result;
+      tree->is_branch                          = BUFF_FALSE;
+   }
+   else if(BUFF_CHECK_PTR(Buff_Size_DT, size))
+   {
+      *size = 0;
    }
 
-   BUFF_DEBUG_RING(buf);
    BUFF_EXIT_FUNC();
-} /* Buff_Ring_Clear */
+
+   return result;
+} /* Buff_Chain_To_Tree */
 #endif
-#endif /* #if(BUFF_USE_RING_BUFFERS) */
+
+#endif /* #if(BUFF_USE_CHAIN_BUFFERS) */
 
 
 
@@ -33,6 +33,32 @@
 
 #define BUFF_RING_USE_PROTECTION            false
 
+#define BUFF_RING_USE_MIRRORED_MEMORY       BUFF_FEATURE_ENABLED
+
+#define BUFF_USE_OPTIMIZED_MEMCPY           BUFF_FEATURE_ENABLED
+
+#define BUFF_USE_CHECKSUM                   BUFF_FEATURE_ENABLED
+
+#define BUFF_RING_USE_NON_TEMPORAL_COPY     BUFF_FEATURE_ENABLED
+#define BUFF_NON_TEMPORAL_COPY_THRESHOLD    100
+
+/* lock-free SPSC builds (BUFF_RING_USE_LOCK_FREE_SPSC given by Makefile) can't grow buffers nor place them in files */
+#ifndef BUFF_RING_USE_LOCK_FREE_SPSC
+#define BUFF_RING_USE_AUTO_GROW             BUFF_FEATURE_ENABLED
+#endif
+
+#define BUFF_RING_USE_FD_IO                 BUFF_FEATURE_ENABLED
+
+#define BUFF_USE_IOVEC                      BUFF_FEATURE_ENABLED
+
+#define BUFF_RING_USE_IO_URING              BUFF_FEATURE_ENABLED
+
+#define BUFF_RING_USE_SPLICE                BUFF_FEATURE_ENABLED
+
+#ifndef BUFF_RING_USE_LOCK_FREE_SPSC
+#define BUFF_RING_USE_FILE                  BUFF_FEATURE_ENABLED
+#endif
+
 #define BUFF_LIKELY(expresion)                    __builtin_expect ((expresion), 1)
 #define BUFF_UNLIKELY(expresion)                  __builtin_expect ((expresion), 0)
 
@@ -0,0 +1,98 @@
+/** ---------------------------------------- LICENSE SECTION -------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 Piotr Wojtowicz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * -----------------------------------------------------------------------------------------------------------------------------
+ */
+
+/*
+ * Single-core benchmark of Buff_Memcpy (BUFF_USE_OPTIMIZED_MEMCPY) against platform memcpy.
+ * Each size is copied BENCHMARK_COPY_TOTAL_SIZE bytes in total between two buffers which stay in L1 cache,
+ * both functions are called through pointer (as BUFF_MEMCPY is called by the library for run-time sizes).
+ * Built by "make benchmark" - to check if BUFF_USE_OPTIMIZED_MEMCPY is worth enabling on given platform.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "buff.h"
+
+#ifndef BENCHMARK_COPY_TOTAL_SIZE
+#define BENCHMARK_COPY_TOTAL_SIZE   ((uint64_t)4 * 1024 * 1024 * 1024)
+#endif
+#define BENCHMARK_COPY_MAX_SIZE     4096
+
+typedef void (*benchmark_copy_HT)(void *dest, const void *src, Buff_Size_DT size);
+
+static uint8_t src_memory[BENCHMARK_COPY_MAX_SIZE];
+static uint8_t dest_memory[BENCHMARK_COPY_MAX_SIZE];
+
+static void benchmark_memcpy(void *dest, const void *src, Buff_Size_DT size)
+{
+   (void)memcpy(dest, src, size);
+} /* benchmark_memcpy */
+
+static double benchmark_run(volatile benchmark_copy_HT copy, Buff_Size_DT size)
+{
+   struct timespec start;
+   struct timespec stop;
+   uint64_t        done;
+
+   clock_gettime(CLOCK_MONOTONIC, &start);
+
+   for(done = 0; done < BENCHMARK_COPY_TOTAL_SIZE; done += size)
+   {
+      copy(dest_memory, src_memory, size);
+   }
+
+   clock_gettime(CLOCK_MONOTONIC, &stop);
+
+   return (double)(stop.tv_sec - start.tv_sec) + ((double)(stop.tv_nsec - start.tv_nsec) / 1000000000.0);
+} /* benchmark_run */
+
+int main(void)
+{
+#if(BUFF_USE_OPTIMIZED_MEMCPY)
+   static const Buff_Size_DT sizes[] = {3, 8, 15, 16, 24, 33, 64, 100, 256, 1000, 4096};
+   double       time_std;
+   double       time_buff;
+   unsigned     cntr;
+
+   memset(src_memory, 0xA5, sizeof(src_memory));
+
+   for(cntr = 0; cntr < (sizeof(sizes) / sizeof(sizes[0])); cntr++)
+   {
+      time_std  = benchmark_run(benchmark_memcpy, sizes[cntr]);
+      time_buff = benchmark_run(Buff_Memcpy, sizes[cntr]);
+
+      printf("copy %4u bytes: memcpy %10.2f MB/s, Buff_Memcpy %10.2f MB/s (%+6.1f%%)\n\r",
+         (unsigned)sizes[cntr],
+         ((double)BENCHMARK_COPY_TOTAL_SIZE / (1024.0 * 1024.0)) / time_std,
+         ((double)BENCHMARK_COPY_TOTAL_SIZE / (1024.0 * 1024.0)) / time_buff,
+         ((time_std / time_buff) - 1.0) * 100.0);
+   }
+#else
+   printf("BUFF_USE_OPTIMIZED_MEMCPY is disabled - nothing to compare\n\r");
+#endif
+
+   return 0;
+}
@@ -0,0 +1,142 @@
+/** ---------------------------------------- LICENSE SECTION -------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 Piotr Wojtowicz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * -----------------------------------------------------------------------------------------------------------------------------
+ */
+
+/*
+ * Cross-core throughput benchmark of lock-free SPSC ring buffer.
+ * Producer and consumer threads are pinned to different CPUs and transfer BENCHMARK_TOTAL_SIZE bytes
+ * in chunks of given size (first parameter, default 8 bytes). Built twice by "make benchmark" - with packed (default)
+ * and with cache-line padded (BUFF_RING_USE_PADDED_LAYOUT) layout of Buff_Ring_XT - to compare false-sharing cost.
+ */
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "buff.h"
+
+#define BENCHMARK_RING_SIZE         4096
+#ifndef BENCHMARK_TOTAL_SIZE
+#define BENCHMARK_TOTAL_SIZE        ((uint64_t)1024 * 1024 * 1024)
+#endif
+#define BENCHMARK_MAX_CHUNK_SIZE    1024
+
+static Buff_Ring_XT ring;
+static uint8_t ring_memory[BENCHMARK_RING_SIZE];
+static Buff_Size_DT chunk_size = 8;
+
+static void pin_to_cpu(int cpu)
+{
+   cpu_set_t set;
+
+   CPU_ZERO(&set);
+   CPU_SET(cpu, &set);
+
+   (void)pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+} /* pin_to_cpu */
+
+static void *producer(void *param)
+{
+   uint8_t      data[BENCHMARK_MAX_CHUNK_SIZE];
+   uint64_t     done = 0;
+   Buff_Size_DT written;
+
+   pin_to_cpu(*((int*)param));
+
+   memset(data, 0xA5, sizeof(data));
+
+   while(done < BENCHMARK_TOTAL_SIZE)
+   {
+      written = Buff_Ring_Write(&ring, data, chunk_size, BUFF_FALSE, BUFF_FALSE);
+      done   += written;
+
+      /* buffer is full - consumer may run on the same CPU (or be preempted), so CPU is given back to it */
+      if(0 == written)
+      {
+         (void)sched_yield();
+      }
+   }
+
+   return NULL;
+} /* producer */
+
+int main(int argc, const char* argv[])
+{
+   pthread_t       producer_thread;
+   struct timespec start;
+   struct timespec stop;
+   uint8_t         data[BENCHMARK_MAX_CHUNK_SIZE];
+   uint64_t        done = 0;
+   Buff_Size_DT    read;
+   double          time_s;
+   int             producer_cpu = 1;
+
+   if(argc > 1)
+   {
+      chunk_size = (Buff_Size_DT)atoi(argv[1]);
+
+      if((chunk_size < 1) || (chunk_size > BENCHMARK_MAX_CHUNK_SIZE))
+      {
+         chunk_size = 8;
+      }
+   }
+
+   (void)Buff_Ring_Init(&ring, ring_memory, sizeof(ring_memory));
+
+   pin_to_cpu(0);
+
+   clock_gettime(CLOCK_MONOTONIC, &start);
+
+   pthread_create(&producer_thread, NULL, producer, &producer_cpu);
+
+   while(done < BENCHMARK_TOTAL_SIZE)
+   {
+      read  = Buff_Ring_Read(&ring, data, chunk_size, BUFF_FALSE);
+      done += read;
+
+      if(0 == read)
+      {
+         (void)sched_yield();
+      }
+   }
+
+   pthread_join(producer_thread, NULL);
+
+   clock_gettime(CLOCK_MONOTONIC, &stop);
+
+   time_s = (double)(stop.tv_sec - start.tv_sec) + ((double)(stop.tv_nsec - start.tv_nsec) / 1000000000.0);
+
+   printf("%s layout, chunk %4u bytes: %8.3f s, %10.2f MB/s, sizeof(Buff_Ring_XT) = %u\n\r",
+      BUFF_RING_USE_PADDED_LAYOUT ? "padded" : "packed",
+      (unsigned)chunk_size,
+      time_s,
+      ((double)BENCHMARK_TOTAL_SIZE / (1024.0 * 1024.0)) / time_s,
+      (unsigned)sizeof(Buff_Ring_XT));
+
+   return 0;
+}
@@ -33,6 +33,39 @@
 #include "ring_test.h"
 #include "test_utils.h"
 
+#if(BUFF_RING_USE_FD_IO)
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#if(BUFF_RING_USE_IO_URING)
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#endif
+
+#if(BUFF_RING_USE_SPLICE)
+#include <errno.h>
+#include <unistd.h>
+#endif
+
+#if(BUFF_RING_USE_FILE)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
+#if(BUFF_RING_USE_LOCK_FREE_SPSC)
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+/* lock-free buffer has no busy_size - it is computed from first_free and first_busy */
+#define RING_BUSY_SIZE(buf)      Buff_Ring_Get_Busy_Size((buf), false)
+#else
+#define RING_BUSY_SIZE(buf)      ((buf)->busy_size)
+#endif
+
 typedef struct
 {
    size_t on_read_cntr;
@@ -105,7 +138,7 @@ static void init_tests(
       && (NULL             == buf->protected_extension)
       && (0                == buf->size)
       && (0                == buf->original_size)
-      && (0                == buf->busy_size)
+      && (0                == RING_BUSY_SIZE(buf))
       && (0                == buf->max_busy_size)
       && (0                == buf->first_free)
       && (0                == buf->first_busy)
@@ -133,7 +166,7 @@ static void init_tests(
       && (NULL             == buf->protected_extension)
       && (0                == buf->size)
       && (0                == buf->original_size)
-      && (0                == buf->busy_size)
+      && (0                == RING_BUSY_SIZE(buf))
       && (0                == buf->max_busy_size)
       && (0                == buf->first_free)
       && (0                == buf->first_busy)
@@ -161,7 +194,7 @@ static void init_tests(
       && (NULL             == buf->protected_extension)
       && (memory_size      == buf->size)
       && (memory_size      == buf->original_size)
-      && (0                == buf->busy_size)
+      && (0                == RING_BUSY_SIZE(buf))
       && (0                == buf->max_busy_size)
       && (0                == buf->first_free)
       && (0                == buf->first_busy)
@@ -189,7 +222,7 @@ static void init_tests(
       && (NULL == buf->protected_extension)
       && (0    == buf->size)
       && (0    == buf->original_size)
-      && (0    == buf->busy_size)
+      && (0    == RING_BUSY_SIZE(buf))
       && (0    == buf->max_busy_size)
       && (0    == buf->first_free)
       && (0    == buf->first_busy)
@@ -395,7 +428,7 @@ static void write_clear_tests(
 
       if((buf_memory_size   == buf->size)
          && (buf_memory_size  == buf->original_size)
-         && (0                == buf->busy_size)
+         && (0                == RING_BUSY_SIZE(buf))
          && (0                == buf->first_free)
          && (0                == buf->first_busy)
          && BUFF_BOOL_IS_TRUE(Buff_Ring_Is_Empty(buf, true))
@@ -595,7 +628,7 @@ static void write_peak_read_tests(
 
       if((buf_memory_size   == buf->size)
          && (buf_memory_size  == buf->original_size)
-         && (0                == buf->busy_size)
+         && (0                == RING_BUSY_SIZE(buf))
          && (0                == buf->first_free)
          && (0                == buf->first_busy)
          && BUFF_BOOL_IS_TRUE(Buff_Ring_Is_Empty(buf, true))
@@ -759,7 +792,7 @@ static void write_peak_read_tests(
 
       if((buf_memory_size   == buf->size)
          && (buf_memory_size  == buf->original_size)
-         && (0                == buf->busy_size)
+         && (0                == RING_BUSY_SIZE(buf))
          && BUFF_BOOL_IS_TRUE(Buff_Ring_Is_Empty(buf, true))
          && BUFF_BOOL_IS_FALSE(Buff_Ring_Is_Full(buf, true))
          && (buf_memory_size  == Buff_Ring_Get_Size(buf, true))
@@ -959,7 +992,7 @@ static void write_peak_vendor_read_vendor_tests(
 
       if((buf_memory_size   == buf->size)
          && (buf_memory_size  == buf->original_size)
-         && (0                == buf->busy_size)
+         && (0                == RING_BUSY_SIZE(buf))
          && (0                == buf->first_free)
          && (0                == buf->first_busy)
          && BUFF_BOOL_IS_TRUE(Buff_Ring_Is_Empty(buf, true))
@@ -1131,7 +1164,7 @@ static void write_peak_vendor_read_vendor_tests(
 
       if((buf_memory_size   == buf->size)
          && (buf_memory_size  == buf->original_size)
-         && (0                == buf->busy_size)
+         && (0                == RING_BUSY_SIZE(buf))
          && BUFF_BOOL_IS_TRUE(Buff_Ring_Is_Empty(buf, true))
          && BUFF_BOOL_IS_FALSE(Buff_Ring_Is_Full(buf, true))
          && (buf_memory_size  == Buff_Ring_Get_Size(buf, true))
@@ -1305,7 +1338,7 @@ static void write_peak_vendor_read_vendor_tests(
 
       if((buf_memory_size   == buf->size)
          && (buf_memory_size  == buf->original_size)
-         && (0                == buf->busy_size)
+         && (0                == RING_BUSY_SIZE(buf))
          && BUFF_BOOL_IS_TRUE(Buff_Ring_Is_Empty(buf, true))
          && BUFF_BOOL_IS_FALSE(Buff_Ring_Is_Full(buf, true))
          && (buf_memory_size  == Buff_Ring_Get_Size(buf, true))
@@ -1504,7 +1537,7 @@ static void write_peak_vector_read_vector_tests(
 
       if((buf_memory_size   == buf->size)
          && (buf_memory_size  == buf->original_size)
-         && (0                == buf->busy_size)
+         && (0                == RING_BUSY_SIZE(buf))
          && (0                == buf->first_free)
          && (0                == buf->first_busy)
          && BUFF_BOOL_IS_TRUE(Buff_Ring_Is_Empty(buf, true))
@@ -1668,7 +1701,7 @@ static void write_peak_vector_read_vector_tests(
 
       if((buf_memory_size   == buf->size)
          && (buf_memory_size  == buf->original_size)
-         && (0                == buf->busy_size)
+         && (0                == RING_BUSY_SIZE(buf))
          && BUFF_BOOL_IS_TRUE(Buff_Ring_Is_Empty(buf, true))
          && BUFF_BOOL_IS_FALSE(Buff_Ring_Is_Full(buf, true))
          && (buf_memory_size  == Buff_Ring_Get_Size(buf, true))
@@ -1876,7 +1909,7 @@ static void write_peak_tree_read_tree_tests(
 
       if((buf_memory_size   == buf->size)
          && (buf_memory_size  == buf->original_size)
-         && (0                == buf->busy_size)
+         && (0                == RING_BUSY_SIZE(buf))
          && (0                == buf->first_free)
          && (0                == buf->first_busy)
          && BUFF_BOOL_IS_TRUE(Buff_Ring_Is_Empty(buf, true))
@@ -2040,7 +2073,7 @@ static void write_peak_tree_read_tree_tests(
 
       if((buf_memory_size   == buf->size)
          && (buf_memory_size  == buf->original_size)
-         && (0                == buf->busy_size)
+         && (0                == RING_BUSY_SIZE(buf))
          && BUFF_BOOL_IS_TRUE(Buff_Ring_Is_Empty(buf, true))
          && BUFF_BOOL_IS_FALSE(Buff_Ring_Is_Full(buf, true))
          && (buf_memory_size  == Buff_Ring_Get_Size(buf, true))
@@ -2133,7 +2166,7 @@ static void getters_tests(
 
    if((buf_memory_size   == buf->size)
       && (buf_memory_size  == buf->original_size)
-      && (0                == buf->busy_size)
+      && (0                == RING_BUSY_SIZE(buf))
       && (0                == buf->first_free)
       && (0                == buf->first_busy)
       && BUFF_BOOL_IS_TRUE(Buff_Ring_Is_Empty(buf, true))
@@ -2237,7 +2270,7 @@ static void write_vendor_clear_tests(
 
       if((buf_memory_size   == buf->size)
          && (buf_memory_size  == buf->original_size)
-         && (0                == buf->busy_size)
+         && (0                == RING_BUSY_SIZE(buf))
          && (0                == buf->first_free)
          && (0                == buf->first_busy)
          && BUFF_BOOL_IS_TRUE(Buff_Ring_Is_Empty(buf, true))
@@ -3680,7 +3713,7 @@ static void add_vendor_read_tests(
    }
 } /* add_vendor_read_tests */
 
-static void check_out_in_test(
+static void read_check_out_in_test(
    Buff_Ring_XT *buf,
    const uint8_t *src,
    size_t src_size,
@@ -3691,9 +3724,11 @@ static void check_out_in_test(
    Buff_Ring_Extensions_XT *extension,
    Buff_Ring_Extensions_XT *protected_extension)
 {
-   uint8_t *ptr;
+   Buff_Readable_Vector_XT vector[2];
+   size_t on_read_cntr;
    int prev_size;
    int size;
+   bool_t wrapped = false;
 
    (void)Buff_Ring_Init(buf, memory, buf_memory_size);
    Buff_Ring_Init_Extension(extension);
@@ -3701,232 +3736,95 @@ static void check_out_in_test(
    Buff_Ring_Init_Extension(protected_extension);
    (void)Buff_Ring_Add_Protected_Extension(buf, protected_extension);
 
-   extension->on_read             = main_ring_on_read;
-   extension->on_write            = main_ring_on_write;
-   extension->on_overwrite        = main_ring_on_overwrite;
-   extension->on_remove           = main_ring_on_remove;
-   extension->on_read_params      = &on_extensions;
-   extension->on_write_params     = &on_extensions;
-   extension->on_overwrite_params = &on_extensions;
-   extension->on_remove_params    = &on_extensions;
-
+   extension->on_read                       = main_ring_on_read;
+   extension->on_read_params                = &on_extensions;
    protected_extension->on_read             = main_ring_on_read;
-   protected_extension->on_write            = main_ring_on_write;
-   protected_extension->on_overwrite        = main_ring_on_overwrite;
-   protected_extension->on_remove           = main_ring_on_remove;
    protected_extension->on_read_params      = &on_protected_extensions;
-   protected_extension->on_write_params     = &on_protected_extensions;
-   protected_extension->on_overwrite_params = &on_protected_extensions;
-   protected_extension->on_remove_params    = &on_protected_extensions;
 
    failure_cntr = 0;
 
-   prev_size = 1;
-
-   if(prev_size == Buff_Ring_Write(buf, &src[prev_size], prev_size, true, true))
+   if(0 != Buff_Ring_Read_Check_Out(buf, vector, true))
    {
-      /* ok */
+      failure_cntr++;
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read_Check_Out empty");
    }
-   else
+   (void)Buff_Ring_Read_Check_In(buf, 0, true);
+
+   prev_size = 1;
+
+   if(prev_size != Buff_Ring_Write(buf, &src[prev_size], prev_size, true, true))
    {
       failure_cntr++;
       printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write 1B");
    }
 
-   /* add data in a loop with variable size, read in same step data added in previous step */
-   for(size = 2; size < (buf_memory_size / 3); size++)
+   for(size = 2; size < (buf_memory_size / 2); size++)
    {
       memset(read1, 0, read1_size);
-      ptr = Buff_Ring_Data_Check_Out(buf, size, true, true);
-      if(NULL != ptr)
+      if(size == Buff_Ring_Write(buf, &src[size], size, true, true))
       {
-         memcpy(ptr, &src[size], size);
-
-         Buff_Ring_Data_Check_In(buf, size, true);
-
-         if(prev_size == Buff_Ring_Read(buf, read1, prev_size, true))
+         if((prev_size + size) == Buff_Ring_Read_Check_Out(buf, vector, true))
          {
-            if(0 != memcmp(&src[prev_size], read1, prev_size))
+            if((vector[0].size + vector[1].size) != (prev_size + size))
             {
-               printf("line: %5d; %-36s failed with size: %d\n\r", __LINE__, "Buff_Ring_Data_Check_In", prev_size);
+               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read_Check_Out-size");
                failure_cntr++;
             }
-            else
+            if(0 != vector[1].size)
             {
-               /* ok */
+               wrapped = true;
             }
-         }
-         else
-         {
-            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
-            failure_cntr++;
-         }
-      }
-      else
-      {
-         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
-      }
-
-      prev_size = size;
-   }
-
-   /**
-    * check out / check in data twice, first with size = sizeof(buf) / 2, next size = sizeof(buf) with option overwrite,
-    * at end check if only data from second check_in is present in the buffer
-    */
-   memset(read1, 0, read1_size);
-   ptr = Buff_Ring_Data_Check_Out(buf, buf_memory_size / 2, true, true);
-   if(NULL != ptr)
-   {
-      memcpy(ptr, &src[buf_memory_size / 2], buf_memory_size / 2);
-
-      Buff_Ring_Data_Check_In(buf, buf_memory_size / 2, true);
-
-      ptr = Buff_Ring_Data_Check_Out(buf, buf_memory_size, true, true);
-      if(NULL != ptr)
-      {
-         memcpy(ptr, src, buf_memory_size);
-
-         Buff_Ring_Data_Check_In(buf, buf_memory_size, true);
+            memcpy(read1, vector[0].data, vector[0].size);
+            memcpy(&read1[vector[0].size], vector[1].data, vector[1].size);
 
-         if(buf_memory_size == Buff_Ring_Read(buf, read1, buf_memory_size, true))
-         {
-            if(0 != memcmp(src, read1, buf_memory_size))
+            if((0 != memcmp(&src[prev_size], read1, prev_size)) || (0 != memcmp(&src[size], &read1[prev_size], size)))
             {
-               printf("line: %5d; %-36s failed with size: %d\n\r", __LINE__, "Buff_Ring_Data_Check_In", buf_memory_size);
+               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read_Check_Out-memcmp");
                failure_cntr++;
             }
-            else
-            {
-               /* ok */
-            }
          }
          else
          {
-            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read_Check_Out");
             failure_cntr++;
          }
-      }
-      else
-      {
-         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
-      }
-   }
-   else
-   {
-      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
-   }
-
-   /**
-    * again the same:
-    * check out / check in data twice, first with size = sizeof(buf) / 2, next size = sizeof(buf) with option overwrite,
-    * at end check if only data from second check_in is present in the buffer
-    */
-   memset(read1, 0, read1_size);
-   ptr = Buff_Ring_Data_Check_Out(buf, buf_memory_size / 2, true, true);
-   if(NULL != ptr)
-   {
-      memcpy(ptr, src, buf_memory_size / 2);
-
-      Buff_Ring_Data_Check_In(buf, buf_memory_size / 2, true);
-
-      ptr = Buff_Ring_Data_Check_Out(buf, buf_memory_size, true, true);
-      if(NULL != ptr)
-      {
-         memcpy(ptr, src, buf_memory_size);
 
-         Buff_Ring_Data_Check_In(buf, buf_memory_size, true);
+         on_read_cntr = on_extensions.on_read_cntr;
 
-         if(buf_memory_size == Buff_Ring_Read(buf, read1, buf_memory_size, true))
-         {
-            if(0 != memcmp(src, read1, buf_memory_size))
-            {
-               printf("line: %5d; %-36s failed with size: %d\n\r", __LINE__, "Buff_Ring_Data_Check_In", buf_memory_size);
-               failure_cntr++;
-            }
-            else
-            {
-               /* ok */
-            }
-         }
-         else
+         if((prev_size != Buff_Ring_Read_Check_In(buf, prev_size, true))
+            || (size != Buff_Ring_Get_Busy_Size(buf, true))
+            || ((on_read_cntr + 1) != on_extensions.on_read_cntr))
          {
-            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read_Check_In");
             failure_cntr++;
          }
       }
       else
       {
-         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_Out");
+         failure_cntr++;
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
       }
-   }
-   else
-   {
-      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_Out");
-   }
 
-   if(0 == failure_cntr)
-   {
-      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_Data_Check_In");
+      prev_size = size;
    }
-   else
+
+   if((prev_size != Buff_Ring_Read_Check_In(buf, buf_memory_size, true)) || (!Buff_Ring_Is_Empty(buf, true)) || (!wrapped))
    {
-      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
+      failure_cntr++;
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read_Check_In all");
    }
 
-   Buff_Ring_Clear(buf, true);
-
-   ptr = Buff_Ring_Data_Check_Out(buf, buf_memory_size / 6, true, true);
-
-   if(NULL != ptr)
+   if(0 == failure_cntr)
    {
-      Buff_Ring_Data_Check_In(buf, buf_memory_size / 6, true);
-
-      Buff_Ring_Remove(buf, Buff_Ring_Get_Busy_Size(buf, true) - 1, true);
-
-      if(1 != Buff_Ring_Get_Busy_Size(buf, true))
-      {
-         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Remove");
-      }
-      else
-      {
-         ptr = Buff_Ring_Data_Check_Out(buf, buf_memory_size / 2, true, true);
-
-         if(NULL != ptr)
-         {
-            Buff_Ring_Data_Check_In(buf, buf_memory_size / 2, true);
-
-            if(((buf_memory_size / 2) + 1) != Buff_Ring_Get_Busy_Size(buf, true))
-            {
-               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
-            }
-            else
-            {
-               ptr = Buff_Ring_Data_Check_Out(buf, (buf_memory_size * 5) / 6, false, true);
-
-               if(NULL != ptr)
-               {
-                  printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_Out???");
-               }
-               else
-               {
-                  /* ok */
-               }
-            }
-         }
-         else
-         {
-            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_Out");
-         }
-      }
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_Read_Check_Out/Check_In");
    }
    else
    {
-      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_Out");
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read_Check_Out/Check_In");
    }
-} /* check_out_in_test */
+} /* read_check_out_in_test */
 
-static void add_write_overwrite_if_no_free_space_tests(
+static void check_out_vector_in_test(
    Buff_Ring_XT *buf,
    const uint8_t *src,
    size_t src_size,
@@ -3937,8 +3835,10 @@ static void add_write_overwrite_if_no_free_space_tests(
    Buff_Ring_Extensions_XT *extension,
    Buff_Ring_Extensions_XT *protected_extension)
 {
-   int prev_size;
+   Buff_Writeable_Vector_XT vector[2];
+   Buff_Size_DT free_size;
    int size;
+   bool_t wrapped = false;
 
    (void)Buff_Ring_Init(buf, memory, buf_memory_size);
    Buff_Ring_Init_Extension(extension);
@@ -3946,371 +3846,3267 @@ static void add_write_overwrite_if_no_free_space_tests(
    Buff_Ring_Init_Extension(protected_extension);
    (void)Buff_Ring_Add_Protected_Extension(buf, protected_extension);
 
-   extension->on_read             = main_ring_on_read;
-   extension->on_write            = main_ring_on_write;
-   extension->on_overwrite        = main_ring_on_overwrite;
-   extension->on_remove           = main_ring_on_remove;
-   extension->on_read_params      = &on_extensions;
-   extension->on_write_params     = &on_extensions;
-   extension->on_overwrite_params = &on_extensions;
-   extension->on_remove_params    = &on_extensions;
-
-   protected_extension->on_read             = main_ring_on_read;
-   protected_extension->on_write            = main_ring_on_write;
-   protected_extension->on_overwrite        = main_ring_on_overwrite;
-   protected_extension->on_remove           = main_ring_on_remove;
-   protected_extension->on_read_params      = &on_protected_extensions;
-   protected_extension->on_write_params     = &on_protected_extensions;
-   protected_extension->on_overwrite_params = &on_protected_extensions;
-   protected_extension->on_remove_params    = &on_protected_extensions;
-
    failure_cntr = 0;
 
-   prev_size = buf_memory_size - 1;
+   /* one byte is always left in the buffer, so indexes are not moved to the begining when buffer becomes empty */
+   (void)Buff_Ring_Write(buf, src, 1, false, true);
 
-   if(prev_size == Buff_Ring_Write(buf, &src[0], prev_size, true, true))
+   for(size = 2; size < (buf_memory_size / 2); size += 7)
    {
-      prev_size = 16;
-      if(prev_size == Buff_Ring_Write(buf, &src[0], prev_size, true, true))
+      memset(read1, 0, read1_size);
+
+      free_size = Buff_Ring_Data_Check_Out_Vector(buf, vector, size, false, true);
+
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_PADDED_LAYOUT)
+      /* producer's copy of first_busy is refreshed only if it shows less free space than needed */
+      if((free_size > Buff_Ring_Get_Free_Size(buf, false)) || ((vector[0].size + vector[1].size) != free_size) || (free_size < size))
+#else
+      if((free_size != Buff_Ring_Get_Free_Size(buf, false)) || ((vector[0].size + vector[1].size) != free_size) || (free_size < size))
+#endif
       {
-         /* ok */
-         prev_size = buf_memory_size - 16;
-         if(prev_size == Buff_Ring_Read(buf, read1, prev_size, true))
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_Out_Vector");
+         failure_cntr++;
+      }
+      else
+      {
+         if((vector[0].size < size) && (0 != vector[1].size))
          {
-            if(0 != memcmp(&src[15], read1, prev_size))
-            {
-               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read-memcmp");
-               failure_cntr++;
-            }
-            else
-            {
-               /* ok */
-            }
+            wrapped = true;
+            memcpy(vector[0].data, &src[size], vector[0].size);
+            memcpy(vector[1].data, &src[size + vector[0].size], size - vector[0].size);
          }
          else
          {
-            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read");
-            failure_cntr++;
+            memcpy(vector[0].data, &src[size], size);
          }
       }
-      else
+
+      if((Buff_Ring_Data_Check_In(buf, size, true) >= buf_memory_size)
+         || (1 != Buff_Ring_Remove(buf, 1, true))
+         || ((size - 1) != Buff_Ring_Read(buf, read1, size - 1, true))
+         || (0 != memcmp(&src[size], read1, size - 1)))
       {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
          failure_cntr++;
-         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
       }
    }
-   else
+
+   if(!wrapped)
    {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_Out_Vector wrap");
       failure_cntr++;
-      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
    }
 
-   Buff_Ring_Clear(buf, true);
-
-   prev_size = buf_memory_size - 1;
-
-   vendor_cpy_cntr_limit = buf_memory_size;
-   vendor_cpy_cntr = 0;
-
-   if(prev_size == Buff_Ring_Write_Vendor(buf, &src[0], prev_size, main_vendor_memcpy, true, true))
+   if(0 == failure_cntr)
    {
-      vendor_cpy_cntr_limit = buf_memory_size;
-      vendor_cpy_cntr = 0;
-      prev_size = 16;
-      if(prev_size == Buff_Ring_Write_Vendor(buf, &src[0], prev_size, main_vendor_memcpy, true, true))
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_Data_Check_Out_Vector/Check_In");
+   }
+   else
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_Out_Vector/Check_In");
+   }
+} /* check_out_vector_in_test */
+
+static void mirrored_tests(
+   Buff_Ring_XT *buf,
+   const uint8_t *src,
+   size_t src_size,
+   uint8_t *read1,
+   size_t read1_size)
+{
+   uint8_t *ptr;
+   Buff_Size_DT size;
+   int i;
+   bool_t wrapped = false;
+
+   failure_cntr = 0;
+
+   if(!Buff_Ring_Init_Mirrored(buf, 1000))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Init_Mirrored");
+      return;
+   }
+
+   if((buf->size < 1000) || (!buf->is_mirrored))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Init_Mirrored-size");
+      failure_cntr++;
+   }
+
+   /* one byte is always left in the buffer, so indexes are not moved to the begining when buffer becomes empty */
+   (void)Buff_Ring_Write(buf, src, 1, false, true);
+
+   for(i = 0; i < 200; i++)
+   {
+      size = (Buff_Size_DT)(rand() % read1_size) + 1;
+
+      if(Buff_Ring_Get_Current_Pos(buf, true) > (buf->size - size))
+      {
+         wrapped = true;
+      }
+
+      if(size != Buff_Ring_Write(buf, src, size, false, true))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
+         failure_cntr++;
+      }
+
+      memset(read1, 0, read1_size);
+
+      if((size != Buff_Ring_Peak(buf, read1, size, 1, true)) || (0 != memcmp(src, read1, size)))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Peak");
+         failure_cntr++;
+      }
+
+      memset(read1, 0, read1_size);
+
+      if((1 != Buff_Ring_Remove(buf, 1, true))
+         || ((size - 1) != Buff_Ring_Read(buf, read1, size - 1, true))
+         || (0 != memcmp(src, read1, size - 1)))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read");
+         failure_cntr++;
+      }
+   }
+
+   Buff_Ring_Clear(buf, true);
+
+   /* continous check-out at the end of the memory, without resizing the buffer */
+   (void)Buff_Ring_Write(buf, src, buf->size - 10, false, true);
+   (void)Buff_Ring_Remove(buf, buf->size - 20, true);
+
+   ptr = (uint8_t*)Buff_Ring_Data_Check_Out(buf, 100, false, true);
+
+   if((BUFF_MAKE_INVALID_PTR(uint8_t) == ptr) || (Buff_Ring_Get_Continous_Free_Size(buf, true) != Buff_Ring_Get_Free_Size(buf, true)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_Out");
+      failure_cntr++;
+   }
+   else
+   {
+      memcpy(ptr, &src[100], 100);
+      (void)Buff_Ring_Data_Check_In(buf, 100, true);
+      (void)Buff_Ring_Remove(buf, 10, true);
+
+      if((100 != Buff_Ring_Read(buf, read1, read1_size, true)) || (0 != memcmp(&src[100], read1, 100))
+         || (0 != memcmp(buf->memory, &((uint8_t*)(buf->memory))[buf->size], 100)))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
+         failure_cntr++;
+      }
+   }
+
+   Buff_Ring_Deinit_Mirrored(buf);
+
+   if(!wrapped)
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write wrap");
+      failure_cntr++;
+   }
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_Init_Mirrored");
+   }
+   else
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Init_Mirrored");
+   }
+} /* mirrored_tests */
+
+static void write_cursor_tests(
+   Buff_Ring_XT *buf,
+   const uint8_t *src,
+   size_t src_size,
+   uint8_t *memory,
+   size_t buf_memory_size,
+   uint8_t *read1,
+   size_t read1_size)
+{
+   Buff_Readable_Vector_Cursor_XT vector_cursor;
+   Buff_Readable_Tree_Cursor_XT tree_cursor;
+   Buff_Readable_Vector_XT vector[4];
+   Buff_Readable_Tree_XT tree[2];
+   Buff_Readable_Tree_XT branch[2];
+   Buff_Readable_Tree_XT sub_branch[1];
+   Buff_Size_DT size;
+   Buff_Size_DT written;
+   Buff_Size_DT result;
+   int i;
+
+#if(BUFF_RING_USE_POWER_OF_2_SIZE)
+   if(buf_memory_size > 64)
+   {
+      buf_memory_size = 64;
+   }
+#else
+   if(buf_memory_size > 100)
+   {
+      buf_memory_size = 100;
+   }
+#endif
+
+   if(read1_size > 500)
+   {
+      read1_size = 500;
+   }
+
+   /* 500 bytes of src: vector[0] + vector[1] + (empty) vector[2] + vector[3] */
+   vector[0].data = src;
+   vector[0].size = 7;
+   vector[1].data = &src[7];
+   vector[1].size = 213;
+   vector[2].data = &src[220];
+   vector[2].size = 0;
+   vector[3].data = &src[220];
+   vector[3].size = 280;
+
+   /* tree: tree[0] -> branch[0] -> vector[0..1]; tree[1] -> branch[1] -> sub_branch[0] -> vector[2..3] */
+   tree[0].elem_type.tree.branch                   = &branch[0];
+   tree[0].elem_type.tree.branch_num_elems         = 1;
+   tree[0].is_branch                               = BUFF_TRUE;
+   tree[1].elem_type.tree.branch                   = &branch[1];
+   tree[1].elem_type.tree.branch_num_elems         = 1;
+   tree[1].is_branch                               = BUFF_TRUE;
+   branch[0].elem_type.vector.vector               = vector;
+   branch[0].elem_type.vector.vector_num_elems     = 2;
+   branch[0].is_branch                             = BUFF_FALSE;
+   branch[1].elem_type.tree.branch                 = sub_branch;
+   branch[1].elem_type.tree.branch_num_elems       = Num_Elems(sub_branch);
+   branch[1].is_branch                             = BUFF_TRUE;
+   sub_branch[0].elem_type.vector.vector           = &vector[2];
+   sub_branch[0].elem_type.vector.vector_num_elems = 2;
+   sub_branch[0].is_branch                         = BUFF_FALSE;
+
+   failure_cntr = 0;
+
+   for(i = 0; i < 2; i++)
+   {
+      (void)Buff_Ring_Init(buf, memory, buf_memory_size);
+
+      /* one byte is always left in the buffer, so indexes are not moved to the begining when buffer becomes empty */
+      (void)Buff_Ring_Write(buf, src, 1, false, true);
+
+      Buff_Readable_Vector_Cursor_Init(&vector_cursor, vector, Num_Elems(vector), 0);
+      Buff_Readable_Tree_Cursor_Init(&tree_cursor, tree, Num_Elems(tree), 0);
+
+      /* stream written in chunks of random size; each chunk starts where previous one ended */
+      written = 0;
+      do
+      {
+         size = (Buff_Size_DT)(rand() % (buf_memory_size - 1)) + 1;
+
+         if(0 == i)
+         {
+            result = Buff_Ring_Write_From_Vector_Cursor(buf, &vector_cursor, size, false, true);
+         }
+         else
+         {
+            result = Buff_Ring_Write_From_Tree_Cursor(buf, &tree_cursor, size, false, true);
+         }
+
+         if((result > size) || ((result != Buff_Ring_Peak(buf, &read1[written], result, 1, true))))
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write_From_Cursor");
+            failure_cntr++;
+            break;
+         }
+
+         (void)Buff_Ring_Remove(buf, result, true);
+         written += result;
+      }while((0 != result) && (written < read1_size));
+
+      if((read1_size != written) || (0 != memcmp(read1, src, read1_size)))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, (0 == i) ? "Buff_Ring_Write_From_Vector_Cursor" : "Buff_Ring_Write_From_Tree_Cursor");
+         failure_cntr++;
+      }
+
+      /* end of data reached */
+      if(0 != ((0 == i) ? Buff_Ring_Write_From_Vector_Cursor(buf, &vector_cursor, 10, false, true)
+         : Buff_Ring_Write_From_Tree_Cursor(buf, &tree_cursor, 10, false, true)))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write_From_Cursor-end");
+         failure_cntr++;
+      }
+   }
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_Write_From_Vector/Tree_Cursor");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Ring_Write_From_Vector/Tree_Cursor", failure_cntr);
+   }
+} /* write_cursor_tests */
+
+static void check_out_in_test(
+   Buff_Ring_XT *buf,
+   const uint8_t *src,
+   size_t src_size,
+   uint8_t *memory,
+   size_t buf_memory_size,
+   uint8_t *read1,
+   size_t read1_size,
+   Buff_Ring_Extensions_XT *extension,
+   Buff_Ring_Extensions_XT *protected_extension)
+{
+   uint8_t *ptr;
+   int prev_size;
+   int size;
+
+   (void)Buff_Ring_Init(buf, memory, buf_memory_size);
+   Buff_Ring_Init_Extension(extension);
+   (void)Buff_Ring_Add_Extension(buf, extension);
+   Buff_Ring_Init_Extension(protected_extension);
+   (void)Buff_Ring_Add_Protected_Extension(buf, protected_extension);
+
+   extension->on_read             = main_ring_on_read;
+   extension->on_write            = main_ring_on_write;
+   extension->on_overwrite        = main_ring_on_overwrite;
+   extension->on_remove           = main_ring_on_remove;
+   extension->on_read_params      = &on_extensions;
+   extension->on_write_params     = &on_extensions;
+   extension->on_overwrite_params = &on_extensions;
+   extension->on_remove_params    = &on_extensions;
+
+   protected_extension->on_read             = main_ring_on_read;
+   protected_extension->on_write            = main_ring_on_write;
+   protected_extension->on_overwrite        = main_ring_on_overwrite;
+   protected_extension->on_remove           = main_ring_on_remove;
+   protected_extension->on_read_params      = &on_protected_extensions;
+   protected_extension->on_write_params     = &on_protected_extensions;
+   protected_extension->on_overwrite_params = &on_protected_extensions;
+   protected_extension->on_remove_params    = &on_protected_extensions;
+
+   failure_cntr = 0;
+
+   prev_size = 1;
+
+   if(prev_size == Buff_Ring_Write(buf, &src[prev_size], prev_size, true, true))
+   {
+      /* ok */
+   }
+   else
+   {
+      failure_cntr++;
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write 1B");
+   }
+
+   /* add data in a loop with variable size, read in same step data added in previous step */
+   for(size = 2; size < (buf_memory_size / 3); size++)
+   {
+      memset(read1, 0, read1_size);
+      ptr = Buff_Ring_Data_Check_Out(buf, size, true, true);
+      if(NULL != ptr)
+      {
+         memcpy(ptr, &src[size], size);
+
+         Buff_Ring_Data_Check_In(buf, size, true);
+
+         if(prev_size == Buff_Ring_Read(buf, read1, prev_size, true))
+         {
+            if(0 != memcmp(&src[prev_size], read1, prev_size))
+            {
+               printf("line: %5d; %-36s failed with size: %d\n\r", __LINE__, "Buff_Ring_Data_Check_In", prev_size);
+               failure_cntr++;
+            }
+            else
+            {
+               /* ok */
+            }
+         }
+         else
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
+            failure_cntr++;
+         }
+      }
+      else
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
+      }
+
+      prev_size = size;
+   }
+
+   /**
+    * check out / check in data twice, first with size = sizeof(buf) / 2, next size = sizeof(buf) with option overwrite,
+    * at end check if only data from second check_in is present in the buffer
+    */
+   memset(read1, 0, read1_size);
+   ptr = Buff_Ring_Data_Check_Out(buf, buf_memory_size / 2, true, true);
+   if(NULL != ptr)
+   {
+      memcpy(ptr, &src[buf_memory_size / 2], buf_memory_size / 2);
+
+      Buff_Ring_Data_Check_In(buf, buf_memory_size / 2, true);
+
+      ptr = Buff_Ring_Data_Check_Out(buf, buf_memory_size, true, true);
+      if(NULL != ptr)
+      {
+         memcpy(ptr, src, buf_memory_size);
+
+         Buff_Ring_Data_Check_In(buf, buf_memory_size, true);
+
+         if(buf_memory_size == Buff_Ring_Read(buf, read1, buf_memory_size, true))
+         {
+            if(0 != memcmp(src, read1, buf_memory_size))
+            {
+               printf("line: %5d; %-36s failed with size: %d\n\r", __LINE__, "Buff_Ring_Data_Check_In", buf_memory_size);
+               failure_cntr++;
+            }
+            else
+            {
+               /* ok */
+            }
+         }
+         else
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
+            failure_cntr++;
+         }
+      }
+      else
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
+      }
+   }
+   else
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
+   }
+
+   /**
+    * again the same:
+    * check out / check in data twice, first with size = sizeof(buf) / 2, next size = sizeof(buf) with option overwrite,
+    * at end check if only data from second check_in is present in the buffer
+    */
+   memset(read1, 0, read1_size);
+   ptr = Buff_Ring_Data_Check_Out(buf, buf_memory_size / 2, true, true);
+   if(NULL != ptr)
+   {
+      memcpy(ptr, src, buf_memory_size / 2);
+
+      Buff_Ring_Data_Check_In(buf, buf_memory_size / 2, true);
+
+      ptr = Buff_Ring_Data_Check_Out(buf, buf_memory_size, true, true);
+      if(NULL != ptr)
+      {
+         memcpy(ptr, src, buf_memory_size);
+
+         Buff_Ring_Data_Check_In(buf, buf_memory_size, true);
+
+         if(buf_memory_size == Buff_Ring_Read(buf, read1, buf_memory_size, true))
+         {
+            if(0 != memcmp(src, read1, buf_memory_size))
+            {
+               printf("line: %5d; %-36s failed with size: %d\n\r", __LINE__, "Buff_Ring_Data_Check_In", buf_memory_size);
+               failure_cntr++;
+            }
+            else
+            {
+               /* ok */
+            }
+         }
+         else
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
+            failure_cntr++;
+         }
+      }
+      else
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_Out");
+      }
+   }
+   else
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_Out");
+   }
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_Data_Check_In");
+   }
+   else
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
+   }
+
+   Buff_Ring_Clear(buf, true);
+
+   ptr = Buff_Ring_Data_Check_Out(buf, buf_memory_size / 6, true, true);
+
+   if(NULL != ptr)
+   {
+      Buff_Ring_Data_Check_In(buf, buf_memory_size / 6, true);
+
+      Buff_Ring_Remove(buf, Buff_Ring_Get_Busy_Size(buf, true) - 1, true);
+
+      if(1 != Buff_Ring_Get_Busy_Size(buf, true))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Remove");
+      }
+      else
+      {
+         ptr = Buff_Ring_Data_Check_Out(buf, buf_memory_size / 2, true, true);
+
+         if(NULL != ptr)
+         {
+            Buff_Ring_Data_Check_In(buf, buf_memory_size / 2, true);
+
+            if(((buf_memory_size / 2) + 1) != Buff_Ring_Get_Busy_Size(buf, true))
+            {
+               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_In");
+            }
+            else
+            {
+               ptr = Buff_Ring_Data_Check_Out(buf, (buf_memory_size * 5) / 6, false, true);
+
+               if(NULL != ptr)
+               {
+                  printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_Out???");
+               }
+               else
+               {
+                  /* ok */
+               }
+            }
+         }
+         else
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_Out");
+         }
+      }
+   }
+   else
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Data_Check_Out");
+   }
+} /* check_out_in_test */
+
+static void add_write_overwrite_if_no_free_space_tests(
+   Buff_Ring_XT *buf,
+   const uint8_t *src,
+   size_t src_size,
+   uint8_t *memory,
+   size_t buf_memory_size,
+   uint8_t *read1,
+   size_t read1_size,
+   Buff_Ring_Extensions_XT *extension,
+   Buff_Ring_Extensions_XT *protected_extension)
+{
+   int prev_size;
+   int size;
+
+   (void)Buff_Ring_Init(buf, memory, buf_memory_size);
+   Buff_Ring_Init_Extension(extension);
+   (void)Buff_Ring_Add_Extension(buf, extension);
+   Buff_Ring_Init_Extension(protected_extension);
+   (void)Buff_Ring_Add_Protected_Extension(buf, protected_extension);
+
+   extension->on_read             = main_ring_on_read;
+   extension->on_write            = main_ring_on_write;
+   extension->on_overwrite        = main_ring_on_overwrite;
+   extension->on_remove           = main_ring_on_remove;
+   extension->on_read_params      = &on_extensions;
+   extension->on_write_params     = &on_extensions;
+   extension->on_overwrite_params = &on_extensions;
+   extension->on_remove_params    = &on_extensions;
+
+   protected_extension->on_read             = main_ring_on_read;
+   protected_extension->on_write            = main_ring_on_write;
+   protected_extension->on_overwrite        = main_ring_on_overwrite;
+   protected_extension->on_remove           = main_ring_on_remove;
+   protected_extension->on_read_params      = &on_protected_extensions;
+   protected_extension->on_write_params     = &on_protected_extensions;
+   protected_extension->on_overwrite_params = &on_protected_extensions;
+   protected_extension->on_remove_params    = &on_protected_extensions;
+
+   failure_cntr = 0;
+
+   prev_size = buf_memory_size - 1;
+
+   if(prev_size == Buff_Ring_Write(buf, &src[0], prev_size, true, true))
+   {
+      prev_size = 16;
+      if(prev_size == Buff_Ring_Write(buf, &src[0], prev_size, true, true))
+      {
+         /* ok */
+         prev_size = buf_memory_size - 16;
+         if(prev_size == Buff_Ring_Read(buf, read1, prev_size, true))
+         {
+            if(0 != memcmp(&src[15], read1, prev_size))
+            {
+               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read-memcmp");
+               failure_cntr++;
+            }
+            else
+            {
+               /* ok */
+            }
+         }
+         else
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read");
+            failure_cntr++;
+         }
+      }
+      else
+      {
+         failure_cntr++;
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
+      }
+   }
+   else
+   {
+      failure_cntr++;
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
+   }
+
+   Buff_Ring_Clear(buf, true);
+
+   prev_size = buf_memory_size - 1;
+
+   vendor_cpy_cntr_limit = buf_memory_size;
+   vendor_cpy_cntr = 0;
+
+   if(prev_size == Buff_Ring_Write_Vendor(buf, &src[0], prev_size, main_vendor_memcpy, true, true))
+   {
+      vendor_cpy_cntr_limit = buf_memory_size;
+      vendor_cpy_cntr = 0;
+      prev_size = 16;
+      if(prev_size == Buff_Ring_Write_Vendor(buf, &src[0], prev_size, main_vendor_memcpy, true, true))
+      {
+         /* ok */
+         prev_size = buf_memory_size - 16;
+         if(prev_size == Buff_Ring_Read_Vendor(buf, read1, prev_size, main_vendor_memcpy, true))
+         {
+            if(0 != memcmp(&src[15], read1, prev_size))
+            {
+               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read-memcmp");
+               failure_cntr++;
+            }
+            else
+            {
+               /* ok */
+            }
+         }
+         else
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read");
+            failure_cntr++;
+         }
+      }
+      else
+      {
+         failure_cntr++;
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
+      }
+   }
+   else
+   {
+      failure_cntr++;
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
+   }
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "overwrite_if_no_free_space");
+   }
+   else
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "overwrite_if_no_free_space");
+   }
+} /* add_read_tests */
+
+static void ring_to_ring_copy_tests(
+   Buff_Ring_XT *buf1,
+   Buff_Ring_XT *buf2,
+   const uint8_t *src,
+   size_t src_size,
+   uint8_t *memory1,
+   size_t buf_memory_size1,
+   uint8_t *memory2,
+   size_t buf_memory_size2,
+   uint8_t *read1,
+   size_t read1_size,
+   Buff_Ring_Extensions_XT *extension1,
+   Buff_Ring_Extensions_XT *protected_extension1,
+   Buff_Ring_Extensions_XT *extension2,
+   Buff_Ring_Extensions_XT *protected_extension2)
+{
+   size_t i;
+   size_t offset;
+   size_t on_remove_cntr;
+
+   (void)Buff_Ring_Init(buf1, memory1, buf_memory_size1);
+
+   (void)Buff_Ring_Init(buf2, memory2, buf_memory_size2);
+   Buff_Ring_Init_Extension(extension2);
+   (void)Buff_Ring_Add_Extension(buf2, extension2);
+   Buff_Ring_Init_Extension(protected_extension2);
+   (void)Buff_Ring_Add_Protected_Extension(buf2, protected_extension2);
+
+   extension2->on_read              = main_ring_on_read;
+   extension2->on_write             = main_ring_on_write;
+   extension2->on_overwrite         = main_ring_on_overwrite;
+   extension2->on_remove            = main_ring_on_remove;
+   extension2->on_read_params       = &on_extensions;
+   extension2->on_write_params      = &on_extensions;
+   extension2->on_overwrite_params  = &on_extensions;
+   extension2->on_remove_params     = &on_extensions;
+
+   protected_extension2->on_read             = main_ring_on_read;
+   protected_extension2->on_write            = main_ring_on_write;
+   protected_extension2->on_overwrite        = main_ring_on_overwrite;
+   protected_extension2->on_remove           = main_ring_on_remove;
+   protected_extension2->on_read_params      = &on_protected_extensions;
+   protected_extension2->on_write_params     = &on_protected_extensions;
+   protected_extension2->on_overwrite_params = &on_protected_extensions;
+   protected_extension2->on_remove_params    = &on_protected_extensions;
+
+   failure_cntr = 0;
+
+   for(offset = 0; offset < buf_memory_size1; offset++)
+   {
+      Buff_Ring_Clear(buf1, true);
+      Buff_Ring_Clear(buf2, true);
+
+      if(1 == Buff_Ring_Write(buf1, src, 1, true, true))
+      {
+      }
+      else
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
+         failure_cntr++;
+      }
+
+      if(offset == Buff_Ring_Write(buf2, src, offset, true, true))
+      {
+      }
+      else
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
+         failure_cntr++;
+      }
+
+      for(i = 1; i < src_size; i++)
+      {
+         on_extensions.on_read_cntr       = 0;
+         on_extensions.on_write_cntr      = 0;
+         on_extensions.on_overwrite_cntr  = 0;
+         on_extensions.on_remove_cntr     = 0;
+         on_protected_extensions.on_read_cntr      = 0;
+         on_protected_extensions.on_write_cntr     = 0;
+         on_protected_extensions.on_overwrite_cntr = 0;
+         on_protected_extensions.on_remove_cntr    = 0;
+         if(i < (buf_memory_size1-offset))
+         {
+            if(i == Buff_Ring_Write(buf1, src, i, true, true))
+            {
+            }
+            else
+            {
+               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
+               failure_cntr++;
+            }
+
+            if(i == Buff_Ring_To_Ring_Copy(buf2, buf1, i, 1, true, true))
+            {
+               if((0                      == on_extensions.on_read_cntr)
+                  && (1                      == on_extensions.on_write_cntr)
+                  && (0                      == on_extensions.on_overwrite_cntr)
+                  && (0                      == on_extensions.on_remove_cntr)
+                  && (0                      == on_protected_extensions.on_read_cntr)
+                  && (1                      == on_protected_extensions.on_write_cntr)
+                  && (0                      == on_protected_extensions.on_overwrite_cntr)
+                  && (0                      == on_protected_extensions.on_remove_cntr))
+               {
+               }
+               else
+               {
+                  printf("line: %5d; %-44s failed\n\r", __LINE__, "cntrs check");
+                  failure_cntr++;
+               }
+
+               if(i == Buff_Ring_Peak(buf2, read1, i, offset, true))
+               {
+                  if(0 != memcmp(src, read1, i))
+                  {
+                     printf("line: %5d; %-44s failed; i: %d\n\r", __LINE__, "memcmp Buff_Ring_Peak", i);
+                  }
+                  else
+                  {
+                  }
+               }
+               else
+               {
+                  printf("line: %5d; %-44s failed; buf_busy_size: %d\n\r", __LINE__, "Buff_Ring_Peak", Buff_Ring_Get_Busy_Size(buf2, true));
+                  failure_cntr++;
+               }
+            }
+            else
+            {
+               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_To_Ring_Copy");
+               failure_cntr++;
+            }
+
+            if(i == Buff_Ring_Remove(buf2, i, true))
+            {
+            }
+            else
+            {
+               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Remove");
+               failure_cntr++;
+            }
+
+            if(i == Buff_Ring_Remove(buf1, i, true))
+            {
+            }
+            else
+            {
+               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Remove");
+               failure_cntr++;
+            }
+         }
+      }
+   }
+
+
+
+
+   Buff_Ring_Clear(buf1, true);
+   Buff_Ring_Clear(buf2, true);
+
+   for(i = 1; i < src_size; i++)
+   {
+      on_extensions.on_read_cntr       = 0;
+      on_extensions.on_write_cntr      = 0;
+      on_extensions.on_overwrite_cntr  = 0;
+      on_extensions.on_remove_cntr     = 0;
+      on_protected_extensions.on_read_cntr      = 0;
+      on_protected_extensions.on_write_cntr     = 0;
+      on_protected_extensions.on_overwrite_cntr = 0;
+      on_protected_extensions.on_remove_cntr    = 0;
+      if(i <= (buf_memory_size1))
+      {
+         if(i == Buff_Ring_Write(buf1, src, i, true, true))
+         {
+         }
+         else
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
+            failure_cntr++;
+         }
+
+         offset = Buff_Ring_Get_Busy_Size(buf2, true);
+         on_remove_cntr = 0;
+
+         if(Buff_Ring_Get_Free_Size(buf2, true) < i)
+         {
+            offset -= i - Buff_Ring_Get_Free_Size(buf2, true);
+            on_remove_cntr = 1;
+         }
+
+         if(i == Buff_Ring_To_Ring_Copy(buf2, buf1, i, 0, true, true))
+         {
+            if((0                      == on_extensions.on_read_cntr)
+               && (1                      == on_extensions.on_write_cntr)
+               && (0                      == on_extensions.on_overwrite_cntr)
+               && (on_remove_cntr         == on_extensions.on_remove_cntr)
+               && (0                      == on_protected_extensions.on_read_cntr)
+               && (1                      == on_protected_extensions.on_write_cntr)
+               && (0                      == on_protected_extensions.on_overwrite_cntr)
+               && (on_remove_cntr         == on_protected_extensions.on_remove_cntr))
+            {
+            }
+            else
+            {
+               printf("line: %5d; %-44s failed\n\r", __LINE__, "cntrs check");
+               failure_cntr++;
+            }
+
+            if(i == Buff_Ring_Peak(buf2, read1, i, offset, true))
+            {
+               if(0 != memcmp(src, read1, i))
+               {
+                  printf("line: %5d; %-44s failed; i: %d\n\r", __LINE__, "memcmp Buff_Ring_Peak", i);
+               }
+               else
+               {
+               }
+            }
+            else
+            {
+               printf("line: %5d; %-44s failed; buf_busy_size: %d\n\r", __LINE__, "Buff_Ring_Peak", Buff_Ring_Get_Busy_Size(buf2, true));
+               failure_cntr++;
+            }
+         }
+         else
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_To_Ring_Copy");
+            failure_cntr++;
+         }
+
+         if(i == Buff_Ring_Remove(buf1, i, true))
+         {
+         }
+         else
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Remove");
+            failure_cntr++;
+         }
+      }
+   }
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_To_Ring_Copy");
+   }
+   else
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_To_Ring_Copy");
+   }
+} /* ring_to_ring_copy_tests */
+
+#if(BUFF_RING_USE_LOCK_FREE_SPSC)
+typedef struct
+{
+   Buff_Ring_XT *buf;
+   size_t total_size;
+   size_t transferred;
+   size_t failures;
+}spsc_thread_t;
+
+/* sequence modulo prime number, so lost or doubled chunk never gives the same bytes as expected ones */
+#define SPSC_SEQUENCE_BYTE(pos)     ((uint8_t)((pos) % 251))
+#if(BUFF_RING_USE_POWER_OF_2_SIZE)
+#define SPSC_RING_SIZE              128
+#else
+#define SPSC_RING_SIZE              97
+#endif
+
+static void *spsc_producer(void *params)
+{
+   spsc_thread_t *producer = (spsc_thread_t*)params;
+   uint8_t chunk[64];
+   size_t chunk_size = 0;
+   size_t cntr;
+   Buff_Size_DT written;
+
+   while(producer->transferred < producer->total_size)
+   {
+      /* different sizes of chunks - buffer is wrapped in different places by producer and consumer */
+      chunk_size = (chunk_size % sizeof(chunk)) + 1;
+
+      if(chunk_size > (producer->total_size - producer->transferred))
+      {
+         chunk_size = producer->total_size - producer->transferred;
+      }
+
+      for(cntr = 0; cntr < chunk_size; cntr++)
+      {
+         chunk[cntr] = SPSC_SEQUENCE_BYTE(producer->transferred + cntr);
+      }
+
+      written = Buff_Ring_Write(producer->buf, chunk, chunk_size, false, false);
+
+      if(written > chunk_size)
+      {
+         producer->failures++;
+         break;
+      }
+
+      producer->transferred += written;
+
+      if(0 == written)
+      {
+         (void)sched_yield();
+      }
+   }
+
+   return NULL;
+} /* spsc_producer */
+
+static void *spsc_consumer(void *params)
+{
+   spsc_thread_t *consumer = (spsc_thread_t*)params;
+   uint8_t chunk[64];
+   size_t chunk_size = 0;
+   size_t cntr;
+   Buff_Size_DT read;
+
+   while(consumer->transferred < consumer->total_size)
+   {
+      chunk_size = ((chunk_size * 7) % sizeof(chunk)) + 1;
+
+      read = Buff_Ring_Read(consumer->buf, chunk, chunk_size, false);
+
+      if(read > chunk_size)
+      {
+         consumer->failures++;
+         break;
+      }
+
+      for(cntr = 0; cntr < read; cntr++)
+      {
+         if(SPSC_SEQUENCE_BYTE(consumer->transferred + cntr) != chunk[cntr])
+         {
+            consumer->failures++;
+         }
+      }
+
+      consumer->transferred += read;
+
+      if(0 == read)
+      {
+         (void)sched_yield();
+      }
+   }
+
+   return NULL;
+} /* spsc_consumer */
+#endif
+
+static void spsc_tests(
+   Buff_Ring_XT *buf,
+   uint8_t *src,
+   size_t src_size,
+   uint8_t *memory,
+   size_t buf_memory_size,
+   uint8_t *read_data,
+   size_t read_size)
+{
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_INIT_ENABLED && BUFF_RING_WRITE_ENABLED && BUFF_RING_READ_ENABLED \
+   && BUFF_RING_CLEAR_ENABLED && BUFF_RING_IS_EMPTY_ENABLED && BUFF_RING_IS_FULL_ENABLED && BUFF_RING_GET_BUSY_SIZE_ENABLED \
+   && BUFF_RING_GET_FREE_SIZE_ENABLED)
+   spsc_thread_t producer;
+   spsc_thread_t consumer;
+   pthread_t producer_thread;
+   pthread_t consumer_thread;
+
+   failure_cntr = 0;
+
+   if((buf_memory_size < 100) || (src_size < 100) || (read_size < 100))
+   {
+      return;
+   }
+
+   /* one byte of buffer always stays free - it distinguishes full buffer from empty one */
+   (void)Buff_Ring_Init(buf, memory, 16);
+
+   if((15 != Buff_Ring_Get_Free_Size(buf, false)) || (15 != Buff_Ring_Write(buf, src, 20, false, false))
+      || (!Buff_Ring_Is_Full(buf, false)) || (0 != Buff_Ring_Write(buf, src, 1, false, false))
+      || (10 != Buff_Ring_Read(buf, read_data, 10, false)) || (0 != memcmp(read_data, src, 10)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write/Read SPSC full");
+      failure_cntr++;
+   }
+
+#if(BUFF_RING_USE_PADDED_LAYOUT)
+   /* indexes of producer and consumer are in different cache lines - each side reads index of opposite side
+      only if its own copy shows not enough free space / data */
+   if((((size_t)((uint8_t*)(&buf->first_busy) - (uint8_t*)(&buf->first_free))) < BUFF_CACHE_LINE_SIZE)
+      || (0 != buf->cached_first_busy) || (15 != buf->cached_first_free))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write/Read SPSC padded");
+      failure_cntr++;
+   }
+#endif
+
+   /* data wraps the end of buffer; emptied buffer is not rewound - first_free belongs to producer */
+   if((10 != Buff_Ring_Write(buf, &src[20], 10, false, false)) || (15 != Buff_Ring_Get_Busy_Size(buf, false))
+      || (15 != Buff_Ring_Read(buf, read_data, 100, false)) || (0 != memcmp(read_data, &src[10], 5))
+      || (0 != memcmp(&read_data[5], &src[20], 10)) || (!Buff_Ring_Is_Empty(buf, false))
+      || (9 != buf->first_free) || (buf->first_busy != buf->first_free))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write/Read SPSC wrap");
+      failure_cntr++;
+   }
+
+#if(BUFF_RING_USE_PADDED_LAYOUT)
+   if((10 != buf->cached_first_busy) || (9 != buf->cached_first_free))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write/Read SPSC padded wrap");
+      failure_cntr++;
+   }
+#endif
+
+   (void)Buff_Ring_Write(buf, src, 5, false, false);
+   Buff_Ring_Clear(buf, false);
+
+   if((!Buff_Ring_Is_Empty(buf, false)) || (14 != buf->first_free) || (buf->first_busy != buf->first_free) || (15 != Buff_Ring_Get_Free_Size(buf, false)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Clear SPSC");
+      failure_cntr++;
+   }
+
+   /* producer and consumer in separate threads, without any lock - each byte must be read once, in order of writing */
+   (void)Buff_Ring_Init(buf, memory, SPSC_RING_SIZE);
+
+   memset(&producer, 0, sizeof(producer));
+   memset(&consumer, 0, sizeof(consumer));
+   producer.buf        = buf;
+   producer.total_size = 1000000;
+   consumer.buf        = buf;
+   consumer.total_size = producer.total_size;
+
+   if((0 != pthread_create(&consumer_thread, NULL, spsc_consumer, &consumer))
+      || (0 != pthread_create(&producer_thread, NULL, spsc_producer, &producer)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "pthread_create");
+      failure_cntr++;
+      return;
+   }
+
+   (void)pthread_join(producer_thread, NULL);
+   (void)pthread_join(consumer_thread, NULL);
+
+   if((0 != producer.failures) || (0 != consumer.failures) || (producer.total_size != producer.transferred)
+      || (consumer.total_size != consumer.transferred) || (!Buff_Ring_Is_Empty(buf, false)))
+   {
+      printf("line: %5d; %-44s failed; %d order errors\n\r", __LINE__, "Buff_Ring_Write/Read SPSC threads", (int)consumer.failures);
+      failure_cntr++;
+   }
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring SPSC");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Ring SPSC", failure_cntr);
+   }
+#endif
+} /* spsc_tests */
+
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_MULTI_PRODUCER)
+#define MP_NUM_PRODUCERS         4
+#define MP_RECORD_SIZE           8
+#define MP_NUM_RECORDS           20000
+#if(BUFF_RING_USE_POWER_OF_2_SIZE)
+#define MP_RING_SIZE             128
+#else
+#define MP_RING_SIZE             100
+#endif
+
+typedef struct
+{
+   Buff_Ring_XT *buf;
+   Buff_Size_DT pos;
+   Buff_Size_DT size;
+   volatile int is_committed;
+}mp_commit_t;
+
+typedef struct
+{
+   Buff_Ring_XT *buf;
+   uint32_t id;
+   size_t failures;
+}mp_producer_t;
+
+static void *mp_commit(void *params)
+{
+   mp_commit_t *commit = (mp_commit_t*)params;
+
+   if(Buff_Ring_Commit(commit->buf, commit->pos, commit->size))
+   {
+      commit->is_committed = 1;
+   }
+
+   return NULL;
+} /* mp_commit */
+
+static void *mp_producer(void *params)
+{
+   mp_producer_t *producer = (mp_producer_t*)params;
+   Buff_Writeable_Vector_XT vector[2];
+   uint8_t record[MP_RECORD_SIZE];
+   uint32_t seq;
+   Buff_Size_DT pos;
+
+   for(seq = 0; seq < MP_NUM_RECORDS; seq++)
+   {
+      /* record: id of producer, its sequence number and its check byte */
+      memset(record, (int)(producer->id ^ seq), sizeof(record));
+      record[0] = (uint8_t)(producer->id);
+      memcpy(&record[1], &seq, sizeof(seq));
+
+      while((pos = Buff_Ring_Reserve(producer->buf, vector, sizeof(record))) >= producer->buf->size)
+      {
+         (void)sched_yield();
+      }
+
+      memcpy(vector[0].data, record, vector[0].size);
+      memcpy(vector[1].data, &record[vector[0].size], vector[1].size);
+
+      if(!Buff_Ring_Commit(producer->buf, pos, sizeof(record)))
+      {
+         producer->failures++;
+      }
+   }
+
+   return NULL;
+} /* mp_producer */
+#endif
+
+static void mp_tests(
+   Buff_Ring_XT *buf,
+   uint8_t *src,
+   size_t src_size,
+   uint8_t *memory,
+   size_t buf_memory_size,
+   uint8_t *read_data,
+   size_t read_size)
+{
+#if(BUFF_RING_USE_LOCK_FREE_SPSC && BUFF_RING_USE_MULTI_PRODUCER && BUFF_RING_RESERVE_ENABLED && BUFF_RING_COMMIT_ENABLED \
+   && BUFF_RING_INIT_ENABLED && BUFF_RING_READ_ENABLED && BUFF_RING_GET_BUSY_SIZE_ENABLED)
+   Buff_Writeable_Vector_XT vector[2];
+   mp_commit_t commit;
+   mp_producer_t producers[MP_NUM_PRODUCERS];
+   pthread_t threads[MP_NUM_PRODUCERS];
+   uint32_t next_seq[MP_NUM_PRODUCERS];
+   uint32_t seq;
+   uint8_t record[MP_RECORD_SIZE];
+   Buff_Size_DT pos;
+   Buff_Size_DT pos2;
+   size_t num_records;
+   size_t order_failures;
+   size_t cntr;
+
+   failure_cntr = 0;
+
+   if((buf_memory_size < 100) || (src_size < 100) || (read_size < 100))
+   {
+      return;
+   }
+
+   /* reservations are continous; one byte of buffer always stays free */
+   (void)Buff_Ring_Init(buf, memory, 16);
+
+   pos  = Buff_Ring_Reserve(buf, vector, 10);
+   pos2 = Buff_Ring_Reserve(buf, vector, 6);
+
+   if((0 != pos) || (16 > pos2) || (10 != Buff_Ring_Reserve(buf, vector, 5))
+      || (vector[0].data != &memory[10]) || (5 != vector[0].size) || (0 != vector[1].size)
+      || (0 != Buff_Ring_Get_Busy_Size(buf, false)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Reserve");
+      failure_cntr++;
+   }
+
+   memcpy(memory, src, 15);
+
+   if((!Buff_Ring_Commit(buf, 0, 10)) || (10 != Buff_Ring_Get_Busy_Size(buf, false))
+      || (!Buff_Ring_Commit(buf, 10, 5)) || (15 != Buff_Ring_Read(buf, read_data, 100, false))
+      || (0 != memcmp(read_data, src, 15)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Commit");
+      failure_cntr++;
+   }
+
+   /* reservation which wraps the end of buffer is described by both cells of vector */
+   if((15 != Buff_Ring_Reserve(buf, vector, 4)) || (vector[0].data != &memory[15]) || (1 != vector[0].size)
+      || (vector[1].data != memory) || (3 != vector[1].size) || (!Buff_Ring_Commit(buf, 15, 4))
+      || (4 != Buff_Ring_Get_Busy_Size(buf, false)) || (3 != buf->first_free))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Reserve/Commit wrap");
+      failure_cntr++;
+   }
+
+   /* second reservation committed before first one - it becomes visible only together with the first one */
+   (void)Buff_Ring_Init(buf, memory, 100);
+
+   pos  = Buff_Ring_Reserve(buf, vector, 20);
+   memcpy(vector[0].data, src, 20);
+   pos2 = Buff_Ring_Reserve(buf, vector, 30);
+   memcpy(vector[0].data, &src[20], 30);
+
+   memset(&commit, 0, sizeof(commit));
+   commit.buf  = buf;
+   commit.pos  = pos2;
+   commit.size = 30;
+
+   if((0 != pos) || (20 != pos2) || (0 != pthread_create(&threads[0], NULL, mp_commit, &commit)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Reserve out of order");
+      failure_cntr++;
+      return;
+   }
+
+   (void)usleep(20000);
+
+   if(commit.is_committed || (0 != Buff_Ring_Get_Busy_Size(buf, false)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Commit out of order");
+      failure_cntr++;
+   }
+
+   if(!Buff_Ring_Commit(buf, pos, 20))
+   {
+      failure_cntr++;
+   }
+
+   (void)pthread_join(threads[0], NULL);
+
+   if((!commit.is_committed) || (50 != Buff_Ring_Read(buf, read_data, 100, false)) || (0 != memcmp(read_data, src, 50)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Commit out of order data");
+      failure_cntr++;
+   }
+
+   /* many producers at once - records must not be torn and records of each producer must come in its order */
+   (void)Buff_Ring_Init(buf, memory, MP_RING_SIZE);
+
+   for(cntr = 0; cntr < MP_NUM_PRODUCERS; cntr++)
+   {
+      producers[cntr].buf      = buf;
+      producers[cntr].id       = (uint32_t)cntr;
+      producers[cntr].failures = 0;
+      next_seq[cntr]           = 0;
+
+      if(0 != pthread_create(&threads[cntr], NULL, mp_producer, &producers[cntr]))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "pthread_create");
+         failure_cntr++;
+         return;
+      }
+   }
+
+   order_failures = 0;
+
+   for(num_records = 0; num_records < (MP_NUM_PRODUCERS * MP_NUM_RECORDS); num_records++)
+   {
+      while(Buff_Ring_Get_Busy_Size(buf, false) < sizeof(record))
+      {
+         (void)sched_yield();
+      }
+
+      (void)Buff_Ring_Read(buf, record, sizeof(record), false);
+
+      memcpy(&seq, &record[1], sizeof(seq));
+
+      if((record[0] >= MP_NUM_PRODUCERS) || (seq != next_seq[record[0]]) || (record[5] != (uint8_t)(record[0] ^ seq))
+         || (record[7] != record[5]))
+      {
+         order_failures++;
+         break;
+      }
+
+      next_seq[record[0]]++;
+   }
+
+   for(cntr = 0; cntr < MP_NUM_PRODUCERS; cntr++)
+   {
+      (void)pthread_join(threads[cntr], NULL);
+
+      if((0 != producers[cntr].failures) || (MP_NUM_RECORDS != next_seq[cntr]))
+      {
+         order_failures++;
+      }
+   }
+
+   if((0 != order_failures) || (0 != Buff_Ring_Get_Busy_Size(buf, false)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Reserve/Commit threads");
+      failure_cntr++;
+   }
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_Reserve/Commit");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Ring_Reserve/Commit", failure_cntr);
+   }
+#endif
+} /* mp_tests */
+
+
+static void power_of_2_tests(
+   Buff_Ring_XT *buf,
+   const uint8_t *src,
+   size_t src_size,
+   uint8_t *memory,
+   size_t buf_memory_size,
+   uint8_t *read_data,
+   size_t read_size)
+{
+#if(BUFF_RING_USE_POWER_OF_2_SIZE && BUFF_RING_INIT_ENABLED && BUFF_RING_WRITE_ENABLED && BUFF_RING_WRITE_VENDOR_ENABLED \
+   && BUFF_RING_WRITE_FROM_VECTOR_ENABLED && BUFF_RING_WRITE_FROM_TREE_ENABLED && BUFF_RING_READ_ENABLED && BUFF_RING_READ_VENDOR_ENABLED \
+   && BUFF_RING_READ_TO_VECTOR_ENABLED && BUFF_RING_READ_TO_TREE_ENABLED && BUFF_RING_REMOVE_ENABLED && BUFF_RING_IS_EMPTY_ENABLED)
+   Buff_Readable_Vector_XT r_vector[1];
+   Buff_Readable_Tree_XT r_tree[1];
+   Buff_Writeable_Vector_XT w_vector[1];
+   Buff_Writeable_Tree_XT w_tree[1];
+   Buff_Size_DT size;
+   Buff_Size_DT capacity;
+   Buff_Size_DT pos;
+   Buff_Size_DT count;
+   Buff_Size_DT result;
+   int method = 0;
+
+   failure_cntr = 0;
+
+   if(Buff_Ring_Init(buf, memory, 96) || Buff_Ring_Init(buf, memory, 3) || (!Buff_Ring_Init(buf, memory, 64)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Init power of 2");
+      failure_cntr++;
+   }
+
+   r_vector[0].data                             = &src[1];
+   r_tree[0].elem_type.vector.vector            = r_vector;
+   r_tree[0].elem_type.vector.vector_num_elems  = 1;
+   r_tree[0].is_branch                          = BUFF_FALSE;
+   w_vector[0].data                             = &read_data[1];
+   w_tree[0].elem_type.vector.vector            = w_vector;
+   w_tree[0].elem_type.vector.vector_num_elems  = 1;
+   w_tree[0].is_branch                          = BUFF_FALSE;
+   vendor_cpy_cntr_limit                        = (size_t)(-1);
+
+   /* data of each write / read / remove method is placed on each position of the memory, so indexes are wrapped by masking everywhere */
+   for(size = 2; (size <= buf_memory_size) && (size < src_size) && (size < read_size) && (size <= 256); size *= 2)
+   {
+#if(BUFF_RING_USE_LOCK_FREE_SPSC)
+      capacity = size - 1;
+#else
+      capacity = size;
+#endif
+      for(pos = 0; (pos + 1) < capacity; pos++)
+      {
+         for(count = 1; (count + 1) <= capacity; count++)
+         {
+            (void)Buff_Ring_Init(buf, memory, size);
+
+            /* 1 byte stays busy on "pos", so buffer is not rewound to its begining when emptied */
+            (void)Buff_Ring_Write(buf, src, pos + 1, false, true);
+            (void)Buff_Ring_Remove(buf, pos, true);
+
+            r_vector[0].size  = count;
+            w_vector[0].size  = count;
+            vendor_cpy_cntr   = 0;
+            method++;
+
+            switch(method % 4)
+            {
+               case 0:  result = Buff_Ring_Write(buf, &src[1], count, false, true); break;
+               case 1:  result = Buff_Ring_Write_Vendor(buf, &src[1], count, main_vendor_memcpy, false, true); break;
+               case 2:  result = Buff_Ring_Write_From_Vector(buf, r_vector, 1, count, 0, false, true); break;
+               default: result = Buff_Ring_Write_From_Tree(buf, r_tree, 1, count, 0, false, true); break;
+            }
+
+            if((count != result) || (buf->first_free >= size) || (((pos + 1 + count) & (size - 1)) != buf->first_free))
+            {
+               printf("line: %5d; %-44s failed for size: %d, pos: %d, count: %d\n\r", __LINE__, "Buff_Ring_Write power of 2", (int)size, (int)pos, (int)count);
+               failure_cntr++;
+            }
+
+            (void)Buff_Ring_Read(buf, read_data, 1, true);
+
+            switch((method / 4) % 5)
+            {
+               case 0:  result = Buff_Ring_Read(buf, &read_data[1], count, true); break;
+               case 1:  result = Buff_Ring_Read_Vendor(buf, &read_data[1], count, main_vendor_memcpy, true); break;
+               case 2:  result = Buff_Ring_Read_To_Vector(buf, w_vector, 1, count, 0, true); break;
+               case 3:  result = Buff_Ring_Read_To_Tree(buf, w_tree, 1, count, 0, true); break;
+               default:
+                  result = Buff_Ring_Remove(buf, count, true);
+                  memcpy(&read_data[1], &src[1], count);
+                  break;
+            }
+
+            if((count != result) || (!Buff_Ring_Is_Empty(buf, true)) || (buf->first_busy >= size) || (buf->first_free >= size)
+               || (src[pos] != read_data[0]) || (0 != memcmp(&read_data[1], &src[1], count)))
+            {
+               printf("line: %5d; %-44s failed for size: %d, pos: %d, count: %d\n\r", __LINE__, "Buff_Ring_Read power of 2", (int)size, (int)pos, (int)count);
+               failure_cntr++;
+            }
+         }
+      }
+   }
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring power of 2");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Ring power of 2", failure_cntr);
+   }
+#endif
+} /* power_of_2_tests */
+
+
+
+static void non_temporal_copy_tests(
+   Buff_Ring_XT *buf1,
+   Buff_Ring_XT *buf2,
+   const uint8_t *src,
+   size_t src_size,
+   uint8_t *memory1,
+   size_t buf_memory_size1,
+   uint8_t *memory2,
+   size_t buf_memory_size2,
+   uint8_t *read1,
+   size_t read1_size)
+{
+#if(BUFF_RING_USE_NON_TEMPORAL_COPY)
+   Buff_Size_DT size;
+   int i;
+
+   failure_cntr = 0;
+
+   (void)Buff_Ring_Init(buf1, memory1, buf_memory_size1);
+   (void)Buff_Ring_Init(buf2, memory2, buf_memory_size2);
+
+   if(BUFF_BOOL_IS_TRUE(buf1->use_non_temporal_copy))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Init-non_temporal");
+      failure_cntr++;
+   }
+
+   Buff_Ring_Set_Non_Temporal_Copy(buf1, true);
+   Buff_Ring_Set_Non_Temporal_Copy(buf2, true);
+
+   /* one byte is always left in the buffers, so indexes are not moved to the begining when buffers become empty */
+   (void)Buff_Ring_Write(buf1, src, 1, false, true);
+   (void)Buff_Ring_Write(buf2, src, 1, false, true);
+
+   for(i = 0; i < 300; i++)
+   {
+      /* sizes below and above BUFF_NON_TEMPORAL_COPY_THRESHOLD, written to random (misaligned) positions */
+      size = (Buff_Size_DT)(rand() % (read1_size / 2)) + 1;
+
+      if(size != Buff_Ring_Write(buf1, src, size, false, true))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write-non_temporal");
+         failure_cntr++;
+      }
+
+      if(size != Buff_Ring_To_Ring_Copy(buf2, buf1, size, 1, false, true))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_To_Ring_Copy-non_temporal");
+         failure_cntr++;
+      }
+
+      memset(read1, 0, read1_size);
+
+      if((size != Buff_Ring_Peak(buf1, read1, size, 1, true)) || (0 != memcmp(src, read1, size)))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write-non_temporal");
+         failure_cntr++;
+      }
+
+      memset(read1, 0, read1_size);
+
+      if((size != Buff_Ring_Peak(buf2, read1, size, 1, true)) || (0 != memcmp(src, read1, size)))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_To_Ring_Copy-non_temporal");
+         failure_cntr++;
+      }
+
+      (void)Buff_Ring_Remove(buf1, size, true);
+      (void)Buff_Ring_Remove(buf2, size, true);
+   }
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_Set_Non_Temporal_Copy");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Ring_Set_Non_Temporal_Copy", failure_cntr);
+   }
+#endif
+} /* non_temporal_copy_tests */
+
+static void checksum_tests(
+   Buff_Ring_XT *buf,
+   const uint8_t *src,
+   size_t src_size,
+   uint8_t *memory,
+   size_t buf_memory_size,
+   uint8_t *read1,
+   size_t read1_size)
+{
+#if(BUFF_USE_CHECKSUM && BUFF_USE_VENDOR_BUFFERS)
+   Buff_Checksum_XT write_checksum;
+   Buff_Checksum_XT read_checksum;
+   Buff_Checksum_XT checksum_ref;
+   Buff_Size_DT size;
+   int i;
+
+   failure_cntr = 0;
+
+   (void)Buff_Ring_Init(buf, memory, buf_memory_size);
+
+   /* one byte is always left in the buffer, so data is written and read through the end of the buffer memory */
+   (void)Buff_Ring_Write(buf, src, 1, false, true);
+
+   for(i = 0; i < 300; i++)
+   {
+      size = (Buff_Size_DT)(rand() % (read1_size / 2)) + 2;
+
+      Buff_Checksum_Init(&checksum_ref, (uint8_t)(i % 4));
+      Buff_Checksum_Update(&checksum_ref, src, 1);
+      Buff_Checksum_Update(&checksum_ref, &src[1], size - 1);
+      Buff_Checksum_Init(&write_checksum, (uint8_t)(i % 4));
+      Buff_Checksum_Init(&read_checksum, (uint8_t)(i % 4));
+
+      /* checksum is accumulated by two calls - state is carried between them */
+      if((1 != Buff_Ring_Write_Checksum(buf, src, 1, &write_checksum, false, true))
+         || ((size - 1) != Buff_Ring_Write_Checksum(buf, &src[1], size - 1, &write_checksum, false, true))
+         || (Buff_Checksum_Get(&checksum_ref) != Buff_Checksum_Get(&write_checksum)))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write_Checksum");
+         failure_cntr++;
+      }
+
+      memset(read1, 0, read1_size);
+
+      /* byte left in the buffer is read first; last written byte stays in the buffer */
+      (void)Buff_Ring_Read(buf, read1, 1, true);
+
+      Buff_Checksum_Init(&checksum_ref, (uint8_t)(i % 4));
+      Buff_Checksum_Update(&checksum_ref, src, size - 1);
+
+      if(((size - 1) != Buff_Ring_Read_Checksum(buf, read1, size - 1, &read_checksum, true))
+         || (Buff_Checksum_Get(&checksum_ref) != Buff_Checksum_Get(&read_checksum))
+         || (0 != memcmp(src, read1, size - 1)))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read_Checksum");
+         failure_cntr++;
+      }
+   }
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_Write/Read_Checksum");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Ring_Write/Read_Checksum", failure_cntr);
+   }
+#endif
+} /* checksum_tests */
+
+static Buff_Bool_DT find_reference(
+   const uint8_t *data, size_t size, const uint8_t *pattern, size_t pattern_size, size_t offset, Buff_Size_DT *pos)
+{
+   size_t cntr;
+
+   for(cntr = offset; (cntr + pattern_size) <= size; cntr++)
+   {
+      if(0 == memcmp(&data[cntr], pattern, pattern_size))
+      {
+         *pos = (Buff_Size_DT)cntr;
+         return BUFF_TRUE;
+      }
+   }
+
+   return BUFF_FALSE;
+} /* find_reference */
+
+static void find_tests(
+   Buff_Ring_XT *buf,
+   uint8_t *memory,
+   size_t buf_memory_size,
+   uint8_t *read1,
+   size_t read1_size)
+{
+#if(BUFF_RING_FIND_BYTE_ENABLED && BUFF_RING_FIND_PATTERN_ENABLED)
+   uint8_t data[200];
+   uint8_t pattern[40];
+   Buff_Size_DT busy;
+   Buff_Size_DT offset;
+   Buff_Size_DT pattern_size;
+   Buff_Size_DT pos;
+   Buff_Size_DT pos_ref;
+   Buff_Bool_DT found;
+   Buff_Bool_DT found_ref;
+   int i;
+   int j;
+
+   failure_cntr = 0;
+
+   (void)Buff_Ring_Init(buf, memory, buf_memory_size);
+
+   /* one byte is always left in the buffer, so data crosses the end of the buffer memory */
+   (void)Buff_Ring_Write(buf, "\x01", 1, false, true);
+
+   for(i = 0; i < 1000; i++)
+   {
+      /* small alphabet - patterns are found often, also on positions crossing the end of buffer memory */
+      for(j = 0; j < Num_Elems(data); j++)
+      {
+         data[j] = (uint8_t)(rand() % 4);
+      }
+
+      (void)Buff_Ring_Write(buf, data, (Buff_Size_DT)(rand() % Num_Elems(data)), false, true);
+
+      busy   = Buff_Ring_Get_Busy_Size(buf, true);
+      offset = (Buff_Size_DT)(rand() % (busy + 1));
+      (void)Buff_Ring_Peak(buf, read1, busy, 0, true);
+
+      pattern_size = (Buff_Size_DT)(rand() % Num_Elems(pattern)) + 1;
+
+      if((pattern_size <= busy) && (0 != (rand() % 4)))
+      {
+         memcpy(pattern, &read1[rand() % (busy - pattern_size + 1)], pattern_size);
+      }
+      else
+      {
+         for(j = 0; j < pattern_size; j++)
+         {
+            pattern[j] = (uint8_t)(rand() % 4);
+         }
+      }
+
+      pos       = buf_memory_size;
+      pos_ref   = buf_memory_size;
+      found     = Buff_Ring_Find_Byte(buf, pattern[0], offset, &pos, true);
+      found_ref = find_reference(read1, busy, pattern, 1, offset, &pos_ref);
+
+      if((found != found_ref) || (pos != pos_ref))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Find_Byte");
+         failure_cntr++;
+      }
+
+      pos       = buf_memory_size;
+      pos_ref   = buf_memory_size;
+      found     = Buff_Ring_Find_Pattern(buf, pattern, pattern_size, offset, &pos, true);
+      found_ref = find_reference(read1, busy, pattern, pattern_size, offset, &pos_ref);
+
+      if((found != found_ref) || (pos != pos_ref))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Find_Pattern");
+         failure_cntr++;
+      }
+
+      (void)Buff_Ring_Read(buf, read1, (Buff_Size_DT)(rand() % busy), true);
+   }
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_Find_Byte/Pattern");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Ring_Find_Byte/Pattern", failure_cntr);
+   }
+#endif
+} /* find_tests */
+
+static void record_tests(
+   Buff_Ring_XT *buf,
+   const uint8_t *src,
+   size_t src_size,
+   uint8_t *memory,
+   size_t buf_memory_size,
+   uint8_t *read1,
+   size_t read1_size,
+   Buff_Ring_Extensions_XT *extension,
+   Buff_Ring_Extensions_XT *protected_extension)
+{
+#if(BUFF_RING_WRITE_RECORD_ENABLED && BUFF_RING_PEAK_RECORD_ENABLED && BUFF_RING_READ_RECORD_ENABLED)
+   Buff_Readable_Vector_XT vector[2];
+#if(BUFF_RING_WRITE_RECORD_FROM_TREE_ENABLED && BUFF_USE_TREE_BUFFERS)
+   Buff_Readable_Tree_XT tree;
+#endif
+   size_t starts[512];
+   Buff_Size_DT sizes[512];
+   Buff_Size_DT size;
+   Buff_Size_DT record_size;
+   Buff_Size_DT free_size;
+   Buff_Bool_DT result;
+   size_t start;
+   int first;
+   int last;
+   int i;
+
+   Buff_Ring_Init_Extension(extension);
+   Buff_Ring_Init_Extension(protected_extension);
+
+   extension->on_write                      = main_ring_on_write;
+   extension->on_write_params               = &on_extensions;
+   protected_extension->on_write            = main_ring_on_write;
+   protected_extension->on_write_params     = &on_protected_extensions;
+
+   failure_cntr = 0;
+
+   (void)Buff_Ring_Init(buf, memory, buf_memory_size);
+   (void)Buff_Ring_Add_Extension(buf, extension);
+   (void)Buff_Ring_Add_Protected_Extension(buf, protected_extension);
+
+   /* records are written and read in random order, so they are divided by the end of buffer memory */
+   first = 0;
+   last  = 0;
+
+   for(i = 0; i < 3000; i++)
+   {
+      if((0 != (rand() % 2)) && ((last - first) < Num_Elems(sizes)))
+      {
+         size      = (Buff_Size_DT)(rand() % 100);
+         start     = (size_t)(rand() % (src_size - size));
+         free_size = Buff_Ring_Get_Free_Size(buf, true);
+
+         vector[0].data = &src[start];
+         vector[0].size = size / 2;
+         vector[1].data = &src[start + (size / 2)];
+         vector[1].size = size - (size / 2);
+
+         on_extensions.on_write_cntr           = 0;
+         on_protected_extensions.on_write_cntr = 0;
+
+         switch(rand() % 3)
+         {
+#if(BUFF_RING_WRITE_RECORD_FROM_VECTOR_ENABLED && BUFF_USE_VECTOR_BUFFERS)
+            case 1:
+               result = Buff_Ring_Write_Record_From_Vector(buf, vector, Num_Elems(vector), size, 0, false, true);
+               break;
+#endif
+#if(BUFF_RING_WRITE_RECORD_FROM_TREE_ENABLED && BUFF_USE_TREE_BUFFERS)
+            case 2:
+               tree.is_branch = BUFF_FALSE;
+               tree.elem_type.vector.vector           = vector;
+               tree.elem_type.vector.vector_num_elems = Num_Elems(vector);
+               result = Buff_Ring_Write_Record_From_Tree(buf, &tree, 1, size, 0, false, true);
+               break;
+#endif
+            default:
+               result = Buff_Ring_Write_Record(buf, &src[start], size, false, true);
+               break;
+         }
+
+         /* record is written together with its header or not at all - extensions are called once per record */
+         if((BUFF_BOOL_IS_TRUE(result) != ((size + sizeof(Buff_Size_DT)) <= free_size))
+            || ((BUFF_BOOL_IS_TRUE(result) ? 1 : 0) != on_extensions.on_write_cntr)
+            || ((BUFF_BOOL_IS_TRUE(result) ? 1 : 0) != on_protected_extensions.on_write_cntr))
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write_Record");
+            failure_cntr++;
+         }
+
+         if(BUFF_BOOL_IS_TRUE(result))
+         {
+            starts[last % Num_Elems(sizes)] = start;
+            sizes[last % Num_Elems(sizes)]  = size;
+            last++;
+         }
+         else if(Buff_Ring_Get_Free_Size(buf, true) != free_size)
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write_Record");
+            failure_cntr++;
+         }
+      }
+      else if(first == last)
+      {
+         record_size = 0xFFFF;
+
+         if(BUFF_BOOL_IS_TRUE(Buff_Ring_Read_Record(buf, read1, read1_size, &record_size, true)) || (0xFFFF != record_size))
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read_Record");
+            failure_cntr++;
+         }
+      }
+      else
+      {
+         size = sizes[first % Num_Elems(sizes)];
+
+         /* record bigger than provided buffer stays in ring buffer, only its size is returned */
+         if((size > 0)
+            && (BUFF_BOOL_IS_TRUE(Buff_Ring_Peak_Record(buf, read1, size - 1, &record_size, true)) || (record_size != size)
+               || BUFF_BOOL_IS_TRUE(Buff_Ring_Read_Record(buf, NULL, 0, &record_size, true)) || (record_size != size)))
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read_Record");
+            failure_cntr++;
+         }
+
+         memset(read1, 0, read1_size);
+         record_size = 0;
+
+         if((!BUFF_BOOL_IS_TRUE(Buff_Ring_Peak_Record(buf, read1, read1_size, &record_size, true))) || (record_size != size)
+            || (0 != memcmp(read1, &src[starts[first % Num_Elems(sizes)]], size)))
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Peak_Record");
+            failure_cntr++;
+         }
+
+         memset(read1, 0, read1_size);
+         record_size = 0;
+
+         if((!BUFF_BOOL_IS_TRUE(Buff_Ring_Read_Record(buf, read1, read1_size, &record_size, true))) || (record_size != size)
+            || (0 != memcmp(read1, &src[starts[first % Num_Elems(sizes)]], size)))
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read_Record");
+            failure_cntr++;
+         }
+
+         first++;
+      }
+   }
+
+   /* record which can't fit even into empty buffer is never written, also with overwriting */
+   if(BUFF_BOOL_IS_TRUE(Buff_Ring_Write_Record(buf, src, (Buff_Size_DT)(buf_memory_size - sizeof(Buff_Size_DT) + 1), true, true)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write_Record");
+      failure_cntr++;
+   }
+
+#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+   /* oldest records are removed as a whole - remaining records are newest ones, complete and in order */
+   (void)Buff_Ring_Init(buf, memory, buf_memory_size);
+
+   for(i = 0; i < Num_Elems(sizes); i++)
+   {
+      sizes[i]  = (Buff_Size_DT)(rand() % 100);
+      starts[i] = (size_t)(rand() % (src_size - sizes[i]));
+
+      if(!BUFF_BOOL_IS_TRUE(Buff_Ring_Write_Record(buf, &src[starts[i]], sizes[i], true, true)))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write_Record overwrite");
+         failure_cntr++;
+      }
+   }
+
+   size = Buff_Ring_Get_Busy_Size(buf, true);
+
+   for(first = Num_Elems(sizes); (first > 0) && (size > 0); first--)
+   {
+      size -= sizes[first - 1] + sizeof(Buff_Size_DT);
+   }
+
+   for(; first < Num_Elems(sizes); first++)
+   {
+      memset(read1, 0, read1_size);
+
+      if((!BUFF_BOOL_IS_TRUE(Buff_Ring_Read_Record(buf, read1, read1_size, &record_size, true))) || (record_size != sizes[first])
+         || (0 != memcmp(read1, &src[starts[first]], record_size)))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write_Record overwrite");
+         failure_cntr++;
+      }
+   }
+
+   if((0 != size) || (!BUFF_BOOL_IS_TRUE(Buff_Ring_Is_Empty(buf, true))))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write_Record overwrite");
+      failure_cntr++;
+   }
+
+#if(BUFF_RING_WRITE_RECORD_FROM_VECTOR_ENABLED && BUFF_USE_VECTOR_BUFFERS)
+   /* source too small for requested record size is refused before any old record is removed */
+   for(i = 0; i < 100; i++)
+   {
+      (void)Buff_Ring_Write_Record(buf, src, 10, true, true);
+   }
+
+   size = Buff_Ring_Get_Busy_Size(buf, true);
+
+   vector[0].data = src;
+   vector[0].size = 10;
+   vector[1].data = &src[10];
+   vector[1].size = 10;
+
+   if(BUFF_BOOL_IS_TRUE(Buff_Ring_Write_Record_From_Vector(buf, vector, Num_Elems(vector), 21, 0, true, true))
+      || BUFF_BOOL_IS_TRUE(Buff_Ring_Write_Record_From_Vector(buf, vector, Num_Elems(vector), 10, 11, true, true))
+      || (size != Buff_Ring_Get_Busy_Size(buf, true)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write_Record overwrite");
+      failure_cntr++;
+   }
+#endif
+#endif
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_Write/Peak/Read_Record");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Ring_Write/Peak/Read_Record", failure_cntr);
+   }
+#endif
+} /* record_tests */
+
+static void bip_tests(
+   uint8_t *memory,
+   size_t buf_memory_size)
+{
+#if(BUFF_USE_BIP_BUFFERS && BUFF_BIP_INIT_ENABLED && BUFF_BIP_RESERVE_ENABLED && BUFF_BIP_COMMIT_ENABLED && BUFF_BIP_READ_ENABLED && BUFF_BIP_DECOMMIT_ENABLED && BUFF_BIP_GET_BUSY_SIZE_ENABLED)
+   Buff_Bip_XT bip;
+   uint8_t *reserved;
+   const uint8_t *read;
+   Buff_Size_DT size;
+   Buff_Size_DT cntr;
+   uint8_t write_seq = 0;
+   uint8_t read_seq = 0;
+   size_t written = 0;
+   size_t removed = 0;
+   int i;
+
+   failure_cntr = 0;
+
+   /* region A emptied while reservation just after it is pending - new reservation starts region A from the begining
+      of memory instead of region B, so data is not hidden behind empty region A */
+   (void)Buff_Bip_Init(&bip, memory, 100);
+
+   reserved = Buff_Bip_Reserve(&bip, 60, true);
+
+   if((reserved != memory) || (!Buff_Bip_Commit(&bip, 60, true)) || (Buff_Bip_Reserve(&bip, 10, true) != &memory[60])
+      || (Buff_Bip_Read(&bip, &size, true) != memory) || (60 != size) || (!Buff_Bip_Decommit(&bip, 60, true))
+      || (!Buff_Bip_Commit(&bip, 0, true)) || (Buff_Bip_Reserve(&bip, 50, true) != memory) || (!Buff_Bip_Commit(&bip, 50, true))
+      || (50 != Buff_Bip_Get_Busy_Size(&bip, true)) || (Buff_Bip_Read(&bip, &size, true) != memory) || (50 != size))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Bip_Commit-cancelled after read");
+      failure_cntr++;
+   }
+
+   /* the same, but pending reservation is replaced by new one instead of being cancelled */
+   if((!Buff_Bip_Decommit(&bip, 50, true)) || (0 != Buff_Bip_Get_Busy_Size(&bip, true)) || (Buff_Bip_Reserve(&bip, 60, true) != memory)
+      || (!Buff_Bip_Commit(&bip, 60, true)) || (Buff_Bip_Reserve(&bip, 10, true) != &memory[60]) || (!Buff_Bip_Decommit(&bip, 60, true))
+      || (Buff_Bip_Reserve(&bip, 50, true) != memory) || (!Buff_Bip_Commit(&bip, 50, true))
+      || (Buff_Bip_Read(&bip, &size, true) != memory) || (50 != size) || (!Buff_Bip_Decommit(&bip, 50, true)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Bip_Reserve-replaced after read");
+      failure_cntr++;
+   }
+
+   (void)Buff_Bip_Init(&bip, memory, buf_memory_size);
+
+   /* not enough space after region A - reservation is made on the begining of memory instead of wrapping */
+   reserved = Buff_Bip_Reserve(&bip, 600, true);
+
+   if((reserved != memory) || (!Buff_Bip_Commit(&bip, 600, true)) || (Buff_Bip_Read(&bip, &size, true) != memory) || (600 != size)
+      || (!Buff_Bip_Decommit(&bip, 500, true)) || (Buff_Bip_Reserve(&bip, 501, true) != NULL))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Bip_Reserve");
+      failure_cntr++;
+   }
+
+   reserved = Buff_Bip_Reserve(&bip, 450, true);
+
+   if((reserved != memory) || (!Buff_Bip_Commit(&bip, 450, true)) || (550 != Buff_Bip_Get_Busy_Size(&bip, true))
+      || (Buff_Bip_Read(&bip, &size, true) != &memory[500]) || (100 != size) || Buff_Bip_Decommit(&bip, 101, true)
+      || (!Buff_Bip_Decommit(&bip, 100, true)) || (Buff_Bip_Read(&bip, &size, true) != memory) || (450 != size)
+      || (!Buff_Bip_Decommit(&bip, 450, true)) || (Buff_Bip_Read(&bip, &size, true) != NULL) || (0 != size))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Bip_Commit/Read/Decommit");
+      failure_cntr++;
+   }
+
+   /* random reservations and reads - every area is contiguous and data is never moved nor overwritten */
+   for(i = 0; i < 20000; i++)
+   {
+      if(0 != (rand() % 2))
       {
-         /* ok */
-         prev_size = buf_memory_size - 16;
-         if(prev_size == Buff_Ring_Read_Vendor(buf, read1, prev_size, main_vendor_memcpy, true))
+         size     = (Buff_Size_DT)(rand() % 300) + 1;
+         reserved = Buff_Bip_Reserve(&bip, size, true);
+
+         if(NULL != reserved)
          {
-            if(0 != memcmp(&src[15], read1, prev_size))
+            if((reserved < memory) || ((reserved + size) > &memory[buf_memory_size]))
+            {
+               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Bip_Reserve");
+               failure_cntr++;
+            }
+
+            /* sometimes only part of reservation is used */
+            size = (0 != (rand() % 4)) ? size : (Buff_Size_DT)(rand() % (size + 1));
+
+            for(cntr = 0; cntr < size; cntr++)
+            {
+               reserved[cntr] = write_seq++;
+            }
+
+            (void)Buff_Bip_Commit(&bip, size, true);
+            written += size;
+         }
+      }
+      else
+      {
+         read = Buff_Bip_Read(&bip, &size, true);
+
+         if(size > 0)
+         {
+            size = (Buff_Size_DT)(rand() % size) + 1;
+
+            for(cntr = 0; cntr < size; cntr++)
+            {
+               if(read[cntr] != read_seq++)
+               {
+                  printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Bip_Read");
+                  failure_cntr++;
+                  break;
+               }
+            }
+
+            (void)Buff_Bip_Decommit(&bip, size, true);
+            removed += size;
+         }
+      }
+
+      if(Buff_Bip_Get_Busy_Size(&bip, true) != (written - removed))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Bip_Get_Busy_Size");
+         failure_cntr++;
+      }
+   }
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Bip_Reserve/Commit/Read/Decommit");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Bip_Reserve/Commit/Read/Decommit", failure_cntr);
+   }
+#endif
+} /* bip_tests */
+
+static void pool_tests(
+   uint8_t *memory,
+   size_t buf_memory_size)
+{
+#if(BUFF_USE_POOL_BUFFERS && BUFF_POOL_INIT_ENABLED && BUFF_POOL_ACQUIRE_ENABLED && BUFF_POOL_COMMIT_ENABLED && BUFF_POOL_PEAK_ENABLED \
+   && BUFF_POOL_RELEASE_ENABLED && BUFF_POOL_WRITE_ENABLED && BUFF_POOL_READ_ENABLED && BUFF_POOL_GET_BUSY_SLOTS_ENABLED && BUFF_POOL_GET_FREE_SLOTS_ENABLED)
+   typedef struct
+   {
+      uint32_t seq;
+      uint8_t  payload[9];
+   }slot_T;
+   Buff_Pool_XT pool;
+   slot_T element;
+   slot_T *slot;
+   Buff_Bool_DT done;
+   uint32_t write_seq = 0;
+   uint32_t read_seq = 0;
+#if(BUFF_RING_USE_POWER_OF_2_SIZE)
+   Buff_Size_DT num_slots = 8;
+#else
+   Buff_Size_DT num_slots = 7;
+#endif
+   int i;
+
+   failure_cntr = 0;
+
+   if((buf_memory_size < (sizeof(slot_T) * num_slots)) || (!Buff_Pool_Init(&pool, memory, sizeof(slot_T), num_slots))
+      || Buff_Pool_Init(&pool, memory, sizeof(slot_T), 0) || (!Buff_Pool_Init(&pool, memory, sizeof(slot_T), num_slots))
+      || (NULL != Buff_Pool_Peak(&pool, true)) || Buff_Pool_Release(&pool, true) || Buff_Pool_Commit(&pool, true)
+      || (num_slots != Buff_Pool_Get_Free_Slots(&pool, true)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Pool_Init");
+      failure_cntr++;
+   }
+
+   /* acquired slot is not overwritten by element written before it is committed */
+   slot = (slot_T*)Buff_Pool_Acquire(&pool, true);
+
+   if(NULL != slot)
+   {
+      memset(slot, 0xA5, sizeof(element));
+   }
+
+   memset(&element, 0x5A, sizeof(element));
+
+   if((NULL == slot) || Buff_Pool_Write(&pool, &element, true) || (0 != Buff_Pool_Get_Busy_Slots(&pool, true))
+      || (!Buff_Pool_Commit(&pool, true)) || (!Buff_Pool_Read(&pool, &element, true))
+      || (0xA5 != element.payload[8]) || (0xA5A5A5A5 != element.seq))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Pool_Write to acquired slot");
+      failure_cntr++;
+   }
+
+   /* slots are written and read in random order, so queue wraps many times; all slots stay inside memory */
+   for(i = 0; i < 20000; i++)
+   {
+      if(0 != (rand() % 2))
+      {
+         memset(&element, (int)write_seq, sizeof(element));
+         element.seq = write_seq;
+
+         if(0 != (rand() % 2))
+         {
+            /* slot is filled in place */
+            slot = (slot_T*)Buff_Pool_Acquire(&pool, true);
+            done = (NULL != slot);
+
+            if(done)
+            {
+               memcpy(slot, &element, sizeof(element));
+               done = Buff_Pool_Commit(&pool, true);
+            }
+         }
+         else
+         {
+            done = Buff_Pool_Write(&pool, &element, true);
+         }
+
+         if(done == ((write_seq - read_seq) == num_slots))
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Pool_Acquire/Commit/Write");
+            failure_cntr++;
+         }
+         else if(done)
+         {
+            write_seq++;
+         }
+      }
+      else
+      {
+         memset(&element, 0, sizeof(element));
+
+         if(0 != (rand() % 2))
+         {
+            /* slot is used in place */
+            slot = (slot_T*)Buff_Pool_Peak(&pool, true);
+            done = (NULL != slot);
+
+            if(done)
+            {
+               memcpy(&element, slot, sizeof(element));
+               done = Buff_Pool_Release(&pool, true);
+            }
+         }
+         else
+         {
+            done = Buff_Pool_Read(&pool, &element, true);
+         }
+
+         if((done == (write_seq == read_seq))
+            || (done && ((element.seq != read_seq) || (element.payload[8] != (uint8_t)read_seq))))
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Pool_Peak/Release/Read");
+            failure_cntr++;
+         }
+         else if(done)
+         {
+            read_seq++;
+         }
+      }
+
+      if((Buff_Pool_Get_Busy_Slots(&pool, true) != (write_seq - read_seq))
+         || (Buff_Pool_Get_Free_Slots(&pool, true) != (num_slots - (write_seq - read_seq))))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Pool_Get_Busy/Free_Slots");
+         failure_cntr++;
+      }
+   }
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Pool_XT");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Pool_XT", failure_cntr);
+   }
+#endif
+} /* pool_tests */
+
+#if(BUFF_RING_USE_AUTO_GROW && BUFF_RING_SET_AUTO_GROW_ENABLED)
+static size_t resize_num_allocated;
+
+static void *resize_memory_alloc(Buff_Ring_XT *buf, Buff_Size_DT size)
+{
+   (void)buf;
+   resize_num_allocated++;
+   return malloc(size);
+} /* resize_memory_alloc */
+
+static void resize_memory_free(Buff_Ring_XT *buf, void *memory, Buff_Size_DT size)
+{
+   (void)buf;
+   (void)size;
+   resize_num_allocated--;
+   free(memory);
+} /* resize_memory_free */
+#endif
+
+static void resize_tests(
+   Buff_Ring_XT *buf,
+   uint8_t *src,
+   size_t src_size,
+   uint8_t *memory,
+   size_t buf_memory_size,
+   uint8_t *read,
+   size_t read_size)
+{
+#if(BUFF_RING_RESIZE_ENABLED && BUFF_RING_INIT_ENABLED && BUFF_RING_DEINIT_ENABLED && BUFF_RING_WRITE_ENABLED && BUFF_RING_READ_ENABLED \
+   && BUFF_RING_PEAK_ENABLED && BUFF_RING_REMOVE_ENABLED && BUFF_RING_GET_BUSY_SIZE_ENABLED && BUFF_RING_GET_SIZE_ENABLED)
+   uint8_t small_memory[100];
+   uint8_t big_memory[300];
+   size_t first_size;
+   size_t cntr;
+   size_t size;
+
+   failure_cntr = 0;
+
+   for(first_size = 1; (first_size < 100) && (buf_memory_size >= 100) && (src_size >= 300) && (read_size >= 300); first_size++)
+   {
+      for(size = 0; size <= 100; size++)
+      {
+         /* data wraps inside 100 bytes memory as long as first_size + size > 100 */
+         (void)Buff_Ring_Init(buf, memory, 100);
+         (void)Buff_Ring_Write(buf, src, first_size, false, true);
+         (void)Buff_Ring_Remove(buf, first_size, true);
+
+         if((size != Buff_Ring_Write(buf, src, size, false, true))
+            || (!Buff_Ring_Resize(buf, big_memory, sizeof(big_memory), true))
+            || (size != Buff_Ring_Get_Busy_Size(buf, true))
+            || (size != Buff_Ring_Peak(buf, read, size, 0, true)) || (0 != memcmp(read, src, size))
+            || ((300 - size) != Buff_Ring_Write(buf, &src[size], 300, false, true))
+            || (300 != Buff_Ring_Read(buf, read, 300, true)) || (0 != memcmp(read, src, 300)))
+         {
+            printf("line: %5d; %-44s failed for first_size: %d, size: %d\n\r", __LINE__, "Buff_Ring_Resize grow", (int)first_size, (int)size);
+            failure_cntr++;
+         }
+
+         (void)Buff_Ring_Init(buf, memory, 100);
+         (void)Buff_Ring_Write(buf, src, first_size, false, true);
+         (void)Buff_Ring_Remove(buf, first_size, true);
+         (void)Buff_Ring_Write(buf, src, size, false, true);
+
+         /* shrinking below busy size is not possible, buffer is not modified then */
+         if(((size > 50) == Buff_Ring_Resize(buf, small_memory, 50, true))
+            || (size != Buff_Ring_Get_Busy_Size(buf, true))
+            || (size != Buff_Ring_Read(buf, read, size, true)) || (0 != memcmp(read, src, size)))
+         {
+            printf("line: %5d; %-44s failed for first_size: %d, size: %d\n\r", __LINE__, "Buff_Ring_Resize shrink", (int)first_size, (int)size);
+            failure_cntr++;
+         }
+      }
+   }
+
+   if((buf_memory_size >= 100) && (Buff_Ring_Init(buf, memory, 100)) && Buff_Ring_Resize(buf, NULL, 100, true))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Resize");
+      failure_cntr++;
+   }
+
+#if(BUFF_RING_USE_AUTO_GROW && BUFF_RING_SET_AUTO_GROW_ENABLED)
+   for(size = 1; (size < 100) && (buf_memory_size >= 16) && (src_size >= 1000) && (read_size >= 1000); size++)
+   {
+      resize_num_allocated = 0;
+
+      (void)Buff_Ring_Init(buf, memory, 16);
+      Buff_Ring_Set_Auto_Grow(buf, resize_memory_alloc, resize_memory_free, 2, 1000);
+
+      /* buffer grows 16 -> 32 -> ... -> 512 -> 1000 and then write without overwrite is limited by max_size */
+      for(cntr = 0; cntr < 1000; cntr += size)
+      {
+         if((((cntr + size) <= 1000) ? size : (1000 - cntr)) != Buff_Ring_Write(buf, &src[cntr], size, false, true))
+         {
+            printf("line: %5d; %-44s failed for size: %d, cntr: %d\n\r", __LINE__, "Buff_Ring_Set_Auto_Grow", (int)size, (int)cntr);
+            failure_cntr++;
+         }
+      }
+
+      if((1 != resize_num_allocated) || (1000 != Buff_Ring_Get_Size(buf, true)) || (1000 != Buff_Ring_Get_Busy_Size(buf, true))
+         || (1000 != Buff_Ring_Read(buf, read, 1000, true)) || (0 != memcmp(read, src, 1000)))
+      {
+         printf("line: %5d; %-44s failed for size: %d\n\r", __LINE__, "Buff_Ring_Set_Auto_Grow", (int)size);
+         failure_cntr++;
+      }
+
+      if(buf->is_memory_allocated)
+      {
+         resize_memory_free(buf, buf->memory, buf->original_size);
+      }
+
+      Buff_Ring_Deinit(buf);
+   }
+
+   /* memory given by the user is never released, allocated one is released when buffer moves to user memory */
+   resize_num_allocated = 0;
+
+   if((buf_memory_size < 16) || (!Buff_Ring_Init(buf, memory, 16)) || (src_size < 40)
+      || (Buff_Ring_Set_Auto_Grow(buf, resize_memory_alloc, resize_memory_free, 2, 1000), 40 != Buff_Ring_Write(buf, src, 40, false, true))
+      || (1 != resize_num_allocated) || (!Buff_Ring_Resize(buf, big_memory, sizeof(big_memory), true)) || (0 != resize_num_allocated)
+      || (40 != Buff_Ring_Read(buf, read, 40, true)) || (0 != memcmp(read, src, 40)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Set_Auto_Grow");
+      failure_cntr++;
+   }
+
+   Buff_Ring_Deinit(buf);
+#endif
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_Resize");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Ring_Resize", failure_cntr);
+   }
+#endif
+} /* resize_tests */
+
+static void chain_tests(
+   Buff_Ring_XT *ring,
+   uint8_t *src,
+   size_t src_size,
+   uint8_t *memory,
+   size_t buf_memory_size,
+   uint8_t *read,
+   size_t read_size)
+{
+#if(BUFF_USE_CHAIN_BUFFERS && BUFF_CHAIN_INIT_ENABLED && BUFF_CHAIN_ADD_CHUNKS_ENABLED && BUFF_CHAIN_WRITE_ENABLED && BUFF_CHAIN_PEAK_ENABLED \
+   && BUFF_CHAIN_READ_ENABLED && BUFF_CHAIN_REMOVE_ENABLED && BUFF_CHAIN_GET_BUSY_SIZE_ENABLED && BUFF_CHAIN_GET_FREE_SIZE_ENABLED)
+   Buff_Chain_XT chain;
+   Buff_Chain_Chunk_XT chunks[12];
+   Buff_Chain_Chunk_XT extra_chunks[4];
+   uint8_t extra_memory[4 * 13];
+#if(BUFF_CHAIN_TO_VECTOR_ENABLED && BUFF_CHAIN_TO_TREE_ENABLED && BUFF_USE_VECTOR_BUFFERS && BUFF_USE_TREE_BUFFERS \
+   && BUFF_COPY_FROM_TREE_ENABLED && BUFF_RING_WRITE_FROM_VECTOR_ENABLED && BUFF_RING_INIT_ENABLED)
+   Buff_Readable_Vector_XT vector[16];
+   Buff_Readable_Tree_XT tree;
+   Buff_Num_Elems_DT num_elems;
+   Buff_Size_DT described_size;
+#endif
+#if(BUFF_CHAIN_WRITE_FROM_VECTOR_ENABLED && BUFF_CHAIN_WRITE_FROM_TREE_ENABLED && BUFF_USE_VECTOR_BUFFERS && BUFF_USE_TREE_BUFFERS \
+   && BUFF_READABLE_VECTOR_CURSOR_ENABLED && BUFF_READABLE_TREE_CURSOR_ENABLED)
+   Buff_Readable_Vector_XT data_vector[3];
+   Buff_Readable_Tree_XT data_tree;
+#endif
+   uint8_t pattern[800];
+   size_t write_pos = 250;
+   size_t read_pos = 250;
+   size_t capacity = 12 * 13;
+   size_t size;
+   size_t free_size;
+   size_t result;
+   int i;
+
+   failure_cntr = 0;
+
+   /* pattern repeats every 250 bytes, so positions can be moved back without changing expected data */
+   for(size = 0; (size < sizeof(pattern)) && (src_size >= 250); size++)
+   {
+      pattern[size] = src[size % 250];
+   }
+
+   if((buf_memory_size < (12 * 13)) || (src_size < 250) || (read_size < 800)
+      || Buff_Chain_Init(&chain, chunks, memory, 0, 12) || (!Buff_Chain_Init(&chain, chunks, memory, 13, 12))
+      || (0 != Buff_Chain_Get_Busy_Size(&chain)) || (capacity != Buff_Chain_Get_Free_Size(&chain))
+      || (0 != Buff_Chain_Read(&chain, read, 10)) || (0 != Buff_Chain_Remove(&chain, 10)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Chain_Init");
+      failure_cntr++;
+   }
+
+   /* data written and read in random parts; data is checked by its position in the pattern */
+   for(i = 0; (i < 20000) && (0 == failure_cntr); i++)
+   {
+      size = (size_t)(rand() % 40);
+
+      /* consumed part of first chunk is not free until whole chunk is consumed */
+      free_size = Buff_Chain_Get_Free_Size(&chain);
+
+      switch(rand() % 4)
+      {
+         case 0:
+            result = Buff_Chain_Write(&chain, &pattern[write_pos], size);
+
+            if(result != ((size <= free_size) ? size : free_size))
+            {
+               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Chain_Write");
+               failure_cntr++;
+            }
+            write_pos += result;
+            break;
+
+#if(BUFF_CHAIN_WRITE_FROM_VECTOR_ENABLED && BUFF_CHAIN_WRITE_FROM_TREE_ENABLED && BUFF_USE_VECTOR_BUFFERS && BUFF_USE_TREE_BUFFERS \
+   && BUFF_READABLE_VECTOR_CURSOR_ENABLED && BUFF_READABLE_TREE_CURSOR_ENABLED)
+         case 1:
+            /* source vector has 3 parts; first byte of first part is skipped by offset */
+            data_vector[0].data = &pattern[write_pos - 1];
+            data_vector[0].size = (size / 3) + 1;
+            data_vector[1].data = &pattern[write_pos + (size / 3)];
+            data_vector[1].size = size / 3;
+            data_vector[2].data = &pattern[write_pos + (2 * (size / 3))];
+            data_vector[2].size = size - (2 * (size / 3));
+
+            if(0 != (rand() % 2))
+            {
+               result = Buff_Chain_Write_From_Vector(&chain, data_vector, Num_Elems(data_vector), size, 1);
+            }
+            else
+            {
+               data_tree.elem_type.vector.vector            = data_vector;
+               data_tree.elem_type.vector.vector_num_elems  = Num_Elems(data_vector);
+               data_tree.is_branch                          = BUFF_FALSE;
+
+               result = Buff_Chain_Write_From_Tree(&chain, &data_tree, 1, size, 1);
+            }
+
+            if(result != ((size <= free_size) ? size : free_size))
+            {
+               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Chain_Write_From_Vector/Tree");
+               failure_cntr++;
+            }
+            write_pos += result;
+            break;
+#endif
+
+         case 2:
+            if(0 != (rand() % 2))
+            {
+               result = Buff_Chain_Read(&chain, read, size);
+            }
+            else
+            {
+               /* peak from the middle is checked, then data is removed */
+               result = Buff_Chain_Peak(&chain, read, size, 1);
+
+               if((result != (((write_pos - read_pos) > 1) ? (((write_pos - read_pos - 1) < size) ? (write_pos - read_pos - 1) : size) : 0))
+                  || (0 != memcmp(read, &pattern[read_pos + 1], result)))
+               {
+                  printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Chain_Peak");
+                  failure_cntr++;
+               }
+
+               result = Buff_Chain_Peak(&chain, read, size, 0);
+               (void)Buff_Chain_Remove(&chain, result);
+            }
+
+            if((result != (((write_pos - read_pos) < size) ? (write_pos - read_pos) : size))
+               || (0 != memcmp(read, &pattern[read_pos], result)))
+            {
+               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Chain_Read");
+               failure_cntr++;
+            }
+            read_pos += result;
+            break;
+
+         default:
+#if(BUFF_CHAIN_TO_VECTOR_ENABLED && BUFF_CHAIN_TO_TREE_ENABLED && BUFF_USE_VECTOR_BUFFERS && BUFF_USE_TREE_BUFFERS \
+   && BUFF_COPY_FROM_TREE_ENABLED && BUFF_RING_WRITE_FROM_VECTOR_ENABLED && BUFF_RING_INIT_ENABLED)
+            /* data is handed to other buffers without copying it out of the chain first */
+            num_elems = Buff_Chain_To_Tree(&chain, &tree, vector, Num_Elems(vector), &described_size);
+
+            if((described_size != (write_pos - read_pos)) || (num_elems > ((described_size / 13) + 2))
+               || (described_size != Buff_Copy_From_Tree(read, &tree, 1, described_size, 0, 0, NULL))
+               || (0 != memcmp(read, &pattern[read_pos], described_size)))
             {
-               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read-memcmp");
+               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Chain_To_Tree");
                failure_cntr++;
             }
-            else
+
+            num_elems = Buff_Chain_To_Vector(&chain, vector, Num_Elems(vector), &described_size);
+
+            (void)Buff_Ring_Init(ring, &read[400], 400);
+
+            if((described_size != (write_pos - read_pos))
+               || (described_size != Buff_Ring_Write_From_Vector(ring, vector, num_elems, described_size, 0, false, true))
+               || (0 != memcmp(&read[400], &pattern[read_pos], described_size))
+               || (described_size != Buff_Chain_Remove(&chain, described_size)))
             {
-               /* ok */
+               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Chain_To_Vector");
+               failure_cntr++;
             }
+            read_pos += described_size;
+#endif
+            break;
+      }
+
+      /* sizes depend only on stored data; number of used chunks is checked by free size */
+      if((Buff_Chain_Get_Busy_Size(&chain) != (write_pos - read_pos))
+         || ((Buff_Chain_Get_Free_Size(&chain) + (write_pos - read_pos) + 12) < capacity)
+         || ((Buff_Chain_Get_Free_Size(&chain) + (write_pos - read_pos)) > capacity))
+      {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Chain_Get_Busy/Free_Size");
+         failure_cntr++;
+      }
+
+      if(read_pos >= 500)
+      {
+         write_pos -= 250;
+         read_pos  -= 250;
+      }
+
+      if((i == 10000) && (0 == failure_cntr))
+      {
+         /* capacity is extended in run-time, stored data stays where it is */
+         if((!Buff_Chain_Add_Chunks(&chain, extra_chunks, extra_memory, Num_Elems(extra_chunks)))
+            || Buff_Chain_Add_Chunks(&chain, extra_chunks, extra_memory, 0))
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Chain_Add_Chunks");
+            failure_cntr++;
          }
-         else
+         capacity += sizeof(extra_memory);
+      }
+   }
+
+   Buff_Chain_Deinit(&chain);
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Chain_XT");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Chain_XT", failure_cntr);
+   }
+#endif
+} /* chain_tests */
+
+static void fd_tests(
+   Buff_Ring_XT *buf,
+   uint8_t *src,
+   size_t src_size,
+   uint8_t *memory,
+   size_t buf_memory_size,
+   uint8_t *read_data,
+   size_t read_size,
+   Buff_Ring_Extensions_XT *extension,
+   Buff_Ring_Extensions_XT *protected_extension)
+{
+#if(BUFF_RING_USE_FD_IO && BUFF_RING_WRITE_FROM_FD_ENABLED && BUFF_RING_READ_TO_FD_ENABLED && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED \
+   && BUFF_RING_READ_CHECK_IN_CHECK_OUT_ENABLED && BUFF_RING_INIT_ENABLED && BUFF_RING_WRITE_ENABLED && BUFF_RING_READ_ENABLED \
+   && BUFF_RING_REMOVE_ENABLED && BUFF_RING_GET_BUSY_SIZE_ENABLED)
+   int fds[2];
+   int error;
+   size_t first_size;
+   size_t size;
+   size_t expected;
+
+   Buff_Ring_Init_Extension(extension);
+   Buff_Ring_Init_Extension(protected_extension);
+
+   extension->on_read                       = main_ring_on_read;
+   extension->on_write                      = main_ring_on_write;
+   extension->on_read_params                = &on_extensions;
+   extension->on_write_params               = &on_extensions;
+   protected_extension->on_read             = main_ring_on_read;
+   protected_extension->on_write            = main_ring_on_write;
+   protected_extension->on_read_params      = &on_protected_extensions;
+   protected_extension->on_write_params     = &on_protected_extensions;
+
+   failure_cntr = 0;
+
+   if((0 != pipe(fds)) || (0 != fcntl(fds[0], F_SETFL, O_NONBLOCK)) || (0 != fcntl(fds[1], F_SETFL, O_NONBLOCK)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "pipe");
+      failure_cntr++;
+      return;
+   }
+
+   for(first_size = 0; (first_size < 100) && (buf_memory_size >= 100) && (src_size >= 200) && (read_size >= 200); first_size += 3)
+   {
+      for(size = 0; size <= 100; size++)
+      {
+         /* busy / free area wraps inside 100 bytes memory as long as first_size + size > 100 */
+         (void)Buff_Ring_Init(buf, memory, 100);
+         (void)Buff_Ring_Add_Extension(buf, extension);
+         (void)Buff_Ring_Add_Protected_Extension(buf, protected_extension);
+         (void)Buff_Ring_Write(buf, src, first_size, false, true);
+         (void)Buff_Ring_Remove(buf, first_size, true);
+         (void)Buff_Ring_Write(buf, src, size, false, true);
+         memset(&on_extensions, 0, sizeof(on_extensions));
+         memset(&on_protected_extensions, 0, sizeof(on_protected_extensions));
+
+         /* ring -> pipe -> ring: data goes round and stays in the buffer in same order */
+         expected = (size < 60) ? size : 60;
+
+         if((expected != Buff_Ring_Read_To_Fd(buf, fds[1], 60, &error, true)) || (0 != error)
+            || (expected != Buff_Ring_Write_From_Fd(buf, fds[0], 200, &error, true)) || ((0 != error) && (expected > 0))
+            || (size != Buff_Ring_Get_Busy_Size(buf, true))
+            || (size != Buff_Ring_Read(buf, read_data, 200, true))
+            || (0 != memcmp(read_data, &src[expected], size - expected))
+            || (0 != memcmp(&read_data[size - expected], src, expected)))
          {
-            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read");
+            printf("line: %5d; %-44s failed for first_size: %d, size: %d\n\r", __LINE__, "Buff_Ring_Read_To_Fd/Write_From_Fd", (int)first_size, (int)size);
+            failure_cntr++;
+         }
+
+         /* write extensions are called by Buff_Ring_Write_From_Fd, read extensions by Buff_Ring_Read_To_Fd and Buff_Ring_Read */
+         if((size > 0) && ((2 != on_extensions.on_read_cntr) || (2 != on_protected_extensions.on_read_cntr)
+            || (1 != on_extensions.on_write_cntr) || (1 != on_protected_extensions.on_write_cntr)))
+         {
+            printf("line: %5d; %-44s failed for first_size: %d, size: %d\n\r", __LINE__, "Buff_Ring_Read_To_Fd/Write_From_Fd ext", (int)first_size, (int)size);
             failure_cntr++;
          }
       }
+   }
+
+   /* empty pipe - non-blocking read fails with EAGAIN and buffer is not modified */
+   (void)Buff_Ring_Init(buf, memory, 100);
+
+   if((0 != Buff_Ring_Write_From_Fd(buf, fds[0], 100, &error, true)) || ((EAGAIN != error) && (EWOULDBLOCK != error))
+      || (0 != Buff_Ring_Get_Busy_Size(buf, true)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write_From_Fd EAGAIN");
+      failure_cntr++;
+   }
+
+   /* closed write end - end of file */
+   (void)close(fds[1]);
+
+   if((0 != Buff_Ring_Write_From_Fd(buf, fds[0], 100, &error, true)) || (0 != error))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write_From_Fd EOF");
+      failure_cntr++;
+   }
+
+   (void)close(fds[0]);
+
+   /* closed descriptor - data stays in the buffer */
+   (void)Buff_Ring_Write(buf, src, 10, false, true);
+
+   if((0 != Buff_Ring_Read_To_Fd(buf, fds[1], 100, &error, true)) || (EBADF != error)
+      || (10 != Buff_Ring_Get_Busy_Size(buf, true)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read_To_Fd EBADF");
+      failure_cntr++;
+   }
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_Read_To_Fd/Write_From_Fd");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Ring_Read_To_Fd/Write_From_Fd", failure_cntr);
+   }
+#endif
+} /* fd_tests */
+
+static void uring_tests(
+   Buff_Ring_XT *buf,
+   Buff_Ring_XT *buf2,
+   uint8_t *src,
+   size_t src_size,
+   uint8_t *memory,
+   uint8_t *memory2,
+   size_t buf_memory_size,
+   uint8_t *read_data,
+   size_t read_size,
+   Buff_Ring_Extensions_XT *extension,
+   Buff_Ring_Extensions_XT *protected_extension)
+{
+#if(BUFF_RING_USE_IO_URING && BUFF_RING_URING_ENABLED && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED && BUFF_RING_INIT_ENABLED \
+   && BUFF_RING_WRITE_ENABLED && BUFF_RING_READ_ENABLED && BUFF_RING_REMOVE_ENABLED && BUFF_RING_GET_BUSY_SIZE_ENABLED)
+   Buff_Ring_Uring_XT uring;
+   Buff_Ring_Uring_Feed_XT feeds[2];
+   int pipe_fds[2];
+   int socket_fds[2];
+   int error;
+   int cntr;
+
+   Buff_Ring_Init_Extension(extension);
+   Buff_Ring_Init_Extension(protected_extension);
+
+   extension->on_write                      = main_ring_on_write;
+   extension->on_write_params               = &on_extensions;
+   protected_extension->on_write            = main_ring_on_write;
+   protected_extension->on_write_params     = &on_protected_extensions;
+
+   failure_cntr = 0;
+
+   if((buf_memory_size < 100) || (src_size < 200) || (read_size < 100))
+   {
+      return;
+   }
+
+   if(!Buff_Ring_Uring_Init(&uring, 4))
+   {
+      /* kernel without io_uring or io_uring forbidden in this environment */
+      if((ENOSYS == errno) || (EPERM == errno))
+      {
+         printf("line: %5d; %-44s not supported\n\r", __LINE__, "Buff_Ring_Uring");
+      }
       else
       {
+         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Uring_Init");
+      }
+      return;
+   }
+
+   if((0 != pipe(pipe_fds)) || (0 != socketpair(AF_UNIX, SOCK_STREAM, 0, socket_fds)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "pipe/socketpair");
+      Buff_Ring_Uring_Deinit(&uring);
+      return;
+   }
+
+   /* free space of first buffer wraps after 30 bytes (1 byte stays busy), second buffer is fed by requests of 30 bytes */
+   (void)Buff_Ring_Init(buf, memory, 100);
+   (void)Buff_Ring_Write(buf, src, 70, false, true);
+   (void)Buff_Ring_Remove(buf, 69, true);
+   (void)Buff_Ring_Add_Extension(buf, extension);
+   (void)Buff_Ring_Add_Protected_Extension(buf, protected_extension);
+   (void)Buff_Ring_Init(buf2, memory2, 100);
+   (void)Buff_Ring_Add_Extension(buf2, extension);
+   (void)Buff_Ring_Add_Protected_Extension(buf2, protected_extension);
+   memset(&on_extensions, 0, sizeof(on_extensions));
+   memset(&on_protected_extensions, 0, sizeof(on_protected_extensions));
+
+   Buff_Ring_Uring_Feed_Init(&feeds[0], buf, pipe_fds[0], 100, true);
+   Buff_Ring_Uring_Feed_Init(&feeds[1], buf2, socket_fds[0], 30, true);
+
+   /* no data yet - requests are posted and stay in flight */
+   if((0 != Buff_Ring_Uring_Process(&uring, feeds, Num_Elems(feeds), 0, &error)) || (0 != error)
+      || (!feeds[0].is_posted) || (!feeds[1].is_posted) || (0 != on_extensions.on_write_cntr))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Uring_Process post");
+      failure_cntr++;
+   }
+
+   if((60 != write(pipe_fds[1], src, 60)) || (50 != write(socket_fds[1], &src[100], 50)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "write");
+      failure_cntr++;
+   }
+
+   for(cntr = 0; (cntr < 100) && ((61 != Buff_Ring_Get_Busy_Size(buf, true)) || (50 != Buff_Ring_Get_Busy_Size(buf2, true))); cntr++)
+   {
+      (void)Buff_Ring_Uring_Process(&uring, feeds, Num_Elems(feeds), 1, &error);
+
+      if(0 != error)
+      {
+         printf("line: %5d; %-44s failed with error %d\n\r", __LINE__, "Buff_Ring_Uring_Process", error);
          failure_cntr++;
-         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
+         break;
       }
    }
-   else
+
+   /* data is checked-in in the same order as written; each check-in calls write extensions */
+   if((1 != Buff_Ring_Read(buf, read_data, 1, true)) || (src[69] != read_data[0])
+      || (60 != Buff_Ring_Read(buf, read_data, 100, true)) || (0 != memcmp(read_data, src, 60))
+      || (50 != Buff_Ring_Read(buf2, read_data, 100, true)) || (0 != memcmp(read_data, &src[100], 50))
+      || (on_extensions.on_write_cntr < 4) || (on_extensions.on_write_cntr != on_protected_extensions.on_write_cntr))
    {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Uring_Process data");
       failure_cntr++;
-      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
    }
 
+   /* closed write ends - posted requests complete with end of file */
+   (void)close(pipe_fds[1]);
+   (void)close(socket_fds[1]);
+
+   for(cntr = 0; (cntr < 100) && ((!feeds[0].is_eof) || (!feeds[1].is_eof)); cntr++)
+   {
+      (void)Buff_Ring_Uring_Process(&uring, feeds, Num_Elems(feeds), 1, &error);
+   }
+
+   if((!feeds[0].is_eof) || (!feeds[1].is_eof) || feeds[0].is_posted || feeds[1].is_posted
+      || (0 != feeds[0].error) || (0 != feeds[1].error)
+      || (0 != Buff_Ring_Uring_Process(&uring, feeds, Num_Elems(feeds), 5, &error)) || (0 != error)
+      || (0 != Buff_Ring_Get_Busy_Size(buf, true)) || (0 != Buff_Ring_Get_Busy_Size(buf2, true)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Uring_Process EOF");
+      failure_cntr++;
+   }
+
+   (void)close(pipe_fds[0]);
+   (void)close(socket_fds[0]);
+
+   /*
+    * buffer drained by consumer while read request is posted - completed data must be checked-in where it has been read;
+    * free space belongs to the kernel meantime, so producer writes nothing (even with overwriting)
+    */
+   if(0 != pipe(pipe_fds))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "pipe");
+      Buff_Ring_Uring_Deinit(&uring);
+      return;
+   }
+
+   Buff_Ring_Clear(buf, true);
+   (void)Buff_Ring_Write(buf, src, 10, false, true);
+   Buff_Ring_Uring_Feed_Init(&feeds[0], buf, pipe_fds[0], 100, true);
+   memset(&on_extensions, 0, sizeof(on_extensions));
+
+   if((0 != Buff_Ring_Uring_Process(&uring, feeds, Num_Elems(feeds), 0, &error)) || (0 != error) || (!feeds[0].is_posted)
+      || (10 != feeds[0].posted_pos) || (10 != Buff_Ring_Read(buf, read_data, 100, true)) || (0 != memcmp(read_data, src, 10))
+      || (0 != Buff_Ring_Write(buf, &src[100], 20, true, true)) || (0 != Buff_Ring_Write(buf, &src[100], 20, false, true))
+      || (0 != Buff_Ring_Get_Busy_Size(buf, true)) || (5 != write(pipe_fds[1], &src[150], 5)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Uring_Process drain");
+      failure_cntr++;
+   }
+
+   for(cntr = 0; (cntr < 100) && (0 == Buff_Ring_Get_Busy_Size(buf, true)) && (0 == feeds[0].error); cntr++)
+   {
+      (void)Buff_Ring_Uring_Process(&uring, feeds, Num_Elems(feeds), 1, &error);
+   }
+
+   if((0 != feeds[0].error) || (1 != on_extensions.on_write_cntr)
+      || (5 != Buff_Ring_Read(buf, read_data, 100, true)) || (0 != memcmp(read_data, &src[150], 5)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Uring_Process drain data");
+      failure_cntr++;
+   }
+
+   (void)close(pipe_fds[1]);
+
+   for(cntr = 0; (cntr < 100) && feeds[0].is_posted; cntr++)
+   {
+      (void)Buff_Ring_Uring_Process(&uring, feeds, Num_Elems(feeds), 1, &error);
+   }
+
+   Buff_Ring_Uring_Deinit(&uring);
+   (void)close(pipe_fds[0]);
+
    if(0 == failure_cntr)
    {
-      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "overwrite_if_no_free_space");
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_Uring");
    }
    else
    {
-      printf("line: %5d; %-44s failed\n\r", __LINE__, "overwrite_if_no_free_space");
+      printf("%-36s failed %d times\n\r", "Buff_Ring_Uring", failure_cntr);
    }
-} /* add_read_tests */
+#endif
+} /* uring_tests */
 
-static void ring_to_ring_copy_tests(
-   Buff_Ring_XT *buf1,
-   Buff_Ring_XT *buf2,
-   const uint8_t *src,
+static void splice_tests(
+   Buff_Ring_XT *buf,
+   uint8_t *src,
    size_t src_size,
-   uint8_t *memory1,
-   size_t buf_memory_size1,
-   uint8_t *memory2,
-   size_t buf_memory_size2,
-   uint8_t *read1,
-   size_t read1_size,
-   Buff_Ring_Extensions_XT *extension1,
-   Buff_Ring_Extensions_XT *protected_extension1,
-   Buff_Ring_Extensions_XT *extension2,
-   Buff_Ring_Extensions_XT *protected_extension2)
+   uint8_t *memory,
+   size_t buf_memory_size,
+   uint8_t *read_data,
+   size_t read_size,
+   Buff_Ring_Extensions_XT *extension,
+   Buff_Ring_Extensions_XT *protected_extension)
 {
-   size_t i;
-   size_t offset;
-   size_t on_remove_cntr;
+#if(BUFF_RING_USE_SPLICE && BUFF_RING_SPLICE_OUT_ENABLED && BUFF_RING_SPLICE_IN_ENABLED && BUFF_RING_DATA_CHECK_IN_CHECK_OUT_ENABLED \
+   && BUFF_RING_READ_CHECK_IN_CHECK_OUT_ENABLED && BUFF_RING_INIT_ENABLED && BUFF_RING_WRITE_ENABLED && BUFF_RING_READ_ENABLED \
+   && BUFF_RING_REMOVE_ENABLED && BUFF_RING_GET_BUSY_SIZE_ENABLED)
+   int fds[2];
+   int error;
+   size_t first_size;
+   size_t size;
+   size_t expected;
+
+   Buff_Ring_Init_Extension(extension);
+   Buff_Ring_Init_Extension(protected_extension);
+
+   extension->on_read                       = main_ring_on_read;
+   extension->on_write                      = main_ring_on_write;
+   extension->on_read_params                = &on_extensions;
+   extension->on_write_params               = &on_extensions;
+   protected_extension->on_read             = main_ring_on_read;
+   protected_extension->on_write            = main_ring_on_write;
+   protected_extension->on_read_params      = &on_protected_extensions;
+   protected_extension->on_write_params     = &on_protected_extensions;
+
+   failure_cntr = 0;
+
+   if(0 != pipe(fds))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "pipe");
+      failure_cntr++;
+      return;
+   }
+
+   for(first_size = 0; (first_size < 100) && (buf_memory_size >= 100) && (src_size >= 200) && (read_size >= 200); first_size += 3)
+   {
+      for(size = 0; size <= 100; size++)
+      {
+         /* busy / free area wraps inside 100 bytes memory as long as first_size + size > 100 */
+         (void)Buff_Ring_Init(buf, memory, 100);
+         (void)Buff_Ring_Add_Extension(buf, extension);
+         (void)Buff_Ring_Add_Protected_Extension(buf, protected_extension);
+         (void)Buff_Ring_Write(buf, src, first_size, false, true);
+         (void)Buff_Ring_Remove(buf, first_size, true);
+         (void)Buff_Ring_Write(buf, src, size, false, true);
+         memset(&on_extensions, 0, sizeof(on_extensions));
+         memset(&on_protected_extensions, 0, sizeof(on_protected_extensions));
+
+         /* ring -> pipe in 2 steps; spliced data stays in the buffer until it is released */
+         expected = (size < 40) ? size : 40;
+
+         if((expected != Buff_Ring_Splice_Out(buf, fds[1], 40, &error, true)) || ((0 != error) && (expected > 0))
+            || ((size - expected) != Buff_Ring_Splice_Out(buf, fds[1], 200, &error, true))
+            || (0 != Buff_Ring_Splice_Out(buf, fds[1], 200, &error, true))
+            || (size != Buff_Ring_Get_Busy_Size(buf, true))
+            || ((size > 0) && (((ssize_t)size != read(fds[0], read_data, size)) || (0 != memcmp(read_data, src, size)))))
+         {
+            printf("line: %5d; %-44s failed for first_size: %d, size: %d\n\r", __LINE__, "Buff_Ring_Splice_Out", (int)first_size, (int)size);
+            failure_cntr++;
+         }
+
+         /* pipe drained - spliced data can be removed; release is limited to spliced data */
+         if((expected != Buff_Ring_Splice_Release(buf, expected, true))
+            || ((size - expected) != Buff_Ring_Splice_Release(buf, 200, true))
+            || (0 != Buff_Ring_Get_Busy_Size(buf, true))
+            || ((size > 0) && ((((expected > 0) ? 1 : 0) + (((size - expected) > 0) ? 1 : 0)) != on_extensions.on_read_cntr))
+            || (on_extensions.on_read_cntr != on_protected_extensions.on_read_cntr))
+         {
+            printf("line: %5d; %-44s failed for first_size: %d, size: %d\n\r", __LINE__, "Buff_Ring_Splice_Release", (int)first_size, (int)size);
+            failure_cntr++;
+         }
+
+         /* pipe -> ring: data goes to wrapped free space */
+         (void)Buff_Ring_Init(buf, memory, 100);
+         (void)Buff_Ring_Add_Extension(buf, extension);
+         (void)Buff_Ring_Add_Protected_Extension(buf, protected_extension);
+         (void)Buff_Ring_Write(buf, src, first_size, false, true);
+         (void)Buff_Ring_Remove(buf, first_size, true);
+         memset(&on_extensions, 0, sizeof(on_extensions));
+         memset(&on_protected_extensions, 0, sizeof(on_protected_extensions));
+
+         if((size > 0) && ((ssize_t)size != write(fds[1], &src[50], size)))
+         {
+            printf("line: %5d; %-44s failed\n\r", __LINE__, "write");
+            failure_cntr++;
+         }
+
+         if((size > 0) && ((size != Buff_Ring_Splice_In(buf, fds[0], 200, &error, true)) || (0 != error)
+            || (size != Buff_Ring_Read(buf, read_data, 200, true)) || (0 != memcmp(read_data, &src[50], size))
+            || (1 != on_extensions.on_write_cntr) || (1 != on_protected_extensions.on_write_cntr)))
+         {
+            printf("line: %5d; %-44s failed for first_size: %d, size: %d\n\r", __LINE__, "Buff_Ring_Splice_In", (int)first_size, (int)size);
+            failure_cntr++;
+         }
+      }
+   }
+
+   /* spliced data is referenced by the pipe - it is not read, removed, cleared nor overwritten until it is released */
+   (void)Buff_Ring_Init(buf, memory, 100);
+   (void)Buff_Ring_Write(buf, src, 30, false, true);
+
+   if((10 != Buff_Ring_Splice_Out(buf, fds[1], 10, &error, true))
+      || (0 != Buff_Ring_Read(buf, read_data, 30, true))
+      || (0 != Buff_Ring_Remove(buf, 30, true))
+      || (30 != Buff_Ring_Get_Busy_Size(buf, true)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Read/Remove of spliced data");
+      failure_cntr++;
+   }
+
+   Buff_Ring_Clear(buf, true);
+
+#if(BUFF_RING_ALLOW_OLD_DATA_OVERWRITE)
+   size = Buff_Ring_Write(buf, &src[100], 80, true, true);
+#else
+   size = 0;
+#endif
+
+   if(((30 + size) != Buff_Ring_Get_Busy_Size(buf, true))
+      || (10 != read(fds[0], read_data, 10)) || (0 != memcmp(read_data, src, 10))
+      || (10 != Buff_Ring_Splice_Release(buf, 10, true))
+      || (20 != Buff_Ring_Read(buf, read_data, 20, true)) || (0 != memcmp(read_data, &src[10], 20)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Clear/Write of spliced data");
+      failure_cntr++;
+   }
+
+#if(BUFF_RING_USE_AUTO_GROW && BUFF_RING_SET_AUTO_GROW_ENABLED && BUFF_RING_RESIZE_ENABLED)
+   /* memory referenced by the pipe is not exchanged - buffer is neither resized nor grown until spliced data is released */
+   (void)Buff_Ring_Init(buf, memory, 100);
+   (void)Buff_Ring_Write(buf, src, 60, false, true);
+   Buff_Ring_Set_Auto_Grow(buf, resize_memory_alloc, resize_memory_free, 2, 400);
+   resize_num_allocated = 0;
+
+   if((buf_memory_size < 300) || (60 != Buff_Ring_Splice_Out(buf, fds[1], 60, &error, true))
+      || Buff_Ring_Resize(buf, &memory[100], 200, true)
+      || (40 != Buff_Ring_Write(buf, &src[60], 80, false, true))
+      || (0 != resize_num_allocated) || (memory != buf->memory) || (100 != Buff_Ring_Get_Size(buf, true))
+      || (60 != read(fds[0], read_data, 60)) || (0 != memcmp(read_data, src, 60)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Resize/Auto_Grow of spliced data");
+      failure_cntr++;
+   }
+
+   /* released - buffer grows again */
+   if((60 != Buff_Ring_Splice_Release(buf, 60, true)) || (80 != Buff_Ring_Write(buf, &src[100], 80, false, true))
+      || (1 != resize_num_allocated) || (200 != Buff_Ring_Get_Size(buf, true))
+      || (120 != Buff_Ring_Read(buf, read_data, 200, true)) || (0 != memcmp(read_data, &src[60], 120))
+      || (!Buff_Ring_Resize(buf, memory, 100, true)) || (0 != resize_num_allocated))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Set_Auto_Grow after Splice_Release");
+      failure_cntr++;
+   }
+#endif
+
+   /* empty pipe - non-blocking vmsplice fails with EAGAIN and buffer is not modified */
+   (void)Buff_Ring_Init(buf, memory, 100);
+
+   if((0 != Buff_Ring_Splice_In(buf, fds[0], 100, &error, true)) || (EAGAIN != error)
+      || (0 != Buff_Ring_Get_Busy_Size(buf, true)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Splice_In EAGAIN");
+      failure_cntr++;
+   }
+
+   (void)close(fds[0]);
+   (void)close(fds[1]);
+
+   /* closed descriptor - nothing is spliced */
+   (void)Buff_Ring_Write(buf, src, 10, false, true);
+
+   if((0 != Buff_Ring_Splice_Out(buf, fds[1], 100, &error, true)) || (EBADF != error)
+      || (0 != Buff_Ring_Splice_Release(buf, 10, true)) || (10 != Buff_Ring_Get_Busy_Size(buf, true)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Splice_Out EBADF");
+      failure_cntr++;
+   }
 
-   (void)Buff_Ring_Init(buf1, memory1, buf_memory_size1);
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_Splice");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Ring_Splice", failure_cntr);
+   }
+#endif
+} /* splice_tests */
 
-   (void)Buff_Ring_Init(buf2, memory2, buf_memory_size2);
-   Buff_Ring_Init_Extension(extension2);
-   (void)Buff_Ring_Add_Extension(buf2, extension2);
-   Buff_Ring_Init_Extension(protected_extension2);
-   (void)Buff_Ring_Add_Protected_Extension(buf2, protected_extension2);
+static void file_tests(
+   Buff_Ring_XT *buf,
+   uint8_t *src,
+   size_t src_size,
+   uint8_t *read_data,
+   size_t read_size,
+   Buff_Ring_Extensions_XT *extension)
+{
+#if(BUFF_RING_USE_FILE && BUFF_RING_INIT_FILE_ENABLED && BUFF_RING_USE_PROTECTED_EXTENSIONS && (!BUFF_RING_USE_LOCK_FREE_SPSC) \
+   && BUFF_RING_INIT_ENABLED && BUFF_RING_DEINIT_ENABLED && BUFF_RING_WRITE_ENABLED && BUFF_RING_READ_ENABLED \
+   && BUFF_RING_REMOVE_ENABLED && BUFF_RING_GET_BUSY_SIZE_ENABLED)
+   static const char path[] = "buff_ring_file_test.bin";
+   Buff_Ring_File_XT file;
+   pid_t pid;
+   int status;
+   int fd;
 
-   extension2->on_read              = main_ring_on_read;
-   extension2->on_write             = main_ring_on_write;
-   extension2->on_overwrite         = main_ring_on_overwrite;
-   extension2->on_remove            = main_ring_on_remove;
-   extension2->on_read_params       = &on_extensions;
-   extension2->on_write_params      = &on_extensions;
-   extension2->on_overwrite_params  = &on_extensions;
-   extension2->on_remove_params     = &on_extensions;
+   Buff_Ring_Init_Extension(extension);
 
-   protected_extension2->on_read             = main_ring_on_read;
-   protected_extension2->on_write            = main_ring_on_write;
-   protected_extension2->on_overwrite        = main_ring_on_overwrite;
-   protected_extension2->on_remove           = main_ring_on_remove;
-   protected_extension2->on_read_params      = &on_protected_extensions;
-   protected_extension2->on_write_params     = &on_protected_extensions;
-   protected_extension2->on_overwrite_params = &on_protected_extensions;
-   protected_extension2->on_remove_params    = &on_protected_extensions;
+   extension->on_write                      = main_ring_on_write;
+   extension->on_write_params               = &on_extensions;
 
    failure_cntr = 0;
 
-   for(offset = 0; offset < buf_memory_size1; offset++)
+   if((src_size < 200) || (read_size < 100))
    {
-      Buff_Ring_Clear(buf1, true);
-      Buff_Ring_Clear(buf2, true);
+      return;
+   }
 
-      if(1 == Buff_Ring_Write(buf1, src, 1, true, true))
-      {
-      }
-      else
-      {
-         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
-         failure_cntr++;
-      }
+   (void)unlink(path);
 
-      if(offset == Buff_Ring_Write(buf2, src, offset, true, true))
-      {
-      }
-      else
+   if(Buff_Ring_Recover(buf, &file, path))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Recover no file");
+      failure_cntr++;
+   }
+
+   /* process writes wrapped data and crashes without deinitialization */
+   pid = fork();
+
+   if(0 == pid)
+   {
+      if(Buff_Ring_Init_File(buf, &file, path, 100))
       {
-         printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
-         failure_cntr++;
+         (void)Buff_Ring_Write(buf, src, 70, false, true);
+         (void)Buff_Ring_Remove(buf, 69, true);
+         (void)Buff_Ring_Write(buf, &src[100], 60, false, true);
       }
+      _exit(0);
+   }
 
-      for(i = 1; i < src_size; i++)
-      {
-         on_extensions.on_read_cntr       = 0;
-         on_extensions.on_write_cntr      = 0;
-         on_extensions.on_overwrite_cntr  = 0;
-         on_extensions.on_remove_cntr     = 0;
-         on_protected_extensions.on_read_cntr      = 0;
-         on_protected_extensions.on_write_cntr     = 0;
-         on_protected_extensions.on_overwrite_cntr = 0;
-         on_protected_extensions.on_remove_cntr    = 0;
-         if(i < (buf_memory_size1-offset))
-         {
-            if(i == Buff_Ring_Write(buf1, src, i, true, true))
-            {
-            }
-            else
-            {
-               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
-               failure_cntr++;
-            }
+   if((pid < 0) || (pid != waitpid(pid, &status, 0)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "fork");
+      failure_cntr++;
+   }
 
-            if(i == Buff_Ring_To_Ring_Copy(buf2, buf1, i, 1, true, true))
-            {
-               if((0                      == on_extensions.on_read_cntr)
-                  && (1                      == on_extensions.on_write_cntr)
-                  && (0                      == on_extensions.on_overwrite_cntr)
-                  && (0                      == on_extensions.on_remove_cntr)
-                  && (0                      == on_protected_extensions.on_read_cntr)
-                  && (1                      == on_protected_extensions.on_write_cntr)
-                  && (0                      == on_protected_extensions.on_overwrite_cntr)
-                  && (0                      == on_protected_extensions.on_remove_cntr))
-               {
-               }
-               else
-               {
-                  printf("line: %5d; %-44s failed\n\r", __LINE__, "cntrs check");
-                  failure_cntr++;
-               }
+   /* content published before the crash is reattached; buffer works further and keeps user extension */
+   memset(&on_extensions, 0, sizeof(on_extensions));
 
-               if(i == Buff_Ring_Peak(buf2, read1, i, offset, true))
-               {
-                  if(0 != memcmp(src, read1, i))
-                  {
-                     printf("line: %5d; %-44s failed; i: %d\n\r", __LINE__, "memcmp Buff_Ring_Peak", i);
-                  }
-                  else
-                  {
-                  }
-               }
-               else
-               {
-                  printf("line: %5d; %-44s failed; buf_busy_size: %d\n\r", __LINE__, "Buff_Ring_Peak", Buff_Ring_Get_Busy_Size(buf2, true));
-                  failure_cntr++;
-               }
-            }
-            else
-            {
-               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_To_Ring_Copy");
-               failure_cntr++;
-            }
+   if((!Buff_Ring_Recover(buf, &file, path)) || (61 != Buff_Ring_Get_Busy_Size(buf, true))
+      || (!Buff_Ring_Add_Extension(buf, extension))
+      || (1 != Buff_Ring_Read(buf, read_data, 1, true)) || (src[69] != read_data[0])
+      || (10 != Buff_Ring_Write(buf, &src[160], 10, false, true)) || (1 != on_extensions.on_write_cntr))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Recover after crash");
+      failure_cntr++;
+   }
 
-            if(i == Buff_Ring_Remove(buf2, i, true))
-            {
-            }
-            else
-            {
-               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Remove");
-               failure_cntr++;
-            }
+   /* every modification synchronized with the disk */
+   Buff_Ring_File_Set_Sync(&file, BUFF_RING_FILE_SYNC_SYNC, 0);
 
-            if(i == Buff_Ring_Remove(buf1, i, true))
-            {
-            }
-            else
-            {
-               printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Remove");
-               failure_cntr++;
-            }
-         }
-      }
+   if((10 != Buff_Ring_Write(buf, &src[170], 10, false, true)) || (!Buff_Ring_File_Sync(buf, &file, true)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_File_Sync");
+      failure_cntr++;
    }
 
+   Buff_Ring_Deinit_File(buf, &file);
 
+   /* buffer deinitialized properly is recovered with all its data */
+   if((!Buff_Ring_Recover(buf, &file, path)) || (80 != Buff_Ring_Get_Busy_Size(buf, true))
+      || (80 != Buff_Ring_Read(buf, read_data, 100, true)) || (0 != memcmp(read_data, &src[100], 80)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Recover");
+      failure_cntr++;
+   }
 
+   Buff_Ring_Deinit_File(buf, &file);
 
-   Buff_Ring_Clear(buf1, true);
-   Buff_Ring_Clear(buf2, true);
+   if((!Buff_Ring_Recover(buf, &file, path)) || (0 != Buff_Ring_Get_Busy_Size(buf, true)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Recover empty");
+      failure_cntr++;
+   }
 
-   for(i = 1; i < src_size; i++)
+   /* memory stays in the file and indexes are still published */
+#if(BUFF_RING_ADD_PROTECTED_EXTENSION_ENABLED && BUFF_RING_RESIZE_ENABLED)
+   if(Buff_Ring_Add_Protected_Extension(buf, extension) || (&(file.extension) != buf->protected_extension)
+      || Buff_Ring_Resize(buf, read_data, 100, true) || ((void*)(&((uint8_t*)(file.header))[file.header->header_size]) != buf->memory))
    {
-      on_extensions.on_read_cntr       = 0;
-      on_extensions.on_write_cntr      = 0;
-      on_extensions.on_overwrite_cntr  = 0;
-      on_extensions.on_remove_cntr     = 0;
-      on_protected_extensions.on_read_cntr      = 0;
-      on_protected_extensions.on_write_cntr     = 0;
-      on_protected_extensions.on_overwrite_cntr = 0;
-      on_protected_extensions.on_remove_cntr    = 0;
-      if(i <= (buf_memory_size1))
-      {
-         if(i == Buff_Ring_Write(buf1, src, i, true, true))
-         {
-         }
-         else
-         {
-            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Write");
-            failure_cntr++;
-         }
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Resize of file-backed buffer");
+      failure_cntr++;
+   }
+#endif
+#if(BUFF_RING_USE_AUTO_GROW && BUFF_RING_SET_AUTO_GROW_ENABLED)
+   Buff_Ring_Set_Auto_Grow(buf, resize_memory_alloc, resize_memory_free, 2, 400);
+   resize_num_allocated = 0;
 
-         offset = Buff_Ring_Get_Busy_Size(buf2, true);
-         on_remove_cntr = 0;
+   if((100 != Buff_Ring_Write(buf, src, 150, false, true)) || (0 != resize_num_allocated)
+      || (100 != file.header->state[file.header->sequence & 1].busy_size))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Set_Auto_Grow of file-backed buffer");
+      failure_cntr++;
+   }
+#endif
 
-         if(Buff_Ring_Get_Free_Size(buf2, true) < i)
-         {
-            offset -= i - Buff_Ring_Get_Free_Size(buf2, true);
-            on_remove_cntr = 1;
-         }
+   Buff_Ring_Deinit_File(buf, &file);
 
-         if(i == Buff_Ring_To_Ring_Copy(buf2, buf1, i, 0, true, true))
-         {
-            if((0                      == on_extensions.on_read_cntr)
-               && (1                      == on_extensions.on_write_cntr)
-               && (0                      == on_extensions.on_overwrite_cntr)
-               && (on_remove_cntr         == on_extensions.on_remove_cntr)
-               && (0                      == on_protected_extensions.on_read_cntr)
-               && (1                      == on_protected_extensions.on_write_cntr)
-               && (0                      == on_protected_extensions.on_overwrite_cntr)
-               && (on_remove_cntr         == on_protected_extensions.on_remove_cntr))
-            {
-            }
-            else
-            {
-               printf("line: %5d; %-44s failed\n\r", __LINE__, "cntrs check");
-               failure_cntr++;
-            }
+   /* file which is not file of ring buffer */
+   fd = open(path, O_RDWR | O_TRUNC);
 
-            if(i == Buff_Ring_Peak(buf2, read1, i, offset, true))
-            {
-               if(0 != memcmp(src, read1, i))
-               {
-                  printf("line: %5d; %-44s failed; i: %d\n\r", __LINE__, "memcmp Buff_Ring_Peak", i);
-               }
-               else
-               {
-               }
-            }
-            else
-            {
-               printf("line: %5d; %-44s failed; buf_busy_size: %d\n\r", __LINE__, "Buff_Ring_Peak", Buff_Ring_Get_Busy_Size(buf2, true));
-               failure_cntr++;
-            }
-         }
-         else
-         {
-            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_To_Ring_Copy");
-            failure_cntr++;
-         }
+   if((fd < 0) || (100 != write(fd, src, 100)) || Buff_Ring_Recover(buf, &file, path))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Recover invalid file");
+      failure_cntr++;
+   }
 
-         if(i == Buff_Ring_Remove(buf1, i, true))
-         {
-         }
-         else
-         {
-            printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_Remove");
-            failure_cntr++;
-         }
-      }
+   if(fd >= 0)
+   {
+      (void)close(fd);
    }
+   (void)unlink(path);
 
    if(0 == failure_cntr)
    {
-      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_To_Ring_Copy");
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Ring_Init_File/Recover");
    }
    else
    {
-      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Ring_To_Ring_Copy");
+      printf("%-36s failed %d times\n\r", "Buff_Ring_Init_File/Recover", failure_cntr);
    }
-} /* ring_to_ring_copy_tests */
-
+#endif
+} /* file_tests */
 
 void ring_test(void)
 {
@@ -4327,6 +7123,12 @@ void ring_test(void)
    uint8_t src[2060];
    uint8_t read1[1000];
    uint8_t read2[1000];
+#if(BUFF_RING_USE_POWER_OF_2_SIZE)
+   /* biggest power of 2 which fits to memory */
+   Buff_Size_DT memory_size = 512;
+#else
+   Buff_Size_DT memory_size = sizeof(memory);
+#endif
 
    srand(time(&tt));
 
@@ -4337,44 +7139,102 @@ void ring_test(void)
 
    printf("\n\rbuff-ring tests:\n\r");
 
-   init_tests(&buf, memory, sizeof(memory), src, &extension, &protected_extension);
+   /* tests excluded in lock-free mode expect whole memory to be usable and buffer rewound to its begining when emptied */
+#if(!BUFF_RING_USE_LOCK_FREE_SPSC)
+   init_tests(&buf, memory, memory_size, src, &extension, &protected_extension);
+
+   write_clear_tests(&buf, src, sizeof(src), memory, memory_size, &extension, &protected_extension);
+
+   write_peak_read_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), read2, sizeof(read2), &extension, &protected_extension);
+
+   write_peak_vendor_read_vendor_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), read2, sizeof(read2), &extension, &protected_extension);
+
+   write_peak_vector_read_vector_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), read2, sizeof(read2), &extension, &protected_extension);
+
+   write_peak_tree_read_tree_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), read2, sizeof(read2), &extension, &protected_extension);
+
+   getters_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), &extension, &protected_extension);
+
+   write_vendor_clear_tests(&buf, src, sizeof(src), memory, memory_size, &extension, &protected_extension);
+#endif
+
+   write_vendor_specific_tests(&buf, src, sizeof(src), memory, memory_size, &extension, &protected_extension);
+
+   write_vector_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), &extension, &protected_extension);
+
+#if(!BUFF_RING_USE_LOCK_FREE_SPSC)
+   write_vector_specific_tests(&buf, src, sizeof(src), memory, memory_size, &extension, &protected_extension);
+#endif
+
+   write_tree_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), &extension, &protected_extension);
+
+#if(!BUFF_RING_USE_LOCK_FREE_SPSC)
+   write_tree_specific_tests(&buf, src, sizeof(src), memory, memory_size, &extension, &protected_extension);
+#endif
+
+   write_cursor_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1));
+
+   overwrite_if_exist_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), &extension, &protected_extension);
+
+   overwrite_if_exist_vendor_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), &extension, &protected_extension);
+
+   add_read_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), &extension, &protected_extension);
+
+   add_vendor_read_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), &extension, &protected_extension);
+
+#if((!BUFF_RING_USE_LOCK_FREE_SPSC) && (!BUFF_RING_USE_POWER_OF_2_SIZE))
+   check_out_in_test(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), &extension, &protected_extension);
+#endif
+
+   read_check_out_in_test(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), &extension, &protected_extension);
 
-   write_clear_tests(&buf, src, sizeof(src), memory, sizeof(memory), &extension, &protected_extension);
+   check_out_vector_in_test(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), &extension, &protected_extension);
 
-   write_peak_read_tests(&buf, src, sizeof(src), memory, sizeof(memory), read1, sizeof(read1), read2, sizeof(read2), &extension, &protected_extension);
+   mirrored_tests(&buf, src, sizeof(src), read1, sizeof(read1));
 
-   write_peak_vendor_read_vendor_tests(&buf, src, sizeof(src), memory, sizeof(memory), read1, sizeof(read1), read2, sizeof(read2), &extension, &protected_extension);
+#if(!BUFF_RING_USE_LOCK_FREE_SPSC)
+   add_write_overwrite_if_no_free_space_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), &extension, &protected_extension);
 
-   write_peak_vector_read_vector_tests(&buf, src, sizeof(src), memory, sizeof(memory), read1, sizeof(read1), read2, sizeof(read2), &extension, &protected_extension);
+   ring_to_ring_copy_tests(&buf, &buf2, src, sizeof(src), memory, memory_size, memory2, memory_size, read1, sizeof(read1), &extension, &protected_extension, &extension2, &protected_extension2);
+#endif
 
-   write_peak_tree_read_tree_tests(&buf, src, sizeof(src), memory, sizeof(memory), read1, sizeof(read1), read2, sizeof(read2), &extension, &protected_extension);
+   non_temporal_copy_tests(&buf, &buf2, src, sizeof(src), memory, memory_size, memory2, memory_size, read1, sizeof(read1));
 
-   getters_tests(&buf, src, sizeof(src), memory, sizeof(memory), read1, sizeof(read1), &extension, &protected_extension);
+   checksum_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1));
 
-   write_vendor_clear_tests(&buf, src, sizeof(src), memory, sizeof(memory), &extension, &protected_extension);
+   find_tests(&buf, memory, memory_size, read1, sizeof(read1));
 
-   write_vendor_specific_tests(&buf, src, sizeof(src), memory, sizeof(memory), &extension, &protected_extension);
+   record_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), &extension, &protected_extension);
 
-   write_vector_tests(&buf, src, sizeof(src), memory, sizeof(memory), read1, sizeof(read1), &extension, &protected_extension);
+   pool_tests(memory, memory_size);
 
-   write_vector_specific_tests(&buf, src, sizeof(src), memory, sizeof(memory), &extension, &protected_extension);
+   /* tests excluded in power-of-2 mode initialize buffers with sizes which are not power of 2 */
+#if(!BUFF_RING_USE_POWER_OF_2_SIZE)
+   bip_tests(memory, memory_size);
 
-   write_tree_tests(&buf, src, sizeof(src), memory, sizeof(memory), read1, sizeof(read1), &extension, &protected_extension);
+#if(!BUFF_RING_USE_LOCK_FREE_SPSC)
+   resize_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1));
+#endif
 
-   write_tree_specific_tests(&buf, src, sizeof(src), memory, sizeof(memory), &extension, &protected_extension);
+   chain_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1));
+#endif
 
-   overwrite_if_exist_tests(&buf, src, sizeof(src), memory, sizeof(memory), read1, sizeof(read1), &extension, &protected_extension);
+#if((!BUFF_RING_USE_LOCK_FREE_SPSC) && (!BUFF_RING_USE_POWER_OF_2_SIZE))
+   fd_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), &extension, &protected_extension);
 
-   overwrite_if_exist_vendor_tests(&buf, src, sizeof(src), memory, sizeof(memory), read1, sizeof(read1), &extension, &protected_extension);
+   uring_tests(&buf, &buf2, src, sizeof(src), memory, memory2, memory_size, read1, sizeof(read1), &extension, &protected_extension);
 
-   add_read_tests(&buf, src, sizeof(src), memory, sizeof(memory), read1, sizeof(read1), &extension, &protected_extension);
+   splice_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1), &extension, &protected_extension);
+#endif
 
-   add_vendor_read_tests(&buf, src, sizeof(src), memory, sizeof(memory), read1, sizeof(read1), &extension, &protected_extension);
+#if(!BUFF_RING_USE_POWER_OF_2_SIZE)
+   file_tests(&buf, src, sizeof(src), read1, sizeof(read1), &extension);
+#endif
 
-   check_out_in_test(&buf, src, sizeof(src), memory, sizeof(memory), read1, sizeof(read1), &extension, &protected_extension);
+   spsc_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1));
 
-   add_write_overwrite_if_no_free_space_tests(&buf, src, sizeof(src), memory, sizeof(memory), read1, sizeof(read1), &extension, &protected_extension);
+   mp_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1));
 
-   ring_to_ring_copy_tests(&buf, &buf2, src, sizeof(src), memory, sizeof(memory), memory2, sizeof(memory2), read1, sizeof(read1), &extension, &protected_extension, &extension2, &protected_extension2);
+   power_of_2_tests(&buf, src, sizeof(src), memory, memory_size, read1, sizeof(read1));
 } /* ring_test */
 
@@ -32,6 +32,9 @@
 #include "buff.h"
 #include "tree_test.h"
 #include "test_utils.h"
+#if(BUFF_USE_IOVEC)
+#include <sys/uio.h>
+#endif
 
 static size_t vendor_cpy_cntr;
 static size_t vendor_cpy_cntr_limit;
@@ -89,10 +92,37 @@ void tree_test(void)
    Buff_Writeable_Tree_XT   d_t2t1_short[1];
    Buff_Writeable_Vector_XT d_t2v1_short[2];
    Buff_Writeable_Vector_XT d_t2t1v1_short[1];
+   Buff_Readable_Flat_Tree_XT  s_flat;
+   Buff_Readable_Vector_XT     s_flat_v[20];
+   Buff_Size_DT                s_flat_offset[20];
+   Buff_Writeable_Flat_Tree_XT d_flat;
+   Buff_Writeable_Vector_XT    d_flat_v[20];
+   Buff_Size_DT                d_flat_offset[20];
    Buff_Size_DT dest_offset;
    Buff_Size_DT src_offset;
    Buff_Size_DT size;
    Buff_Size_DT result;
+   Buff_Readable_Tree_Cursor_XT tree_cursor;
+   Buff_Readable_Tree_XT   deep_t[12][2];
+   Buff_Readable_Vector_XT deep_v[12];
+   Buff_Readable_Tree_XT   too_deep_t[BUFF_TREE_MAX_DEPTH + 1][2];
+   Buff_Readable_Vector_XT too_deep_v[BUFF_TREE_MAX_DEPTH + 1];
+   Buff_Size_DT str_size;
+   Buff_Bool_DT end_of_destination;
+#if(BUFF_USE_IOVEC)
+   Buff_Readable_Tree_XT   p_t[2];
+   Buff_Readable_Vector_XT p_v[8];
+   struct iovec iov[4];
+   uint8_t dest_ref[200];
+   Buff_Num_Elems_DT iov_size;
+   Buff_Num_Elems_DT iov_num_elems;
+   Buff_Num_Elems_DT cntr;
+   Buff_Bool_DT truncated;
+#endif
+#if(BUFF_USE_CHECKSUM)
+   Buff_Checksum_XT checksum;
+   Buff_Checksum_XT checksum_ref;
+#endif
 
    srand(time(&tt));
 
@@ -689,7 +719,14 @@ void tree_test(void)
     //        printf("size: %d, dest_offset: %d, src_offset: %d\n\r", size, dest_offset, src_offset);
             memset(dest, 0, sizeof(dest));
 
-            result = Buff_Copy_Tree_To_Tree(d_t_short, Num_Elems(d_t_short), s_t, Num_Elems(s_t), size, dest_offset, src_offset, NULL, NULL);
+            result = Buff_Copy_Tree_To_Tree(
+               d_t_short, Num_Elems(d_t_short), s_t, Num_Elems(s_t), size, dest_offset, src_offset, &str_size, &end_of_destination);
+
+            if((BUFF_BOOL_IS_TRUE(end_of_destination) != ((dest_offset + size) > SHORTER_DESTINATION)) || ((src_offset + result) != str_size))
+            {
+               printf("wrong end of destination: %d or size of source returned: %d\n\r", end_of_destination, str_size);
+               failure_cntr++;
+            }
 
             if((dest_offset + size) < SHORTER_DESTINATION)
             {
@@ -756,6 +793,411 @@ void tree_test(void)
 
 
 
+   printf("\n\rflattened tree copy tests:\n\r");
+
+
+
+   failure_cntr = 0;
+   if(!Buff_Readable_Tree_Flatten(&s_flat, s_flat_v, s_flat_offset, Num_Elems(s_flat_v), s_t, Num_Elems(s_t))
+      || (Buff_Get_Readable_Tree_Data_Size(s_t, Num_Elems(s_t)) != s_flat.size)
+      || (s_flat.size != Buff_Get_Readable_Tree_Data_Size(&s_flat.tree, 1)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Readable_Tree_Flatten");
+      failure_cntr++;
+   }
+   if(!Buff_Writeable_Tree_Flatten(&d_flat, d_flat_v, d_flat_offset, Num_Elems(d_flat_v), d_t, Num_Elems(d_t))
+      || (Buff_Get_Writeable_Tree_Data_Size(d_t, Num_Elems(d_t)) != d_flat.size))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Writeable_Tree_Flatten");
+      failure_cntr++;
+   }
+   /* not enough place for all parts of the tree */
+   if(Buff_Readable_Tree_Flatten(&s_flat, s_flat_v, s_flat_offset, 2, s_t, Num_Elems(s_t)) || (0 != s_flat.size))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "Buff_Readable_Tree_Flatten-too_small");
+      failure_cntr++;
+   }
+   (void)Buff_Readable_Tree_Flatten(&s_flat, s_flat_v, s_flat_offset, Num_Elems(s_flat_v), s_t, Num_Elems(s_t));
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Readable/Writeable_Tree_Flatten");
+   }
+
+
+
+   failure_cntr = 0;
+   for(size = 1; size < sizeof(dest); size++)
+   {
+      for(dest_offset = 0; dest_offset < (sizeof(dest) - size); dest_offset++)
+      {
+         for(src_offset = 0; src_offset < (sizeof(dest) - size); src_offset++)
+         {
+            memset(dest, 0, sizeof(dest));
+
+            result = Buff_Copy_From_Flat_Tree(dest, &s_flat, size, dest_offset, src_offset);
+
+            if(size != result)
+            {
+               printf("wrong size returned! %d, expected: %d\n\r", result, size);
+               printf("press any key to continue...\n\r");
+               getc(stdin);
+            }
+            is_zero(dest, dest_offset);
+            is_zero(&dest[dest_offset + size], sizeof(dest) - (dest_offset + size));
+            compare_and_print_status(
+               &dest[dest_offset], &src[src_offset], size, sizeof(src) - size, "Buff_Copy_From_Flat_Tree");
+         }
+      }
+
+      printf("step %d / %d\r", size, sizeof(dest));
+   }
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Copy_From_Flat_Tree");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Copy_From_Flat_Tree", failure_cntr);
+   }
+
+
+
+   failure_cntr = 0;
+   for(size = 1; size < sizeof(dest); size++)
+   {
+      for(dest_offset = 0; dest_offset < (sizeof(dest) - size); dest_offset++)
+      {
+         for(src_offset = 0; src_offset < (sizeof(dest) - size); src_offset++)
+         {
+            memset(dest, 0, sizeof(dest));
+
+            result = Buff_Copy_To_Flat_Tree(&d_flat, src, size, dest_offset, src_offset);
+
+            if(size != result)
+            {
+               printf("wrong size returned! %d, expected: %d\n\r", result, size);
+               printf("press any key to continue...\n\r");
+               getc(stdin);
+            }
+            is_zero(dest, dest_offset);
+            is_zero(&dest[dest_offset + size], sizeof(dest) - (dest_offset + size));
+            compare_and_print_status(
+               &dest[dest_offset], &src[src_offset], size, sizeof(src) - size, "Buff_Copy_To_Flat_Tree");
+         }
+      }
+
+      printf("step %d / %d\r", size, sizeof(dest));
+   }
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Copy_To_Flat_Tree");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Copy_To_Flat_Tree", failure_cntr);
+   }
+
+
+
+   failure_cntr = 0;
+   for(size = 1; size < sizeof(dest); size += 7)
+   {
+      memset(dest, 0, sizeof(dest));
+
+      /* flattened tree used by function which takes regular tree */
+      result = Buff_Copy_From_Tree(dest, &s_flat.tree, 1, size, 0, sizeof(src) - size, NULL);
+
+      if(size != result)
+      {
+         printf("wrong size returned! %d, expected: %d\n\r", result, size);
+         failure_cntr++;
+      }
+      compare_and_print_status(dest, &src[sizeof(src) - size], size, sizeof(src) - size, "Buff_Copy_From_Tree-flat");
+   }
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Copy_From_Tree-flat");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Copy_From_Tree-flat", failure_cntr);
+   }
+
+
+
+   failure_cntr = 0;
+   for(src_offset = 0; src_offset < sizeof(src); src_offset++)
+   {
+      for(size = 1; size < 40; size++)
+      {
+         memset(dest, 0, sizeof(dest));
+
+         Buff_Readable_Tree_Cursor_Init(&tree_cursor, s_t, Num_Elems(s_t), src_offset);
+
+         /* data copied in chunks of "size" bytes, each chunk starts where previous one ended */
+         dest_offset = 0;
+         do
+         {
+            result = Buff_Copy_From_Tree_Cursor(&dest[dest_offset], &tree_cursor, size);
+            dest_offset += result;
+         }while(result == size);
+
+         if(dest_offset != (sizeof(src) - src_offset))
+         {
+            printf("wrong size returned! %d, expected: %d\n\r", dest_offset, sizeof(src) - src_offset);
+            failure_cntr++;
+         }
+         is_zero(&dest[dest_offset], sizeof(dest) - dest_offset);
+         compare_and_print_status(dest, &src[src_offset], dest_offset, sizeof(src) - dest_offset, "Buff_Copy_From_Tree_Cursor");
+      }
+   }
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Copy_From_Tree_Cursor");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Copy_From_Tree_Cursor", failure_cntr);
+   }
+
+
+
+#if(BUFF_USE_IOVEC)
+   failure_cntr = 0;
+   /* contiguous parts of s_t are coalesced into one iovec element */
+   for(src_offset = 0; src_offset < sizeof(src); src_offset++)
+   {
+      Buff_Readable_Tree_Cursor_Init(&tree_cursor, s_t, Num_Elems(s_t), src_offset);
+
+      iov_num_elems = Num_Elems(iov);
+      result = Buff_Tree_To_Iovec(iov, &iov_num_elems, &tree_cursor, sizeof(src), &truncated);
+
+      if((result != (sizeof(src) - src_offset)) || (1 != iov_num_elems) || BUFF_BOOL_IS_TRUE(truncated)
+         || (iov[0].iov_base != &src[src_offset]) || (iov[0].iov_len != result))
+      {
+         printf("wrong iovec! size: %d, expected: %d; num elems: %d\n\r", result, sizeof(src) - src_offset, iov_num_elems);
+         failure_cntr++;
+      }
+   }
+
+   /* not contiguous parts (every second 10 bytes of src, only p_v[3] and p_v[4] are adjacent) - iovec table is filled
+      and description is continued from the cursor as long as data is available */
+   for(cntr = 0; cntr < Num_Elems(p_v); cntr++)
+   {
+      p_v[cntr].data = &src[(cntr < 4) ? (cntr * 20) : (cntr * 20 - 10)];
+      p_v[cntr].size = 10;
+   }
+   p_t[0].elem_type.vector.vector              = p_v;
+   p_t[0].elem_type.vector.vector_num_elems    = 4;
+   p_t[0].is_branch = BUFF_FALSE;
+   p_t[1].elem_type.vector.vector              = &p_v[4];
+   p_t[1].elem_type.vector.vector_num_elems    = 4;
+   p_t[1].is_branch = BUFF_FALSE;
+
+   for(iov_size = 1; iov_size <= Num_Elems(iov); iov_size++)
+   {
+      for(src_offset = 0; src_offset < 80; src_offset++)
+      {
+         for(size = 1; size < 40; size++)
+         {
+            memset(dest, 0, sizeof(dest));
+
+            Buff_Readable_Tree_Cursor_Init(&tree_cursor, p_t, Num_Elems(p_t), src_offset);
+
+            dest_offset = 0;
+            do
+            {
+               iov_num_elems = iov_size;
+               result = Buff_Tree_To_Iovec(iov, &iov_num_elems, &tree_cursor, size, &truncated);
+
+               if((iov_num_elems > iov_size) || (BUFF_BOOL_IS_TRUE(truncated) && ((iov_num_elems != iov_size) || (result >= size))))
+               {
+                  printf("wrong iovec! size: %d, num elems: %d, truncated: %d\n\r", result, iov_num_elems, truncated);
+                  failure_cntr++;
+               }
+
+               for(cntr = 0; cntr < iov_num_elems; cntr++)
+               {
+                  memcpy(&dest[dest_offset], iov[cntr].iov_base, iov[cntr].iov_len);
+                  dest_offset += iov[cntr].iov_len;
+               }
+            }while((result == size) || BUFF_BOOL_IS_TRUE(truncated));
+
+            Buff_Readable_Tree_Cursor_Init(&tree_cursor, p_t, Num_Elems(p_t), src_offset);
+            memset(dest_ref, 0, sizeof(dest_ref));
+            result = Buff_Copy_From_Tree_Cursor(dest_ref, &tree_cursor, sizeof(dest_ref));
+
+            if(dest_offset != (80 - src_offset))
+            {
+               printf("wrong size returned! %d, expected: %d\n\r", dest_offset, 80 - src_offset);
+               failure_cntr++;
+            }
+            compare_and_print_status(dest, dest_ref, sizeof(dest), sizeof(dest_ref), "Buff_Tree_To_Iovec");
+         }
+      }
+   }
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Tree_To_Iovec");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Tree_To_Iovec", failure_cntr);
+   }
+#endif
+
+
+
+   /* tree deeper than recursion-friendly test trees - each level holds one vector and branch to next level */
+   for(i = 0; i < Num_Elems(deep_t); i++)
+   {
+      deep_v[i].data                               = &src[i * 16];
+      deep_v[i].size                               = 16;
+      deep_t[i][0].elem_type.vector.vector         = &deep_v[i];
+      deep_t[i][0].elem_type.vector.vector_num_elems = 1;
+      deep_t[i][0].is_branch                       = BUFF_FALSE;
+      deep_t[i][1].elem_type.tree.branch           = ((i + 1) < Num_Elems(deep_t)) ? deep_t[i + 1] : NULL;
+      deep_t[i][1].elem_type.tree.branch_num_elems = ((i + 1) < Num_Elems(deep_t)) ? Num_Elems(deep_t[i]) : 0;
+      deep_t[i][1].is_branch                       = BUFF_TRUE;
+   }
+
+   failure_cntr = 0;
+   if(Buff_Get_Readable_Tree_Data_Size(deep_t[0], Num_Elems(deep_t[0])) != (Num_Elems(deep_t) * 16))
+   {
+      printf("wrong size returned! %d, expected: %d\n\r",
+         Buff_Get_Readable_Tree_Data_Size(deep_t[0], Num_Elems(deep_t[0])), Num_Elems(deep_t) * 16);
+      failure_cntr++;
+   }
+   for(size = 1; size <= (Num_Elems(deep_t) * 16); size++)
+   {
+      for(src_offset = 0; src_offset <= ((Num_Elems(deep_t) * 16) - size); src_offset++)
+      {
+         memset(dest, 0, sizeof(dest));
+
+         result = Buff_Copy_From_Tree(dest, deep_t[0], Num_Elems(deep_t[0]), size, 0, src_offset, &str_size);
+
+         if((size != result) || ((src_offset + size) != str_size))
+         {
+            printf("wrong size returned! %d, expected: %d\n\r", result, size);
+            failure_cntr++;
+         }
+         is_zero(&dest[size], sizeof(dest) - size);
+         compare_and_print_status(dest, &src[src_offset], size, sizeof(src) - size, "Buff_Copy_From_Tree-deep");
+      }
+   }
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Copy_From_Tree-deep");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Copy_From_Tree-deep", failure_cntr);
+   }
+
+   /* tree deeper than BUFF_TREE_MAX_DEPTH - functions which reach its deepest branch fail */
+   for(i = 0; i < Num_Elems(too_deep_t); i++)
+   {
+      too_deep_v[i].data                               = &src[i * 4];
+      too_deep_v[i].size                               = 4;
+      too_deep_t[i][0].elem_type.vector.vector         = &too_deep_v[i];
+      too_deep_t[i][0].elem_type.vector.vector_num_elems = 1;
+      too_deep_t[i][0].is_branch                       = BUFF_FALSE;
+      too_deep_t[i][1].elem_type.tree.branch           = ((i + 1) < Num_Elems(too_deep_t)) ? too_deep_t[i + 1] : NULL;
+      too_deep_t[i][1].elem_type.tree.branch_num_elems = ((i + 1) < Num_Elems(too_deep_t)) ? Num_Elems(too_deep_t[i]) : 0;
+      too_deep_t[i][1].is_branch                       = BUFF_TRUE;
+   }
+
+   failure_cntr = 0;
+   memset(dest, 0, sizeof(dest));
+   str_size = 1;
+
+   if((0 != Buff_Get_Readable_Tree_Data_Size(too_deep_t[0], Num_Elems(too_deep_t[0])))
+      || (0 != Buff_Copy_From_Tree(dest, too_deep_t[0], Num_Elems(too_deep_t[0]), sizeof(dest), 0, 0, &str_size))
+      || (0 != str_size)
+      || (0 != Buff_Copy_Tree_To_Tree(d_t, Num_Elems(d_t), too_deep_t[0], Num_Elems(too_deep_t[0]), sizeof(dest), 0, 0, NULL, NULL))
+      || Buff_Readable_Tree_Flatten(&s_flat, s_flat_v, s_flat_offset, Num_Elems(s_flat_v), too_deep_t[0], Num_Elems(too_deep_t[0])))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "too deep tree not reported");
+      failure_cntr++;
+   }
+
+   /* data before the deepest branch is processed normally */
+   if((8 != Buff_Copy_From_Tree(dest, too_deep_t[0], Num_Elems(too_deep_t[0]), 8, 0, 0, &str_size)) || (8 != str_size)
+      || (0 != memcmp(dest, src, 8)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "too deep tree partial copy");
+      failure_cntr++;
+   }
+
+   Buff_Readable_Tree_Cursor_Init(&tree_cursor, too_deep_t[0], Num_Elems(too_deep_t[0]), 0);
+
+   if(BUFF_BOOL_IS_TRUE(tree_cursor.is_too_deep)
+      || ((BUFF_TREE_MAX_DEPTH * 4) != Buff_Copy_From_Tree_Cursor(dest, &tree_cursor, sizeof(dest)))
+      || (!BUFF_BOOL_IS_TRUE(tree_cursor.is_too_deep)) || (0 != memcmp(dest, src, BUFF_TREE_MAX_DEPTH * 4)))
+   {
+      printf("line: %5d; %-44s failed\n\r", __LINE__, "too deep tree cursor");
+      failure_cntr++;
+   }
+
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Copy_From_Tree-too deep");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Copy_From_Tree-too deep", failure_cntr);
+   }
+
+
+
+#if(BUFF_USE_CHECKSUM && BUFF_USE_VENDOR_BUFFERS)
+   failure_cntr = 0;
+   for(size = 1; size < sizeof(dest); size++)
+   {
+      for(src_offset = 0; src_offset < (sizeof(dest) - size); src_offset++)
+      {
+         memset(dest, 0, sizeof(dest));
+
+         Buff_Checksum_Init(&checksum_ref, BUFF_CHECKSUM_ONES_COMPLEMENT);
+         Buff_Checksum_Update(&checksum_ref, &src[src_offset], size);
+         Buff_Checksum_Init(&checksum, BUFF_CHECKSUM_ONES_COMPLEMENT);
+
+         result = Buff_Copy_From_Tree_Checksum(dest, s_t, Num_Elems(s_t), size, 0, src_offset, NULL, &checksum);
+
+         if((size != result) || (Buff_Checksum_Get(&checksum_ref) != Buff_Checksum_Get(&checksum)))
+         {
+            printf("wrong size returned! %d, expected: %d\n\r", result, size);
+            failure_cntr++;
+         }
+         is_zero(&dest[size], sizeof(dest) - size);
+         compare_and_print_status(dest, &src[src_offset], size, sizeof(src) - size, "Buff_Copy_From_Tree_Checksum");
+
+         memset(dest, 0, sizeof(dest));
+         Buff_Checksum_Init(&checksum, BUFF_CHECKSUM_ONES_COMPLEMENT);
+
+         result = Buff_Copy_To_Tree_Checksum(d_t, Num_Elems(d_t), &src[src_offset], size, 0, 0, NULL, &checksum);
+
+         if((size != result) || (Buff_Checksum_Get(&checksum_ref) != Buff_Checksum_Get(&checksum)))
+         {
+            printf("wrong size returned! %d, expected: %d\n\r", result, size);
+            failure_cntr++;
+         }
+         is_zero(&dest[size], sizeof(dest) - size);
+         compare_and_print_status(dest, &src[src_offset], size, sizeof(src) - size, "Buff_Copy_To_Tree_Checksum");
+      }
+   }
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Copy_From/To_Tree_Checksum");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Copy_From/To_Tree_Checksum", failure_cntr);
+   }
+#endif
+
+
+
    printf("\n\rtree vendor copy tests:\n\r");
 
 
@@ -32,6 +32,9 @@
 #include "buff.h"
 #include "vector_test.h"
 #include "test_utils.h"
+#if(BUFF_USE_IOVEC)
+#include <sys/uio.h>
+#endif
 
 static size_t vendor_cpy_cntr;
 static size_t vendor_cpy_cntr_limit;
@@ -66,6 +69,22 @@ void vector_test(void)
    Buff_Size_DT src_offset;
    Buff_Size_DT size;
    Buff_Size_DT result;
+   Buff_Readable_Vector_Cursor_XT vector_cursor;
+#if(BUFF_USE_IOVEC)
+   Buff_Readable_Vector_XT p_v[8];
+   struct iovec iov[4];
+   uint8_t dest_ref[200];
+   Buff_Num_Elems_DT iov_size;
+   Buff_Num_Elems_DT iov_num_elems;
+   Buff_Num_Elems_DT cntr;
+   Buff_Bool_DT truncated;
+#endif
+#if(BUFF_USE_CHECKSUM)
+   static const uint32_t checksum_check[4] = { 0xE3069283, 0x29B1, 0x091E01DE, 0xF62A };
+   Buff_Checksum_XT checksum;
+   Buff_Checksum_XT checksum_ref;
+   uint8_t checksum_type;
+#endif
 
    srand(time(&tt));
 
@@ -75,6 +94,84 @@ void vector_test(void)
    }
 
 
+#if(BUFF_USE_OPTIMIZED_MEMCPY)
+   failure_cntr = 0;
+   for(size = 0; size < sizeof(dest); size++)
+   {
+      for(dest_offset = 0; (dest_offset < 32) && ((dest_offset + size) <= sizeof(dest)); dest_offset++)
+      {
+         for(src_offset = 0; (src_offset < 32) && ((src_offset + size) <= sizeof(src)); src_offset++)
+         {
+            memset(dest, 0, sizeof(dest));
+
+            Buff_Memcpy(&dest[dest_offset], &src[src_offset], size);
+
+            is_zero(dest, dest_offset);
+            is_zero(&dest[dest_offset + size], sizeof(dest) - (dest_offset + size));
+            compare_and_print_status(
+               &dest[dest_offset], &src[src_offset], size, sizeof(src) - size, "Buff_Memcpy");
+         }
+      }
+
+      printf("step %d / %d\r", size, sizeof(dest));
+   }
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Memcpy");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Memcpy", failure_cntr);
+   }
+#endif
+
+
+
+#if(BUFF_USE_CHECKSUM)
+   failure_cntr = 0;
+   for(checksum_type = BUFF_CHECKSUM_CRC32C; checksum_type <= BUFF_CHECKSUM_ONES_COMPLEMENT; checksum_type++)
+   {
+      /* standard check value - checksum of string "123456789" */
+      Buff_Checksum_Init(&checksum, checksum_type);
+      Buff_Checksum_Update(&checksum, "123456789", 9);
+
+      if(checksum_check[checksum_type] != Buff_Checksum_Get(&checksum))
+      {
+         printf("wrong checksum %d: 0x%08X, expected: 0x%08X\n\r", checksum_type, Buff_Checksum_Get(&checksum), checksum_check[checksum_type]);
+         failure_cntr++;
+      }
+
+      Buff_Checksum_Init(&checksum_ref, checksum_type);
+      Buff_Checksum_Update(&checksum_ref, src, sizeof(src));
+
+      /* data copied in two parts of any size gives the same checksum as whole data */
+      for(size = 0; size <= sizeof(src); size++)
+      {
+         memset(dest, 0, sizeof(dest));
+
+         Buff_Checksum_Init(&checksum, checksum_type);
+         Buff_Memcpy_Checksum(dest, src, size, &checksum);
+         Buff_Memcpy_Checksum(&dest[size], &src[size], sizeof(src) - size, &checksum);
+
+         if(Buff_Checksum_Get(&checksum_ref) != Buff_Checksum_Get(&checksum))
+         {
+            printf("wrong checksum %d: 0x%08X, expected: 0x%08X\n\r", checksum_type, Buff_Checksum_Get(&checksum), Buff_Checksum_Get(&checksum_ref));
+            failure_cntr++;
+         }
+         compare_and_print_status(dest, src, sizeof(src), 0, "Buff_Memcpy_Checksum");
+      }
+   }
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Memcpy_Checksum");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Memcpy_Checksum", failure_cntr);
+   }
+#endif
+
+
 
    pos = 0;
    ptr = src;
@@ -460,6 +557,171 @@ void vector_test(void)
 
 
 
+   failure_cntr = 0;
+   for(src_offset = 0; src_offset < sizeof(src); src_offset++)
+   {
+      for(size = 1; size < 40; size++)
+      {
+         memset(dest, 0, sizeof(dest));
+
+         Buff_Readable_Vector_Cursor_Init(&vector_cursor, s_v, Num_Elems(s_v), src_offset);
+
+         /* data copied in chunks of "size" bytes, each chunk starts where previous one ended */
+         dest_offset = 0;
+         do
+         {
+            result = Buff_Copy_From_Vector_Cursor(&dest[dest_offset], &vector_cursor, size);
+            dest_offset += result;
+         }while(result == size);
+
+         if(dest_offset != (sizeof(src) - src_offset))
+         {
+            printf("wrong size returned! %d, expected: %d\n\r", dest_offset, sizeof(src) - src_offset);
+            failure_cntr++;
+         }
+         is_zero(&dest[dest_offset], sizeof(dest) - dest_offset);
+         compare_and_print_status(dest, &src[src_offset], dest_offset, sizeof(src) - dest_offset, "Buff_Copy_From_Vector_Cursor");
+      }
+   }
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Copy_From_Vector_Cursor");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Copy_From_Vector_Cursor", failure_cntr);
+   }
+
+
+
+#if(BUFF_USE_IOVEC)
+   failure_cntr = 0;
+   /* contiguous parts of s_v are coalesced into one iovec element */
+   for(src_offset = 0; src_offset < sizeof(src); src_offset++)
+   {
+      Buff_Readable_Vector_Cursor_Init(&vector_cursor, s_v, Num_Elems(s_v), src_offset);
+
+      iov_num_elems = Num_Elems(iov);
+      result = Buff_Vector_To_Iovec(iov, &iov_num_elems, &vector_cursor, sizeof(src), &truncated);
+
+      if((result != (sizeof(src) - src_offset)) || (1 != iov_num_elems) || BUFF_BOOL_IS_TRUE(truncated)
+         || (iov[0].iov_base != &src[src_offset]) || (iov[0].iov_len != result))
+      {
+         printf("wrong iovec! size: %d, expected: %d; num elems: %d\n\r", result, sizeof(src) - src_offset, iov_num_elems);
+         failure_cntr++;
+      }
+   }
+
+   /* not contiguous parts (every second 10 bytes of src, only p_v[3] and p_v[4] are adjacent) - iovec table is filled
+      and description is continued from the cursor as long as data is available */
+   for(cntr = 0; cntr < Num_Elems(p_v); cntr++)
+   {
+      p_v[cntr].data = &src[(cntr < 4) ? (cntr * 20) : (cntr * 20 - 10)];
+      p_v[cntr].size = 10;
+   }
+
+   for(iov_size = 1; iov_size <= Num_Elems(iov); iov_size++)
+   {
+      for(src_offset = 0; src_offset < 80; src_offset++)
+      {
+         for(size = 1; size < 40; size++)
+         {
+            memset(dest, 0, sizeof(dest));
+
+            Buff_Readable_Vector_Cursor_Init(&vector_cursor, p_v, Num_Elems(p_v), src_offset);
+
+            dest_offset = 0;
+            do
+            {
+               iov_num_elems = iov_size;
+               result = Buff_Vector_To_Iovec(iov, &iov_num_elems, &vector_cursor, size, &truncated);
+
+               if((iov_num_elems > iov_size) || (BUFF_BOOL_IS_TRUE(truncated) && ((iov_num_elems != iov_size) || (result >= size))))
+               {
+                  printf("wrong iovec! size: %d, num elems: %d, truncated: %d\n\r", result, iov_num_elems, truncated);
+                  failure_cntr++;
+               }
+
+               for(cntr = 0; cntr < iov_num_elems; cntr++)
+               {
+                  memcpy(&dest[dest_offset], iov[cntr].iov_base, iov[cntr].iov_len);
+                  dest_offset += iov[cntr].iov_len;
+               }
+            }while((result == size) || BUFF_BOOL_IS_TRUE(truncated));
+
+            Buff_Readable_Vector_Cursor_Init(&vector_cursor, p_v, Num_Elems(p_v), src_offset);
+            memset(dest_ref, 0, sizeof(dest_ref));
+            result = Buff_Copy_From_Vector_Cursor(dest_ref, &vector_cursor, sizeof(dest_ref));
+
+            if(dest_offset != (80 - src_offset))
+            {
+               printf("wrong size returned! %d, expected: %d\n\r", dest_offset, 80 - src_offset);
+               failure_cntr++;
+            }
+            compare_and_print_status(dest, dest_ref, sizeof(dest), sizeof(dest_ref), "Buff_Vector_To_Iovec");
+         }
+      }
+   }
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Vector_To_Iovec");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Vector_To_Iovec", failure_cntr);
+   }
+#endif
+
+
+
+#if(BUFF_USE_CHECKSUM)
+   failure_cntr = 0;
+   for(size = 1; size < sizeof(dest); size++)
+   {
+      for(src_offset = 0; src_offset < (sizeof(dest) - size); src_offset++)
+      {
+         memset(dest, 0, sizeof(dest));
+
+         Buff_Checksum_Init(&checksum_ref, BUFF_CHECKSUM_CRC32C);
+         Buff_Checksum_Update(&checksum_ref, &src[src_offset], size);
+         Buff_Checksum_Init(&checksum, BUFF_CHECKSUM_CRC32C);
+
+         result = Buff_Copy_From_Vector_Checksum(dest, s_v, Num_Elems(s_v), size, 0, src_offset, &checksum);
+
+         if((size != result) || (Buff_Checksum_Get(&checksum_ref) != Buff_Checksum_Get(&checksum)))
+         {
+            printf("wrong size returned! %d, expected: %d\n\r", result, size);
+            failure_cntr++;
+         }
+         is_zero(&dest[size], sizeof(dest) - size);
+         compare_and_print_status(dest, &src[src_offset], size, sizeof(src) - size, "Buff_Copy_From_Vector_Checksum");
+
+         memset(dest, 0, sizeof(dest));
+         Buff_Checksum_Init(&checksum, BUFF_CHECKSUM_CRC32C);
+
+         result = Buff_Copy_To_Vector_Checksum(d_v, Num_Elems(d_v), &src[src_offset], size, 0, 0, &checksum);
+
+         if((size != result) || (Buff_Checksum_Get(&checksum_ref) != Buff_Checksum_Get(&checksum)))
+         {
+            printf("wrong size returned! %d, expected: %d\n\r", result, size);
+            failure_cntr++;
+         }
+         is_zero(&dest[size], sizeof(dest) - size);
+         compare_and_print_status(dest, &src[src_offset], size, sizeof(src) - size, "Buff_Copy_To_Vector_Checksum");
+      }
+   }
+   if(0 == failure_cntr)
+   {
+      printf("line: %5d; %-44s succeeded\n\r", __LINE__, "Buff_Copy_From/To_Vector_Checksum");
+   }
+   else
+   {
+      printf("%-36s failed %d times\n\r", "Buff_Copy_From/To_Vector_Checksum", failure_cntr);
+   }
+#endif
+
+
+
    printf("\n\rvector vendor copy tests:\n\r");
 
 